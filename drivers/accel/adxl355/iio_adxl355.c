@@ -42,6 +42,7 @@
 #include "adxl355.h"
 #include "no_os_units.h"
 #include "no_os_alloc.h"
+#include "iio_scan.h"
 
 /******************************************************************************/
 /********************** Macros and Constants Definitions **********************/
@@ -992,8 +993,9 @@ static int adxl355_iio_update_channels(void* dev, uint32_t mask)
 static int32_t adxl355_trigger_handler(struct iio_device_data *dev_data)
 {
 	int32_t data_buff[3];
-	uint32_t x,y,z;
-	uint8_t i = 0;
+	uint32_t raw[3];
+	uint32_t nb_ch;
+	int ret;
 
 	struct adxl355_iio_dev *iio_adxl355;
 	struct adxl355_dev *adxl355;
@@ -1008,20 +1010,14 @@ static int32_t adxl355_trigger_handler(struct iio_device_data *dev_data)
 
 	adxl355 = iio_adxl355->adxl355_dev;
 
-	adxl355_get_raw_xyz(adxl355, &x, &y, &z);
+	adxl355_get_raw_xyz(adxl355, &raw[0], &raw[1], &raw[2]);
 
-	if (dev_data->buffer->active_mask & NO_OS_BIT(0)) {
-		data_buff[0] = no_os_sign_extend32(x, 19);
-		i++;
-	}
-	if (dev_data->buffer->active_mask & NO_OS_BIT(1)) {
-		data_buff[i] = no_os_sign_extend32(y, 19);
-		i++;
-	}
-	if (dev_data->buffer->active_mask & NO_OS_BIT(2)) {
-		data_buff[i] = no_os_sign_extend32(z, 19);
-		i++;
-	}
+	nb_ch = iio_scan_select(data_buff, raw, dev_data->buffer->active_mask,
+				NO_OS_ARRAY_SIZE(raw), sizeof(raw[0]));
+	ret = iio_scan_sign_extend(&adxl355_iio_accel_scan_type, data_buff,
+				   nb_ch);
+	if (ret)
+		return ret;
 
 	return iio_buffer_push_scan(dev_data->buffer, &data_buff[0]);
 }
@@ -38,6 +38,10 @@
 #include "no_os_util.h"
 #include "iio_adc_demo.h"
 #include "iio.h"
+#include "iio_scan.h"
+
+/* Number of scans interleaved at once from the external channel buffers */
+#define ADC_DEMO_BLOCK_SCANS	32
 
 /**
  * @brief utility function for computing next upcoming channel
@@ -140,8 +144,9 @@ int32_t adc_submit_samples(struct iio_device_data *dev_data)
 	uint32_t k = 0;
 	uint32_t ch = -1;
 	uint16_t buff[TOTAL_ADC_CHANNELS];
-	uint32_t i;
-	uint16_t *ch_buf_ptr;
+	uint16_t block[ADC_DEMO_BLOCK_SCANS * TOTAL_ADC_CHANNELS];
+	const void *srcs[TOTAL_ADC_CHANNELS];
+	uint32_t i, j, n, nb_scans;
 
 	if(!dev_data)
 		return -ENODEV;
@@ -159,15 +164,20 @@ int32_t adc_submit_samples(struct iio_device_data *dev_data)
 		return dev_data->buffer->size / dev_data->buffer->bytes_per_scan;
 	}
 
-	for(i = 0; i < dev_data->buffer->size / dev_data->buffer->bytes_per_scan; i++) {
-		while(get_next_ch_idx(desc->active_ch, ch, &ch)) {
-			ch_buf_ptr = (uint16_t*)desc->ext_buff + (ch * desc->ext_buff_len);
-			buff[k++] = ch_buf_ptr[i];
-		}
-		k = 0;
-		iio_buffer_push_scan(dev_data->buffer, buff);
+	while(get_next_ch_idx(desc->active_ch, ch, &ch))
+		srcs[k++] = (uint16_t*)desc->ext_buff + (ch * desc->ext_buff_len);
+
+	/* Interleave the channel buffers a block of scans at a time */
+	nb_scans = dev_data->buffer->size / dev_data->buffer->bytes_per_scan;
+	for(i = 0; i < nb_scans; i += n) {
+		n = no_os_min(nb_scans - i, ADC_DEMO_BLOCK_SCANS);
+		iio_scan_interleave(block, srcs, k, n, sizeof(*block));
+		for(j = 0; j < k; j++)
+			srcs[j] = (const uint16_t *)srcs[j] + n;
+		for(j = 0; j < n; j++)
+			iio_buffer_push_scan(dev_data->buffer, &block[j * k]);
 	}
-	return dev_data->buffer->size / dev_data->buffer->bytes_per_scan;
+	return nb_scans;
 }
 
 
@@ -112,7 +112,9 @@ int no_os_dma_init(struct no_os_dma_desc **desc,
 	(*desc)->platform_ops = param->platform_ops;
 
 	for (i = 0; i < param->num_ch; i++) {
-		ret = no_os_list_init(&(*desc)->channels[i].sg_list, NO_OS_LIST_QUEUE, NULL);
+		ret = no_os_list_init_pool(&(*desc)->channels[i].sg_list,
+					   NO_OS_LIST_QUEUE, NULL,
+					   NO_OS_DMA_SG_POOL_LEN);
 		if (ret)
 			goto list_err;
 
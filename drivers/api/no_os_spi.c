@@ -180,7 +180,7 @@ int32_t no_os_spi_write_and_read(struct no_os_spi_desc *desc,
  * @param desc - The SPI descriptor.
  * @param msgs - Array of messages.
  * @param len - Number of messages in the array.
- * @return 0 in case of success, negativ error code otherwise.
+ * @return 0 in case of success, negative error code otherwise.
  */
 int32_t no_os_spi_transfer(struct no_os_spi_desc *desc,
 			   struct no_os_spi_msg *msgs,
@@ -219,7 +219,7 @@ out:
  * @param desc - The SPI descriptor.
  * @param msgs - Array of messages.
  * @param len - Number of messages in the array.
- * @return 0 in case of success, negativ error code otherwise.
+ * @return 0 in case of success, negative error code otherwise.
  */
 int32_t no_os_spi_transfer_dma_sync(struct no_os_spi_desc *desc,
 				    struct no_os_spi_msg *msgs,
@@ -243,7 +243,7 @@ int32_t no_os_spi_transfer_dma_sync(struct no_os_spi_desc *desc,
  * @param len - Number of messages in the array.
  * @param callback - A function which will be called after all the transfers are done.
  * @param ctx - User specific data which should be passed to the callback function.
- * @return 0 in case of success, negativ error code otherwise.
+ * @return 0 in case of success, negative error code otherwise.
  */
 int32_t no_os_spi_transfer_dma_async(struct no_os_spi_desc *desc,
 				     struct no_os_spi_msg *msgs,
@@ -260,3 +260,111 @@ int32_t no_os_spi_transfer_dma_async(struct no_os_spi_desc *desc,
 
 	return -ENOSYS;
 }
+
+/**
+ * @brief Allocate a batch of messages to be sent on a SPI descriptor.
+ *
+ * Register accesses done one by one cost a full transfer each (a system call
+ * on Linux). Queueing them in a batch and flushing it sends all of them with
+ * a single no_os_spi_transfer() call.
+ * @param batch - The batch.
+ * @param desc - The SPI descriptor the messages are sent on.
+ * @param capacity - Maximum number of queued messages. It must not exceed the
+ *		     platform-defined limit of messages sent in one transfer,
+ *		     no_os_spi_transfer() fails above it.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t no_os_spi_batch_init(struct no_os_spi_batch **batch,
+			     struct no_os_spi_desc *desc, uint32_t capacity)
+{
+	struct no_os_spi_batch *b;
+
+	if (!batch || !desc || !capacity)
+		return -EINVAL;
+
+	b = (struct no_os_spi_batch *)no_os_calloc(1, sizeof(*b));
+	if (!b)
+		return -ENOMEM;
+
+	b->msgs = (struct no_os_spi_msg *)no_os_calloc(capacity,
+			sizeof(*b->msgs));
+	if (!b->msgs) {
+		no_os_free(b);
+		return -ENOMEM;
+	}
+
+	b->desc = desc;
+	b->capacity = capacity;
+	*batch = b;
+
+	return 0;
+}
+
+/**
+ * @brief Queue a message. The message buffers must stay valid until the batch
+ *	  is flushed. If the batch is full, it is flushed first.
+ *
+ * Chip select is not released between queued messages unless cs_change is
+ * set. Callers queueing independent register accesses must set cs_change on
+ * the last message of each access.
+ * @param batch - The batch.
+ * @param msg - The message to queue.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t no_os_spi_batch_add(struct no_os_spi_batch *batch,
+			    const struct no_os_spi_msg *msg)
+{
+	int32_t ret;
+
+	if (!batch || !msg)
+		return -EINVAL;
+
+	if (batch->len == batch->capacity) {
+		ret = no_os_spi_batch_flush(batch);
+		if (ret)
+			return ret;
+	}
+
+	batch->msgs[batch->len++] = *msg;
+
+	return 0;
+}
+
+/**
+ * @brief Send all the queued messages in a single transfer and empty the
+ *	  batch, even if the transfer fails.
+ * @param batch - The batch.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t no_os_spi_batch_flush(struct no_os_spi_batch *batch)
+{
+	int32_t ret;
+
+	if (!batch)
+		return -EINVAL;
+
+	if (!batch->len)
+		return 0;
+
+	ret = no_os_spi_transfer(batch->desc, batch->msgs, batch->len);
+	batch->len = 0;
+
+	return ret;
+}
+
+/**
+ * @brief Free the resources allocated by no_os_spi_batch_init(). Queued
+ *	  messages which were not flushed are dropped.
+ * @param batch - The batch.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t no_os_spi_batch_remove(struct no_os_spi_batch *batch)
+{
+	if (!batch)
+		return -EINVAL;
+
+	no_os_free(batch->msgs);
+	no_os_free(batch);
+
+	return 0;
+}
@@ -38,6 +38,7 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 #include "no_os_axi_io.h"
 #include "no_os_error.h"
 #include "no_os_delay.h"
@@ -514,6 +515,33 @@ int32_t axi_dmac_transfer_start(struct axi_dmac *dmac,
 	return 0;
 }
 
+/*******************************************************************************
+ * @brief One step of a completion polling loop. The first AXI_DMAC_SPIN_COUNT
+ *			steps return immediately so that short transfers are caught
+ *			without sleeping, then the delay doubles on each step up to
+ *			AXI_DMAC_MAX_BACKOFF_US.
+ *
+ * @param iter - Step counter, must be 0 on the first call of a polling loop.
+ *
+ * @return Number of microseconds spent sleeping.
+*******************************************************************************/
+static uint32_t axi_dmac_backoff(uint32_t *iter)
+{
+	uint32_t delay_us;
+
+	if (*iter < AXI_DMAC_SPIN_COUNT) {
+		(*iter)++;
+		return 0;
+	}
+
+	delay_us = NO_OS_BIT(*iter - AXI_DMAC_SPIN_COUNT);
+	if (delay_us < AXI_DMAC_MAX_BACKOFF_US)
+		(*iter)++;
+	no_os_udelay(delay_us);
+
+	return delay_us;
+}
+
 /*******************************************************************************
  * @brief Wait for DMA transfer to be completed.
  *
@@ -525,27 +553,27 @@ int32_t axi_dmac_transfer_start(struct axi_dmac *dmac,
 int32_t axi_dmac_transfer_wait_completion(struct axi_dmac *dmac,
 		uint32_t timeout_ms)
 {
-	uint32_t timeout = 0;
+	uint64_t timeout_us = (uint64_t)timeout_ms * 1000;
+	uint64_t elapsed_us = 0;
+	uint32_t iter = 0;
 	uint32_t reg_val = 0;
 
 	if (dmac->irq_option == IRQ_ENABLED) {
 		while (!dmac->transfer.transfer_done) {
-			timeout++;
-			no_os_mdelay(1);
-			if (timeout == timeout_ms) {
+			if (elapsed_us >= timeout_us) {
 				printf("Error transferring data using DMA.\n");
 				return -1;
 			}
+			elapsed_us += axi_dmac_backoff(&iter);
 		}
 	} else if (dmac->irq_option == IRQ_DISABLED) {
 		axi_dmac_read(dmac, AXI_DMAC_REG_IRQ_PENDING, &reg_val);
 		while (reg_val != (AXI_DMAC_IRQ_SOT | AXI_DMAC_IRQ_EOT)) {
-			timeout++;
-			no_os_mdelay(1);
-			if (timeout == timeout_ms) {
+			if (elapsed_us >= timeout_us) {
 				printf("Error transferring data using DMA.\n");
 				return -1;
 			}
+			elapsed_us += axi_dmac_backoff(&iter);
 			axi_dmac_read(dmac, AXI_DMAC_REG_IRQ_PENDING, &reg_val);
 		}
 		axi_dmac_write(dmac, AXI_DMAC_REG_IRQ_PENDING, reg_val);
@@ -565,3 +593,343 @@ void axi_dmac_transfer_stop(struct axi_dmac *dmac)
 {
 	axi_dmac_write(dmac, AXI_DMAC_REG_CTRL, AXI_DMAC_CTRL_DISABLE);
 }
+
+/*******************************************************************************
+ * @brief Check that the addresses of a transfer are aligned with the data path
+ *			widths used by the DMAC direction.
+ *
+ * @param dmac - DMAC istance.
+ * @param dma_transfer - Structure containing transfer details.
+ *
+ * @return true if the transfer addresses are aligned, false otherwise.
+*******************************************************************************/
+static bool axi_dmac_is_aligned(struct axi_dmac *dmac,
+				struct axi_dma_transfer *dma_transfer)
+{
+	bool dest_ok = !(dma_transfer->dest_addr % (dmac->width_dst / 8));
+	bool src_ok = !(dma_transfer->src_addr % (dmac->width_src / 8));
+
+	switch (dmac->direction) {
+	case DMA_DEV_TO_MEM:
+		return dest_ok;
+	case DMA_MEM_TO_DEV:
+		return src_ok;
+	case DMA_MEM_TO_MEM:
+		return dest_ok && src_ok;
+	default:
+		return false;
+	}
+}
+
+/*******************************************************************************
+ * @brief Hand the next burst of the software queue to the hardware. The caller
+ *			must check that the hardware queue is not full.
+ *
+ * @param dmac - DMAC istance.
+ *
+ * @return None.
+*******************************************************************************/
+static void axi_dmac_queue_hw_submit(struct axi_dmac *dmac)
+{
+	struct axi_dmac_queue *queue = &dmac->queue;
+	struct axi_dma_transfer *xfer = queue->xfers[queue->next];
+	struct axi_dmac_hw_slot *slot;
+	uint32_t remaining_size, burst_size, id;
+
+	remaining_size = xfer->size - queue->next_offset;
+	if (remaining_size > dmac->max_length)
+		burst_size = dmac->max_length;
+	else
+		burst_size = remaining_size - 1;
+
+	if (dmac->direction != DMA_MEM_TO_DEV) {
+		axi_dmac_write(dmac, AXI_DMAC_REG_DEST_ADDRESS,
+			       xfer->dest_addr + queue->next_offset);
+		axi_dmac_write(dmac, AXI_DMAC_REG_DEST_STRIDE, 0x0);
+	}
+	if (dmac->direction != DMA_DEV_TO_MEM) {
+		axi_dmac_write(dmac, AXI_DMAC_REG_SRC_ADDRESS,
+			       xfer->src_addr + queue->next_offset);
+		axi_dmac_write(dmac, AXI_DMAC_REG_SRC_STRIDE, 0x0);
+	}
+	axi_dmac_write(dmac, AXI_DMAC_REG_X_LENGTH, burst_size);
+	axi_dmac_write(dmac, AXI_DMAC_REG_Y_LENGTH, 0x0);
+
+	/* The ID is the one the hardware will assign to this submission. */
+	axi_dmac_read(dmac, AXI_DMAC_REG_TRANSFER_ID, &id);
+	axi_dmac_write(dmac, AXI_DMAC_REG_TRANSFER_SUBMIT, AXI_DMAC_TRANSFER_SUBMIT);
+
+	slot = &queue->hw[(queue->hw_tail + queue->hw_count) %
+				 AXI_DMAC_HW_QUEUE_DEPTH];
+	slot->id = id & AXI_DMAC_TRANSFER_ID_MASK;
+	slot->last = (remaining_size == burst_size + 1);
+	queue->hw_count++;
+
+	if (slot->last) {
+		queue->next = (queue->next + 1) % AXI_DMAC_SW_QUEUE_DEPTH;
+		queue->next_offset = 0;
+	} else {
+		queue->next_offset += burst_size + 1;
+	}
+}
+
+/*******************************************************************************
+ * @brief Keep axi_dmac_queue_isr away from the queue while thread
+ *			context updates it. The end of transfer interrupt is masked
+ *			in the DMAC, so an EOT raised meanwhile stays pending and
+ *			fires on unlock. The busy flag covers an interrupt that was
+ *			already on its way to the CPU when the mask was written.
+ *
+ * @param dmac - DMAC istance.
+ *
+ * @return None.
+*******************************************************************************/
+static void axi_dmac_queue_lock(struct axi_dmac *dmac)
+{
+	uint32_t reg_val;
+
+	if (dmac->irq_option != IRQ_ENABLED)
+		return;
+
+	dmac->queue.busy = true;
+	axi_dmac_write(dmac, AXI_DMAC_REG_IRQ_MASK,
+		       AXI_DMAC_IRQ_SOT | AXI_DMAC_IRQ_EOT);
+	/* Read back so that the mask is applied before the queue is touched. */
+	axi_dmac_read(dmac, AXI_DMAC_REG_IRQ_MASK, &reg_val);
+}
+
+/*******************************************************************************
+ * @brief Undo axi_dmac_queue_lock.
+ *
+ * @param dmac - DMAC istance.
+ *
+ * @return None.
+*******************************************************************************/
+static void axi_dmac_queue_unlock(struct axi_dmac *dmac)
+{
+	if (dmac->irq_option != IRQ_ENABLED)
+		return;
+
+	dmac->queue.busy = false;
+	axi_dmac_write(dmac, AXI_DMAC_REG_IRQ_MASK, AXI_DMAC_IRQ_SOT);
+}
+
+/*******************************************************************************
+ * @brief Complete the queued transfers the hardware reports as done and refill
+ *			the hardware queue. The caller must hold the queue, either
+ *			by running from axi_dmac_queue_isr or through
+ *			axi_dmac_queue_lock.
+ *
+ * @param dmac - DMAC istance.
+ *
+ * @return None.
+*******************************************************************************/
+static void axi_dmac_queue_advance(struct axi_dmac *dmac)
+{
+	struct axi_dmac_queue *queue = &dmac->queue;
+	struct axi_dma_transfer *xfer;
+	struct axi_dmac_hw_slot *slot;
+	uint32_t reg_val;
+
+	/* Retire the bursts the hardware is done with, oldest first. */
+	if (queue->hw_count) {
+		axi_dmac_read(dmac, AXI_DMAC_REG_TRANSFER_DONE, &reg_val);
+		while (queue->hw_count) {
+			slot = &queue->hw[queue->hw_tail];
+			if (!(reg_val & NO_OS_BIT(slot->id)))
+				break;
+
+			queue->hw_tail = (queue->hw_tail + 1) %
+					 AXI_DMAC_HW_QUEUE_DEPTH;
+			queue->hw_count--;
+			if (!slot->last)
+				continue;
+
+			xfer = queue->xfers[queue->tail];
+			queue->tail = (queue->tail + 1) % AXI_DMAC_SW_QUEUE_DEPTH;
+			xfer->transfer_done = true;
+			if (queue->complete)
+				queue->complete(queue->ctx, xfer);
+		}
+	}
+
+	/* Keep the hardware queue full. */
+	while (queue->next != queue->head &&
+	       queue->hw_count < AXI_DMAC_HW_QUEUE_DEPTH) {
+		axi_dmac_read(dmac, AXI_DMAC_REG_TRANSFER_SUBMIT, &reg_val);
+		if (reg_val & AXI_DMAC_QUEUE_FULL)
+			break;
+		axi_dmac_queue_hw_submit(dmac);
+	}
+}
+
+/*******************************************************************************
+ * @brief Prepare the DMAC for queued transfers. Unlike axi_dmac_transfer_start,
+ *			several transfers can be submitted back to back and the hardware
+ *			queue is kept full, so there is no gap between them.
+ *
+ * @note Any transfer in progress is aborted. With IRQ_ENABLED,
+ *			axi_dmac_queue_isr must be registered as the DMAC interrupt
+ *			handler; only the end of transfer interrupt is unmasked.
+ *
+ * @param dmac - DMAC istance.
+ * @param complete - Optional callback called for each completed transfer.
+ * @param ctx - Value passed to the complete callback.
+ *
+ * @return 0 for success, negative error code otherwise.
+*******************************************************************************/
+int32_t axi_dmac_queue_start(struct axi_dmac *dmac,
+			     axi_dmac_complete_cb complete, void *ctx)
+{
+	uint32_t reg_val;
+
+	if (!dmac)
+		return -EINVAL;
+
+	memset(&dmac->queue, 0, sizeof(dmac->queue));
+	dmac->queue.complete = complete;
+	dmac->queue.ctx = ctx;
+
+	axi_dmac_write(dmac, AXI_DMAC_REG_CTRL, AXI_DMAC_CTRL_DISABLE);
+
+	axi_dmac_read(dmac, AXI_DMAC_REG_FLAGS, &reg_val);
+	axi_dmac_write(dmac, AXI_DMAC_REG_FLAGS, reg_val & ~DMA_CYCLIC);
+
+	if (dmac->irq_option == IRQ_ENABLED)
+		axi_dmac_write(dmac, AXI_DMAC_REG_IRQ_MASK, AXI_DMAC_IRQ_SOT);
+	else
+		axi_dmac_write(dmac, AXI_DMAC_REG_IRQ_MASK,
+			       AXI_DMAC_IRQ_SOT | AXI_DMAC_IRQ_EOT);
+
+	axi_dmac_read(dmac, AXI_DMAC_REG_IRQ_PENDING, &reg_val);
+	axi_dmac_write(dmac, AXI_DMAC_REG_IRQ_PENDING, reg_val);
+
+	axi_dmac_write(dmac, AXI_DMAC_REG_CTRL, AXI_DMAC_CTRL_ENABLE);
+
+	return 0;
+}
+
+/*******************************************************************************
+ * @brief Queue a transfer. It is handed to the hardware as soon as there is
+ *			room in the hardware queue; transfers bigger than the maximum
+ *			burst size are split. dma_transfer->transfer_done is set once the
+ *			whole transfer is done.
+ *
+ * @note dma_transfer must stay valid until it is completed. With IRQ_ENABLED,
+ *			the end of transfer interrupt is masked while the queue
+ *			is updated, so this can be called while transfers are in
+ *			flight.
+ *
+ * @param dmac - DMAC istance.
+ * @param dma_transfer - Structure containing transfer details.
+ *
+ * @return 0 for success, -EBUSY if the software queue is full, -EINVAL for
+ *			cyclic, empty or misaligned transfers.
+*******************************************************************************/
+int32_t axi_dmac_queue_submit(struct axi_dmac *dmac,
+			      struct axi_dma_transfer *dma_transfer)
+{
+	struct axi_dmac_queue *queue;
+
+	if (!dmac || !dma_transfer || !dma_transfer->size ||
+	    dma_transfer->cyclic == CYCLIC)
+		return -EINVAL;
+
+	if (!axi_dmac_is_aligned(dmac, dma_transfer))
+		return -EINVAL;
+
+	queue = &dmac->queue;
+	/* One entry is kept free to tell a full queue from an empty one. */
+	if ((queue->head + 1) % AXI_DMAC_SW_QUEUE_DEPTH == queue->tail)
+		return -EBUSY;
+
+	dma_transfer->transfer_done = false;
+	axi_dmac_queue_lock(dmac);
+	queue->xfers[queue->head] = dma_transfer;
+	queue->head = (queue->head + 1) % AXI_DMAC_SW_QUEUE_DEPTH;
+	axi_dmac_queue_advance(dmac);
+	axi_dmac_queue_unlock(dmac);
+
+	return 0;
+}
+
+/*******************************************************************************
+ * @brief Complete the queued transfers the hardware reports as done and refill
+ *			the hardware queue. With IRQ_DISABLED it must be called
+ *			periodically or through axi_dmac_queue_wait; with
+ *			IRQ_ENABLED axi_dmac_queue_isr does it.
+ *
+ * @param dmac - DMAC istance.
+ *
+ * @return 0 for success, negative error code otherwise.
+*******************************************************************************/
+int32_t axi_dmac_queue_process(struct axi_dmac *dmac)
+{
+	if (!dmac)
+		return -EINVAL;
+
+	axi_dmac_queue_lock(dmac);
+	axi_dmac_queue_advance(dmac);
+	axi_dmac_queue_unlock(dmac);
+
+	return 0;
+}
+
+/*******************************************************************************
+ * @brief ISR for queued transfers. It completes finished transfers and submits
+ *			the pending ones.
+ *
+ * @param instance - the instance that triggered the ISR.
+ *
+ * @return None.
+*******************************************************************************/
+void axi_dmac_queue_isr(void *instance)
+{
+	struct axi_dmac *dmac = (struct axi_dmac *)instance;
+	uint32_t reg_val;
+
+	/*
+	 * Thread context owns the queue. Leave the interrupt pending, it is
+	 * raised again once the EOT interrupt is unmasked.
+	 */
+	if (dmac->queue.busy)
+		return;
+
+	/* Get interrupt sources and clear interrupts. */
+	axi_dmac_read(dmac, AXI_DMAC_REG_IRQ_PENDING, &reg_val);
+	axi_dmac_write(dmac, AXI_DMAC_REG_IRQ_PENDING, reg_val);
+
+	axi_dmac_queue_advance(dmac);
+}
+
+/*******************************************************************************
+ * @brief Wait for a queued transfer to be completed. Spins first and then
+ *			backs off, so short transfers complete without sleeping.
+ *
+ * @param dmac - DMAC istance.
+ * @param dma_transfer - Transfer passed to axi_dmac_queue_submit.
+ * @param timeout_ms - Number of ms to wait for completion of transfer.
+ *
+ * @return 0 for success, -ETIMEDOUT if the transfer is not completed in time.
+*******************************************************************************/
+int32_t axi_dmac_queue_wait(struct axi_dmac *dmac,
+			    struct axi_dma_transfer *dma_transfer,
+			    uint32_t timeout_ms)
+{
+	uint64_t timeout_us = (uint64_t)timeout_ms * 1000;
+	uint64_t elapsed_us = 0;
+	uint32_t iter = 0;
+
+	if (!dmac || !dma_transfer)
+		return -EINVAL;
+
+	while (true) {
+		if (dmac->irq_option == IRQ_DISABLED)
+			axi_dmac_queue_process(dmac);
+		if (dma_transfer->transfer_done)
+			return 0;
+		if (elapsed_us >= timeout_us)
+			return -ETIMEDOUT;
+		elapsed_us += axi_dmac_backoff(&iter);
+	}
+}
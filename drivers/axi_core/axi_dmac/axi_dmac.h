@@ -72,6 +72,20 @@
 #define AXI_DMAC_REG_SRC_STRIDE			0x424
 #define AXI_DMAC_REG_TRANSFER_DONE		0x428
 
+/* Transfer IDs are 2 bits wide, so the hardware queue holds 4 transfers. */
+#define AXI_DMAC_HW_QUEUE_DEPTH			4
+#define AXI_DMAC_TRANSFER_ID_MASK		NO_OS_GENMASK(1,0)
+
+/* Number of transfers that can be pending in the software queue. */
+#ifndef AXI_DMAC_SW_QUEUE_DEPTH
+#define AXI_DMAC_SW_QUEUE_DEPTH			8
+#endif
+
+/* Completion polling: spin this many times before starting to sleep. */
+#define AXI_DMAC_SPIN_COUNT				64
+/* Upper bound of the exponential polling backoff, in microseconds. */
+#define AXI_DMAC_MAX_BACKOFF_US			1024
+
 /******************************************************************************/
 /*************************** Types Declarations *******************************/
 /******************************************************************************/
@@ -107,6 +121,39 @@ struct axi_dma_transfer {
 	uint32_t dest_addr;
 };
 
+/* Called from axi_dmac_queue_process() for each completed queued transfer. */
+typedef void (*axi_dmac_complete_cb)(void *ctx,
+				     struct axi_dma_transfer *dma_transfer);
+
+/* Burst handed to the hardware on behalf of a queued transfer. */
+struct axi_dmac_hw_slot {
+	/* Transfer ID read from AXI_DMAC_REG_TRANSFER_ID on submission */
+	uint32_t id;
+	/* Set on the last burst of a transfer */
+	bool last;
+};
+
+struct axi_dmac_queue {
+	/* Queued transfers, completed in order */
+	struct axi_dma_transfer *xfers[AXI_DMAC_SW_QUEUE_DEPTH];
+	/* Index where the next transfer is queued */
+	uint32_t head;
+	/* Index of the oldest transfer not completed */
+	uint32_t tail;
+	/* Index of the first transfer not fully handed to the hardware */
+	uint32_t next;
+	/* Bytes of xfers[next] already handed to the hardware */
+	uint32_t next_offset;
+	/* Bursts owned by the hardware, oldest first */
+	struct axi_dmac_hw_slot hw[AXI_DMAC_HW_QUEUE_DEPTH];
+	uint32_t hw_tail;
+	uint32_t hw_count;
+	axi_dmac_complete_cb complete;
+	void *ctx;
+	/* Set while thread context updates the queue with the EOT IRQ masked */
+	volatile bool busy;
+};
+
 struct axi_dmac {
 	const char *name;
 	uint32_t base;
@@ -122,6 +169,8 @@ struct axi_dmac {
 	uint32_t remaining_size;
 	uint32_t next_src_addr;
 	uint32_t next_dest_addr;
+	//Queued transfers
+	struct axi_dmac_queue queue;
 };
 
 struct axi_dmac_init {
@@ -150,5 +199,14 @@ int32_t axi_dmac_transfer_start(struct axi_dmac *dmac,
 int32_t axi_dmac_transfer_wait_completion(struct axi_dmac *dmac,
 		uint32_t timeout_ms);
 void axi_dmac_transfer_stop(struct axi_dmac *dmac);
+int32_t axi_dmac_queue_start(struct axi_dmac *dmac,
+			     axi_dmac_complete_cb complete, void *ctx);
+int32_t axi_dmac_queue_submit(struct axi_dmac *dmac,
+			      struct axi_dma_transfer *dma_transfer);
+int32_t axi_dmac_queue_process(struct axi_dmac *dmac);
+void axi_dmac_queue_isr(void *instance);
+int32_t axi_dmac_queue_wait(struct axi_dmac *dmac,
+			    struct axi_dma_transfer *dma_transfer,
+			    uint32_t timeout_ms);
 
 #endif
@@ -84,10 +84,10 @@
 #define ADXCVR_DRP_PORT_ADDR_COMMON		0x00
 #define ADXCVR_DRP_PORT_ADDR_CHANNEL	0x20
 
-#define ADXCVR_DRP_PORT_COMMON(x)		(x)
-#define ADXCVR_DRP_PORT_CHANNEL(x)		(0x100 + (x))
-
-#define ADXCVR_BROADCAST				0xff
+/* Can be overridden from the project build flags */
+#ifndef ADXCVR_DRP_IDLE_POLLS
+#define ADXCVR_DRP_IDLE_POLLS		32
+#endif
 
 #define ADI_AXI_PCORE_VER(major, minor, patch)	\
 	(((major) << 16) | ((minor) << 8) | (patch))
@@ -137,13 +137,17 @@ int32_t adxcvr_read(struct adxcvr *xcvr,
 int32_t adxcvr_drp_wait_idle(struct adxcvr *xcvr,
 			     uint32_t drp_addr)
 {
-	uint32_t val;
+	uint32_t val, polls;
 	int32_t timeout = 20;
 
 	do {
-		adxcvr_read(xcvr, ADXCVR_REG_DRP_STATUS(drp_addr), &val);
-		if (!(val & ADXCVR_DRP_STATUS_BUSY))
-			return ADXCVR_DRP_STATUS_RDATA(val);
+		/* An access takes a few DRP clocks, poll before sleeping */
+		for (polls = 0; polls < ADXCVR_DRP_IDLE_POLLS; polls++) {
+			adxcvr_read(xcvr, ADXCVR_REG_DRP_STATUS(drp_addr),
+				    &val);
+			if (!(val & ADXCVR_DRP_STATUS_BUSY))
+				return ADXCVR_DRP_STATUS_RDATA(val);
+		}
 
 		no_os_mdelay(1);
 	} while (timeout--);
@@ -330,6 +334,10 @@ int adxcvr_clk_set_rate(struct adxcvr *xcvr,
 	if (ret < 0)
 		return ret;
 
+	ret = xilinx_xcvr_drp_batch_start(&xcvr->xlx_xcvr, xcvr->num_lanes);
+	if (ret)
+		return ret;
+
 	for (i = 0; i < xcvr->num_lanes; i++) {
 
 		if (xcvr->cpll_enable)
@@ -340,14 +348,14 @@ int adxcvr_clk_set_rate(struct adxcvr *xcvr,
 							    xcvr->sys_clk_sel,
 							    ADXCVR_DRP_PORT_COMMON(i), &qpll_conf);
 		if (ret < 0)
-			return ret;
+			goto err;
 
 		ret = xilinx_xcvr_write_out_div(&xcvr->xlx_xcvr,
 						ADXCVR_DRP_PORT_CHANNEL(i),
 						xcvr->tx_enable ? -1 : (int32_t)out_div,
 						xcvr->tx_enable ? (int32_t)out_div : -1);
 		if (ret < 0)
-			return ret;
+			goto err;
 
 		if (xcvr->out_clk_sel == ADXCVR_PROGDIV_CLK) {
 			unsigned int max_progdiv, div = 1, ratio;
@@ -382,7 +390,8 @@ int adxcvr_clk_set_rate(struct adxcvr *xcvr,
 				max_progdiv = 100;
 				break;
 			default:
-				return -EINVAL;
+				ret = -EINVAL;
+				goto err;
 			}
 
 			prog_div = NO_OS_DIV_ROUND_CLOSEST(ratio * out_div, 2 * div);
@@ -398,7 +407,7 @@ int adxcvr_clk_set_rate(struct adxcvr *xcvr,
 							 xcvr->tx_enable ? -1 : (int32_t)prog_div,
 							 xcvr->tx_enable ? (int32_t)prog_div : -1);
 			if (ret < 0)
-				return ret;
+				goto err;
 		}
 
 		if (!xcvr->tx_enable) {
@@ -406,7 +415,7 @@ int adxcvr_clk_set_rate(struct adxcvr *xcvr,
 							ADXCVR_DRP_PORT_CHANNEL(i), rate, out_div,
 							xcvr->lpm_enable);
 			if (ret < 0)
-				return ret;
+				goto err;
 
 			ret = xilinx_xcvr_write_rx_clk25_div(&xcvr->xlx_xcvr,
 							     ADXCVR_DRP_PORT_CHANNEL(i), clk25_div);
@@ -416,13 +425,21 @@ int adxcvr_clk_set_rate(struct adxcvr *xcvr,
 		}
 
 		if (ret < 0)
-			return ret;
+			goto err;
 	}
 
+	ret = xilinx_xcvr_drp_batch_end(&xcvr->xlx_xcvr, true);
+	if (ret < 0)
+		return ret;
 
 	xcvr->lane_rate_khz = rate;
 
 	return 0;
+
+err:
+	xilinx_xcvr_drp_batch_end(&xcvr->xlx_xcvr, false);
+
+	return ret;
 }
 
 /**
@@ -647,11 +664,20 @@ int32_t adxcvr_init(struct adxcvr **ad_xcvr,
 	xcvr->xlx_xcvr.ad_xcvr = xcvr;
 
 	if (!xcvr->tx_enable) {
+		ret = xilinx_xcvr_drp_batch_start(&xcvr->xlx_xcvr,
+						  xcvr->num_lanes);
+		if (ret)
+			goto err;
+
 		for (i = 0; i < xcvr->num_lanes; i++) {
 			xilinx_xcvr_configure_lpm_dfe_mode(&xcvr->xlx_xcvr,
 							   ADXCVR_DRP_PORT_CHANNEL(i),
 							   xcvr->lpm_enable);
 		}
+
+		ret = xilinx_xcvr_drp_batch_end(&xcvr->xlx_xcvr, true);
+		if (ret)
+			goto err;
 	}
 
 	if (xcvr->lane_rate_khz && xcvr->ref_rate_khz) {
@@ -56,6 +56,12 @@
 #define ADXCVR_REFCLK_DIV2	4
 #define ADXCVR_PROGDIV_CLK	5 /* GTHE3, GTHE4, GTYE4 only */
 
+#define ADXCVR_DRP_PORT_COMMON(x)		(x)
+#define ADXCVR_DRP_PORT_CHANNEL(x)		(0x100 + (x))
+
+/* DRP select addressing all channels of the link at once */
+#define ADXCVR_BROADCAST				0xff
+
 /**
  * @struct adxcvr
  * @brief ADI JESD204B/C AXI_ADXCVR Highspeed Transceiver Device structure.
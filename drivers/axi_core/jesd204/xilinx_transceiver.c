@@ -40,6 +40,7 @@
 #include <inttypes.h>
 #include "no_os_util.h"
 #include "no_os_error.h"
+#include "no_os_alloc.h"
 #include "axi_adxcvr.h"
 #include "xilinx_transceiver.h"
 #include "no_os_print_log.h"
@@ -152,8 +153,9 @@ static int xilinx_xcvr_drp_read(struct xilinx_xcvr *xcvr,
  * @return ret - Result of the writing operation (0 - success, negative
  *               value for failure).
  *******************************************************************************/
-static int xilinx_xcvr_drp_write(struct xilinx_xcvr *xcvr,
-				 uint32_t drp_port, uint32_t reg, uint32_t val)
+static int xilinx_xcvr_drp_write_now(struct xilinx_xcvr *xcvr,
+				     uint32_t drp_port, uint32_t reg,
+				     uint32_t val)
 {
 	uint32_t read_val;
 	int ret;
@@ -195,19 +197,301 @@ static int xilinx_xcvr_drp_write(struct xilinx_xcvr *xcvr,
  * @return ret - Result of the writing operation (0 - success, negative
  *               value for failure).
  *******************************************************************************/
-int xilinx_xcvr_drp_update(struct xilinx_xcvr *xcvr, uint32_t drp_port,
-			   uint32_t reg, uint32_t mask, uint32_t val)
+static int xilinx_xcvr_drp_update_now(struct xilinx_xcvr *xcvr,
+				      uint32_t drp_port, uint32_t reg,
+				      uint32_t mask, uint32_t val)
 {
 	uint32_t read_val;
 	int ret;
 
+	if ((mask & 0xffff) == 0xffff)
+		return xilinx_xcvr_drp_write_now(xcvr, drp_port, reg, val);
+
 	ret = xilinx_xcvr_drp_read(xcvr, drp_port, reg, &read_val);
 	if (ret < 0)
 		return ret;
 
 	val |= read_val & ~mask;
 
-	return xilinx_xcvr_drp_write(xcvr, drp_port, reg, val);
+	return xilinx_xcvr_drp_write_now(xcvr, drp_port, reg, val);
+}
+
+/*******************************************************************************
+ * @brief Issue a queued DRP write, together with the matching writes of the
+ *        other lanes, as a single broadcast access.
+ *
+ * Only done when every lane of the batch gets the same value and, for partial
+ * updates, the bits outside the mask read back equal on every lane. Each lane
+ * is read back afterwards and written on its own if the broadcast did not
+ * reach it, in which case the broadcast port is not used again.
+ *
+ * @param xcvr - The device structure.
+ * @param op - First queued write of the group.
+ *
+ * @return ret - 0 if issued, 1 if the writes have to be issued per lane,
+ *               negative value for failure.
+ *******************************************************************************/
+static int xilinx_xcvr_drp_flush_lanes(struct xilinx_xcvr *xcvr,
+				       struct xilinx_xcvr_drp_op *op)
+{
+	struct xilinx_xcvr_drp_batch *batch = &xcvr->drp_batch;
+	struct xilinx_xcvr_drp_op *it;
+	uint32_t lane, port, val, read_val, keep = 0;
+	uint64_t lanes = 0;
+	int ret;
+
+	if (batch->no_broadcast || batch->num_lanes < 2 ||
+	    batch->num_lanes > 64)
+		return 1;
+
+	for (it = op; it < batch->ops + batch->num_ops; it++) {
+		if (it->done || it->reg != op->reg || it->mask != op->mask ||
+		    it->val != op->val ||
+		    it->drp_port < ADXCVR_DRP_PORT_CHANNEL(0))
+			continue;
+
+		lane = it->drp_port - ADXCVR_DRP_PORT_CHANNEL(0);
+		if (lane < batch->num_lanes)
+			lanes |= 1ULL << lane;
+	}
+
+	if (lanes != (~0ULL >> (64 - batch->num_lanes)))
+		return 1;
+
+	val = op->val;
+	if (op->mask != 0xffff) {
+		for (lane = 0; lane < batch->num_lanes; lane++) {
+			port = ADXCVR_DRP_PORT_CHANNEL(lane);
+			ret = xilinx_xcvr_drp_read(xcvr, port, op->reg,
+						   &read_val);
+			if (ret < 0)
+				return ret;
+
+			read_val &= ~op->mask & 0xffff;
+			if (lane && read_val != keep)
+				return 1;
+			keep = read_val;
+		}
+		val |= keep;
+	}
+
+	ret = adxcvr_drp_write(xcvr->ad_xcvr,
+			       ADXCVR_DRP_PORT_CHANNEL(ADXCVR_BROADCAST),
+			       op->reg, val);
+	if (ret)
+		return 1;
+
+	for (lane = 0; lane < batch->num_lanes; lane++) {
+		ret = xilinx_xcvr_drp_read(xcvr, ADXCVR_DRP_PORT_CHANNEL(lane),
+					   op->reg, &read_val);
+		if (ret < 0)
+			return ret;
+
+		if (read_val == val)
+			continue;
+
+		pr_debug("%s: broadcast missed lane %" PRIu32 ", reg %#06x\n",
+			 __func__, lane, op->reg);
+		batch->no_broadcast = true;
+		ret = xilinx_xcvr_drp_update_now(xcvr,
+						 ADXCVR_DRP_PORT_CHANNEL(lane),
+						 op->reg, op->mask, op->val);
+		if (ret < 0)
+			return ret;
+	}
+
+	for (it = op; it < batch->ops + batch->num_ops; it++)
+		if (it->reg == op->reg && it->mask == op->mask &&
+		    it->val == op->val &&
+		    it->drp_port >= ADXCVR_DRP_PORT_CHANNEL(0) &&
+		    it->drp_port < ADXCVR_DRP_PORT_CHANNEL(batch->num_lanes))
+			it->done = true;
+
+	return 0;
+}
+
+/*******************************************************************************
+ * @brief Issue the queued DRP writes, in the order they were first queued.
+ *
+ * @param xcvr - The device structure.
+ *
+ * @return ret - Result of the writing operation (0 - success, negative
+ *               value for failure).
+ *******************************************************************************/
+static int xilinx_xcvr_drp_flush(struct xilinx_xcvr *xcvr)
+{
+	struct xilinx_xcvr_drp_batch *batch = &xcvr->drp_batch;
+	struct xilinx_xcvr_drp_op *op;
+	uint32_t i;
+	int ret;
+
+	for (i = 0; i < batch->num_ops; i++) {
+		op = &batch->ops[i];
+		if (op->done)
+			continue;
+
+		ret = 1;
+		if (op->drp_port >= ADXCVR_DRP_PORT_CHANNEL(0))
+			ret = xilinx_xcvr_drp_flush_lanes(xcvr, op);
+		if (ret > 0)
+			ret = xilinx_xcvr_drp_update_now(xcvr, op->drp_port,
+							 op->reg, op->mask,
+							 op->val);
+		if (ret < 0)
+			return ret;
+
+		op->done = true;
+	}
+
+	batch->num_ops = 0;
+
+	return 0;
+}
+
+/*******************************************************************************
+ * @brief Queue a DRP write, merging it with a queued write of the same
+ *        register.
+ *
+ * @param xcvr - The device structure.
+ * @param drp_port - DRP where data is updated.
+ * @param reg - DRP address.
+ * @param mask - The mask to be applied.
+ * @param val - Value to be written.
+ *
+ * @return ret - Result of the operation (0 - success, negative value for
+ *               failure).
+ *******************************************************************************/
+static int xilinx_xcvr_drp_queue(struct xilinx_xcvr *xcvr, uint32_t drp_port,
+				 uint32_t reg, uint32_t mask, uint32_t val)
+{
+	struct xilinx_xcvr_drp_batch *batch = &xcvr->drp_batch;
+	struct xilinx_xcvr_drp_op *op;
+	uint32_t i;
+	int ret;
+
+	for (i = 0; i < batch->num_ops; i++) {
+		op = &batch->ops[i];
+		if (op->drp_port == drp_port && op->reg == reg) {
+			op->val = (op->val & ~mask) | val;
+			op->mask |= mask;
+			return 0;
+		}
+	}
+
+	if (batch->num_ops == XILINX_XCVR_DRP_BATCH_SIZE) {
+		ret = xilinx_xcvr_drp_flush(xcvr);
+		if (ret < 0)
+			return ret;
+	}
+
+	op = &batch->ops[batch->num_ops++];
+	op->drp_port = drp_port;
+	op->reg = reg;
+	op->mask = mask;
+	op->val = val;
+	op->done = false;
+
+	return 0;
+}
+
+/*******************************************************************************
+ * @brief Start queuing DRP writes and updates. The queued accesses are
+ *        merged per register and issued by xilinx_xcvr_drp_batch_end(),
+ *        using the broadcast port for the ones identical on every lane.
+ *        Reads are not queued and return the current hardware value.
+ *
+ * @param xcvr - The device structure.
+ * @param num_lanes - Number of channel ports that may share a broadcast.
+ *
+ * @return ret - Result of the operation (0 - success, negative value for
+ *               failure).
+ *******************************************************************************/
+int xilinx_xcvr_drp_batch_start(struct xilinx_xcvr *xcvr, uint32_t num_lanes)
+{
+	struct xilinx_xcvr_drp_batch *batch = &xcvr->drp_batch;
+
+	if (batch->ops)
+		return -EBUSY;
+
+	batch->ops = no_os_calloc(XILINX_XCVR_DRP_BATCH_SIZE,
+				  sizeof(*batch->ops));
+	if (!batch->ops)
+		return -ENOMEM;
+
+	batch->num_ops = 0;
+	batch->num_lanes = num_lanes;
+
+	return 0;
+}
+
+/*******************************************************************************
+ * @brief Stop queuing DRP accesses.
+ *
+ * @param xcvr - The device structure.
+ * @param commit - Issue the queued writes if true, drop them otherwise.
+ *
+ * @return ret - Result of the writing operation (0 - success, negative
+ *               value for failure).
+ *******************************************************************************/
+int xilinx_xcvr_drp_batch_end(struct xilinx_xcvr *xcvr, bool commit)
+{
+	struct xilinx_xcvr_drp_batch *batch = &xcvr->drp_batch;
+	int ret = 0;
+
+	if (!batch->ops)
+		return -EINVAL;
+
+	if (commit)
+		ret = xilinx_xcvr_drp_flush(xcvr);
+
+	no_os_free(batch->ops);
+	batch->ops = NULL;
+	batch->num_ops = 0;
+
+	return ret;
+}
+
+/*******************************************************************************
+ * @brief Write data to a dynamic reconfiguration port (DRP), or queue it
+ *        while a batch is open.
+ *
+ * @param xcvr - The device structure.
+ * @param drp_port - DRP to write data to.
+ * @param reg - DRP address.
+ * @param val - Value to be written.
+ *
+ * @return ret - Result of the writing operation (0 - success, negative
+ *               value for failure).
+ *******************************************************************************/
+static int xilinx_xcvr_drp_write(struct xilinx_xcvr *xcvr,
+				 uint32_t drp_port, uint32_t reg, uint32_t val)
+{
+	if (xcvr->drp_batch.ops)
+		return xilinx_xcvr_drp_queue(xcvr, drp_port, reg, 0xffff, val);
+
+	return xilinx_xcvr_drp_write_now(xcvr, drp_port, reg, val);
+}
+
+/*******************************************************************************
+ * @brief Update data of a dynamic reconfiguration port (DRP), or queue the
+ *        update while a batch is open.
+ *
+ * @param xcvr - The device structure.
+ * @param drp_port - DRP where data is updated.
+ * @param reg - DRP address.
+ * @param mask - The mask to be applied.
+ * @param val - Value to be written.
+ *
+ * @return ret - Result of the writing operation (0 - success, negative
+ *               value for failure).
+ *******************************************************************************/
+int xilinx_xcvr_drp_update(struct xilinx_xcvr *xcvr, uint32_t drp_port,
+			   uint32_t reg, uint32_t mask, uint32_t val)
+{
+	if (xcvr->drp_batch.ops)
+		return xilinx_xcvr_drp_queue(xcvr, drp_port, reg, mask, val);
+
+	return xilinx_xcvr_drp_update_now(xcvr, drp_port, reg, mask, val);
 }
 
 
@@ -62,6 +62,11 @@
 #define AXI_INFO_FPGA_DEV_PACKAGE(info)	((info) & 0xff)
 #define AXI_INFO_FPGA_VOLTAGE(val)      ((val) & 0xffff)
 
+/* Can be overridden from the project build flags */
+#ifndef XILINX_XCVR_DRP_BATCH_SIZE
+#define XILINX_XCVR_DRP_BATCH_SIZE	256
+#endif
+
 /**
  * @enum xilinx_xcvr_type
  * @brief Enum for GT type.
@@ -159,6 +164,32 @@ enum axi_fpga_dev_pack {
 	AXI_FPGA_DEV_FA,
 };
 
+/**
+ * @struct xilinx_xcvr_drp_op
+ * @brief Queued DRP write, a full write has all mask bits set.
+ */
+struct xilinx_xcvr_drp_op {
+	uint32_t drp_port;
+	uint16_t reg;
+	uint16_t mask;
+	uint16_t val;
+	bool done;
+};
+
+/**
+ * @struct xilinx_xcvr_drp_batch
+ * @brief DRP writes queued between xilinx_xcvr_drp_batch_start() and
+ *        xilinx_xcvr_drp_batch_end().
+ */
+struct xilinx_xcvr_drp_batch {
+	struct xilinx_xcvr_drp_op *ops;
+	uint32_t num_ops;
+	/* Channel ports 0 .. num_lanes - 1 may share a broadcast write */
+	uint32_t num_lanes;
+	/* Set once a broadcast write missed a lane, kept across batches */
+	bool no_broadcast;
+};
+
 /**
  * @struct xilinx_xcvr
  * @brief xilinx_xcvr parameters structure.
@@ -180,6 +211,8 @@ struct xilinx_xcvr {
 	uint32_t vco0_max; // kHz
 	uint32_t vco1_min; // kHz
 	uint32_t vco1_max; // kHz
+
+	struct xilinx_xcvr_drp_batch drp_batch;
 };
 
 struct xilinx_xcvr_drp_ops {
@@ -271,6 +304,11 @@ struct xilinx_xcvr_qpll_config {
 /************************ Functions Declarations ******************************/
 /******************************************************************************/
 
+/** Queue DRP writes and updates instead of issuing them. */
+int xilinx_xcvr_drp_batch_start(struct xilinx_xcvr *xcvr, uint32_t num_lanes);
+/** Issue (or drop) the queued DRP writes and stop queuing. */
+int xilinx_xcvr_drp_batch_end(struct xilinx_xcvr *xcvr, bool commit);
+
 /** Configure the Clock Data Recovery circuit. */
 int xilinx_xcvr_configure_cdr(struct xilinx_xcvr *xcvr,
 			      uint32_t drp_port, uint32_t lane_rate, uint32_t out_div,
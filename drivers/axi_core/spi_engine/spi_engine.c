@@ -45,6 +45,7 @@ significant delays */
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sleep.h>
 #include <inttypes.h>
 
@@ -224,328 +225,348 @@ static int32_t spi_get_sleep_div(struct no_os_spi_desc *desc,
 }
 
 /**
- * @brief Create a new commands queue used in a spi transfer
+ * @brief Write the SPI engine's command fifo
  *
- * @param fifo Command buffer, usualy used in fifo mode
- * @param cmd Command with wich the buffer will be initiated
- * @return int32_t Failure if the memory allocation failed
+ * @param desc Decriptor containing SPI Engine's parameters
+ * @param cmd The command that will be written
+ * @return int32_t Returns -1 if the the axi transfer failed
  */
-static int32_t spi_engine_queue_new_cmd(struct spi_engine_cmd_queue **fifo,
+static int32_t spi_engine_write_cmd_reg(struct spi_engine_desc *desc,
 					uint32_t cmd)
 {
-	struct spi_engine_cmd_queue *local_fifo;
-
-	local_fifo = (spi_engine_cmd_queue*)no_os_malloc(sizeof(*local_fifo));
+	int32_t ret;
 
-	if(!local_fifo)
-		return -1;
+	/* Check if offload is enabled */
+	if(desc->offload_config & (OFFLOAD_TX_EN | OFFLOAD_RX_EN)) {
+		ret = spi_engine_write(desc,
+				       SPI_ENGINE_REG_OFFLOAD_CMD_MEM(0),
+				       cmd);
 
-	local_fifo->cmd = cmd;
-	local_fifo->next = NULL;
-	*fifo = local_fifo;
+	} else {
+		ret = spi_engine_write(desc,
+				       SPI_ENGINE_REG_CMD_FIFO,
+				       cmd);
+	}
 
-	return 0;
+	return ret;
 }
 
 /**
- * @brief Add a command at the end of an existing queue
+ * @brief Get the SPI mode configuration of the engine
  *
- * @param fifo Command buffer, usualy used in fifo mode
- * @param cmd Command to be added
+ * @param desc Decriptor containing SPI interface parameters
+ * @return uint8_t The value of the engine's config register
  */
-static void spi_engine_queue_add_cmd(struct spi_engine_cmd_queue **fifo,
-				     uint32_t cmd)
+static uint8_t spi_engine_get_cfg_reg(struct no_os_spi_desc *desc)
 {
-	struct spi_engine_cmd_queue *to_add = NULL;
-	struct spi_engine_cmd_queue *local_fifo;
+	struct spi_engine_desc	*desc_extra;
+	uint8_t			cfg_reg;
 
-	local_fifo = *fifo;
-	while (local_fifo->next != NULL) {
-		// Get the last element
-		local_fifo = local_fifo->next;
-	}
+	desc_extra = desc->extra;
 
-	// Create a new element
-	spi_engine_queue_new_cmd(&to_add, cmd);
-	// Add as the next element
-	local_fifo->next = to_add;
+	/*
+	 * Configure the spi mode :
+	 * 	- sdo_idle_state
+	 *	- 3 wire
+	 *	- CPOL
+	 *	- CPHA
+	 */
+	cfg_reg = desc->mode;
+	if (desc_extra->sdo_idle_state != 0)
+		cfg_reg |= SPI_ENGINE_CONFIG_SDO_IDLE;
+
+	return cfg_reg;
 }
 
 /**
- * @brief Add a command at the beginning of an existing queue
+ * @brief Spi engine command interpreter
  *
- * @param fifo Command buffer, usualy used in fifo mode
- * @param cmd Command to be added
+ * @param desc Decriptor containing SPI interface parameters
+ * @param cmd Message command to translate
+ * @param engine_cmd Engine instruction for the message command
+ * @param tx_len Incremented with the number of words sent by the command
+ * @return int32_t - 1 if the command translates to an engine instruction
+ *		   - 0 if the command has no effect
+ *		   - -EINVAL if the command format is invalid
  */
-static void spi_engine_queue_append_cmd(struct spi_engine_cmd_queue **fifo,
-					uint32_t cmd)
+static int32_t spi_engine_compile_cmd(struct no_os_spi_desc *desc,
+				      uint32_t cmd,
+				      uint32_t *engine_cmd,
+				      uint32_t *tx_len)
 {
-	struct spi_engine_cmd_queue *to_add = NULL;
+	uint8_t				engine_command;
+	uint8_t				parameter;
+	uint8_t				modifier;
+	uint8_t				words_number;
+	uint8_t				mask;
+	uint32_t			sleep_div;
+	struct spi_engine_desc		*desc_extra;
 
-	// Create a new element
-	spi_engine_queue_new_cmd(&to_add, cmd);
-	// Interchange the addresses
-	to_add->next = *fifo;
-	*fifo = to_add;
-}
+	desc_extra = desc->extra;
 
+	engine_command = (cmd >> 12) & 0x0F;
+	modifier = (cmd >> 8) & 0x0F;
+	parameter = cmd & 0xFF;
 
-/**
- * @brief Get the command from the beginning of the queue
- *
- * @param fifo Command buffer, usualy used in fifo mode
- * @param cmd Value of the command that was extracted
- * @return int32_t Return -1 if the queue is empty
- */
-static int32_t spi_engine_queue_get_cmd(struct spi_engine_cmd_queue **fifo,
-					uint32_t *cmd)
-{
-	struct spi_engine_cmd_queue *local_fifo;
+	switch(engine_command) {
+	case SPI_ENGINE_INST_TRANSFER:
+		words_number = spi_get_words_number(desc_extra, parameter);
+		*tx_len += words_number;
+
+		/*
+		 * Engine Wiki:
+		 *
+		 * https://wiki.analog.com/resources/fpga/peripherals/spi_engine
+		 *
+		 * The words number is zero based
+		 */
+		*engine_cmd = SPI_ENGINE_CMD_TRANSFER(modifier,
+						      words_number - 1);
+		break;
 
-	if (!*fifo)
-		return -1;
+	case SPI_ENGINE_INST_ASSERT:
+		mask = 0xFF;
+		if (parameter == 0x00)
+			/* Switch the state only of the selected chip select */
+			mask ^= NO_OS_BIT(desc->chip_select);
+		else if (parameter != 0xFF)
+			return 0;
+
+		*engine_cmd = SPI_ENGINE_CMD_ASSERT(desc_extra->cs_delay, mask);
+		break;
 
-	local_fifo = *fifo;
-	*cmd = local_fifo->cmd;
-	if ((*fifo)->next) {
-		*fifo = local_fifo->next;
-		no_os_free(local_fifo);
-	} else {
-		no_os_free(*fifo);
-		*fifo = NULL;
-	}
+	/* The SYNC and SLEEP commands got the same value but different
+	modifier */
+	case SPI_ENGINE_INST_SYNC_SLEEP:
+		if (modifier == SPI_ENGINE_MISC_SYNC) {
+			*engine_cmd = cmd;
+		} else if (modifier == SPI_ENGINE_MISC_SLEEP) {
+			spi_get_sleep_div(desc, parameter, &sleep_div);
+			*engine_cmd = SPI_ENGINE_CMD_SLEEP(sleep_div);
+		} else {
+			return 0;
+		}
+		break;
 
-	return 0;
-}
+	case SPI_ENGINE_INST_CONFIG:
+		*engine_cmd = cmd;
+		break;
 
-/**
- * @brief Free the memory allocated by a queue
- *
- * @param fifo The queue that needs it's memory freed
- * @return int32_t This function allways returns 0
- */
-static int32_t spi_engine_queue_no_os_free(struct spi_engine_cmd_queue **fifo)
-{
-	if(*fifo && (*fifo)->next)
-		spi_engine_queue_no_os_free(&(*fifo)->next);
-	if((*fifo) != NULL) {
-		no_os_free(*fifo);
-		*fifo = NULL;
+	default:
+		return -EINVAL;
 	}
 
-	return 0;
+	return 1;
 }
 
 /**
- * @brief Write the SPI engine's command fifo
+ * @brief Compile the engine configuration commands preceding a message:
+ * spi mode, data transfer length and prescaler
  *
- * @param desc Decriptor containing SPI Engine's parameters
- * @param cmd The command that will be written
- * @return int32_t Returns -1 if the the axi transfer failed
+ * @param desc Decriptor containing SPI interface parameters
+ * @param cmds Buffer of SPI_ENGINE_PROGRAM_CONFIG_CMDS engine instructions
  */
-static int32_t spi_engine_write_cmd_reg(struct spi_engine_desc *desc,
-					uint32_t cmd)
+static void spi_engine_compile_config(struct no_os_spi_desc *desc,
+				      uint32_t *cmds)
 {
-	int32_t ret;
-
-	/* Check if offload is enabled */
-	if(desc->offload_config & (OFFLOAD_TX_EN | OFFLOAD_RX_EN)) {
-		ret = spi_engine_write(desc,
-				       SPI_ENGINE_REG_OFFLOAD_CMD_MEM(0),
-				       cmd);
+	struct spi_engine_desc	*desc_extra;
 
-	} else {
-		ret = spi_engine_write(desc,
-				       SPI_ENGINE_REG_CMD_FIFO,
-				       cmd);
-	}
+	desc_extra = desc->extra;
 
-	return ret;
+	cmds[0] = SPI_ENGINE_CMD_CONFIG(SPI_ENGINE_CMD_REG_CONFIG,
+					spi_engine_get_cfg_reg(desc));
+	cmds[1] = SPI_ENGINE_CMD_CONFIG(SPI_ENGINE_CMD_DATA_TRANSFER_LEN,
+					desc_extra->data_width);
+	cmds[2] = SPI_ENGINE_CMD_CONFIG(SPI_ENGINE_CMD_REG_CLK_DIV,
+					desc_extra->clk_div);
 }
 
 /**
- * @brief Write a transfer command to the SPI engine's command fifo
+ * @brief Check if a program was compiled for a message and the current
+ * engine configuration
  *
- * @param desc Decriptor containing SPI Engine's parameters
- * @param read_write Read/Write operation flag
- * @param bytes_number Number of bytes to transfer
- * @return int32_t This function allways returns 0
+ * @param desc Decriptor containing SPI interface parameters
+ * @param prog The compiled program
+ * @param cmds Message commands
+ * @param no_cmds Number of message commands
+ * @return bool true if the program can be used for the message
  */
-static int32_t spi_engine_transfer(struct spi_engine_desc *desc,
-				   uint8_t read_write,
-				   uint8_t bytes_number)
+static bool spi_engine_program_match(struct no_os_spi_desc *desc,
+				     struct spi_engine_program *prog,
+				     const uint32_t *cmds,
+				     uint32_t no_cmds)
 {
-	uint8_t words_number;
-
-	words_number = spi_get_words_number(desc, bytes_number);
-
-	desc->offload_tx_len += words_number;
-
-	/*
-	 * Engine Wiki:
-	 *
-	 * https://wiki.analog.com/resources/fpga/peripherals/spi_engine
-	 *
-	 * The words number is zero based
-	 */
+	struct spi_engine_desc	*desc_extra;
 
-	spi_engine_write_cmd_reg(desc,
-				 SPI_ENGINE_CMD_TRANSFER(read_write,
-						 words_number  - 1));
+	desc_extra = desc->extra;
 
-	return 0;
+	return prog->id && prog->no_src == no_cmds &&
+	       prog->clk_div == desc_extra->clk_div &&
+	       prog->max_speed_hz == desc->max_speed_hz &&
+	       prog->data_width == desc_extra->data_width &&
+	       prog->mode == spi_engine_get_cfg_reg(desc) &&
+	       prog->chip_select == desc->chip_select &&
+	       prog->cs_delay == desc_extra->cs_delay &&
+	       !memcmp(prog->src, cmds, no_cmds * sizeof(*cmds));
 }
 
 /**
- * @brief Change the state of the chip select port
+ * @brief Compile the message commands into a program
+ *
+ * The program starts with the prescaler, data transfer length and spi mode
+ * configuration, followed by the translated message commands.
  *
  * @param desc Decriptor containing SPI interface parameters
- * @param assert Chip select state.
- * 		 The supported values are :
- * 			-true (HIGH)
- * 			-false (LOW)
+ * @param cmds Message commands
+ * @param no_cmds Number of message commands, at most
+ *	  SPI_ENGINE_PROGRAM_MAX_CMDS
+ * @param prog The compiled program
+ * @return int32_t 0 in case of success, negative error code otherwise
  */
-static void spi_engine_set_cs(struct no_os_spi_desc *desc,
-			      bool assert)
+static int32_t spi_engine_compile_program(struct no_os_spi_desc *desc,
+		const uint32_t *cmds,
+		uint32_t no_cmds,
+		struct spi_engine_program *prog)
 {
-	uint8_t			mask;
-	struct spi_engine_desc	*eng_desc;
+	struct spi_engine_desc	*desc_extra;
+	uint32_t		i;
+	int32_t			ret;
 
-	eng_desc = desc->extra;
+	desc_extra = desc->extra;
 
-	mask = 0xFF;
-	/* Switch the state only of the selected chip select */
-	if (!assert)
-		mask ^= NO_OS_BIT(desc->chip_select);
+	prog->id = 0;
+	prog->tx_len = 0;
 
-	spi_engine_write_cmd_reg(eng_desc,
-				 SPI_ENGINE_CMD_ASSERT(eng_desc->cs_delay,
-						 mask));
-}
+	spi_engine_compile_config(desc, prog->cmds);
+	prog->no_cmds = SPI_ENGINE_PROGRAM_CONFIG_CMDS;
 
-/**
- * @brief Add a delay bewtheen the engine commands
- *
- * @param desc Decriptor containing SPI interface parameters
- * @param sleep_time_ns Number of nanoseconds to sleep between commands
- */
-static void spi_gen_sleep_ns(struct no_os_spi_desc *desc,
-			     uint32_t sleep_time_ns)
-{
-	uint32_t 		sleep_div;
-	struct spi_engine_desc	*eng_desc;
+	for (i = 0; i < no_cmds; i++) {
+		ret = spi_engine_compile_cmd(desc, cmds[i],
+					     &prog->cmds[prog->no_cmds],
+					     &prog->tx_len);
+		if (ret < 0)
+			return ret;
 
-	eng_desc = desc->extra;
+		prog->no_cmds += ret;
+	}
+
+	memcpy(prog->src, cmds, no_cmds * sizeof(*cmds));
+	prog->no_src = no_cmds;
+	prog->clk_div = desc_extra->clk_div;
+	prog->max_speed_hz = desc->max_speed_hz;
+	prog->data_width = desc_extra->data_width;
+	prog->mode = spi_engine_get_cfg_reg(desc);
+	prog->chip_select = desc->chip_select;
+	prog->cs_delay = desc_extra->cs_delay;
 
-	spi_get_sleep_div(desc, sleep_time_ns, &sleep_div);
+	/* Ids are never 0, which marks unused entries */
+	if (!++desc_extra->program_id)
+		desc_extra->program_id++;
+	prog->id = desc_extra->program_id;
 
-	spi_engine_write_cmd_reg(eng_desc, SPI_ENGINE_CMD_SLEEP(sleep_div));
+	return 0;
 }
 
 /**
- * @brief Spi engine command interpreter
+ * @brief Get the compiled program of a message
+ *
+ * Programs are looked up in the descriptor's cache by message shape and engine
+ * configuration. On a miss, the message is compiled into the oldest entry.
  *
  * @param desc Decriptor containing SPI interface parameters
- * @param cmd Command to send to the engine
- * @return int32_t - 0 if the command is transfered
- *		   - -1 if the command format is invalid
+ * @param cmds Message commands
+ * @param no_cmds Number of message commands
+ * @param prog The compiled program, NULL if the message doesn't fit in a
+ *	  program and must be compiled on the fly
+ * @return int32_t 0 in case of success, negative error code otherwise
  */
-static int32_t spi_engine_write_cmd(struct no_os_spi_desc *desc,
-				    uint32_t cmd)
+static int32_t spi_engine_get_program(struct no_os_spi_desc *desc,
+				      const uint32_t *cmds,
+				      uint32_t no_cmds,
+				      struct spi_engine_program **prog)
 {
-	uint8_t				engine_command;
-	uint8_t				parameter;
-	uint8_t				modifier;
-	struct spi_engine_desc		*desc_extra;
+	struct spi_engine_desc	*desc_extra;
+	uint32_t		i;
+	int32_t			ret;
 
 	desc_extra = desc->extra;
+	*prog = NULL;
 
-	engine_command = (cmd >> 12) & 0x0F;
-	modifier = (cmd >> 8) & 0x0F;
-	parameter = cmd & 0xFF;
-
-	switch(engine_command) {
-	case SPI_ENGINE_INST_TRANSFER:
-		spi_engine_transfer(desc_extra, modifier, parameter);
-		break;
-
-	case SPI_ENGINE_INST_ASSERT:
-		if(parameter == 0xFF) {
-			/* Set the CS HIGH */
-			spi_engine_set_cs(desc, true);
-		} else if(parameter == 0x00) {
-			/* Set the CS LOW */
-			spi_engine_set_cs(desc, false);
-		}
-		break;
+	if (!SPI_ENGINE_PROGRAM_CACHE_DEPTH ||
+	    no_cmds > SPI_ENGINE_PROGRAM_MAX_CMDS)
+		return 0;
 
-	/* The SYNC and SLEEP commands got the same value but different
-	modifier */
-	case SPI_ENGINE_INST_SYNC_SLEEP:
-		/* SYNC instruction */
-		if(modifier == 0x00) {
-			spi_engine_write_cmd_reg(desc_extra, cmd);
-		} else if(modifier == 0x01) {
-			spi_gen_sleep_ns(desc, parameter);
+	for (i = 0; i < SPI_ENGINE_PROGRAM_CACHE_DEPTH; i++) {
+		if (spi_engine_program_match(desc, &desc_extra->programs[i],
+					     cmds, no_cmds)) {
+			*prog = &desc_extra->programs[i];
+			return 0;
 		}
-		break;
-	case SPI_ENGINE_INST_CONFIG:
-		spi_engine_write_cmd_reg(desc_extra, cmd);
+	}
 
-		break;
+	i = desc_extra->program_next;
+	desc_extra->program_next = (i + 1) % SPI_ENGINE_PROGRAM_CACHE_DEPTH;
 
-	default:
+	ret = spi_engine_compile_program(desc, cmds, no_cmds,
+					 &desc_extra->programs[i]);
+	if (ret)
+		return ret;
 
-		return -1;
-	}
+	*prog = &desc_extra->programs[i];
 
 	return 0;
 }
 
 /**
- * @brief Prepare the command queue before sending it to the engine
+ * @brief Write the message commands to the engine, followed by a sync command
+ * signaling that the transfer has finished
  *
  * @param desc Decriptor containing SPI interface parameters
  * @param msg Structure used to store the transfer messages
- * @return int32_t This function allways returns 0
+ * @return int32_t 0 in case of success, negative error code otherwise
  */
-static int32_t spi_engine_compile_message(struct no_os_spi_desc *desc,
-		struct spi_engine_msg *msg)
+static int32_t spi_engine_write_program(struct no_os_spi_desc *desc,
+					struct spi_engine_msg *msg)
 {
-	struct spi_engine_desc	*desc_extra;
-	uint8_t cfg_reg;
+	struct spi_engine_program	*prog;
+	struct spi_engine_desc		*desc_extra;
+	uint32_t			config[SPI_ENGINE_PROGRAM_CONFIG_CMDS];
+	uint32_t			i;
+	uint32_t			cmd;
+	int32_t				ret;
 
 	desc_extra = desc->extra;
 
-	/* Configure the prescaler */
-	spi_engine_queue_append_cmd(&msg->cmds,
-				    SPI_ENGINE_CMD_CONFIG(
-					    SPI_ENGINE_CMD_REG_CLK_DIV,
-					    desc_extra->clk_div));
-
-	/* Set the data transfer length */
-	spi_engine_queue_append_cmd(&msg->cmds,
-				    SPI_ENGINE_CMD_CONFIG(
-					    SPI_ENGINE_CMD_DATA_TRANSFER_LEN,
-					    desc_extra->data_width));
-	/*
-	 * Configure the spi mode :
-	 * 	- sdo_idle_state
-	 *	- 3 wire
-	 *	- CPOL
-	 *	- CPHA
-	 */
-	cfg_reg = desc->mode;
-	if (desc_extra->sdo_idle_state != 0)
-		cfg_reg |= SPI_ENGINE_CONFIG_SDO_IDLE;
+	ret = spi_engine_get_program(desc, msg->cmds, msg->no_cmds, &prog);
+	if (ret)
+		return ret;
 
-	spi_engine_queue_append_cmd(&msg->cmds,
-				    SPI_ENGINE_CMD_CONFIG(
-					    SPI_ENGINE_CMD_REG_CONFIG,
-					    cfg_reg));
+	if (prog) {
+		for (i = 0; i < prog->no_cmds; i++)
+			spi_engine_write_cmd_reg(desc_extra, prog->cmds[i]);
 
-	/* Add a sync command to signal that the transfer has finished */
-	spi_engine_queue_add_cmd(&msg->cmds, SPI_ENGINE_CMD_SYNC(_sync_id));
+		desc_extra->offload_tx_len += prog->tx_len;
+	} else {
+		/* Too long to be cached, compile while writing */
+		spi_engine_compile_config(desc, config);
+		for (i = 0; i < SPI_ENGINE_PROGRAM_CONFIG_CMDS; i++)
+			spi_engine_write_cmd_reg(desc_extra, config[i]);
+
+		for (i = 0; i < msg->no_cmds; i++) {
+			uint32_t tx_len = 0;
+
+			ret = spi_engine_compile_cmd(desc, msg->cmds[i], &cmd,
+						     &tx_len);
+			if (ret < 0)
+				return ret;
+			if (ret)
+				spi_engine_write_cmd_reg(desc_extra, cmd);
+
+			desc_extra->offload_tx_len += tx_len;
+		}
+	}
+
+	spi_engine_write_cmd_reg(desc_extra, SPI_ENGINE_CMD_SYNC(_sync_id));
 
 	return 0;
 }
@@ -556,7 +577,7 @@ static int32_t spi_engine_compile_message(struct no_os_spi_desc *desc,
  * @param desc Decriptor containing SPI interface parameters
  * @param msg Structure used to store the transfer messages
  * @return int32_t - 0 if the transfer finished
- *		   - -1 if the memory allocation failed
+ *		   - negative error code if the message is invalid
  */
 static int32_t spi_engine_transfer_message(struct no_os_spi_desc *desc,
 		struct spi_engine_msg *msg)
@@ -565,20 +586,18 @@ static int32_t spi_engine_transfer_message(struct no_os_spi_desc *desc,
 	uint32_t		data;
 	uint32_t		sync_id;
 	bool 			offload_en;
+	int32_t			ret;
 	struct spi_engine_desc	*desc_extra;
 
 	desc_extra = desc->extra;
 
-	spi_engine_compile_message(desc, msg);
-
 	offload_en = (desc_extra->offload_config & OFFLOAD_TX_EN) |
 		     (desc_extra->offload_config & OFFLOAD_RX_EN);
 
 	/* Write the command fifo buffer */
-	while(msg->cmds != NULL) {
-		spi_engine_queue_get_cmd(&msg->cmds, &data);
-		spi_engine_write_cmd(desc, data);
-	}
+	ret = spi_engine_write_program(desc, msg);
+	if (ret)
+		return ret;
 
 	/* Write a number of tx_length WORDS on the SDO line */
 
@@ -641,7 +660,7 @@ int32_t spi_engine_init(struct no_os_spi_desc **desc,
 		return -1;
 	}
 
-	eng_desc = (struct spi_engine_desc*)no_os_malloc(sizeof(*eng_desc));
+	eng_desc = (struct spi_engine_desc*)no_os_calloc(1, sizeof(*eng_desc));
 
 	if (!eng_desc)
 		return -1;
@@ -657,6 +676,7 @@ int32_t spi_engine_init(struct no_os_spi_desc **desc,
 	eng_desc->spi_engine_baseaddr = spi_engine_init->spi_engine_baseaddr;
 	eng_desc->type = spi_engine_init->type;
 	eng_desc->cs_delay = spi_engine_init->cs_delay;
+	eng_desc->sdo_idle_state = spi_engine_init->sdo_idle_state;
 	eng_desc->ref_clk_hz = spi_engine_init->ref_clk_hz;
 	eng_desc->clk_div =  eng_desc->ref_clk_hz /
 			     (2 * param->max_speed_hz) - 1;
@@ -704,6 +724,7 @@ int32_t spi_engine_write_and_read(struct no_os_spi_desc *desc,
 	int32_t 		ret;
 	struct spi_engine_msg	msg;
 	struct spi_engine_desc	*desc_extra;
+	uint32_t		cmds[4];
 
 	desc_extra = desc->extra;
 
@@ -716,23 +737,24 @@ int32_t spi_engine_write_and_read(struct no_os_spi_desc *desc,
 
 	words_number = spi_get_words_number(desc_extra, bytes_number);
 
-	msg.cmds = (spi_engine_cmd_queue*)no_os_malloc(sizeof(*msg.cmds));
-	if (!msg.cmds)
-		return -1;
-
 	msg.tx_buf =(uint32_t*)no_os_calloc(words_number, sizeof(msg.tx_buf[0]));
 	msg.rx_buf =(uint32_t*)no_os_calloc(words_number, sizeof(msg.rx_buf[0]));
+	if (!msg.tx_buf || !msg.rx_buf) {
+		ret = -ENOMEM;
+		goto out;
+	}
 	msg.length = words_number;
 
 	/* Get the length of transfered word */
 	word_len = spi_get_word_lenght(desc_extra);
 
 	/* Make sure the CS is HIGH before starting a transaction */
-	msg.cmds->next = NULL;
-	msg.cmds->cmd = CS_HIGH;
-	spi_engine_queue_add_cmd(&msg.cmds, CS_LOW);
-	spi_engine_queue_add_cmd(&msg.cmds, WRITE_READ(bytes_number));
-	spi_engine_queue_add_cmd(&msg.cmds, CS_HIGH);
+	cmds[0] = CS_HIGH;
+	cmds[1] = CS_LOW;
+	cmds[2] = WRITE_READ(bytes_number);
+	cmds[3] = CS_HIGH;
+	msg.cmds = cmds;
+	msg.no_cmds = NO_OS_ARRAY_SIZE(cmds);
 
 	/* Pack the bytes into engine WORDS */
 	for (i = 0; i < bytes_number; i++)
@@ -740,13 +762,15 @@ int32_t spi_engine_write_and_read(struct no_os_spi_desc *desc,
 							(i % word_len + 1) * 8);
 
 	ret = spi_engine_transfer_message(desc, &msg);
+	if (ret)
+		goto out;
 
 	for (i = 0; i < bytes_number; i++)
 		data[i] = msg.rx_buf[(i) / word_len] >>
 			  (desc_extra->data_width -
 			   ((i) % word_len + 1) * 8);
 
-	spi_engine_queue_no_os_free(&msg.cmds);
+out:
 	no_os_free(msg.tx_buf);
 	no_os_free(msg.rx_buf);
 
@@ -769,6 +793,10 @@ int32_t spi_engine_offload_init(struct no_os_spi_desc *desc,
 	eng_desc = desc->extra;
 
 	eng_desc->offload_config = param->offload_config;
+	if (eng_desc->offload_continuous != param->continuous) {
+		eng_desc->offload_continuous = param->continuous;
+		eng_desc->offload_program_id = 0;
+	}
 
 	if(!param->dma_flags) {
 		eng_desc->cyclic = CYCLIC;
@@ -780,14 +808,28 @@ int32_t spi_engine_offload_init(struct no_os_spi_desc *desc,
 	}
 
 	dmac_init.irq_option = IRQ_DISABLED;
-	if(param->offload_config & OFFLOAD_TX_EN) {
+	/* Keep the DMACs of a previous initialization */
+	if (eng_desc->offload_tx_dma &&
+	    eng_desc->offload_tx_dma->base != param->tx_dma_baseaddr) {
+		axi_dmac_remove(eng_desc->offload_tx_dma);
+		eng_desc->offload_tx_dma = NULL;
+	}
+	if (eng_desc->offload_rx_dma &&
+	    eng_desc->offload_rx_dma->base != param->rx_dma_baseaddr) {
+		axi_dmac_remove(eng_desc->offload_rx_dma);
+		eng_desc->offload_rx_dma = NULL;
+	}
+
+	if((param->offload_config & OFFLOAD_TX_EN) &&
+	    !eng_desc->offload_tx_dma) {
 		dmac_init.name = "DAC DMAC";
 		dmac_init.base = param->tx_dma_baseaddr;
 		axi_dmac_init(&eng_desc->offload_tx_dma, &dmac_init);
 		if(!eng_desc->offload_tx_dma)
 			return -1;
 	}
-	if(param->offload_config & OFFLOAD_RX_EN) {
+	if((param->offload_config & OFFLOAD_RX_EN) &&
+	    !eng_desc->offload_rx_dma) {
 		dmac_init.name = "ADC DMAC";
 		dmac_init.base = param->rx_dma_baseaddr;
 		axi_dmac_init(&eng_desc->offload_rx_dma, &dmac_init);
@@ -798,6 +840,26 @@ int32_t spi_engine_offload_init(struct no_os_spi_desc *desc,
 	return 0;
 }
 
+/**
+ * @brief Check if the offload module already holds a program and its data
+ *
+ * @param eng_desc Decriptor containing SPI Engine's parameters
+ * @param prog The compiled program
+ * @param tx_buf The SDO data of the program
+ * @return bool true if the offload module doesn't have to be loaded again
+ */
+static bool spi_engine_offload_loaded(struct spi_engine_desc *eng_desc,
+				      struct spi_engine_program *prog,
+				      const uint32_t *tx_buf)
+{
+	if (!eng_desc->offload_continuous || !prog ||
+	    eng_desc->offload_program_id != prog->id)
+		return false;
+
+	return !prog->tx_len || !memcmp(eng_desc->offload_sdo, tx_buf,
+					prog->tx_len * sizeof(*tx_buf));
+}
+
 /**
  * @brief Initiate a SPI transfer in offload mode
  *
@@ -810,10 +872,10 @@ int32_t spi_engine_offload_transfer(struct no_os_spi_desc *desc,
 				    struct spi_engine_offload_message msg,
 				    uint32_t no_samples)
 {
-	struct spi_engine_msg	transfer;
-	struct spi_engine_desc	*eng_desc;
-	uint32_t 		i;
-	int32_t			ret;
+	struct spi_engine_program	*prog;
+	struct spi_engine_msg		transfer;
+	struct spi_engine_desc		*eng_desc;
+	int32_t				ret;
 
 	eng_desc = desc->extra;
 
@@ -822,31 +884,40 @@ int32_t spi_engine_offload_transfer(struct no_os_spi_desc *desc,
 	     (eng_desc->offload_config & OFFLOAD_RX_EN)))
 		return -1;
 
-	spi_engine_write(eng_desc, SPI_ENGINE_REG_OFFLOAD_RESET(0), 1);
-	spi_engine_write(eng_desc, SPI_ENGINE_REG_OFFLOAD_RESET(0), 0);
+	ret = spi_engine_get_program(desc, msg.commands, msg.no_commands,
+				     &prog);
+	if (ret)
+		return ret;
 
-	eng_desc->offload_tx_len = 0;
-	eng_desc->offload_rx_len = 0;
+	/* In continuous mode the offload module keeps the last program */
+	if (!spi_engine_offload_loaded(eng_desc, prog, msg.commands_data)) {
+		eng_desc->offload_program_id = 0;
 
-	transfer.cmds = (spi_engine_cmd_queue*)no_os_malloc(sizeof(*transfer.cmds));
+		spi_engine_write(eng_desc, SPI_ENGINE_REG_OFFLOAD_RESET(0), 1);
+		spi_engine_write(eng_desc, SPI_ENGINE_REG_OFFLOAD_RESET(0), 0);
 
-	if (!transfer.cmds)
-		return -1;
+		eng_desc->offload_tx_len = 0;
+		eng_desc->offload_rx_len = 0;
 
-	transfer.tx_buf = msg.commands_data;
-
-	/* Load the commands into the message */
-	transfer.cmds->next = NULL;
-	transfer.cmds->cmd = msg.commands[0];
-	i = 1;
-	while(i < msg.no_commands) {
-		spi_engine_queue_add_cmd(&transfer.cmds, msg.commands[i++]);
+		transfer.tx_buf = msg.commands_data;
+		transfer.cmds = msg.commands;
+		transfer.no_cmds = msg.no_commands;
 
+		ret = spi_engine_transfer_message(desc, &transfer);
+		if (ret)
+			return ret;
+
+		if (eng_desc->offload_continuous && prog &&
+		    prog->tx_len <= NO_OS_ARRAY_SIZE(eng_desc->offload_sdo)) {
+			if (prog->tx_len)
+				memcpy(eng_desc->offload_sdo, msg.commands_data,
+				       prog->tx_len * sizeof(uint32_t));
+			eng_desc->offload_program_id = prog->id;
+		}
+	} else {
+		eng_desc->offload_tx_len = prog->tx_len;
 	}
 
-	ret = 0;
-	spi_engine_transfer_message(desc, &transfer);
-
 	/* Start transfer */
 	spi_engine_write(eng_desc, SPI_ENGINE_REG_OFFLOAD_CTRL(0), 0x0001);
 	if(eng_desc->offload_config & OFFLOAD_TX_EN) {
@@ -864,7 +935,7 @@ int32_t spi_engine_offload_transfer(struct no_os_spi_desc *desc,
 		};
 		ret = axi_dmac_transfer_start(eng_desc->offload_tx_dma, &tx_transfer);
 		if (ret)
-			goto error;
+			return ret;
 	}
 
 	if(eng_desc->offload_config & OFFLOAD_RX_EN) {
@@ -882,18 +953,16 @@ int32_t spi_engine_offload_transfer(struct no_os_spi_desc *desc,
 		};
 		ret = axi_dmac_transfer_start(eng_desc->offload_rx_dma, &rx_transfer);
 		if (ret)
-			goto error;
+			return ret;
 		ret = axi_dmac_transfer_wait_completion(eng_desc->offload_rx_dma, 500);
 		if (ret)
-			goto error;
+			return ret;
 	}
 
-	usleep(1000);
-
-error:
-	spi_engine_queue_no_os_free(&transfer.cmds);
+	if (!eng_desc->offload_continuous)
+		usleep(1000);
 
-	return ret;
+	return 0;
 }
 
 /**
@@ -908,9 +977,10 @@ int32_t spi_engine_remove(struct no_os_spi_desc *desc)
 
 	eng_desc = desc->extra;
 
-	if(eng_desc->offload_config & OFFLOAD_TX_EN)
+	spi_engine_write(eng_desc, SPI_ENGINE_REG_OFFLOAD_CTRL(0), 0);
+	if(eng_desc->offload_tx_dma)
 		axi_dmac_remove(eng_desc->offload_tx_dma);
-	if(eng_desc->offload_config & OFFLOAD_RX_EN)
+	if(eng_desc->offload_rx_dma)
 		axi_dmac_remove(eng_desc->offload_rx_dma);
 	no_os_free(desc->extra);
 	no_os_free(desc);
@@ -72,6 +72,20 @@ and will be used inside the function call */
 #define CS_HIGH				SPI_ENGINE_CMD_ASSERT(0x03, 0xFF)
 #define CS_LOW				SPI_ENGINE_CMD_ASSERT(0x03, 0x00)
 
+/*
+ * Number of compiled command programs kept by each SPI engine descriptor,
+ * 0 disables the cache. Can be overridden from the project build flags.
+ */
+#ifndef SPI_ENGINE_PROGRAM_CACHE_DEPTH
+#define SPI_ENGINE_PROGRAM_CACHE_DEPTH	4
+#endif
+
+#if SPI_ENGINE_PROGRAM_CACHE_DEPTH
+#define SPI_ENGINE_PROGRAM_CACHE_LEN	SPI_ENGINE_PROGRAM_CACHE_DEPTH
+#else
+#define SPI_ENGINE_PROGRAM_CACHE_LEN	1
+#endif
+
 /******************************************************************************/
 /*************************** Types Declarations *******************************/
 /******************************************************************************/
@@ -133,6 +147,18 @@ struct spi_engine_desc {
 	uint8_t 		max_data_width;
 	/**  output of SDO when CS is inactive or read-only transfers */
 	uint8_t			sdo_idle_state;
+	/** Compiled command programs, looked up by message shape */
+	struct spi_engine_program	programs[SPI_ENGINE_PROGRAM_CACHE_LEN];
+	/** Next entry of programs to be replaced */
+	uint32_t		program_next;
+	/** Id of the last compiled program */
+	uint32_t		program_id;
+	/** Keep the offload module loaded and enabled between transfers */
+	bool			offload_continuous;
+	/** Id of the program loaded in the offload command memory, 0 if none */
+	uint32_t		offload_program_id;
+	/** Data loaded in the offload SDO memory */
+	uint32_t		offload_sdo[SPI_ENGINE_PROGRAM_MAX_CMDS];
 };
 
 
@@ -149,6 +175,11 @@ struct spi_engine_offload_init_param {
 	uint32_t	dma_flags;
 	/** Offload's module transfer direction : TX, RX or both */
 	uint8_t		offload_config;
+	/**
+	 * Keep the offload module loaded and enabled across transfers. The
+	 * commands and SDO data are only written again when they change.
+	 */
+	bool		continuous;
 };
 
 /**
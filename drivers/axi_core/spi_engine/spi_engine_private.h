@@ -137,16 +137,44 @@
 /*************************** Types Declarations *******************************/
 /******************************************************************************/
 
-typedef struct spi_engine_cmd_queue {
-	uint32_t	cmd;
-	struct		spi_engine_cmd_queue *next;
-} spi_engine_cmd_queue;
+/* Maximum number of message commands of a cached program */
+#define SPI_ENGINE_PROGRAM_MAX_CMDS		16
+
+/* The clock divider, data width and mode commands preceding the message */
+#define SPI_ENGINE_PROGRAM_CONFIG_CMDS		3
+
+/**
+ * @struct spi_engine_program
+ * @brief  Message commands compiled to SPI engine instructions, along with the
+ * message shape and engine configuration they were compiled for.
+ */
+struct spi_engine_program {
+	/** Unique id of the compilation, 0 if the entry is unused */
+	uint32_t	id;
+	/** Message commands the program was compiled from */
+	uint32_t	src[SPI_ENGINE_PROGRAM_MAX_CMDS];
+	uint32_t	no_src;
+	/** Engine configuration the program was compiled for */
+	uint32_t	clk_div;
+	uint32_t	max_speed_hz;
+	uint8_t		data_width;
+	uint8_t		mode;
+	uint8_t		chip_select;
+	uint8_t		cs_delay;
+	/** Engine instructions, without the final SYNC */
+	uint32_t	cmds[SPI_ENGINE_PROGRAM_MAX_CMDS +
+			     SPI_ENGINE_PROGRAM_CONFIG_CMDS];
+	uint32_t	no_cmds;
+	/** Number of SDO words consumed by the program */
+	uint32_t	tx_len;
+};
 
 typedef struct spi_engine_msg {
 	uint32_t			*tx_buf;
 	uint32_t			*rx_buf;
 	uint32_t			length;
-	struct spi_engine_cmd_queue	*cmds;
+	const uint32_t			*cmds;
+	uint32_t			no_cmds;
 } spi_engine_msg;
 
 #endif // SPI_ENGINE_PRIVATE_H
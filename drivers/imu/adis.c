@@ -52,6 +52,8 @@
 #define ADIS_32_BIT_BURST_SIZE		1
 #define ADIS_FIFO_NOT_PRESENT		0
 #define ADIS_FIFO_PRESENT		1
+/* Messages queued by adis_write_regs() before a flush */
+#define ADIS_BATCH_LEN			32
 #define ADIS_MSG_SIZE_16_BIT_BURST 	20 /* in bytes */
 #define ADIS_MSG_SIZE_32_BIT_BURST 	32 /* in bytes */
 #define ADIS_CHECKSUM_SIZE		2  /* in bytes */
@@ -394,6 +396,107 @@ int adis_write_reg(struct adis_dev *adis, uint32_t reg, uint32_t val,
 	return 0;
 }
 
+/**
+ * @brief Queue a single byte register write in a SPI batch.
+ * @param batch - The batch, flushed first if it is full.
+ * @param tx    - Transmit buffers, one per batch entry.
+ * @param msg   - Message template.
+ * @param reg   - The register address.
+ * @param val   - The register value.
+ * @return 0 in case of success, error code otherwise.
+ */
+static int adis_batch_write(struct no_os_spi_batch *batch, uint8_t (*tx)[2],
+			    struct no_os_spi_msg *msg, uint32_t reg,
+			    uint8_t val)
+{
+	int ret;
+
+	/* The buffers of the queued messages must not be reused. */
+	if (batch->len == batch->capacity) {
+		ret = no_os_spi_batch_flush(batch);
+		if (ret)
+			return ret;
+	}
+
+	tx[batch->len][0] = ADIS_WRITE_REG(reg);
+	tx[batch->len][1] = val;
+	msg->tx_buff = tx[batch->len];
+
+	return no_os_spi_batch_add(batch, msg);
+}
+
+/**
+ * @brief Write consecutive 16-bit registers, such as FIR coefficient banks,
+ *	  with a single SPI transfer instead of one per register.
+ * @param adis  - The adis device.
+ * @param reg   - The address of the lower byte of the first register.
+ * @param vals  - The values to write.
+ * @param count - The number of registers.
+ * @return 0 in case of success, error code otherwise.
+ */
+int adis_write_regs(struct adis_dev *adis, uint32_t reg, const uint16_t *vals,
+		    uint32_t count)
+{
+	struct no_os_spi_msg msg = {
+		.bytes_number = 2,
+		/* Every byte write is a separate SPI frame. */
+		.cs_change = 1,
+		.cs_change_delay = adis->info->cs_change_delay,
+		.cs_delay_last = adis->info->write_delay,
+	};
+	uint8_t tx[ADIS_BATCH_LEN][2];
+	struct no_os_spi_batch *batch;
+	uint32_t i, addr, page;
+	int ret, ret2;
+
+	if (!vals)
+		return -EINVAL;
+
+	if (adis->is_locked)
+		return -EPERM;
+
+	if (adis->info->write_reg) {
+		for (i = 0; i < count; i++) {
+			ret = adis_write_reg(adis, reg + 2 * i, vals[i],
+					     ADIS_2_BYTES_SIZE);
+			if (ret)
+				return ret;
+		}
+
+		return 0;
+	}
+
+	ret = no_os_spi_batch_init(&batch, adis->spi_desc, ADIS_BATCH_LEN);
+	if (ret)
+		return ret;
+
+	for (i = 0; i < 2 * count && !ret; i++) {
+		addr = reg + i;
+		page = addr / ADIS_PAGE_SIZE;
+		if (adis->current_page != page) {
+			ret = adis_batch_write(batch, tx, &msg,
+					       ADIS_REG_PAGE_ID, page);
+			if (ret)
+				break;
+			adis->current_page = page;
+		}
+
+		ret = adis_batch_write(batch, tx, &msg, addr,
+				       i % 2 ? vals[i / 2] >> 8 : vals[i / 2]);
+	}
+
+	ret2 = no_os_spi_batch_flush(batch);
+	if (!ret)
+		ret = ret2;
+	no_os_spi_batch_remove(batch);
+
+	/* The page written last is unknown after a failed transfer. */
+	if (ret && adis->info->has_paging)
+		adis->current_page = -1;
+
+	return ret;
+}
+
 /**
  * @brief Read field to uint32 value.
  * @param adis      - The adis device.
@@ -339,6 +339,9 @@ int adis_read_reg(struct adis_dev *adis,  uint32_t reg, uint32_t *val,
 /*! Write N bytes to register. */
 int adis_write_reg(struct adis_dev *adis, uint32_t reg, uint32_t value,
 		   uint32_t size);
+/*! Write consecutive 16-bit registers with a single SPI transfer. */
+int adis_write_regs(struct adis_dev *adis, uint32_t reg, const uint16_t *vals,
+		    uint32_t count);
 /*! Update the desired bits of reg in accordance with mask and val. */
 int adis_update_bits_base(struct adis_dev *adis, uint32_t reg,
 			  const uint32_t mask, const uint32_t val, uint8_t size);
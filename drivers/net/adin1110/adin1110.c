@@ -44,6 +44,12 @@
 
 #define ADIN1110_CRC_POLYNOMIAL	0x7
 
+/* Layout of desc->data for the scatter/gather FIFO transfers */
+#define ADIN1110_SG_REG_OFF	8
+#define ADIN1110_SG_PAD_OFF	20
+/* Minimum frame padding and the 4 byte alignment */
+#define ADIN1110_SG_PAD_LEN	68
+
 NO_OS_DECLARE_CRC8_TABLE(_crc_table);
 
 struct _adin1110_priv {
@@ -63,90 +69,144 @@ static struct _adin1110_priv driver_data[2] = {
 };
 
 /**
- * @brief Write a register's value
+ * @brief Prepare the SPI message of a register write
  * @param desc - the device descriptor
  * @param addr - register's address
  * @param data - register's value
- * @return 0 in case of success, negative error code otherwise
+ * @param buf - buffer for the message, at least 8 bytes
+ * @param xfer - the message to be prepared
  */
-int adin1110_reg_write(struct adin1110_desc *desc, uint16_t addr, uint32_t data)
+static void adin1110_reg_write_msg(struct adin1110_desc *desc, uint16_t addr,
+				   uint32_t data, uint8_t *buf,
+				   struct no_os_spi_msg *xfer)
 {
 	uint32_t header_len = ADIN1110_WR_HDR_SIZE;
-	struct no_os_spi_msg xfer = {
-		.tx_buff = desc->data,
+
+	*xfer = (struct no_os_spi_msg) {
+		.tx_buff = buf,
 		.bytes_number = ADIN1110_WR_FRAME_SIZE,
 		.cs_change = 1,
 	};
 
 	addr &= ADIN1110_ADDR_MASK;
 	addr |= ADIN1110_CD_MASK | ADIN1110_RW_MASK;
-	no_os_put_unaligned_be16(addr, desc->data);
+	no_os_put_unaligned_be16(addr, buf);
 
 	if (desc->append_crc) {
-		desc->data[2] = no_os_crc8(_crc_table, desc->data, 2, 0);
+		buf[2] = no_os_crc8(_crc_table, buf, 2, 0);
 		header_len++;
-		xfer.bytes_number++;
+		xfer->bytes_number++;
 	}
 
-	no_os_put_unaligned_be32(data, &desc->data[header_len]);
+	no_os_put_unaligned_be32(data, &buf[header_len]);
 	if (desc->append_crc) {
-		desc->data[header_len + ADIN1110_REG_LEN] =
-			no_os_crc8(_crc_table, &desc->data[header_len], ADIN1110_REG_LEN, 0);
-		xfer.bytes_number++;
+		buf[header_len + ADIN1110_REG_LEN] =
+			no_os_crc8(_crc_table, &buf[header_len], ADIN1110_REG_LEN, 0);
+		xfer->bytes_number++;
 	}
-
-	return no_os_spi_transfer(desc->comm_desc, &xfer, 1);
 }
 
 /**
- * @brief Read a register's value
+ * @brief Write a register's value
  * @param desc - the device descriptor
  * @param addr - register's address
  * @param data - register's value
  * @return 0 in case of success, negative error code otherwise
  */
-int adin1110_reg_read(struct adin1110_desc *desc, uint16_t addr, uint32_t *data)
+int adin1110_reg_write(struct adin1110_desc *desc, uint16_t addr, uint32_t data)
+{
+	struct no_os_spi_msg xfer;
+
+	adin1110_reg_write_msg(desc, addr, data, desc->data, &xfer);
+
+	return no_os_spi_transfer(desc->comm_desc, &xfer, 1);
+}
+
+/**
+ * @brief Prepare the SPI message of a register read
+ * @param desc - the device descriptor
+ * @param addr - register's address
+ * @param buf - buffer for the message, at least 9 bytes
+ * @param xfer - the message to be prepared
+ * @return offset of the register's value in buf
+ */
+static uint32_t adin1110_reg_read_msg(struct adin1110_desc *desc,
+				      uint16_t addr, uint8_t *buf,
+				      struct no_os_spi_msg *xfer)
 {
-	uint8_t crc;
-	uint8_t recv_crc;
 	uint32_t header_len = ADIN1110_RD_HEADER_LEN;
-	struct no_os_spi_msg xfer = {
-		.tx_buff = desc->data,
-		.rx_buff = desc->data,
+
+	*xfer = (struct no_os_spi_msg) {
+		.tx_buff = buf,
+		.rx_buff = buf,
 		.bytes_number = ADIN1110_REG_LEN,
 		.cs_change = 1,
 	};
-	int ret;
 
-	no_os_put_unaligned_be16(addr, &desc->data[0]);
-	desc->data[0] |= ADIN1110_SPI_CD;
-	desc->data[2] = 0x0;
+	no_os_put_unaligned_be16(addr, &buf[0]);
+	buf[0] |= ADIN1110_SPI_CD;
+	buf[2] = 0x0;
 
 	if (desc->append_crc) {
-		xfer.bytes_number += ADIN1110_CRC_LEN;
-		desc->data[2] = no_os_crc8(_crc_table, desc->data, 2, 0);
-		desc->data[3] = 0x0;
+		xfer->bytes_number += ADIN1110_CRC_LEN;
+		buf[2] = no_os_crc8(_crc_table, buf, 2, 0);
+		buf[3] = 0x0;
 		header_len++;
 	}
 
-	xfer.bytes_number += header_len;
-	ret = no_os_spi_transfer(desc->comm_desc, &xfer, 1);
-	if (ret)
-		return ret;
+	xfer->bytes_number += header_len;
+
+	return header_len;
+}
+
+/**
+ * @brief Get the register's value from a completed register read message
+ * @param desc - the device descriptor
+ * @param buf - buffer of the message
+ * @param header_len - offset of the register's value in buf
+ * @param data - register's value
+ * @return 0 in case of success, negative error code otherwise
+ */
+static int adin1110_reg_read_val(struct adin1110_desc *desc, uint8_t *buf,
+				 uint32_t header_len, uint32_t *data)
+{
+	uint8_t crc;
+	uint8_t recv_crc;
 
 	if (desc->append_crc) {
-		crc = no_os_crc8(_crc_table, &desc->data[header_len], 4, 0);
-		recv_crc = desc->data[header_len + ADIN1110_REG_LEN];
+		crc = no_os_crc8(_crc_table, &buf[header_len], 4, 0);
+		recv_crc = buf[header_len + ADIN1110_REG_LEN];
 
 		if (crc != recv_crc)
 			return -EINVAL;
 	}
 
-	*data = no_os_get_unaligned_be32(&desc->data[header_len]);
+	*data = no_os_get_unaligned_be32(&buf[header_len]);
 
 	return 0;
 }
 
+/**
+ * @brief Read a register's value
+ * @param desc - the device descriptor
+ * @param addr - register's address
+ * @param data - register's value
+ * @return 0 in case of success, negative error code otherwise
+ */
+int adin1110_reg_read(struct adin1110_desc *desc, uint16_t addr, uint32_t *data)
+{
+	struct no_os_spi_msg xfer;
+	uint32_t header_len;
+	int ret;
+
+	header_len = adin1110_reg_read_msg(desc, addr, desc->data, &xfer);
+	ret = no_os_spi_transfer(desc->comm_desc, &xfer, 1);
+	if (ret)
+		return ret;
+
+	return adin1110_reg_read_val(desc, desc->data, header_len, data);
+}
+
 /**
  * @brief Update a register's value based on a mask
  * @param desc - the device descriptor
@@ -480,36 +540,42 @@ int adin1110_broadcast_filter(struct adin1110_desc *desc, bool enabled)
 }
 
 /**
- * @brief Write a frame to the TX FIFO.
+ * @brief Write a frame gathered from a list of segments to the TX FIFO. The
+ * 	  segments are transferred in place, without being copied to the
+ * 	  descriptor's buffer, and the frame size is written in the same
+ * 	  SPI transfer.
  * @param desc - the device descriptor
  * @param port - the port for the frame to be transmitted on.
- * @param eth_buff - the frame to be transmitted.
+ * @param sg - the segments of the frame, starting with the ethernet header.
+ * @param nb_sg - the number of segments, at most ADIN1110_MAX_SG.
  * @return 0 in case of success, negative error code otherwise
  */
-int adin1110_write_fifo(struct adin1110_desc *desc, uint32_t port,
-			struct adin1110_eth_buff *eth_buff)
+int adin1110_write_fifo_sg(struct adin1110_desc *desc, uint32_t port,
+			   const struct adin1110_sg *sg, uint32_t nb_sg)
 {
+	struct no_os_spi_msg *msgs = desc->sg_msgs;
 	uint32_t header_len = ADIN1110_WR_HEADER_LEN;
-	uint32_t frame_offset;
 	uint32_t padding = 0;
 	uint32_t padded_len;
 	uint32_t round_len;
 	uint32_t tx_space;
+	uint32_t len = 0;
+	uint32_t nb_msgs;
+	uint32_t i;
 	int ret;
 
-	struct no_os_spi_msg xfer = {
-		.tx_buff = desc->data,
-		.cs_change = 1,
-	};
-
-	if (port >= driver_data[desc->chip_type].num_ports)
+	if (port >= driver_data[desc->chip_type].num_ports ||
+	    !nb_sg || nb_sg > ADIN1110_MAX_SG)
 		return -EINVAL;
 
+	for (i = 0; i < nb_sg; i++)
+		len += sg[i].len;
+
 	/* The minimum frame length is 64 bytes */
-	if (eth_buff->len + ADIN1110_FCS_LEN < 64)
-		padding = 64 - (eth_buff->len + ADIN1110_FCS_LEN);
+	if (len + ADIN1110_FCS_LEN < 64)
+		padding = 64 - (len + ADIN1110_FCS_LEN);
 
-	padded_len = eth_buff->len + padding + ADIN1110_FRAME_HEADER_LEN;
+	padded_len = len + padding + ADIN1110_FRAME_HEADER_LEN;
 
 	/** Align the frame length to 4 bytes */
 	round_len = no_os_align(padded_len, 4);
@@ -525,9 +591,8 @@ int adin1110_write_fifo(struct adin1110_desc *desc, uint32_t port,
 	if (padded_len > 2 * (tx_space - ADIN1110_FRAME_HEADER_LEN))
 		return -EAGAIN;
 
-	ret = adin1110_reg_write(desc, ADIN1110_TX_FSIZE_REG, padded_len);
-	if (ret)
-		return ret;
+	adin1110_reg_write_msg(desc, ADIN1110_TX_FSIZE_REG, padded_len,
+			       &desc->data[ADIN1110_SG_REG_OFF], &msgs[0]);
 
 	no_os_put_unaligned_be16(ADIN1110_TX_REG, &desc->data[0]);
 	desc->data[0] |= ADIN1110_SPI_CD | ADIN1110_SPI_RW;
@@ -539,60 +604,163 @@ int adin1110_write_fifo(struct adin1110_desc *desc, uint32_t port,
 
 	/* Set the port on which to send the frame */
 	no_os_put_unaligned_be16(port, &desc->data[header_len]);
-	xfer.bytes_number = round_len + header_len;
-	frame_offset = header_len + ADIN1110_FRAME_HEADER_LEN;
+	msgs[1] = (struct no_os_spi_msg) {
+		.tx_buff = desc->data,
+		.bytes_number = header_len + ADIN1110_FRAME_HEADER_LEN,
+	};
+	nb_msgs = 2;
 
-	memcpy(&desc->data[frame_offset], (void *)&eth_buff->mac_dest[0],
-	       ADIN1110_ETH_HDR_LEN);
-	frame_offset += ADIN1110_ETH_HDR_LEN;
-	memcpy(&desc->data[frame_offset], eth_buff->payload,
-	       eth_buff->len - ADIN1110_ETH_HDR_LEN);
+	for (i = 0; i < nb_sg; i++) {
+		if (!sg[i].len)
+			continue;
 
-	return no_os_spi_transfer(desc->comm_desc, &xfer, 1);
+		msgs[nb_msgs++] = (struct no_os_spi_msg) {
+			.tx_buff = sg[i].buf,
+			.bytes_number = sg[i].len,
+		};
+	}
+
+	/* The padding and the 4 byte alignment are sent as 0 */
+	if (round_len > len + ADIN1110_FRAME_HEADER_LEN) {
+		memset(&desc->data[ADIN1110_SG_PAD_OFF], 0, ADIN1110_SG_PAD_LEN);
+		msgs[nb_msgs++] = (struct no_os_spi_msg) {
+			.tx_buff = &desc->data[ADIN1110_SG_PAD_OFF],
+			.bytes_number = round_len - len -
+					ADIN1110_FRAME_HEADER_LEN,
+		};
+	}
+	msgs[nb_msgs - 1].cs_change = 1;
+
+	return no_os_spi_transfer(desc->comm_desc, msgs, nb_msgs);
 }
 
 /**
- * @brief Read a frame from the RX FIFO.
+ * @brief Write a frame to the TX FIFO.
  * @param desc - the device descriptor
- * @param port - the port from which the frame shall be received.
- * @param eth_buff - the frame to be received.
+ * @param port - the port for the frame to be transmitted on.
+ * @param eth_buff - the frame to be transmitted.
  * @return 0 in case of success, negative error code otherwise
  */
-int adin1110_read_fifo(struct adin1110_desc *desc, uint32_t port,
-		       struct adin1110_eth_buff *eth_buff)
+int adin1110_write_fifo(struct adin1110_desc *desc, uint32_t port,
+			struct adin1110_eth_buff *eth_buff)
 {
-	uint32_t field_offset = ADIN1110_RD_HEADER_LEN;
-	uint32_t payload_length;
-	uint32_t fifo_fsize_reg;
-	uint32_t rounded_len;
-	uint32_t frame_size;
-	uint32_t fifo_reg;
-	struct no_os_spi_msg xfer = {
-		.tx_buff = desc->data,
-		.rx_buff = desc->data,
-		.cs_change = 1,
+	struct adin1110_sg sg[2] = {
+		{
+			.buf = eth_buff->mac_dest,
+			.len = ADIN1110_ETH_HDR_LEN,
+		},
+		{
+			.buf = eth_buff->payload,
+			.len = eth_buff->len - ADIN1110_ETH_HDR_LEN,
+		},
 	};
-	int ret;
 
+	return adin1110_write_fifo_sg(desc, port, sg, NO_OS_ARRAY_SIZE(sg));
+}
+
+/**
+ * @brief Get the FIFO registers of a port.
+ * @param desc - the device descriptor
+ * @param port - the port.
+ * @param fifo_reg - the RX FIFO register.
+ * @param fifo_fsize_reg - the RX frame size register.
+ * @return 0 in case of success, negative error code otherwise
+ */
+static int adin1110_rx_regs(struct adin1110_desc *desc, uint32_t port,
+			    uint16_t *fifo_reg, uint16_t *fifo_fsize_reg)
+{
 	if (port >= driver_data[desc->chip_type].num_ports)
 		return -EINVAL;
 
 	if (!port) {
-		fifo_reg = ADIN1110_RX_REG;
-		fifo_fsize_reg = ADIN1110_RX_FSIZE_REG;
+		*fifo_reg = ADIN1110_RX_REG;
+		*fifo_fsize_reg = ADIN1110_RX_FSIZE_REG;
 	} else {
-		fifo_reg = ADIN2111_RX_P2_REG;
-		fifo_fsize_reg = ADIN2111_RX_P2_FSIZE_REG;
+		*fifo_reg = ADIN2111_RX_P2_REG;
+		*fifo_fsize_reg = ADIN2111_RX_P2_FSIZE_REG;
 	}
 
+	return 0;
+}
+
+/**
+ * @brief Get the frame length from the value of the RX frame size register.
+ * @param frame_size - the RX frame size register's value.
+ * @return the frame length, 0 if there is no frame.
+ */
+static uint32_t adin1110_frame_len(uint32_t frame_size)
+{
+	if (frame_size < ADIN1110_FRAME_HEADER_LEN + ADIN1110_FEC_LEN)
+		return 0;
+
+	return frame_size - ADIN1110_FRAME_HEADER_LEN;
+}
+
+/**
+ * @brief Get the length of the next frame in the RX FIFO.
+ * @param desc - the device descriptor
+ * @param port - the port from which the frame shall be received.
+ * @param len - the frame length, 0 if there is no frame.
+ * @return 0 in case of success, negative error code otherwise
+ */
+int adin1110_read_fifo_len(struct adin1110_desc *desc, uint32_t port,
+			   uint32_t *len)
+{
+	uint16_t fifo_fsize_reg;
+	uint32_t frame_size;
+	uint16_t fifo_reg;
+	int ret;
+
+	ret = adin1110_rx_regs(desc, port, &fifo_reg, &fifo_fsize_reg);
+	if (ret)
+		return ret;
+
 	ret = adin1110_reg_read(desc, fifo_fsize_reg, &frame_size);
 	if (ret)
 		return ret;
 
-	if (frame_size < ADIN1110_FRAME_HEADER_LEN + ADIN1110_FEC_LEN)
-		return 0;
+	*len = adin1110_frame_len(frame_size);
+
+	return 0;
+}
+
+/**
+ * @brief Read a frame from the RX FIFO straight into a list of segments. The
+ * 	  frame size register is read again in the same SPI transfer, so that
+ * 	  consecutive frames can be drained with a single transfer per frame.
+ * @param desc - the device descriptor
+ * @param port - the port from which the frame shall be received.
+ * @param len - the frame length, as returned by adin1110_read_fifo_len() or
+ * 		by the previous call.
+ * @param sg - the segments where the frame is stored, with room for len bytes.
+ * @param nb_sg - the number of segments, at most ADIN1110_MAX_SG.
+ * @param next_len - the length of the next frame, 0 if there is no frame. May
+ * 		     be NULL, in which case the frame size register isn't read.
+ * @return 0 in case of success, negative error code otherwise
+ */
+int adin1110_read_fifo_sg(struct adin1110_desc *desc, uint32_t port,
+			  uint32_t len, const struct adin1110_sg *sg,
+			  uint32_t nb_sg, uint32_t *next_len)
+{
+	struct no_os_spi_msg *msgs = desc->sg_msgs;
+	uint32_t field_offset = ADIN1110_RD_HEADER_LEN;
+	uint32_t fsize_offset = 0;
+	uint32_t rounded_len;
+	uint32_t frame_size;
+	uint16_t fifo_fsize_reg;
+	uint16_t fifo_reg;
+	uint32_t nb_msgs;
+	uint32_t left = len;
+	uint32_t i;
+	int ret;
+
+	if (!len || nb_sg > ADIN1110_MAX_SG)
+		return -EINVAL;
+
+	ret = adin1110_rx_regs(desc, port, &fifo_reg, &fifo_fsize_reg);
+	if (ret)
+		return ret;
 
-	memset(desc->data, 0, ADIN1110_BUFF_LEN);
 	no_os_put_unaligned_be16(fifo_reg, &desc->data[0]);
 	desc->data[0] |= ADIN1110_SPI_CD;
 	desc->data[2] = 0x0;
@@ -605,23 +773,92 @@ int adin1110_read_fifo(struct adin1110_desc *desc, uint32_t port,
 
 	/* Set the port from which to receive the frame */
 	no_os_put_unaligned_be16(port, &desc->data[field_offset]);
-	rounded_len = no_os_align(frame_size, 4);
+	msgs[0] = (struct no_os_spi_msg) {
+		.tx_buff = desc->data,
+		.rx_buff = desc->data,
+		.bytes_number = field_offset + ADIN1110_FRAME_HEADER_LEN,
+	};
+	nb_msgs = 1;
+
+	for (i = 0; i < nb_sg && left; i++) {
+		if (!sg[i].len)
+			continue;
+
+		msgs[nb_msgs] = (struct no_os_spi_msg) {
+			.rx_buff = sg[i].buf,
+			.bytes_number = no_os_min(sg[i].len, left),
+		};
+		left -= msgs[nb_msgs].bytes_number;
+		nb_msgs++;
+	}
+
+	if (left)
+		return -EINVAL;
 
 	/* Can only read multiples of 4 bytes (the last bytes might be 0) */
-	xfer.bytes_number = rounded_len + field_offset;
-	field_offset += ADIN1110_FRAME_HEADER_LEN;
+	rounded_len = no_os_align(len + ADIN1110_FRAME_HEADER_LEN, 4);
+	if (rounded_len > len + ADIN1110_FRAME_HEADER_LEN) {
+		msgs[nb_msgs++] = (struct no_os_spi_msg) {
+			.rx_buff = &desc->data[ADIN1110_SG_PAD_OFF],
+			.bytes_number = rounded_len - len -
+					ADIN1110_FRAME_HEADER_LEN,
+		};
+	}
+	msgs[nb_msgs - 1].cs_change = 1;
+
+	if (next_len)
+		fsize_offset = adin1110_reg_read_msg(desc, fifo_fsize_reg,
+				&desc->data[ADIN1110_SG_REG_OFF],
+				&msgs[nb_msgs++]);
 
 	/** Burst read the whole frame */
-	ret = no_os_spi_transfer(desc->comm_desc, &xfer, 1);
+	ret = no_os_spi_transfer(desc->comm_desc, msgs, nb_msgs);
+	if (ret)
+		return ret;
+
+	if (!next_len)
+		return 0;
+
+	ret = adin1110_reg_read_val(desc, &desc->data[ADIN1110_SG_REG_OFF],
+				    fsize_offset, &frame_size);
+	if (ret)
+		return ret;
+
+	*next_len = adin1110_frame_len(frame_size);
+
+	return 0;
+}
+
+/**
+ * @brief Read a frame from the RX FIFO.
+ * @param desc - the device descriptor
+ * @param port - the port from which the frame shall be received.
+ * @param eth_buff - the frame to be received.
+ * @return 0 in case of success, negative error code otherwise
+ */
+int adin1110_read_fifo(struct adin1110_desc *desc, uint32_t port,
+		       struct adin1110_eth_buff *eth_buff)
+{
+	struct adin1110_sg sg[2];
+	uint32_t len;
+	int ret;
+
+	ret = adin1110_read_fifo_len(desc, port, &len);
+	if (ret || !len)
+		return ret;
+
+	/* mac_dest, mac_source and ethertype are contiguous */
+	sg[0].buf = eth_buff->mac_dest;
+	sg[0].len = no_os_min(len, (uint32_t)ADIN1110_ETH_HDR_LEN);
+	sg[1].buf = eth_buff->payload;
+	sg[1].len = len - sg[0].len;
+
+	ret = adin1110_read_fifo_sg(desc, port, len, sg, NO_OS_ARRAY_SIZE(sg),
+				    NULL);
 	if (ret)
 		return ret;
 
-	payload_length = frame_size - ADIN1110_FRAME_HEADER_LEN - ADIN1110_ETH_HDR_LEN;
-	memcpy((void *)&eth_buff->mac_dest[0], &desc->data[field_offset],
-	       ADIN1110_ETH_HDR_LEN);
-	field_offset += ADIN1110_ETH_HDR_LEN;
-	memcpy(eth_buff->payload, &desc->data[field_offset], payload_length);
-	eth_buff->len = frame_size - ADIN1110_FRAME_HEADER_LEN;
+	eth_buff->len = len;
 
 	return 0;
 }
@@ -185,6 +185,9 @@
 #define ADIN_MAC_P2_ADDR_SLOT			3
 #define ADIN_MAC_FDB_ADDR_SLOT			4
 
+/* Maximum number of segments of a frame in a scatter/gather transfer */
+#define ADIN1110_MAX_SG				8
+
 /**
  * @brief The chips supported by this driver.
  */
@@ -203,6 +206,8 @@ struct adin1110_desc {
 	uint8_t data[ADIN1110_BUFF_LEN];
 	struct no_os_gpio_desc *reset_gpio;
 	bool append_crc;
+	/* SPI messages of the scatter/gather FIFO transfers */
+	struct no_os_spi_msg sg_msgs[ADIN1110_MAX_SG + 4];
 };
 
 /**
@@ -227,6 +232,14 @@ struct adin1110_eth_buff {
 	uint8_t *payload;
 };
 
+/**
+ * @brief Segment of a frame, for scatter/gather FIFO transfers.
+ */
+struct adin1110_sg {
+	uint8_t *buf;
+	uint32_t len;
+};
+
 /* Reset both the MAC and PHY. */
 int adin1110_sw_reset(struct adin1110_desc *);
 
@@ -247,6 +260,17 @@ int adin1110_write_fifo(struct adin1110_desc *, uint32_t,
 int adin1110_read_fifo(struct adin1110_desc *, uint32_t,
 		       struct adin1110_eth_buff *);
 
+/* Get the length of the next frame in the RX FIFO */
+int adin1110_read_fifo_len(struct adin1110_desc *, uint32_t, uint32_t *);
+
+/* Read a frame from the RX FIFO straight into a list of segments */
+int adin1110_read_fifo_sg(struct adin1110_desc *, uint32_t, uint32_t,
+			  const struct adin1110_sg *, uint32_t, uint32_t *);
+
+/* Write a frame gathered from a list of segments to the TX FIFO */
+int adin1110_write_fifo_sg(struct adin1110_desc *, uint32_t,
+			   const struct adin1110_sg *, uint32_t);
+
 /* Write a PHY register using clause 22 */
 int adin1110_mdio_write(struct adin1110_desc *, uint32_t, uint32_t, uint16_t);
 
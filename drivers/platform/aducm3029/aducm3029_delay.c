@@ -130,3 +130,24 @@ void no_os_mdelay(uint32_t msecs)
 			return ;
 	start_and_wait(ms_timer, msecs);
 }
+
+/**
+ * @brief Get a monotonic timestamp in nanoseconds.
+ *
+ * Read from the free running microsecond timer also used by no_os_udelay(),
+ * which is started on the first call. The timestamp wraps with the 32 bit
+ * timer counter, about every 71 minutes.
+ * @return Nanoseconds from the first use of the microsecond timer.
+ */
+uint64_t no_os_get_time_ns(void)
+{
+	uint32_t count;
+
+	if (!us_timer)
+		if (!initialize_timer(&us_timer, 1))
+			return 0;
+
+	no_os_timer_counter_get(dummy_timer, &count);
+
+	return (uint64_t)count * 1000;
+}
@@ -71,3 +71,40 @@ int32_t no_os_axi_io_write(uint32_t base, uint32_t offset, uint32_t data)
 	return 0;
 }
 
+/**
+ * @brief AXI IO Altera specific block read function.
+ * @param base - Base address
+ * @param offset - Address offset of the first register
+ * @param data - buffer where the returned data is stored
+ * @param nb_regs - number of consecutive 32-bit registers to be read
+ * @return 0 in case of success, -1 otherwise.
+ */
+int32_t no_os_axi_io_read_block(uint32_t base, uint32_t offset,
+				uint32_t *data, uint32_t nb_regs)
+{
+	uint32_t i;
+
+	for (i = 0; i < nb_regs; i++)
+		data[i] = IORD_32DIRECT(base, offset + i * 4);
+
+	return 0;
+}
+
+/**
+ * @brief AXI IO Altera specific block write function.
+ * @param base - Base address
+ * @param offset - Address offset of the first register
+ * @param data - data to be written
+ * @param nb_regs - number of consecutive 32-bit registers to be written
+ * @return 0 in case of success, -1 otherwise.
+ */
+int32_t no_os_axi_io_write_block(uint32_t base, uint32_t offset,
+				 const uint32_t *data, uint32_t nb_regs)
+{
+	uint32_t i;
+
+	for (i = 0; i < nb_regs; i++)
+		IOWR_32DIRECT(base, offset + i * 4, data[i]);
+
+	return 0;
+}
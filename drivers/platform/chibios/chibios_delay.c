@@ -63,3 +63,13 @@ struct no_os_time no_os_get_time(void)
 
 	return t;
 }
+
+/**
+ * @brief Get a monotonic timestamp in nanoseconds.
+ * @return Nanoseconds from system start, with system tick resolution.
+ */
+uint64_t no_os_get_time_ns(void)
+{
+	return (uint64_t)chVTGetSystemTimeX() * 1000000000 /
+	       CH_CFG_ST_FREQUENCY;
+}
@@ -78,3 +78,12 @@ struct no_os_time no_os_get_time(void)
 
 	return t;
 }
+
+/**
+ * @brief Get a monotonic timestamp in nanoseconds.
+ * @return Nanoseconds from scheduler start, with RTOS tick resolution.
+ */
+uint64_t no_os_get_time_ns(void)
+{
+	return (uint64_t)xTaskGetTickCount() * 1000000000 / configTICK_RATE_HZ;
+}
@@ -74,3 +74,41 @@ int32_t no_os_axi_io_write(uint32_t base, uint32_t offset, uint32_t data)
 
 	return 0;
 }
+
+/**
+ * @brief AXI IO generic block read function.
+ * @param base - Base address
+ * @param offset - Address offset of the first register
+ * @param data - buffer where the returned data is stored
+ * @param nb_regs - number of consecutive 32-bit registers to be read
+ * @return 0 in case of success, -1 otherwise.
+ */
+int32_t no_os_axi_io_read_block(uint32_t base, uint32_t offset,
+				uint32_t *data, uint32_t nb_regs)
+{
+	NO_OS_UNUSED_PARAM(base);
+	NO_OS_UNUSED_PARAM(offset);
+	NO_OS_UNUSED_PARAM(data);
+	NO_OS_UNUSED_PARAM(nb_regs);
+
+	return 0;
+}
+
+/**
+ * @brief AXI IO generic block write function.
+ * @param base - Base address
+ * @param offset - Address offset of the first register
+ * @param data - data to be written.
+ * @param nb_regs - number of consecutive 32-bit registers to be written
+ * @return 0 in case of success, -1 otherwise.
+ */
+int32_t no_os_axi_io_write_block(uint32_t base, uint32_t offset,
+				 const uint32_t *data, uint32_t nb_regs)
+{
+	NO_OS_UNUSED_PARAM(base);
+	NO_OS_UNUSED_PARAM(offset);
+	NO_OS_UNUSED_PARAM(data);
+	NO_OS_UNUSED_PARAM(nb_regs);
+
+	return 0;
+}
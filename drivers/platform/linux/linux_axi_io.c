@@ -36,123 +36,267 @@
 /******************************************************************************/
 #include <fcntl.h>
 #include <inttypes.h>
+#include <pthread.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <sys/mman.h>
 #include "no_os_error.h"
+#include "no_os_util.h"
 #include "no_os_axi_io.h"
 
+/******************************************************************************/
+/********************** Macros and Constants Definitions **********************/
+/******************************************************************************/
+
+/**
+ * Maximum number of UIO regions/devmem windows kept mapped at once. Accesses
+ * to further regions map and unmap the region on each call.
+ */
+#define LINUX_AXI_IO_MAX_MAPS	32
+
+/******************************************************************************/
+/*************************** Types Declarations *******************************/
+/******************************************************************************/
+
+/**
+ * @struct linux_axi_io_map
+ * @brief Persistent mapping of one UIO region or /dev/mem window.
+ */
+struct linux_axi_io_map {
+	/** UIO index (/dev/uioX) or physical base address */
+	uint32_t base;
+	/** Offset of base inside the mapping (non-zero only for devmem) */
+	uint32_t delta;
+	/** Size of the mapping */
+	size_t size;
+	/** File descriptor backing the mapping */
+	int fd;
+	/** Mapped address */
+	volatile uint8_t *addr;
+};
+
+/******************************************************************************/
+/************************ Variables Definitions *******************************/
+/******************************************************************************/
+
+/*
+ * Entries are only ever appended and stay mapped until exit, so a register
+ * pointer handed out by linux_axi_io_get() remains valid while other threads
+ * add mappings. The lock serializes lookups against appends.
+ */
+static struct linux_axi_io_map axi_io_maps[LINUX_AXI_IO_MAX_MAPS];
+static uint32_t axi_io_maps_cnt;
+static bool axi_io_cleanup_registered;
+static pthread_mutex_t axi_io_maps_lock = PTHREAD_MUTEX_INITIALIZER;
+
 /******************************************************************************/
 /************************ Functions Definitions *******************************/
 /******************************************************************************/
 
 /**
- * @brief AXI IO through UIO read/write function.
+ * @brief Unmap all the cached regions. Registered with atexit().
+ * @return None.
+ */
+static void linux_axi_io_unmap_all(void)
+{
+	uint32_t i;
+
+	pthread_mutex_lock(&axi_io_maps_lock);
+	for (i = 0; i < axi_io_maps_cnt; i++) {
+		munmap((void *)axi_io_maps[i].addr, axi_io_maps[i].size);
+		close(axi_io_maps[i].fd);
+	}
+
+	axi_io_maps_cnt = 0;
+	pthread_mutex_unlock(&axi_io_maps_lock);
+}
+
+#ifndef DEVMEM
+/**
+ * @brief Get the size of the first memory map of an UIO device.
  * @param base - UIO index (/dev/uioX).
- * @param offset - Address offset.
- * @param read - Location where read data will be stored.
- * @param write - Data to be written.
+ * @return Size of the map in bytes, 0 if it can't be determined.
+ */
+static size_t uio_get_map_size(uint32_t base)
+{
+	char buf[64];
+	FILE *stream;
+	unsigned long size = 0;
+
+	sprintf(buf, "/sys/class/uio/uio%"PRIu32"/maps/map0/size", base);
+
+	stream = fopen(buf, "r");
+	if (!stream)
+		return 0;
+
+	if (fscanf(stream, "%lx", &size) != 1)
+		size = 0;
+
+	fclose(stream);
+
+	return size;
+}
+#endif
+
+/**
+ * @brief Map a region so that it covers an access.
+ * @param map - Map entry to be initialized. Its fd must be valid.
+ * @param len - Minimum number of bytes, starting from base, to be mapped.
+ * @return 0 in case of success, -1 otherwise.
+ */
+static int32_t linux_axi_io_do_map(struct linux_axi_io_map *map, size_t len)
+{
+	long page_size = sysconf(_SC_PAGESIZE);
+	size_t size;
+	off_t phys = 0;
+	void *addr;
+
+#ifdef DEVMEM
+	phys = map->base & ~((uint32_t)page_size - 1);
+	map->delta = map->base - phys;
+#else
+	map->delta = 0;
+	size = uio_get_map_size(map->base);
+	if (size >= len)
+		len = size;
+#endif
+	size = NO_OS_DIV_ROUND_UP(len + map->delta, page_size) * page_size;
+
+	addr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, map->fd,
+		    phys);
+	if (addr == MAP_FAILED) {
+		printf("%s: mmap() failed\n\r", __func__);
+		return -1;
+	}
+
+	map->addr = addr;
+	map->size = size;
+
+	return 0;
+}
+
+/**
+ * @brief Open and map base, covering at least len bytes.
+ * @param map - Map entry to be initialized.
+ * @param base - UIO index (/dev/uioX)/base address.
+ * @param len - Minimum number of bytes, starting from base, to be mapped.
  * @return 0 in case of success, -1 otherwise.
  */
-static int32_t uio_read_write(uint32_t base, uint32_t offset, uint32_t *read,
-			      uint32_t *write)
+static int32_t linux_axi_io_open(struct linux_axi_io_map *map, uint32_t base,
+				 size_t len)
 {
 	char buf[32];
-	int ret;
-	int uio_fd;
-	int32_t status = 0;
-	void *uio_addr;
+	int fd;
 
+#ifdef DEVMEM
+	sprintf(buf, "/dev/mem");
+	fd = open(buf, O_RDWR | O_SYNC);
+#else
 	sprintf(buf, "/dev/uio%"PRIu32"", base);
-
-	uio_fd = open(buf, O_RDWR);
-	if (uio_fd < 0) {
+	fd = open(buf, O_RDWR);
+#endif
+	if (fd < 0) {
 		printf("%s: Can't open %s\n\r", __func__, buf);
 		return -1;
 	}
 
-	uio_addr = mmap(NULL,
-			offset + sizeof(*read),
-			PROT_READ|PROT_WRITE,
-			MAP_SHARED,
-			uio_fd,
-			0);
-	if (uio_addr == MAP_FAILED) {
-		printf("%s: mmap() failed\n\r", __func__);
-		status = -1;
-		goto close;
+	map->base = base;
+	map->fd = fd;
+	map->addr = NULL;
+	map->size = 0;
+	if (linux_axi_io_do_map(map, len)) {
+		close(fd);
+		return -1;
 	}
 
-	if (read)
-		*read = *(uint32_t *)((uintptr_t)uio_addr + offset);
-	if (write)
-		*(uint32_t *)((uintptr_t)uio_addr + offset) = *write;
+	return 0;
+}
 
-	ret = munmap(uio_addr, offset + sizeof(*read));
-	if (ret < 0) {
-		printf("%s: munmap() failed\n\r", __func__);
-		status = -1;
-	}
+/**
+ * @brief Add a mapping of base covering at least len bytes. A region that
+ *        needs to grow gets a new, larger entry; the smaller one is kept
+ *        mapped because other threads may still access it.
+ * @param base - UIO index (/dev/uioX)/base address.
+ * @param len - Minimum number of bytes, starting from base, to be mapped.
+ * @return The new entry, NULL if the cache is full or in case of failure.
+ */
+static struct linux_axi_io_map *linux_axi_io_add(uint32_t base, size_t len)
+{
+	struct linux_axi_io_map *map;
+
+	if (axi_io_maps_cnt == LINUX_AXI_IO_MAX_MAPS)
+		return NULL;
+
+	map = &axi_io_maps[axi_io_maps_cnt];
+	if (linux_axi_io_open(map, base, len))
+		return NULL;
 
-close:
-	ret = close(uio_fd);
-	if (ret < 0) {
-		printf("%s: Can't close %s\n\r", __func__, buf);
-		status = -1;
+	axi_io_maps_cnt++;
+	if (!axi_io_cleanup_registered) {
+		atexit(linux_axi_io_unmap_all);
+		axi_io_cleanup_registered = true;
 	}
 
-	return status;
+	return map;
 }
 
-#ifdef DEVMEM
 /**
- * @brief AXI IO through devmem read/write function.
- * @param base - Base address.
+ * @brief Get the cached mapping covering [base + offset, base + offset + len),
+ *        creating it on first use. When the cache is full, the region is
+ *        mapped in tmp instead and must be released with linux_axi_io_put().
+ * @param base - UIO index (/dev/uioX)/base address.
  * @param offset - Address offset.
- * @param read - Location where read data will be stored.
- * @param write - Data to be written.
- * @return 0 in case of success, -1 otherwise.
+ * @param len - Access length in bytes.
+ * @param tmp - Uncached mapping, used only when the cache is full.
+ * @return Pointer to the mapped register, NULL in case of failure.
  */
-static int32_t devmem_read_write(uint32_t base, uint32_t offset, uint32_t *read,
-				 uint32_t *write)
+static volatile uint32_t *linux_axi_io_get(uint32_t base, uint32_t offset,
+		size_t len, struct linux_axi_io_map *tmp)
 {
-	char command[64];
-	char answer[64];
-	FILE *stream;
-	int32_t ret;
-
-	if (write)
-		ret = snprintf(command, sizeof(command),
-			       "busybox devmem 0x%x w 0x%x", base + offset, *write);
-	else if (read)
-		ret = snprintf(command, sizeof(command),
-			       "busybox devmem 0x%x", base + offset);
-	else
-		return -1;
+	struct linux_axi_io_map *map = NULL;
+	size_t end = (size_t)offset + len;
+	uint32_t i;
 
-	if (ret < 0 || ret >= (int32_t) sizeof(command))
-		return -1;
+	tmp->addr = NULL;
 
-	stream = popen(command, "r");
-	if (stream == NULL)
-		return -1;
+	pthread_mutex_lock(&axi_io_maps_lock);
+	for (i = 0; i < axi_io_maps_cnt; i++) {
+		if (axi_io_maps[i].base == base &&
+		    end + axi_io_maps[i].delta <= axi_io_maps[i].size) {
+			map = &axi_io_maps[i];
+			break;
+		}
+	}
 
-	if (!(fgets(answer, sizeof(answer), stream))) {
-		ret = -1;
-		goto close;
+	if (!map)
+		map = linux_axi_io_add(base, end);
+	pthread_mutex_unlock(&axi_io_maps_lock);
+
+	if (!map) {
+		if (linux_axi_io_open(tmp, base, end))
+			return NULL;
+		map = tmp;
 	}
 
-	if (read)
-		*read = strtol(answer, NULL, 0);
+	return (volatile uint32_t *)(map->addr + map->delta + offset);
+}
 
-	ret = 0;
-close:
-	pclose(stream);
+/**
+ * @brief Release the uncached mapping set up by linux_axi_io_get(), if any.
+ * @param tmp - Uncached mapping.
+ * @return None.
+ */
+static void linux_axi_io_put(struct linux_axi_io_map *tmp)
+{
+	if (!tmp->addr)
+		return;
 
-	return ret;
+	munmap((void *)tmp->addr, tmp->size);
+	close(tmp->fd);
 }
-#endif //DEVMEM
+
 /**
  * @brief AXI IO through UIO/devmem read function.
  * @param base - UIO index (/dev/uioX)/base address.
@@ -162,25 +306,89 @@ close:
  */
 int32_t no_os_axi_io_read(uint32_t base, uint32_t offset, uint32_t *data)
 {
-#ifdef DEVMEM
-	return devmem_read_write(base, offset, data, NULL);
-#else
-	return uio_read_write(base, offset, data, NULL);
-#endif
+	struct linux_axi_io_map tmp;
+	volatile uint32_t *reg;
+
+	reg = linux_axi_io_get(base, offset, sizeof(*data), &tmp);
+	if (!reg)
+		return -1;
+
+	*data = *reg;
+	linux_axi_io_put(&tmp);
+
+	return 0;
 }
 
 /**
- * @brief AXI IO through UIO specific write function.
- * @param base - UIO index (/dev/uioX).
+ * @brief AXI IO through UIO/devmem write function.
+ * @param base - UIO index (/dev/uioX)/base address.
  * @param offset - Address offset.
  * @param data - Data to be written.
  * @return 0 in case of success, -1 otherwise.
  */
 int32_t no_os_axi_io_write(uint32_t base, uint32_t offset, uint32_t data)
 {
-#ifdef DEVMEM
-	return devmem_read_write(base, offset, NULL, &data);
-#else
-	return uio_read_write(base, offset, NULL, &data);
-#endif
+	struct linux_axi_io_map tmp;
+	volatile uint32_t *reg;
+
+	reg = linux_axi_io_get(base, offset, sizeof(data), &tmp);
+	if (!reg)
+		return -1;
+
+	*reg = data;
+	linux_axi_io_put(&tmp);
+
+	return 0;
+}
+
+/**
+ * @brief AXI IO through UIO/devmem block read function.
+ * @param base - UIO index (/dev/uioX)/base address.
+ * @param offset - Address offset of the first register.
+ * @param data - Location where the read data will be stored.
+ * @param nb_regs - Number of consecutive 32-bit registers to be read.
+ * @return 0 in case of success, -1 otherwise.
+ */
+int32_t no_os_axi_io_read_block(uint32_t base, uint32_t offset,
+				uint32_t *data, uint32_t nb_regs)
+{
+	struct linux_axi_io_map tmp;
+	volatile uint32_t *reg;
+	uint32_t i;
+
+	reg = linux_axi_io_get(base, offset, nb_regs * sizeof(*data), &tmp);
+	if (!reg)
+		return -1;
+
+	for (i = 0; i < nb_regs; i++)
+		data[i] = reg[i];
+	linux_axi_io_put(&tmp);
+
+	return 0;
+}
+
+/**
+ * @brief AXI IO through UIO/devmem block write function.
+ * @param base - UIO index (/dev/uioX)/base address.
+ * @param offset - Address offset of the first register.
+ * @param data - Data to be written.
+ * @param nb_regs - Number of consecutive 32-bit registers to be written.
+ * @return 0 in case of success, -1 otherwise.
+ */
+int32_t no_os_axi_io_write_block(uint32_t base, uint32_t offset,
+				 const uint32_t *data, uint32_t nb_regs)
+{
+	struct linux_axi_io_map tmp;
+	volatile uint32_t *reg;
+	uint32_t i;
+
+	reg = linux_axi_io_get(base, offset, nb_regs * sizeof(*data), &tmp);
+	if (!reg)
+		return -1;
+
+	for (i = 0; i < nb_regs; i++)
+		reg[i] = data[i];
+	linux_axi_io_put(&tmp);
+
+	return 0;
 }
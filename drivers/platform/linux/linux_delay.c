@@ -36,7 +36,9 @@
 /******************************************************************************/
 
 #include <stdint.h>
+#include <time.h>
 #include <unistd.h>
+#include "no_os_delay.h"
 
 /******************************************************************************/
 /************************ Functions Definitions *******************************/
@@ -61,3 +63,34 @@ void no_os_mdelay(uint32_t msecs)
 {
 	usleep(msecs * 1000);
 }
+
+/**
+ * @brief Get a monotonic timestamp in nanoseconds.
+ *
+ * Uses CLOCK_MONOTONIC, the same clock the kernel uses to timestamp GPIO edge
+ * events and IIO buffers, through the vDSO, so no system call is made.
+ * @return The timestamp.
+ */
+uint64_t no_os_get_time_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/**
+ * @brief Get current time.
+ * @return Current time structure from the monotonic clock.
+ */
+struct no_os_time no_os_get_time(void)
+{
+	struct no_os_time t;
+	uint64_t ns = no_os_get_time_ns();
+
+	t.s = ns / 1000000000;
+	t.us = (ns % 1000000000) / 1000;
+
+	return t;
+}
@@ -39,13 +39,16 @@
 #include "no_os_gpio.h"
 #include "no_os_delay.h"
 #include "no_os_alloc.h"
+#include "linux_gpio.h"
 
 #include <errno.h>
 #include <fcntl.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <sys/ioctl.h>
+#include <linux/gpio.h>
 
 /******************************************************************************/
 /*************************** Types Declarations *******************************/
@@ -62,6 +65,30 @@ struct linux_gpio_desc {
 	int value_fd;
 };
 
+/**
+ * @struct linux_gpio_cdev_desc
+ * @brief Linux GPIO character device descriptor
+ */
+struct linux_gpio_cdev_desc {
+	/** /dev/gpiochip"port" file descriptor */
+	int chip_fd;
+	/** Line request file descriptor */
+	int req_fd;
+	/** Bias flags derived from the pull configuration */
+	uint64_t bias;
+};
+
+/**
+ * @struct linux_gpio_lines
+ * @brief Set of lines of a GPIO chip requested as a single handle
+ */
+struct linux_gpio_lines {
+	/** Line request file descriptor */
+	int req_fd;
+	/** Number of lines in the request */
+	uint32_t nb_lines;
+};
+
 /******************************************************************************/
 /************************ Functions Definitions *******************************/
 /******************************************************************************/
@@ -364,6 +391,450 @@ int32_t linux_gpio_get_direction(struct no_os_gpio_desc *desc,
 	return 0;
 }
 
+/**
+ * @brief Open a GPIO character device.
+ * @param chip - GPIO chip index, the device is /dev/gpiochip"chip".
+ * @return The file descriptor in case of success, negative error code
+ *	   otherwise.
+ */
+int linux_gpio_chip_open(uint32_t chip)
+{
+	char path[32];
+	int fd;
+
+	sprintf(path, "/dev/gpiochip%u", chip);
+	fd = open(path, O_RDWR | O_CLOEXEC);
+	if (fd < 0)
+		return -errno;
+
+	return fd;
+}
+
+/**
+ * @brief Request lines of a GPIO chip as a single handle.
+ * @param chip_fd - GPIO chip file descriptor.
+ * @param offsets - Offsets of the lines in the chip.
+ * @param nb_lines - Number of lines, up to LINUX_GPIO_LINES_MAX.
+ * @param flags - GPIO_V2_LINE_FLAG_* flags applied to all the lines.
+ * @param out_mask - Bitmap of the lines to be configured as outputs, indexed
+ *		     by position in offsets. Overrides flags for those lines.
+ * @param values - Initial values of the outputs.
+ * @return The line request file descriptor in case of success, negative error
+ *	   code otherwise.
+ */
+int linux_gpio_line_request(int chip_fd, const uint32_t *offsets,
+			    uint32_t nb_lines, uint64_t flags,
+			    uint64_t out_mask, uint64_t values)
+{
+	struct gpio_v2_line_request req;
+	struct gpio_v2_line_config_attribute *attr;
+	uint32_t i;
+	int ret;
+
+	if (!offsets || !nb_lines || nb_lines > LINUX_GPIO_LINES_MAX)
+		return -EINVAL;
+
+	memset(&req, 0, sizeof(req));
+	for (i = 0; i < nb_lines; i++)
+		req.offsets[i] = offsets[i];
+	req.num_lines = nb_lines;
+	strncpy(req.consumer, "no-os", sizeof(req.consumer) - 1);
+	req.config.flags = flags;
+
+	if (out_mask) {
+		attr = &req.config.attrs[req.config.num_attrs++];
+		attr->attr.id = GPIO_V2_LINE_ATTR_ID_FLAGS;
+		attr->attr.flags = GPIO_V2_LINE_FLAG_OUTPUT |
+				   (flags & ~(uint64_t)(GPIO_V2_LINE_FLAG_INPUT |
+						   GPIO_V2_LINE_FLAG_EDGE_RISING |
+						   GPIO_V2_LINE_FLAG_EDGE_FALLING));
+		attr->mask = out_mask;
+
+		attr = &req.config.attrs[req.config.num_attrs++];
+		attr->attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+		attr->attr.values = values;
+		attr->mask = out_mask;
+	}
+
+	ret = ioctl(chip_fd, GPIO_V2_GET_LINE_IOCTL, &req);
+	if (ret < 0)
+		return -errno;
+
+	return req.fd;
+}
+
+/**
+ * @brief Convert the pull configuration to line bias flags.
+ * @param pull - Pull configuration.
+ * @return GPIO_V2_LINE_FLAG_BIAS_* flags, 0 to keep the current bias.
+ */
+static uint64_t linux_gpio_cdev_bias(enum no_os_gpio_pull_up pull)
+{
+	switch (pull) {
+	case NO_OS_PULL_UP:
+	case NO_OS_PULL_UP_WEAK:
+		return GPIO_V2_LINE_FLAG_BIAS_PULL_UP;
+	case NO_OS_PULL_DOWN:
+	case NO_OS_PULL_DOWN_WEAK:
+		return GPIO_V2_LINE_FLAG_BIAS_PULL_DOWN;
+	default:
+		return 0;
+	}
+}
+
+/**
+ * @brief Change the configuration of a requested line.
+ * @param linux_desc - The character device descriptor.
+ * @param flags - New GPIO_V2_LINE_FLAG_* flags.
+ * @param value - Output value, used if flags selects the output direction.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int linux_gpio_cdev_set_config(struct linux_gpio_cdev_desc *linux_desc,
+				      uint64_t flags, uint8_t value)
+{
+	struct gpio_v2_line_config config;
+	int ret;
+
+	memset(&config, 0, sizeof(config));
+	config.flags = flags | linux_desc->bias;
+	if (flags & GPIO_V2_LINE_FLAG_OUTPUT) {
+		config.num_attrs = 1;
+		config.attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+		config.attrs[0].attr.values = value ? 1 : 0;
+		config.attrs[0].mask = 1;
+	}
+
+	ret = ioctl(linux_desc->req_fd, GPIO_V2_LINE_SET_CONFIG_IOCTL, &config);
+	if (ret < 0)
+		return -errno;
+
+	return 0;
+}
+
+/**
+ * @brief Obtain a GPIO descriptor backed by the GPIO character device.
+ *
+ * The line is requested with its current direction, or as an input if a pull
+ * configuration is given, since the kernel only accepts bias flags together
+ * with a direction.
+ * @param desc - The GPIO descriptor.
+ * @param param - GPIO initialization parameters. port selects
+ *		  /dev/gpiochip"port" and number is the line offset in the chip.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t linux_gpio_cdev_get(struct no_os_gpio_desc **desc,
+			    const struct no_os_gpio_init_param *param)
+{
+	struct linux_gpio_cdev_desc *linux_desc;
+	struct no_os_gpio_desc *descriptor;
+	uint32_t offset;
+	uint64_t flags;
+	int ret;
+
+	if (!desc || !param || param->port < 0 || param->number < 0)
+		return -EINVAL;
+
+	descriptor = no_os_calloc(1, sizeof(*descriptor));
+	if (!descriptor)
+		return -ENOMEM;
+
+	linux_desc = no_os_calloc(1, sizeof(*linux_desc));
+	if (!linux_desc) {
+		ret = -ENOMEM;
+		goto free_desc;
+	}
+
+	descriptor->extra = linux_desc;
+	descriptor->port = param->port;
+	descriptor->number = param->number;
+	descriptor->pull = param->pull;
+	linux_desc->bias = linux_gpio_cdev_bias(param->pull);
+
+	ret = linux_gpio_chip_open(param->port);
+	if (ret < 0) {
+		printf("%s: Can't open gpiochip%d\n\r", __func__, param->port);
+		goto free_linux_desc;
+	}
+	linux_desc->chip_fd = ret;
+
+	offset = param->number;
+	flags = linux_desc->bias;
+	if (flags)
+		flags |= GPIO_V2_LINE_FLAG_INPUT;
+	ret = linux_gpio_line_request(linux_desc->chip_fd, &offset, 1, flags,
+				      0, 0);
+	if (ret < 0) {
+		printf("%s: Can't request line %d\n\r", __func__, param->number);
+		goto close_chip;
+	}
+	linux_desc->req_fd = ret;
+
+	*desc = descriptor;
+
+	return 0;
+
+close_chip:
+	close(linux_desc->chip_fd);
+free_linux_desc:
+	no_os_free(linux_desc);
+free_desc:
+	no_os_free(descriptor);
+
+	return ret;
+}
+
+/**
+ * @brief Get an optional GPIO descriptor backed by the GPIO character device.
+ * @param desc - The GPIO descriptor. Set to NULL if the line can't be used.
+ * @param param - GPIO Initialization parameters.
+ * @return 0
+ */
+int32_t linux_gpio_cdev_get_optional(struct no_os_gpio_desc **desc,
+				     const struct no_os_gpio_init_param *param)
+{
+	if (linux_gpio_cdev_get(desc, param))
+		*desc = NULL;
+
+	return 0;
+}
+
+/**
+ * @brief Free the resources allocated by linux_gpio_cdev_get().
+ * @param desc - The GPIO descriptor.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t linux_gpio_cdev_remove(struct no_os_gpio_desc *desc)
+{
+	struct linux_gpio_cdev_desc *linux_desc;
+
+	if (!desc)
+		return -EINVAL;
+
+	linux_desc = desc->extra;
+	close(linux_desc->req_fd);
+	close(linux_desc->chip_fd);
+	no_os_free(linux_desc);
+	no_os_free(desc);
+
+	return 0;
+}
+
+/**
+ * @brief Set the value of the specified GPIO with a single ioctl.
+ * @param desc - The GPIO descriptor.
+ * @param value - The value.
+ *                Example: NO_OS_GPIO_HIGH
+ *                         NO_OS_GPIO_LOW
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t linux_gpio_cdev_set_value(struct no_os_gpio_desc *desc,
+				  uint8_t value)
+{
+	struct linux_gpio_cdev_desc *linux_desc = desc->extra;
+	struct gpio_v2_line_values values = {
+		.bits = value ? 1 : 0,
+		.mask = 1,
+	};
+
+	if (ioctl(linux_desc->req_fd, GPIO_V2_LINE_SET_VALUES_IOCTL, &values))
+		return -errno;
+
+	return 0;
+}
+
+/**
+ * @brief Get the value of the specified GPIO with a single ioctl.
+ * @param desc - The GPIO descriptor.
+ * @param value - The value.
+ *                Example: NO_OS_GPIO_HIGH
+ *                         NO_OS_GPIO_LOW
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t linux_gpio_cdev_get_value(struct no_os_gpio_desc *desc,
+				  uint8_t *value)
+{
+	struct linux_gpio_cdev_desc *linux_desc = desc->extra;
+	struct gpio_v2_line_values values = {
+		.mask = 1,
+	};
+
+	if (ioctl(linux_desc->req_fd, GPIO_V2_LINE_GET_VALUES_IOCTL, &values))
+		return -errno;
+
+	*value = (values.bits & 1) ? NO_OS_GPIO_HIGH : NO_OS_GPIO_LOW;
+
+	return 0;
+}
+
+/**
+ * @brief Enable the input direction of the specified GPIO.
+ * @param desc - The GPIO descriptor.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t linux_gpio_cdev_direction_input(struct no_os_gpio_desc *desc)
+{
+	return linux_gpio_cdev_set_config(desc->extra, GPIO_V2_LINE_FLAG_INPUT,
+					  0);
+}
+
+/**
+ * @brief Enable the output direction of the specified GPIO.
+ *
+ * The direction and the value are applied atomically by the kernel.
+ * @param desc - The GPIO descriptor.
+ * @param value - The value.
+ *                Example: NO_OS_GPIO_HIGH
+ *                         NO_OS_GPIO_LOW
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t linux_gpio_cdev_direction_output(struct no_os_gpio_desc *desc,
+		uint8_t value)
+{
+	return linux_gpio_cdev_set_config(desc->extra, GPIO_V2_LINE_FLAG_OUTPUT,
+					  value);
+}
+
+/**
+ * @brief Get the direction of the specified GPIO.
+ * @param desc - The GPIO descriptor.
+ * @param direction - The direction.
+ *                    Example: NO_OS_GPIO_OUT
+ *                             NO_OS_GPIO_IN
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t linux_gpio_cdev_get_direction(struct no_os_gpio_desc *desc,
+				      uint8_t *direction)
+{
+	struct linux_gpio_cdev_desc *linux_desc = desc->extra;
+	struct gpio_v2_line_info info;
+
+	memset(&info, 0, sizeof(info));
+	info.offset = desc->number;
+	if (ioctl(linux_desc->chip_fd, GPIO_V2_GET_LINEINFO_IOCTL, &info))
+		return -errno;
+
+	if (info.flags & GPIO_V2_LINE_FLAG_OUTPUT)
+		*direction = NO_OS_GPIO_OUT;
+	else
+		*direction = NO_OS_GPIO_IN;
+
+	return 0;
+}
+
+/**
+ * @brief Request several lines of a GPIO chip as a single handle.
+ * @param lines - The lines descriptor.
+ * @param param - Lines initialization parameters.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int linux_gpio_lines_get(struct linux_gpio_lines **lines,
+			 const struct linux_gpio_lines_init_param *param)
+{
+	struct linux_gpio_lines *l;
+	uint64_t flags;
+	int chip_fd;
+	int ret;
+
+	if (!lines || !param || !param->offsets || !param->nb_lines ||
+	    param->nb_lines > LINUX_GPIO_LINES_MAX)
+		return -EINVAL;
+
+	l = no_os_calloc(1, sizeof(*l));
+	if (!l)
+		return -ENOMEM;
+
+	chip_fd = linux_gpio_chip_open(param->chip);
+	if (chip_fd < 0) {
+		ret = chip_fd;
+		goto free_lines;
+	}
+
+	flags = GPIO_V2_LINE_FLAG_INPUT | linux_gpio_cdev_bias(param->pull);
+	ret = linux_gpio_line_request(chip_fd, param->offsets, param->nb_lines,
+				      flags, param->out_mask, param->values);
+	close(chip_fd);
+	if (ret < 0)
+		goto free_lines;
+
+	l->req_fd = ret;
+	l->nb_lines = param->nb_lines;
+	*lines = l;
+
+	return 0;
+
+free_lines:
+	no_os_free(l);
+
+	return ret;
+}
+
+/**
+ * @brief Release the lines requested with linux_gpio_lines_get().
+ * @param lines - The lines descriptor.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int linux_gpio_lines_remove(struct linux_gpio_lines *lines)
+{
+	if (!lines)
+		return -EINVAL;
+
+	close(lines->req_fd);
+	no_os_free(lines);
+
+	return 0;
+}
+
+/**
+ * @brief Set several output lines with a single ioctl.
+ * @param lines - The lines descriptor.
+ * @param mask - Bitmap of the lines to be set, indexed by position in the
+ *		 offsets array.
+ * @param bits - New values of the lines selected by mask.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int linux_gpio_lines_set(struct linux_gpio_lines *lines, uint64_t mask,
+			 uint64_t bits)
+{
+	struct gpio_v2_line_values values = {
+		.bits = bits,
+		.mask = mask,
+	};
+
+	if (!lines)
+		return -EINVAL;
+
+	if (ioctl(lines->req_fd, GPIO_V2_LINE_SET_VALUES_IOCTL, &values))
+		return -errno;
+
+	return 0;
+}
+
+/**
+ * @brief Read several lines with a single ioctl.
+ * @param lines - The lines descriptor.
+ * @param mask - Bitmap of the lines to be read, indexed by position in the
+ *		 offsets array.
+ * @param bits - Values of the lines selected by mask.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int linux_gpio_lines_get_values(struct linux_gpio_lines *lines, uint64_t mask,
+				uint64_t *bits)
+{
+	struct gpio_v2_line_values values = {
+		.mask = mask,
+	};
+
+	if (!lines || !bits)
+		return -EINVAL;
+
+	if (ioctl(lines->req_fd, GPIO_V2_LINE_GET_VALUES_IOCTL, &values))
+		return -errno;
+
+	*bits = values.bits & mask;
+
+	return 0;
+}
+
 /**
  * @brief Linux platform specific GPIO platform ops structure
  */
@@ -377,3 +848,17 @@ const struct no_os_gpio_platform_ops linux_gpio_ops = {
 	.gpio_ops_set_value = &linux_gpio_set_value,
 	.gpio_ops_get_value = &linux_gpio_get_value,
 };
+
+/**
+ * @brief Linux GPIO character device platform ops structure
+ */
+const struct no_os_gpio_platform_ops linux_gpio_cdev_ops = {
+	.gpio_ops_get = &linux_gpio_cdev_get,
+	.gpio_ops_get_optional = &linux_gpio_cdev_get_optional,
+	.gpio_ops_remove = &linux_gpio_cdev_remove,
+	.gpio_ops_direction_input = &linux_gpio_cdev_direction_input,
+	.gpio_ops_direction_output = &linux_gpio_cdev_direction_output,
+	.gpio_ops_get_direction = &linux_gpio_cdev_get_direction,
+	.gpio_ops_set_value = &linux_gpio_cdev_set_value,
+	.gpio_ops_get_value = &linux_gpio_cdev_get_value,
+};
@@ -33,9 +33,69 @@
 #ifndef LINUX_GPIO_H_
 #define LINUX_GPIO_H_
 
+#include <stdint.h>
+#include "no_os_gpio.h"
+
+/* Maximum number of lines in a single request, GPIO_V2_LINES_MAX */
+#define LINUX_GPIO_LINES_MAX	64
+
 /**
- * @brief Linux specific GPIO platform ops structure
+ * @struct linux_gpio_lines_init_param
+ * @brief Parameters of a set of lines requested as a single handle
+ */
+struct linux_gpio_lines_init_param {
+	/** GPIO chip index, the device is /dev/gpiochip"chip" */
+	uint32_t chip;
+	/** Offsets of the lines in the chip */
+	const uint32_t *offsets;
+	/** Number of lines in offsets */
+	uint32_t nb_lines;
+	/**
+	 * Bitmap of the lines requested as outputs, indexed by position in
+	 * offsets. The other lines are requested as inputs.
+	 */
+	uint64_t out_mask;
+	/** Initial values of the outputs */
+	uint64_t values;
+	/** Bias applied to all the lines */
+	enum no_os_gpio_pull_up pull;
+};
+
+/**
+ * @struct linux_gpio_lines
+ * @brief Lines requested with linux_gpio_lines_get()
+ */
+struct linux_gpio_lines;
+
+/**
+ * @brief Linux specific GPIO platform ops structure, using the deprecated
+ * sysfs interface. number is the global GPIO number.
  */
 extern const struct no_os_gpio_platform_ops linux_gpio_ops;
 
+/**
+ * @brief Linux GPIO character device (uAPI v2) platform ops structure. port
+ * selects /dev/gpiochip"port" and number is the line offset in the chip.
+ */
+extern const struct no_os_gpio_platform_ops linux_gpio_cdev_ops;
+
+/* Open /dev/gpiochip"chip" and return its file descriptor */
+int linux_gpio_chip_open(uint32_t chip);
+/* Request lines of an open chip and return the request file descriptor */
+int linux_gpio_line_request(int chip_fd, const uint32_t *offsets,
+			    uint32_t nb_lines, uint64_t flags,
+			    uint64_t out_mask, uint64_t values);
+
+/* Request several lines of a chip as a single handle */
+int linux_gpio_lines_get(struct linux_gpio_lines **lines,
+			 const struct linux_gpio_lines_init_param *param);
+/* Release the lines */
+int linux_gpio_lines_remove(struct linux_gpio_lines *lines);
+/* Set the lines selected by mask to bits in a single ioctl */
+int linux_gpio_lines_set(struct linux_gpio_lines *lines, uint64_t mask,
+			 uint64_t bits);
+/* Read the lines selected by mask in a single ioctl */
+int linux_gpio_lines_get_values(struct linux_gpio_lines *lines, uint64_t mask,
+				uint64_t *bits);
+
 #endif // LINUX_GPIO_H_
@@ -0,0 +1,508 @@
+/***************************************************************************//**
+ *   @file   linux/linux_gpio_irq.c
+ *   @brief  Linux GPIO interrupt controller based on line edge events
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+
+#include "no_os_error.h"
+#include "no_os_alloc.h"
+#include "linux_gpio.h"
+#include "linux_gpio_irq.h"
+
+/******************************************************************************/
+/*************************** Types Declarations *******************************/
+/******************************************************************************/
+
+/* Number of events read from a line with a single read() */
+#define LINUX_GPIO_IRQ_EVENTS	16
+
+/**
+ * @struct linux_gpio_irq_line
+ * @brief State of a line of the interrupt controller
+ */
+struct linux_gpio_irq_line {
+	/** Line request file descriptor, -1 while the interrupt is disabled */
+	int fd;
+	/** Edge detection flags */
+	uint64_t edge_flags;
+	/** Registered callback */
+	struct no_os_callback_desc cb;
+	/** Last event seen on the line */
+	struct linux_gpio_irq_event last;
+};
+
+/**
+ * @struct linux_gpio_irq_desc
+ * @brief Linux GPIO interrupt controller descriptor
+ */
+struct linux_gpio_irq_desc {
+	/** GPIO chip file descriptor */
+	int chip_fd;
+	/** Number of lines of the chip */
+	uint32_t nb_lines;
+	/** Callbacks are not called while false */
+	bool enabled;
+	/** Per line state */
+	struct linux_gpio_irq_line *lines;
+	/** poll() descriptors of the enabled lines */
+	struct pollfd *pfds;
+};
+
+/******************************************************************************/
+/************************ Functions Definitions *******************************/
+/******************************************************************************/
+
+/**
+ * @brief Initialize the GPIO interrupt controller
+ * @param desc - Pointer where the configured instance is stored
+ * @param param - Configuration information for the instance. irq_ctrl_id is
+ *		  the GPIO chip index.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int linux_gpio_irq_ctrl_init(struct no_os_irq_ctrl_desc **desc,
+				    const struct no_os_irq_init_param *param)
+{
+	struct no_os_irq_ctrl_desc *descriptor;
+	struct linux_gpio_irq_desc *extra;
+	struct gpiochip_info info;
+	uint32_t i;
+	int ret;
+
+	if (!desc || !param)
+		return -EINVAL;
+
+	descriptor = no_os_calloc(1, sizeof(*descriptor));
+	if (!descriptor)
+		return -ENOMEM;
+
+	extra = no_os_calloc(1, sizeof(*extra));
+	if (!extra) {
+		ret = -ENOMEM;
+		goto free_desc;
+	}
+
+	ret = linux_gpio_chip_open(param->irq_ctrl_id);
+	if (ret < 0)
+		goto free_extra;
+	extra->chip_fd = ret;
+
+	memset(&info, 0, sizeof(info));
+	if (ioctl(extra->chip_fd, GPIO_GET_CHIPINFO_IOCTL, &info)) {
+		ret = -errno;
+		goto close_chip;
+	}
+
+	extra->nb_lines = info.lines;
+	extra->lines = no_os_calloc(info.lines, sizeof(*extra->lines));
+	extra->pfds = no_os_calloc(info.lines, sizeof(*extra->pfds));
+	if (!extra->lines || !extra->pfds) {
+		ret = -ENOMEM;
+		goto free_lines;
+	}
+
+	for (i = 0; i < info.lines; i++) {
+		extra->lines[i].fd = -1;
+		extra->lines[i].edge_flags = GPIO_V2_LINE_FLAG_EDGE_RISING;
+	}
+	extra->enabled = true;
+
+	descriptor->irq_ctrl_id = param->irq_ctrl_id;
+	descriptor->extra = extra;
+	*desc = descriptor;
+
+	return 0;
+
+free_lines:
+	no_os_free(extra->pfds);
+	no_os_free(extra->lines);
+close_chip:
+	close(extra->chip_fd);
+free_extra:
+	no_os_free(extra);
+free_desc:
+	no_os_free(descriptor);
+
+	return ret;
+}
+
+/**
+ * @brief Disable a specific interrupt
+ * @param desc - The GPIO irq descriptor.
+ * @param irq_id - Line offset.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int linux_gpio_irq_disable(struct no_os_irq_ctrl_desc *desc,
+				  uint32_t irq_id)
+{
+	struct linux_gpio_irq_desc *extra;
+
+	if (!desc)
+		return -EINVAL;
+
+	extra = desc->extra;
+	if (irq_id >= extra->nb_lines)
+		return -EINVAL;
+
+	if (extra->lines[irq_id].fd >= 0) {
+		close(extra->lines[irq_id].fd);
+		extra->lines[irq_id].fd = -1;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Free the resources allocated by linux_gpio_irq_ctrl_init()
+ * @param desc - Interrupt GPIO controller descriptor.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int linux_gpio_irq_ctrl_remove(struct no_os_irq_ctrl_desc *desc)
+{
+	struct linux_gpio_irq_desc *extra;
+	uint32_t i;
+
+	if (!desc)
+		return -EINVAL;
+
+	extra = desc->extra;
+	for (i = 0; i < extra->nb_lines; i++)
+		linux_gpio_irq_disable(desc, i);
+
+	close(extra->chip_fd);
+	no_os_free(extra->pfds);
+	no_os_free(extra->lines);
+	no_os_free(extra);
+	no_os_free(desc);
+
+	return 0;
+}
+
+/**
+ * @brief Register a callback for a line
+ * @param desc - The GPIO irq descriptor.
+ * @param irq_id - Line offset.
+ * @param cb - Callback descriptor.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int linux_gpio_irq_register_callback(struct no_os_irq_ctrl_desc *desc,
+		uint32_t irq_id,
+		struct no_os_callback_desc *cb)
+{
+	struct linux_gpio_irq_desc *extra;
+
+	if (!desc || !cb)
+		return -EINVAL;
+
+	extra = desc->extra;
+	if (irq_id >= extra->nb_lines)
+		return -EINVAL;
+
+	extra->lines[irq_id].cb = *cb;
+
+	return 0;
+}
+
+/**
+ * @brief Unregister the callback of a line
+ * @param desc - The GPIO irq descriptor.
+ * @param irq_id - Line offset.
+ * @param cb - Callback descriptor.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int linux_gpio_irq_unregister_callback(struct no_os_irq_ctrl_desc *desc,
+		uint32_t irq_id,
+		struct no_os_callback_desc *cb)
+{
+	struct linux_gpio_irq_desc *extra;
+
+	if (!desc || !cb)
+		return -EINVAL;
+
+	extra = desc->extra;
+	if (irq_id >= extra->nb_lines)
+		return -EINVAL;
+
+	memset(&extra->lines[irq_id].cb, 0, sizeof(*cb));
+
+	return 0;
+}
+
+/**
+ * @brief Enable a specific interrupt by requesting the line with edge
+ * detection.
+ * @param desc - The GPIO irq descriptor.
+ * @param irq_id - Line offset.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int linux_gpio_irq_enable(struct no_os_irq_ctrl_desc *desc,
+				 uint32_t irq_id)
+{
+	struct linux_gpio_irq_desc *extra;
+	struct linux_gpio_irq_line *line;
+	int ret;
+
+	if (!desc)
+		return -EINVAL;
+
+	extra = desc->extra;
+	if (irq_id >= extra->nb_lines)
+		return -EINVAL;
+
+	line = &extra->lines[irq_id];
+	if (line->fd >= 0)
+		return 0;
+
+	ret = linux_gpio_line_request(extra->chip_fd, &irq_id, 1,
+				      GPIO_V2_LINE_FLAG_INPUT |
+				      line->edge_flags, 0, 0);
+	if (ret < 0)
+		return ret;
+
+	fcntl(ret, F_SETFL, fcntl(ret, F_GETFL) | O_NONBLOCK);
+	line->fd = ret;
+
+	return 0;
+}
+
+/**
+ * @brief Set the trigger condition.
+ * @param desc - The GPIO irq descriptor.
+ * @param irq_id - Line offset.
+ * @param trig - The trigger condition. Only edges are supported.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int linux_gpio_irq_trigger_level_set(struct no_os_irq_ctrl_desc *desc,
+		uint32_t irq_id,
+		enum no_os_irq_trig_level trig)
+{
+	struct linux_gpio_irq_desc *extra;
+	struct linux_gpio_irq_line *line;
+	struct gpio_v2_line_config config;
+
+	if (!desc)
+		return -EINVAL;
+
+	extra = desc->extra;
+	if (irq_id >= extra->nb_lines)
+		return -EINVAL;
+
+	line = &extra->lines[irq_id];
+	switch (trig) {
+	case NO_OS_IRQ_EDGE_RISING:
+		line->edge_flags = GPIO_V2_LINE_FLAG_EDGE_RISING;
+		break;
+	case NO_OS_IRQ_EDGE_FALLING:
+		line->edge_flags = GPIO_V2_LINE_FLAG_EDGE_FALLING;
+		break;
+	case NO_OS_IRQ_EDGE_BOTH:
+		line->edge_flags = GPIO_V2_LINE_FLAG_EDGE_RISING |
+				   GPIO_V2_LINE_FLAG_EDGE_FALLING;
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	if (line->fd < 0)
+		return 0;
+
+	memset(&config, 0, sizeof(config));
+	config.flags = GPIO_V2_LINE_FLAG_INPUT | line->edge_flags;
+	if (ioctl(line->fd, GPIO_V2_LINE_SET_CONFIG_IOCTL, &config))
+		return -errno;
+
+	return 0;
+}
+
+/**
+ * @brief Allow the callbacks to be called by linux_gpio_irq_poll()
+ * @param desc - GPIO interrupt controller descriptor.
+ * @return 0
+ */
+static int linux_gpio_irq_global_enable(struct no_os_irq_ctrl_desc *desc)
+{
+	struct linux_gpio_irq_desc *extra = desc->extra;
+
+	extra->enabled = true;
+
+	return 0;
+}
+
+/**
+ * @brief Keep the events queued in the kernel instead of calling the
+ * callbacks
+ * @param desc - GPIO interrupt controller descriptor.
+ * @return 0
+ */
+static int linux_gpio_irq_global_disable(struct no_os_irq_ctrl_desc *desc)
+{
+	struct linux_gpio_irq_desc *extra = desc->extra;
+
+	extra->enabled = false;
+
+	return 0;
+}
+
+/**
+ * @brief Read the pending events of a line and call its callback for each.
+ * @param line - The line.
+ * @return Number of events handled, negative error code otherwise.
+ */
+static int linux_gpio_irq_handle_line(struct linux_gpio_irq_line *line)
+{
+	struct gpio_v2_line_event ev[LINUX_GPIO_IRQ_EVENTS];
+	ssize_t len;
+	int nb;
+	int i;
+
+	len = read(line->fd, ev, sizeof(ev));
+	if (len < 0)
+		return (errno == EAGAIN) ? 0 : -errno;
+
+	nb = len / sizeof(ev[0]);
+	for (i = 0; i < nb; i++) {
+		line->last.timestamp_ns = ev[i].timestamp_ns;
+		line->last.rising =
+			ev[i].id == GPIO_V2_LINE_EVENT_RISING_EDGE;
+		line->last.seqno = ev[i].line_seqno;
+		if (line->cb.callback)
+			line->cb.callback(line->cb.ctx);
+	}
+
+	return nb;
+}
+
+/**
+ * @brief Wait for edge events and call the registered callbacks.
+ *
+ * Linux has no user space interrupt context, so the application calls this
+ * from its main loop or from a dedicated thread. Callbacks are called from
+ * the calling context, once per edge, in the order reported by the kernel.
+ * @param desc - GPIO interrupt controller descriptor.
+ * @param timeout_ms - Maximum time to wait, 0 to return immediately and -1 to
+ *		       wait forever.
+ * @return Number of events handled, negative error code otherwise.
+ */
+int linux_gpio_irq_poll(struct no_os_irq_ctrl_desc *desc, int timeout_ms)
+{
+	struct linux_gpio_irq_desc *extra;
+	uint32_t nb_fds = 0;
+	uint32_t i;
+	int total = 0;
+	int ret;
+
+	if (!desc)
+		return -EINVAL;
+
+	extra = desc->extra;
+	if (!extra->enabled)
+		return 0;
+
+	for (i = 0; i < extra->nb_lines; i++) {
+		if (extra->lines[i].fd < 0)
+			continue;
+		extra->pfds[nb_fds].fd = extra->lines[i].fd;
+		extra->pfds[nb_fds].events = POLLIN;
+		extra->pfds[nb_fds].revents = 0;
+		nb_fds++;
+	}
+	if (!nb_fds)
+		return 0;
+
+	ret = poll(extra->pfds, nb_fds, timeout_ms);
+	if (ret < 0)
+		return (errno == EINTR) ? 0 : -errno;
+	if (!ret)
+		return 0;
+
+	for (i = 0; i < extra->nb_lines; i++) {
+		if (extra->lines[i].fd < 0)
+			continue;
+		ret = linux_gpio_irq_handle_line(&extra->lines[i]);
+		if (ret < 0)
+			return ret;
+		total += ret;
+	}
+
+	return total;
+}
+
+/**
+ * @brief Get the last event seen on a line.
+ *
+ * Meant to be called from the line callback, to get the kernel timestamp of
+ * the edge that triggered it.
+ * @param desc - GPIO interrupt controller descriptor.
+ * @param irq_id - Line offset.
+ * @param event - Filled with the last event.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int linux_gpio_irq_get_event(struct no_os_irq_ctrl_desc *desc,
+			     uint32_t irq_id,
+			     struct linux_gpio_irq_event *event)
+{
+	struct linux_gpio_irq_desc *extra;
+
+	if (!desc || !event)
+		return -EINVAL;
+
+	extra = desc->extra;
+	if (irq_id >= extra->nb_lines)
+		return -EINVAL;
+
+	*event = extra->lines[irq_id].last;
+
+	return 0;
+}
+
+/**
+ * @brief Linux GPIO interrupt controller platform ops structure
+ */
+const struct no_os_irq_platform_ops linux_gpio_irq_ops = {
+	.init = (int32_t (*)())linux_gpio_irq_ctrl_init,
+	.register_callback = (int32_t (*)())linux_gpio_irq_register_callback,
+	.unregister_callback = (int32_t (*)())linux_gpio_irq_unregister_callback,
+	.enable = (int32_t (*)())linux_gpio_irq_enable,
+	.disable = (int32_t (*)())linux_gpio_irq_disable,
+	.trigger_level_set = (int32_t (*)())linux_gpio_irq_trigger_level_set,
+	.global_enable = (int32_t (*)())linux_gpio_irq_global_enable,
+	.global_disable = (int32_t (*)())linux_gpio_irq_global_disable,
+	.remove = (int32_t (*)())linux_gpio_irq_ctrl_remove
+};
@@ -0,0 +1,67 @@
+/***************************************************************************//**
+ *   @file   linux/linux_gpio_irq.h
+ *   @brief  Header file of Linux GPIO interrupt controller
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef LINUX_GPIO_IRQ_H_
+#define LINUX_GPIO_IRQ_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "no_os_irq.h"
+
+/**
+ * @struct linux_gpio_irq_event
+ * @brief Last edge event seen on a line
+ */
+struct linux_gpio_irq_event {
+	/** Kernel timestamp of the edge, CLOCK_MONOTONIC in nanoseconds */
+	uint64_t timestamp_ns;
+	/** True for a rising edge, false for a falling one */
+	bool rising;
+	/** Sequence number of the event on this line */
+	uint32_t seqno;
+};
+
+/**
+ * @brief Linux GPIO character device interrupt controller. irq_ctrl_id
+ * selects /dev/gpiochip"irq_ctrl_id" and irq_id is the line offset. Only
+ * edge triggers are supported.
+ */
+extern const struct no_os_irq_platform_ops linux_gpio_irq_ops;
+
+/* Wait up to timeout_ms for edge events and call the registered callbacks */
+int linux_gpio_irq_poll(struct no_os_irq_ctrl_desc *desc, int timeout_ms);
+/* Get the last event seen on a line */
+int linux_gpio_irq_get_event(struct no_os_irq_ctrl_desc *desc,
+			     uint32_t irq_id,
+			     struct linux_gpio_irq_event *event);
+
+#endif // LINUX_GPIO_IRQ_H_
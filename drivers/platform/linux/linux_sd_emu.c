@@ -0,0 +1,518 @@
+/***************************************************************************//**
+ *   @file   linux/linux_sd_emu.c
+ *   @brief  SD card over SPI emulator, backed by a file
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+
+#define _FILE_OFFSET_BITS 64
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include "no_os_alloc.h"
+#include "no_os_error.h"
+#include "no_os_util.h"
+#include "linux_sd_emu.h"
+
+/******************************************************************************/
+/********************** Macros and Constants Definitions **********************/
+/******************************************************************************/
+
+#define SD_EMU_BLOCK_LEN	512
+#define SD_EMU_BLOCK_BITS	9
+/* Card size granularity of a version 2.0 CSD */
+#define SD_EMU_SIZE_UNIT	(SD_EMU_BLOCK_LEN << 10)
+#define SD_EMU_CMD_LEN		6
+#define SD_EMU_CRC_LEN		2
+#define SD_EMU_CSD_LEN		16
+
+#define SD_EMU_R1_READY		0x00
+#define SD_EMU_R1_IDLE		0x01
+#define SD_EMU_R1_ILLEGAL	0x04
+#define SD_EMU_R1_ADDRESS	0x20
+
+#define SD_EMU_START_1_BLOCK	0xFE
+#define SD_EMU_START_N_BLOCK	0xFC
+#define SD_EMU_STOP_TRAN	0xFD
+#define SD_EMU_DATA_ACCEPTED	0x05
+#define SD_EMU_DATA_WRITE_ERR	0x0D
+
+/******************************************************************************/
+/*************************** Types Declarations *******************************/
+/******************************************************************************/
+
+enum linux_sd_emu_state {
+	/* Waiting for a command */
+	SD_EMU_IDLE,
+	/* Sending the blocks of CMD17 or CMD18 */
+	SD_EMU_READ,
+	/* Waiting for a data token of CMD24 or CMD25 */
+	SD_EMU_WRITE,
+	/* Receiving a data block */
+	SD_EMU_WRITE_DATA,
+};
+
+/**
+ * @struct linux_sd_emu_desc
+ * @brief Emulated card state, stored in no_os_spi_desc.extra
+ */
+struct linux_sd_emu_desc {
+	/** Card image */
+	FILE			*file;
+	/** Card size in blocks */
+	uint64_t		nb_blocks;
+	uint32_t		busy_polls;
+	uint32_t		erased_busy_polls;
+	enum linux_sd_emu_state	state;
+	/** Set until ACMD41 is received */
+	bool			idle;
+	/** Set after CMD55, the next command is an application command */
+	bool			app_cmd;
+	/** Set for CMD18 and CMD25 */
+	bool			multi;
+	/** Next block read or written */
+	uint64_t		block;
+	/** Blocks left from the ACMD23 pre-erase count */
+	uint32_t		pre_erase;
+	/** Command being received */
+	uint8_t			cmd[SD_EMU_CMD_LEN];
+	uint32_t		cmd_idx;
+	/** Bytes to be sent to the host, followed by busy bytes */
+	uint8_t			out[SD_EMU_BLOCK_LEN + SD_EMU_CRC_LEN + 4];
+	uint32_t		out_len;
+	uint32_t		out_idx;
+	uint32_t		busy;
+	/** Data block being received, with its CRC */
+	uint8_t			in[SD_EMU_BLOCK_LEN + SD_EMU_CRC_LEN];
+	uint32_t		in_idx;
+	struct linux_sd_emu_stats	stats;
+};
+
+/******************************************************************************/
+/************************ Functions Definitions *******************************/
+/******************************************************************************/
+
+/**
+ * @brief Queue bytes to be sent to the host, replacing the pending ones.
+ * @param emu - The emulator descriptor.
+ * @param buf - Bytes to be sent.
+ * @param len - Number of bytes.
+ */
+static void linux_sd_emu_reply(struct linux_sd_emu_desc *emu,
+			       const uint8_t *buf, uint32_t len)
+{
+	memcpy(emu->out, buf, len);
+	emu->out_len = len;
+	emu->out_idx = 0;
+	emu->busy = 0;
+}
+
+/**
+ * @brief Queue the next block of a read command.
+ * @param emu - The emulator descriptor.
+ */
+static void linux_sd_emu_load_block(struct linux_sd_emu_desc *emu)
+{
+	size_t n;
+
+	if (emu->block >= emu->nb_blocks) {
+		emu->state = SD_EMU_IDLE;
+		return;
+	}
+
+	emu->out[0] = SD_EMU_START_1_BLOCK;
+	n = 0;
+	if (!fseeko(emu->file, emu->block << SD_EMU_BLOCK_BITS, SEEK_SET))
+		n = fread(emu->out + 1, 1, SD_EMU_BLOCK_LEN, emu->file);
+	/* Blocks past the end of the image read as zero, like the holes */
+	memset(emu->out + 1 + n, 0, SD_EMU_BLOCK_LEN - n);
+	memset(emu->out + 1 + SD_EMU_BLOCK_LEN, 0xFF, SD_EMU_CRC_LEN);
+	emu->out_len = 1 + SD_EMU_BLOCK_LEN + SD_EMU_CRC_LEN;
+	emu->out_idx = 0;
+
+	emu->stats.blocks_read++;
+	emu->block++;
+	if (!emu->multi)
+		emu->state = SD_EMU_IDLE;
+}
+
+/**
+ * @brief Program the received block and queue the data response.
+ * @param emu - The emulator descriptor.
+ */
+static void linux_sd_emu_program_block(struct linux_sd_emu_desc *emu)
+{
+	uint8_t resp = SD_EMU_DATA_WRITE_ERR;
+
+	if (emu->block < emu->nb_blocks &&
+	    !fseeko(emu->file, emu->block << SD_EMU_BLOCK_BITS, SEEK_SET) &&
+	    fwrite(emu->in, 1, SD_EMU_BLOCK_LEN, emu->file) == SD_EMU_BLOCK_LEN)
+		resp = SD_EMU_DATA_ACCEPTED;
+
+	linux_sd_emu_reply(emu, &resp, 1);
+	if (emu->pre_erase) {
+		emu->pre_erase--;
+		emu->busy = emu->erased_busy_polls;
+	} else {
+		emu->busy = emu->busy_polls;
+	}
+
+	emu->stats.blocks_written++;
+	emu->block++;
+	emu->state = emu->multi ? SD_EMU_WRITE : SD_EMU_IDLE;
+}
+
+/**
+ * @brief Execute a received command and queue its response.
+ * @param emu - The emulator descriptor.
+ */
+static void linux_sd_emu_run_cmd(struct linux_sd_emu_desc *emu)
+{
+	uint8_t		resp[SD_EMU_CSD_LEN + SD_EMU_CRC_LEN + 4];
+	uint8_t		r1 = emu->idle ? SD_EMU_R1_IDLE : SD_EMU_R1_READY;
+	uint32_t	arg = no_os_get_unaligned_be32(emu->cmd + 1);
+	uint32_t	c_size;
+	uint32_t	len;
+	uint8_t		cmd = emu->cmd[0] & 0x3F;
+	bool		app_cmd = emu->app_cmd;
+
+	emu->stats.commands++;
+	emu->app_cmd = false;
+	emu->state = SD_EMU_IDLE;
+
+	/* One byte of response latency, then R1 */
+	resp[0] = 0xFF;
+	resp[1] = r1;
+	len = 2;
+
+	switch (cmd) {
+	case 0:
+		emu->idle = true;
+		resp[1] = SD_EMU_R1_IDLE;
+		break;
+	case 8:
+		resp[2] = 0x00;
+		resp[3] = 0x00;
+		resp[4] = (arg >> 8) & 0xF;
+		resp[5] = arg & 0xFF;
+		len = 6;
+		break;
+	case 9:
+		/* Version 2.0 CSD */
+		c_size = emu->nb_blocks / (SD_EMU_SIZE_UNIT >>
+					   SD_EMU_BLOCK_BITS) - 1;
+		memset(resp + 2, 0xFF, SD_EMU_CSD_LEN + SD_EMU_CRC_LEN + 1);
+		resp[2] = SD_EMU_START_1_BLOCK;
+		memset(resp + 3, 0, SD_EMU_CSD_LEN);
+		resp[3] = 0x40;
+		resp[3 + 7] = (c_size >> 16) & 0x3F;
+		resp[3 + 8] = (c_size >> 8) & 0xFF;
+		resp[3 + 9] = c_size & 0xFF;
+		len = 3 + SD_EMU_CSD_LEN + SD_EMU_CRC_LEN;
+		break;
+	case 12:
+		break;
+	case 13:
+		resp[2] = 0x00;
+		len = 3;
+		break;
+	case 17:
+	case 18:
+	case 24:
+	case 25:
+		if (arg >= emu->nb_blocks) {
+			resp[1] |= SD_EMU_R1_ADDRESS;
+			break;
+		}
+		emu->block = arg;
+		emu->multi = (cmd == 18 || cmd == 25);
+		emu->state = (cmd < 24) ? SD_EMU_READ : SD_EMU_WRITE;
+		break;
+	case 23:
+		if (!app_cmd)
+			goto illegal;
+		emu->pre_erase = arg & 0x7FFFFF;
+		break;
+	case 41:
+		if (!app_cmd)
+			goto illegal;
+		emu->idle = false;
+		resp[1] = SD_EMU_R1_READY;
+		break;
+	case 55:
+		emu->app_cmd = true;
+		break;
+	case 58:
+		/* OCR with the power up and card capacity status bits set */
+		resp[2] = 0xC0;
+		resp[3] = 0xFF;
+		resp[4] = 0x80;
+		resp[5] = 0x00;
+		len = 6;
+		break;
+	default:
+illegal:
+		resp[1] |= SD_EMU_R1_ILLEGAL;
+		break;
+	}
+
+	/* The pre-erase count only applies to the next write */
+	if (cmd != 23 && cmd != 55 && cmd != 25)
+		emu->pre_erase = 0;
+
+	linux_sd_emu_reply(emu, resp, len);
+}
+
+/**
+ * @brief Exchange one byte with the emulated card.
+ * @param emu - The emulator descriptor.
+ * @param in - Byte sent by the host.
+ * @return Byte sent by the card.
+ */
+static uint8_t linux_sd_emu_xfer(struct linux_sd_emu_desc *emu, uint8_t in)
+{
+	static const uint8_t stuff = 0xFF;
+	uint8_t out = 0xFF;
+
+	if (emu->state == SD_EMU_READ && emu->out_idx == emu->out_len &&
+	    !emu->cmd_idx)
+		linux_sd_emu_load_block(emu);
+
+	if (emu->out_idx < emu->out_len) {
+		out = emu->out[emu->out_idx++];
+	} else if (emu->busy) {
+		out = 0x00;
+		emu->busy--;
+		emu->stats.busy_polls++;
+	}
+
+	switch (emu->state) {
+	case SD_EMU_WRITE_DATA:
+		emu->in[emu->in_idx++] = in;
+		if (emu->in_idx == sizeof(emu->in))
+			linux_sd_emu_program_block(emu);
+		break;
+	case SD_EMU_WRITE:
+		if (in == (emu->multi ? SD_EMU_START_N_BLOCK :
+			   SD_EMU_START_1_BLOCK)) {
+			emu->in_idx = 0;
+			emu->state = SD_EMU_WRITE_DATA;
+		} else if (in == SD_EMU_STOP_TRAN && emu->multi) {
+			/* One stuff byte, then busy while finishing */
+			linux_sd_emu_reply(emu, &stuff, 1);
+			emu->busy = emu->busy_polls;
+			emu->pre_erase = 0;
+			emu->state = SD_EMU_IDLE;
+		}
+		break;
+	default:
+		/* Commands start with the 01 bit pattern */
+		if (!emu->cmd_idx && (in & 0xC0) != 0x40)
+			break;
+		emu->cmd[emu->cmd_idx++] = in;
+		if (emu->cmd_idx == SD_EMU_CMD_LEN) {
+			emu->cmd_idx = 0;
+			linux_sd_emu_run_cmd(emu);
+		}
+		break;
+	}
+
+	return out;
+}
+
+/**
+ * @brief Open the card image and initialize the emulator.
+ * @param desc - The SPI descriptor.
+ * @param param - The structure that contains the SPI parameters. extra must
+ * point to a struct linux_sd_emu_init_param.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int32_t linux_sd_emu_init(struct no_os_spi_desc **desc,
+				 const struct no_os_spi_init_param *param)
+{
+	struct linux_sd_emu_init_param	*emu_param;
+	struct linux_sd_emu_desc	*emu;
+	struct no_os_spi_desc		*descriptor;
+	int32_t				ret;
+
+	if (!desc || !param || !param->extra)
+		return -EINVAL;
+
+	emu_param = param->extra;
+	if (!emu_param->path || emu_param->size < SD_EMU_SIZE_UNIT)
+		return -EINVAL;
+
+	descriptor = no_os_calloc(1, sizeof(*descriptor));
+	if (!descriptor)
+		return -ENOMEM;
+
+	emu = no_os_calloc(1, sizeof(*emu));
+	if (!emu) {
+		ret = -ENOMEM;
+		goto free_desc;
+	}
+
+	emu->file = fopen(emu_param->path, "r+b");
+	if (!emu->file)
+		emu->file = fopen(emu_param->path, "w+b");
+	if (!emu->file) {
+		printf("%s: Can't open %s\n\r", __func__, emu_param->path);
+		ret = -errno;
+		goto free_emu;
+	}
+
+	emu->nb_blocks = (emu_param->size / SD_EMU_SIZE_UNIT) *
+			 (SD_EMU_SIZE_UNIT >> SD_EMU_BLOCK_BITS);
+	emu->busy_polls = emu_param->busy_polls;
+	emu->erased_busy_polls = emu_param->erased_busy_polls;
+	emu->idle = true;
+
+	descriptor->extra = emu;
+	descriptor->device_id = param->device_id;
+	descriptor->max_speed_hz = param->max_speed_hz;
+	descriptor->chip_select = param->chip_select;
+	descriptor->mode = param->mode;
+	descriptor->bit_order = param->bit_order;
+	descriptor->lanes = param->lanes;
+
+	*desc = descriptor;
+
+	return 0;
+free_emu:
+	no_os_free(emu);
+free_desc:
+	no_os_free(descriptor);
+
+	return ret;
+}
+
+/**
+ * @brief Exchange data with the emulated card, in place.
+ * @param desc - The SPI descriptor.
+ * @param data - Data to be sent, replaced by the received data.
+ * @param bytes_number - Number of bytes.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int32_t linux_sd_emu_write_and_read(struct no_os_spi_desc *desc,
+		uint8_t *data, uint16_t bytes_number)
+{
+	struct linux_sd_emu_desc *emu = desc->extra;
+	uint16_t i;
+
+	for (i = 0; i < bytes_number; i++)
+		data[i] = linux_sd_emu_xfer(emu, data[i]);
+
+	return 0;
+}
+
+/**
+ * @brief Exchange a list of messages with the emulated card.
+ * @param desc - The SPI descriptor.
+ * @param msgs - Array of messages.
+ * @param len - Number of messages.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int32_t linux_sd_emu_transfer(struct no_os_spi_desc *desc,
+				     struct no_os_spi_msg *msgs, uint32_t len)
+{
+	struct linux_sd_emu_desc *emu = desc->extra;
+	uint32_t i, j;
+	uint8_t out;
+
+	for (i = 0; i < len; i++) {
+		for (j = 0; j < msgs[i].bytes_number; j++) {
+			out = linux_sd_emu_xfer(emu, msgs[i].tx_buff ?
+						msgs[i].tx_buff[j] : 0xFF);
+			if (msgs[i].rx_buff)
+				msgs[i].rx_buff[j] = out;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Close the card image and free the descriptor.
+ * @param desc - The SPI descriptor.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int32_t linux_sd_emu_remove(struct no_os_spi_desc *desc)
+{
+	struct linux_sd_emu_desc *emu;
+	int32_t ret = 0;
+
+	if (!desc)
+		return -EINVAL;
+
+	emu = desc->extra;
+	if (fclose(emu->file))
+		ret = -errno;
+
+	no_os_free(emu);
+	no_os_free(desc);
+
+	return ret;
+}
+
+/**
+ * @brief Get the activity counters of the emulated card.
+ * @param desc - The SPI descriptor.
+ * @param stats - Counters are stored here.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t linux_sd_emu_get_stats(struct no_os_spi_desc *desc,
+			       struct linux_sd_emu_stats *stats)
+{
+	struct linux_sd_emu_desc *emu;
+
+	if (!desc || !stats)
+		return -EINVAL;
+
+	emu = desc->extra;
+	*stats = emu->stats;
+
+	return 0;
+}
+
+/**
+ * @brief Linux SD card emulator SPI platform ops structure
+ */
+const struct no_os_spi_platform_ops linux_sd_emu_ops = {
+	.init = &linux_sd_emu_init,
+	.write_and_read = &linux_sd_emu_write_and_read,
+	.remove = &linux_sd_emu_remove,
+	.transfer = &linux_sd_emu_transfer
+};
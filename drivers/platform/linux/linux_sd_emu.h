@@ -0,0 +1,91 @@
+/***************************************************************************//**
+ *   @file   linux/linux_sd_emu.h
+ *   @brief  Header file of the Linux SD card emulator
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+#ifndef LINUX_SD_EMU_H_
+#define LINUX_SD_EMU_H_
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+#include <stdint.h>
+#include "no_os_spi.h"
+
+/******************************************************************************/
+/*************************** Types Declarations *******************************/
+/******************************************************************************/
+
+/**
+ * @struct linux_sd_emu_init_param
+ * @brief Emulated card parameters, given as no_os_spi_init_param.extra
+ */
+struct linux_sd_emu_init_param {
+	/** Image file holding the card content, created if it doesn't exist */
+	const char	*path;
+	/** Card size in bytes, rounded down to a multiple of 512 KiB */
+	uint64_t	size;
+	/**
+	 * Busy bytes sent after each programmed block. The SD driver waits
+	 * 1 ms for each one, so this models the block programming time.
+	 */
+	uint32_t	busy_polls;
+	/** Busy bytes sent after a block pre-erased with ACMD23 */
+	uint32_t	erased_busy_polls;
+};
+
+/**
+ * @struct linux_sd_emu_stats
+ * @brief Activity of the emulated card
+ */
+struct linux_sd_emu_stats {
+	/** Commands received */
+	uint32_t	commands;
+	/** Data blocks sent to the host */
+	uint32_t	blocks_read;
+	/** Data blocks programmed */
+	uint32_t	blocks_written;
+	/** Busy bytes sent to the host */
+	uint32_t	busy_polls;
+};
+
+/**
+ * @brief Linux SD card emulator SPI platform ops structure
+ */
+extern const struct no_os_spi_platform_ops linux_sd_emu_ops;
+
+/******************************************************************************/
+/************************ Functions Declarations ******************************/
+/******************************************************************************/
+
+/* Get the activity counters of the emulated card */
+int32_t linux_sd_emu_get_stats(struct no_os_spi_desc *desc,
+			       struct linux_sd_emu_stats *stats);
+
+#endif // LINUX_SD_EMU_H_
@@ -40,7 +40,9 @@
 #include "no_os_alloc.h"
 #include "linux_spi.h"
 
+#include <errno.h>
 #include <fcntl.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <sys/ioctl.h>
@@ -49,6 +51,16 @@
 
 #warning SPI cs_delay_first and cs_delay_last delays are not supported on the linux platform
 
+/******************************************************************************/
+/********************** Macros and Constants Definitions **********************/
+/******************************************************************************/
+
+/* Transfer array entries allocated by linux_spi_init() */
+#define LINUX_SPI_PREALLOC_MSGS	16
+/* Largest number of messages accepted by a single SPI_IOC_MESSAGE ioctl */
+#define LINUX_SPI_MAX_MSGS	\
+	(((1 << _IOC_SIZEBITS) - 1) / sizeof(struct spi_ioc_transfer))
+
 /******************************************************************************/
 /*************************** Types Declarations *******************************/
 /******************************************************************************/
@@ -60,12 +72,71 @@
 struct linux_spi_desc {
 	/** /dev/spidev"device_id"."chip_select" file descriptor */
 	int spidev_fd;
+	/** Transfer array reused by every linux_spi_transfer() call */
+	struct spi_ioc_transfer *tr;
+	/** Number of entries in tr */
+	uint32_t tr_len;
+	/** Settings last written to the spidev */
+	uint8_t mode;
+	uint8_t bits_per_word;
+	uint32_t max_speed_hz;
 };
 
 /******************************************************************************/
 /************************ Functions Definitions *******************************/
 /******************************************************************************/
 
+/**
+ * @brief Write the SPI mode, bits per word and speed of the descriptor to the
+ * spidev. Only the settings which changed since the last call are written, so
+ * this is free when drivers don't change desc->mode or desc->max_speed_hz.
+ * @param desc - The SPI descriptor.
+ * @param force - Write all the settings, used at initialization.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int32_t linux_spi_update_config(struct no_os_spi_desc *desc,
+				       bool force)
+{
+	struct linux_spi_desc *linux_desc = desc->extra;
+	uint8_t mode = desc->mode;
+	uint8_t bits = 8;
+	int ret;
+
+	if (force || mode != linux_desc->mode) {
+		ret = ioctl(linux_desc->spidev_fd, SPI_IOC_WR_MODE, &mode);
+		if (ret == -1) {
+			ret = -errno;
+			printf("%s: Can't set SPI mode\n\r", __func__);
+			return ret;
+		}
+		linux_desc->mode = mode;
+	}
+
+	if (force || bits != linux_desc->bits_per_word) {
+		ret = ioctl(linux_desc->spidev_fd, SPI_IOC_WR_BITS_PER_WORD,
+			    &bits);
+		if (ret == -1) {
+			ret = -errno;
+			printf("%s: Can't set SPI bits per word\n\r", __func__);
+			return ret;
+		}
+		linux_desc->bits_per_word = bits;
+	}
+
+	if (force || desc->max_speed_hz != linux_desc->max_speed_hz) {
+		ret = ioctl(linux_desc->spidev_fd, SPI_IOC_WR_MAX_SPEED_HZ,
+			    &desc->max_speed_hz);
+		if (ret == -1) {
+			ret = -errno;
+			printf("%s: Can't set SPI max speed hz\n\r", __func__);
+			return ret;
+		}
+		linux_desc->max_speed_hz = desc->max_speed_hz;
+	}
+
+	return 0;
+}
+
 /**
  * @brief Initialize the SPI communication peripheral.
  * @param desc - The SPI descriptor.
@@ -77,20 +148,31 @@ int32_t linux_spi_init(struct no_os_spi_desc **desc,
 {
 	struct linux_spi_desc *linux_desc;
 	struct no_os_spi_desc *descriptor;
-	uint8_t bits = 8;
 	char path[64];
 	int ret;
 
-	descriptor = no_os_malloc(sizeof(*descriptor));
+	descriptor = no_os_calloc(1, sizeof(*descriptor));
 	if (!descriptor)
 		return -1;
 
-	linux_desc = (struct linux_spi_desc*) no_os_malloc(sizeof(
+	linux_desc = (struct linux_spi_desc*) no_os_calloc(1, sizeof(
 				struct linux_spi_desc));
 	if (!linux_desc)
 		goto free_desc;
 
+	linux_desc->tr = no_os_calloc(LINUX_SPI_PREALLOC_MSGS,
+				      sizeof(*linux_desc->tr));
+	if (!linux_desc->tr)
+		goto free_linux_desc;
+	linux_desc->tr_len = LINUX_SPI_PREALLOC_MSGS;
+
 	descriptor->extra = linux_desc;
+	descriptor->device_id = param->device_id;
+	descriptor->max_speed_hz = param->max_speed_hz;
+	descriptor->chip_select = param->chip_select;
+	descriptor->mode = param->mode;
+	descriptor->bit_order = param->bit_order;
+	descriptor->lanes = param->lanes;
 
 	snprintf(path, sizeof(path), "/dev/spidev%d.%d",
 		 param->device_id, param->chip_select);
@@ -101,24 +183,9 @@ int32_t linux_spi_init(struct no_os_spi_desc **desc,
 		goto free;
 	}
 
-	ret = ioctl(linux_desc->spidev_fd, SPI_IOC_WR_MODE,
-		    &param->mode);
-	if (ret == -1) {
-		printf("%s: Can't set SPI mode\n\r", __func__);
-		goto free;
-	}
-
-	ret = ioctl(linux_desc->spidev_fd, SPI_IOC_WR_BITS_PER_WORD,
-		    &bits);
-	if (ret == -1) {
-		printf("%s: Can't set SPI bits per word\n\r", __func__);
-		goto free;
-	}
-
-	ret = ioctl(linux_desc->spidev_fd, SPI_IOC_WR_MAX_SPEED_HZ,
-		    &param->max_speed_hz);
-	if (ret == -1) {
-		printf("%s: Can't set SPI max speed hz\n\r", __func__);
+	ret = linux_spi_update_config(descriptor, true);
+	if (ret) {
+		close(linux_desc->spidev_fd);
 		goto free;
 	}
 
@@ -126,6 +193,8 @@ int32_t linux_spi_init(struct no_os_spi_desc **desc,
 
 	return 0;
 free:
+	no_os_free(linux_desc->tr);
+free_linux_desc:
 	no_os_free(linux_desc);
 free_desc:
 	no_os_free(descriptor);
@@ -154,8 +223,12 @@ int32_t linux_spi_write_and_read(struct no_os_spi_desc *desc,
 
 	linux_desc = desc->extra;
 
+	ret = linux_spi_update_config(desc, false);
+	if (ret)
+		return -1;
+
 	ret = ioctl(linux_desc->spidev_fd, SPI_IOC_MESSAGE(1), &tr);
-	if (ret == 1) {
+	if (ret < 0) {
 		printf("%s: Can't send spi message\n\r", __func__);
 		return -1;
 	}
@@ -181,12 +254,27 @@ int32_t linux_spi_remove(struct no_os_spi_desc *desc)
 		return -1;
 	}
 
+	no_os_free(linux_desc->tr);
 	no_os_free(desc->extra);
 	no_os_free(desc);
 
 	return 0;
 }
 
+/**
+ * @brief Send an array of messages with a single ioctl, using a transfer array
+ * which is only reallocated when it has to grow.
+ *
+ * Chip select stays asserted between messages unless cs_change is set, so a
+ * caller queueing independent register accesses must set cs_change on the
+ * last message of each access. cs_change is ignored on the last message,
+ * spidev always releases chip select at the end of the ioctl.
+ * @param desc - The SPI descriptor.
+ * @param msgs - Array of messages.
+ * @param len - Number of messages in the array, at most LINUX_SPI_MAX_MSGS.
+ * @return 0 in case of success, -E2BIG if there are more messages than a
+ * single ioctl accepts, negative error code otherwise.
+ */
 static int32_t linux_spi_transfer(struct no_os_spi_desc *desc,
 				  struct no_os_spi_msg *msgs,
 				  uint32_t len)
@@ -194,34 +282,52 @@ static int32_t linux_spi_transfer(struct no_os_spi_desc *desc,
 {
 	struct spi_ioc_transfer *tr;
 	struct linux_spi_desc	*linux_desc;
-	int			ret;
 	uint32_t		i;
+	int			ret;
 
 	linux_desc = desc->extra;
 
-	tr = (struct spi_ioc_transfer *)no_os_calloc(len, sizeof(*tr));
-	if (!tr)
-		return -ENOMEM;
+	/*
+	 * Splitting the list would release chip select between two ioctls,
+	 * in the middle of what the caller sent as one transfer.
+	 */
+	if (len > LINUX_SPI_MAX_MSGS)
+		return -E2BIG;
+
+	ret = linux_spi_update_config(desc, false);
+	if (ret)
+		return ret;
 
+	if (len > linux_desc->tr_len) {
+		tr = (struct spi_ioc_transfer *)no_os_calloc(len, sizeof(*tr));
+		if (!tr)
+			return -ENOMEM;
+		no_os_free(linux_desc->tr);
+		linux_desc->tr = tr;
+		linux_desc->tr_len = len;
+	}
+
+	tr = linux_desc->tr;
 	for (i = 0; i < len; i++) {
-		tr[i].tx_buf = (unsigned long) msgs[i].tx_buff;
-		tr[i].rx_buf = (unsigned long) msgs[i].rx_buff;
-		tr[i].len = msgs[i].bytes_number;
-		tr[i].cs_change = msgs[i].cs_change;
-		tr[i].word_delay_usecs = msgs[i].cs_change_delay;
+		tr[i] = (struct spi_ioc_transfer) {
+			.tx_buf = (unsigned long) msgs[i].tx_buff,
+			.rx_buf = (unsigned long) msgs[i].rx_buff,
+			.len = msgs[i].bytes_number,
+			.cs_change = msgs[i].cs_change && i < len - 1,
+			.word_delay_usecs = msgs[i].cs_change_delay,
+		};
 	}
 
 	ret = ioctl(linux_desc->spidev_fd, SPI_IOC_MESSAGE(len), tr);
-
-	no_os_free(tr);
-
 	if (ret < 0) {
-		printf("%s: Can't send spi message (%d)\n\r", __func__, errno);
+		ret = -errno;
+		printf("%s: Can't send spi message (%d)\n\r", __func__, ret);
 		return ret;
 	}
 
 	return 0;
 }
+
 /**
  * @brief Linux platform specific SPI platform ops structure
  */
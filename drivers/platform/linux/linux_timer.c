@@ -37,10 +37,16 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/timerfd.h>
 #include "no_os_error.h"
 #include "no_os_timer.h"
 #include "no_os_alloc.h"
+#include "linux_timer.h"
 
 /******************************************************************************/
 /*************************** Types Declarations *******************************/
@@ -51,17 +57,130 @@
  * @brief Linux platform specific timer descriptor
  */
 struct linux_timer_desc {
-	timer_t		timer_id;
 	bool		enable;
 	struct timespec	start_time;
+	/** timerfd, -1 if the timer has no callback */
+	int		fd;
+	/** Thread running the callback */
+	pthread_t	thread;
+	/** Set to stop the thread */
+	volatile bool	quit;
+	/** Held while the callback runs, so stop can wait for it */
+	pthread_mutex_t	lock;
+	/** Period of the callback */
+	uint64_t	period_ns;
+	/** Callback parameters */
+	struct linux_timer_init_param param;
 };
 
 /******************************************************************************/
 /************************ Functions Definitions *******************************/
 /******************************************************************************/
 
+/**
+ * @brief Arm or disarm the timerfd.
+ * @param linux_desc - Linux timer descriptor.
+ * @param first_ns - Delay until the first expiration, 0 to disarm.
+ * @param period_ns - Period of the next expirations, 0 for a single one.
+ * @return 0 in case of success, negative errno error codes otherwise.
+ */
+static int linux_timer_arm(struct linux_timer_desc *linux_desc,
+			   uint64_t first_ns, uint64_t period_ns)
+{
+	struct itimerspec its;
+
+	memset(&its, 0, sizeof(its));
+	its.it_value.tv_sec = first_ns / 1000000000;
+	its.it_value.tv_nsec = first_ns % 1000000000;
+	its.it_interval.tv_sec = period_ns / 1000000000;
+	its.it_interval.tv_nsec = period_ns % 1000000000;
+
+	if (timerfd_settime(linux_desc->fd, 0, &its, NULL))
+		return -errno;
+
+	return 0;
+}
+
+/**
+ * @brief Thread calling the timer callback on each expiration.
+ *
+ * If the callback takes longer than the period, the missed expirations are
+ * reported as a single read and the callback is called once per expiration.
+ * The callback runs with the descriptor lock held and only while the timer is
+ * enabled, so no callback runs once linux_timer_stop() returns.
+ * @param arg - Linux timer descriptor.
+ * @return NULL
+ */
+static void *linux_timer_thread(void *arg)
+{
+	struct linux_timer_desc *linux_desc = arg;
+	uint64_t expirations;
+	ssize_t ret;
+
+	while (!linux_desc->quit) {
+		ret = read(linux_desc->fd, &expirations, sizeof(expirations));
+		if (ret != sizeof(expirations))
+			continue;
+
+		pthread_mutex_lock(&linux_desc->lock);
+		while (expirations-- && linux_desc->enable && !linux_desc->quit)
+			linux_desc->param.callback(linux_desc->param.ctx);
+		pthread_mutex_unlock(&linux_desc->lock);
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Create the timerfd and the callback thread.
+ * @param linux_desc - Linux timer descriptor.
+ * @return 0 in case of success, negative errno error codes otherwise.
+ */
+static int linux_timer_thread_init(struct linux_timer_desc *linux_desc)
+{
+	struct sched_param sched;
+	pthread_attr_t attr;
+	int ret;
+
+	linux_desc->fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+	if (linux_desc->fd < 0)
+		return -errno;
+
+	ret = pthread_mutex_init(&linux_desc->lock, NULL);
+	if (ret) {
+		close(linux_desc->fd);
+		linux_desc->fd = -1;
+		return -ret;
+	}
+
+	pthread_attr_init(&attr);
+	if (linux_desc->param.rt_priority) {
+		memset(&sched, 0, sizeof(sched));
+		sched.sched_priority = linux_desc->param.rt_priority;
+		pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+		pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+		pthread_attr_setschedparam(&attr, &sched);
+	}
+
+	ret = pthread_create(&linux_desc->thread, &attr, linux_timer_thread,
+			     linux_desc);
+	pthread_attr_destroy(&attr);
+	if (ret) {
+		pthread_mutex_destroy(&linux_desc->lock);
+		close(linux_desc->fd);
+		linux_desc->fd = -1;
+		return -ret;
+	}
+
+	return 0;
+}
+
 /**
  * @brief Timer driver init function
+ *
+ * If param->extra is a struct linux_timer_init_param with a callback, the
+ * callback is called every ticks_count / freq_hz seconds while the timer is
+ * started, from a dedicated thread.
  * @param desc - timer descriptor to be initialized
  * @param param - initialization parameter for the desc
  * @return 0 in case of success, negative errno error codes otherwise.
@@ -71,14 +190,21 @@ int linux_timer_init(struct no_os_timer_desc **desc,
 {
 	struct no_os_timer_desc *descriptor;
 	struct linux_timer_desc *linux_desc;
+	struct linux_timer_init_param *linux_param;
+	int ret;
+
+	if (!desc || !param)
+		return -EINVAL;
 
 	descriptor = no_os_calloc(1, sizeof(*descriptor));
 	if (!descriptor)
 		return -ENOMEM;
 
 	linux_desc = no_os_calloc(1, sizeof(*linux_desc));
-	if (!linux_desc)
+	if (!linux_desc) {
+		ret = -ENOMEM;
 		goto free_desc;
+	}
 
 	descriptor->extra = linux_desc;
 
@@ -86,14 +212,35 @@ int linux_timer_init(struct no_os_timer_desc **desc,
 	descriptor->freq_hz = param->freq_hz;
 	descriptor->ticks_count = param->ticks_count;
 
+	linux_desc->fd = -1;
+	linux_param = param->extra;
+	if (linux_param && linux_param->callback) {
+		if (!param->freq_hz || !param->ticks_count) {
+			ret = -EINVAL;
+			goto free_linux_desc;
+		}
+
+		linux_desc->param = *linux_param;
+		linux_desc->period_ns = (uint64_t)param->ticks_count *
+					1000000000 / param->freq_hz;
+		if (!linux_desc->period_ns)
+			linux_desc->period_ns = 1;
+
+		ret = linux_timer_thread_init(linux_desc);
+		if (ret)
+			goto free_linux_desc;
+	}
+
 	*desc = descriptor;
 
 	return 0;
 
+free_linux_desc:
+	no_os_free(linux_desc);
 free_desc:
 	no_os_free(descriptor);
 
-	return -ENOMEM;
+	return ret;
 }
 
 /**
@@ -103,6 +250,21 @@ free_desc:
  */
 int linux_timer_remove(struct no_os_timer_desc *desc)
 {
+	struct linux_timer_desc *linux_desc;
+
+	if (!desc)
+		return -EINVAL;
+
+	linux_desc = desc->extra;
+	if (linux_desc->fd >= 0) {
+		/* Wake the thread up with a last expiration and wait for it */
+		linux_desc->quit = true;
+		linux_timer_arm(linux_desc, 1, 0);
+		pthread_join(linux_desc->thread, NULL);
+		pthread_mutex_destroy(&linux_desc->lock);
+		close(linux_desc->fd);
+	}
+
 	no_os_free(desc->extra);
 	no_os_free(desc);
 
@@ -112,7 +274,7 @@ int linux_timer_remove(struct no_os_timer_desc *desc)
 /**
  * @brief Timer count start function
  * @param desc - timer descriptor
- * @return 0 in case of success, -EINVAL otherwise.
+ * @return 0 in case of success, negative errno error codes otherwise.
  */
 int linux_timer_start(struct no_os_timer_desc *desc)
 {
@@ -120,26 +282,48 @@ int linux_timer_start(struct no_os_timer_desc *desc)
 
 	linux_desc = desc->extra;
 
-	clock_gettime(CLOCK_REALTIME, &linux_desc->start_time);
+	clock_gettime(CLOCK_MONOTONIC, &linux_desc->start_time);
 	linux_desc->enable = true;
 
+	if (linux_desc->fd >= 0)
+		return linux_timer_arm(linux_desc, linux_desc->period_ns,
+				       linux_desc->period_ns);
+
 	return 0;
 }
 
 /**
  * @brief Timer count stop function
+ *
+ * If a callback is running, wait for it to return. When called from the
+ * callback itself, the callback is not called again after it returns.
  * @param desc - timer descriptor
- * @return 0 in case of success, -EINVAL otherwise.
+ * @return 0 in case of success, negative errno error codes otherwise.
  */
 int linux_timer_stop(struct no_os_timer_desc *desc)
 {
 	struct linux_timer_desc *linux_desc;
+	bool in_callback;
+	int ret;
 
 	linux_desc = desc->extra;
 
+	if (linux_desc->fd < 0) {
+		linux_desc->enable = false;
+		return 0;
+	}
+
+	in_callback = pthread_equal(pthread_self(), linux_desc->thread);
+	if (!in_callback)
+		pthread_mutex_lock(&linux_desc->lock);
+
 	linux_desc->enable = false;
+	ret = linux_timer_arm(linux_desc, 0, 0);
 
-	return 0;
+	if (!in_callback)
+		pthread_mutex_unlock(&linux_desc->lock);
+
+	return ret;
 }
 
 /**
@@ -156,7 +340,7 @@ int linux_timer_counter_get(struct no_os_timer_desc *desc,
 
 	linux_desc = desc->extra;
 
-	clock_gettime(CLOCK_REALTIME, &curr_value);
+	clock_gettime(CLOCK_MONOTONIC, &curr_value);
 
 	curr_value.tv_sec -= linux_desc->start_time.tv_sec;
 
@@ -190,7 +374,7 @@ int linux_timer_counter_set(struct no_os_timer_desc *desc,
 
 	linux_desc = desc->extra;
 
-	clock_gettime(CLOCK_REALTIME, &curr_value);
+	clock_gettime(CLOCK_MONOTONIC, &curr_value);
 
 	linux_desc->start_time.tv_sec = curr_value.tv_sec + new_val / 1000;
 	linux_desc->start_time.tv_nsec = curr_value.tv_nsec +
@@ -230,7 +414,7 @@ int linux_timer_count_clk_set(struct no_os_timer_desc *desc,
 }
 
 /**
- * @brief Not implemented
+ * @brief Function to get the time elapsed since the timer was started
  * @param desc - timer descriptor
  * @param elapsed_time - time in nanoseconds
  * @return 0 in case of success, negative errno error codes otherwise.
@@ -243,7 +427,7 @@ int linux_timer_get_elapsed_time_nsec(struct no_os_timer_desc *desc,
 
 	linux_desc = desc->extra;
 
-	clock_gettime(CLOCK_REALTIME, &curr_value);
+	clock_gettime(CLOCK_MONOTONIC, &curr_value);
 
 	*elapsed_time = curr_value.tv_sec * 1000000000 + curr_value.tv_nsec -
 			linux_desc->start_time.tv_sec * 1000000000 -
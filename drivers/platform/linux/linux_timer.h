@@ -39,6 +39,28 @@
 /******************************************************************************/
 #include "no_os_timer.h"
 
+/**
+ * @struct linux_timer_init_param
+ * @brief Linux specific timer parameters, passed in no_os_timer_init_param
+ * extra.
+ */
+struct linux_timer_init_param {
+	/**
+	 * Called every ticks_count / freq_hz seconds while the timer is
+	 * started. It runs on a thread owned by the timer, so it must
+	 * synchronize with the rest of the application. Stopping the timer
+	 * waits for a running callback to return.
+	 */
+	void (*callback)(void *ctx);
+	/** Parameter passed to callback */
+	void *ctx;
+	/**
+	 * SCHED_FIFO priority (1 to 99) of the callback thread. 0 keeps the
+	 * default scheduling policy. Needs CAP_SYS_NICE.
+	 */
+	int rt_priority;
+};
+
 /**
  * @brief Linux specific timer platform ops.
  */
@@ -88,3 +88,22 @@ struct no_os_time no_os_get_time(void)
 
 	return t;
 }
+
+/**
+ * @brief Get a monotonic timestamp in nanoseconds.
+ * @return Nanoseconds from system start, with SysTick resolution.
+ */
+uint64_t no_os_get_time_ns(void)
+{
+	uint32_t systick_val;
+	uint64_t ticks;
+
+	SysTick->CTRL &= ~(SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk);
+	systick_val = SysTick->VAL;
+	ticks = _system_ticks;
+	SysTick->CTRL |= SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+
+	return ticks * 1000000 +
+	       ((uint64_t)(SysTick->LOAD - systick_val) * 1000000) /
+	       SysTick->LOAD;
+}
@@ -61,3 +61,12 @@ void no_os_mdelay(uint32_t msecs)
 {
 	sleep_ms(msecs);
 }
+
+/**
+ * @brief Get a monotonic timestamp in nanoseconds.
+ * @return Nanoseconds from boot, with microsecond resolution.
+ */
+uint64_t no_os_get_time_ns(void)
+{
+	return time_us_64() * 1000;
+}
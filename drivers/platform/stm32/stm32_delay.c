@@ -94,3 +94,13 @@ struct no_os_time no_os_get_time(void)
 
 	return t;
 }
+
+/**
+ * @brief Get a monotonic timestamp in nanoseconds.
+ * @return Nanoseconds from system start, with HAL tick (millisecond)
+ * resolution.
+ */
+uint64_t no_os_get_time_ns(void)
+{
+	return (uint64_t)HAL_GetTick() * 1000000;
+}
@@ -92,3 +92,24 @@ struct no_os_time no_os_get_time(void)
 
 	return t;
 }
+
+/**
+ * @brief Get a monotonic timestamp in nanoseconds.
+ * @return Nanoseconds from system start, 0 when there is no global timer.
+ */
+uint64_t no_os_get_time_ns(void)
+{
+#ifdef _XPARAMETERS_PS_H_
+	unsigned long long Xtime_Global;
+	uint64_t s;
+	uint32_t rem;
+
+	XTime_GetTime(&Xtime_Global);
+	s = no_os_div_u64_rem(Xtime_Global, COUNTS_PER_SECOND, &rem);
+
+	return s * 1000000000 +
+	       no_os_div_u64((uint64_t)rem * 1000000000, COUNTS_PER_SECOND);
+#else
+	return 0;
+#endif
+}
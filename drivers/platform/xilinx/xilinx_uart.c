@@ -78,8 +78,8 @@ static int32_t uart_fifo_insert(struct no_os_uart_desc *desc)
 		ret = no_os_irq_disable(irq_desc, xil_uart_desc->irq_id);
 		if (ret < 0)
 			return ret;
-		ret = no_os_fifo_insert(&xil_uart_desc->fifo, xil_uart_desc->buff,
-					xil_uart_desc->bytes_received);
+		ret = no_os_fifo_push(xil_uart_desc->fifo, xil_uart_desc->buff,
+				      xil_uart_desc->bytes_received);
 		if (ret < 0)
 			return ret;
 		xil_uart_desc->bytes_received = 0;
@@ -117,25 +117,28 @@ static int32_t xil_uart_read_byte(struct no_os_uart_desc *desc, uint8_t *data)
 	XUartLite *instance = xil_uart_desc->instance;
 #endif
 #ifdef XUARTPS_H
+	struct no_os_fifo_element *elem;
 	int32_t ret;
 #endif
 
 	switch(xil_uart_desc->type) {
 	case UART_PS:
 #ifdef XUARTPS_H
-		while (xil_uart_desc->fifo == NULL) {
+		while (xil_uart_desc->fifo->head == NULL) {
 			/* nothing in fifo, wait until something is received */
 			ret = uart_fifo_insert(desc);
 			if (ret < 0)
 				return ret;
 		}
 
-		*data = xil_uart_desc->fifo->data[xil_uart_desc->fifo_read_offset];
+		elem = xil_uart_desc->fifo->head;
+		*data = elem->data[xil_uart_desc->fifo_read_offset];
 		xil_uart_desc->fifo_read_offset++;
 
-		if (xil_uart_desc->fifo->len - xil_uart_desc->fifo_read_offset <= 0) {
+		if (elem->len - xil_uart_desc->fifo_read_offset <= 0) {
 			xil_uart_desc->fifo_read_offset = 0;
-			xil_uart_desc->fifo = no_os_fifo_remove(xil_uart_desc->fifo);
+			no_os_fifo_release(xil_uart_desc->fifo,
+					   no_os_fifo_pop(xil_uart_desc->fifo));
 		}
 #endif // XUARTPS_H
 		break;
@@ -399,6 +402,12 @@ static int32_t xil_uart_init(struct no_os_uart_desc **desc,
 		xil_uart_desc->instance = no_os_calloc(1, sizeof(XUartPs));
 		if (!(xil_uart_desc->instance))
 			goto error_free_xil_uart_desc;
+
+		status = no_os_fifo_desc_init(&xil_uart_desc->fifo,
+					      UART_BUFF_LENGTH,
+					      UART_FIFO_NB_ELEMENTS);
+		if (status)
+			goto error_free_instance;
 		/*
 		 * Initialize the UART driver so that it's ready to use
 		 * Look up the configuration in the config table, then initialize it.
@@ -469,6 +478,7 @@ static int32_t xil_uart_init(struct no_os_uart_desc **desc,
 	return 0;
 
 error_free_instance:
+	no_os_fifo_desc_remove(xil_uart_desc->fifo);
 	no_os_free(xil_uart_desc->instance);
 error_free_xil_uart_desc:
 	no_os_free(xil_uart_desc);
@@ -486,6 +496,7 @@ error_free_descriptor:
 static int32_t xil_uart_remove(struct no_os_uart_desc *desc)
 {
 	struct xil_uart_desc *xil_uart_desc = desc->extra;
+	no_os_fifo_desc_remove(xil_uart_desc->fifo);
 	no_os_free(xil_uart_desc->instance);
 	no_os_free(xil_uart_desc);
 	no_os_free(desc);
@@ -43,6 +43,7 @@
 /******************************************************************************/
 
 #define UART_BUFF_LENGTH 256
+#define UART_FIFO_NB_ELEMENTS 4
 
 /******************************************************************************/
 /*************************** Types Declarations *******************************/
@@ -85,7 +86,7 @@ struct xil_uart_desc {
 	/** Interrupt Request Descriptor */
 	struct no_os_irq_ctrl_desc *irq_desc;
 	/** FIFO */
-	struct no_os_fifo_element	*fifo;
+	struct no_os_fifo_desc		*fifo;
 	/** FIFO read offset */
 	uint32_t 			fifo_read_offset;
 	/** UART Buffer */
@@ -2843,6 +2843,8 @@
 
 #define MAX_MBYTE_SPI			8
 
+#define AD9361_NUM_REGS			0x400
+
 #define RFPLL_MODULUS			8388593UL
 #define BBPLL_MODULUS			2088960UL
 
@@ -3331,9 +3333,32 @@ enum dev_id {
 	ID_AD9363A
 };
 
+struct ad9361_regcache_stats {
+	/* SPI read transactions issued to the device */
+	uint32_t	spi_reads;
+	/* SPI write transactions issued to the device */
+	uint32_t	spi_writes;
+	/* Read transactions served from the cache */
+	uint32_t	reads_saved;
+	/* Write transactions dropped because the value was unchanged */
+	uint32_t	writes_saved;
+};
+
+struct ad9361_regcache {
+	uint8_t				val[AD9361_NUM_REGS];
+	uint8_t				valid[AD9361_NUM_REGS / 8];
+	uint8_t				dirty[AD9361_NUM_REGS / 8];
+	uint8_t				vol_map[AD9361_NUM_REGS / 8];
+	/* Writes only update the cache until ad9361_regcache_sync() */
+	bool				cache_only;
+	struct ad9361_regcache_stats	stats;
+};
+
 struct ad9361_rf_phy {
 	enum dev_id		dev_sel;
 	struct no_os_spi_desc 	*spi;
+	/* NULL unless built with AD9361_REGCACHE */
+	struct ad9361_regcache	*regcache;
 	struct no_os_gpio_desc 	*gpio_desc_resetb;
 	struct no_os_gpio_desc 	*gpio_desc_sync;
 	struct no_os_gpio_desc 	*gpio_desc_cal_sw1;
@@ -3434,16 +3459,23 @@ enum debugfs_cmd {
 /******************************************************************************/
 /************************ Functions Declarations ******************************/
 /******************************************************************************/
-int32_t ad9361_spi_readm(struct no_os_spi_desc *spi, uint32_t reg,
+int32_t ad9361_spi_readm(struct ad9361_rf_phy *phy, uint32_t reg,
 			 uint8_t *rbuf, uint32_t num);
-int32_t ad9361_spi_read(struct no_os_spi_desc *spi, uint32_t reg);
+int32_t ad9361_spi_read(struct ad9361_rf_phy *phy, uint32_t reg);
 int32_t ad9361_reg_read(struct ad9361_rf_phy *phy,
 			uint32_t reg, uint32_t *val);
-int32_t ad9361_spi_write(struct no_os_spi_desc *spi,
+int32_t ad9361_spi_write(struct ad9361_rf_phy *phy,
 			 uint32_t reg, uint32_t val);
 int32_t ad9361_reg_write(struct ad9361_rf_phy *phy,
 			 uint32_t reg, uint32_t val);
 int32_t ad9361_reset(struct ad9361_rf_phy *phy);
+int32_t ad9361_regcache_init(struct ad9361_rf_phy *phy);
+int32_t ad9361_regcache_remove(struct ad9361_rf_phy *phy);
+void ad9361_regcache_drop(struct ad9361_rf_phy *phy);
+int32_t ad9361_regcache_cache_only(struct ad9361_rf_phy *phy, bool enable);
+int32_t ad9361_regcache_sync(struct ad9361_rf_phy *phy);
+int32_t ad9361_regcache_get_stats(struct ad9361_rf_phy *phy,
+				  struct ad9361_regcache_stats *stats);
 int32_t ad9361_register_clocks(struct ad9361_rf_phy *phy);
 int32_t ad9361_unregister_clocks(struct ad9361_rf_phy *phy);
 uint32_t ad9361_gt(struct ad9361_rf_phy *phy);
@@ -16,6 +16,19 @@
 #include <stdbool.h>
 #include <string.h>
 
+/*
+ * Optional HAL hooks, NULL unless the platform HAL defines them. Without them
+ * the API reads the CPU and stream images in 1 KiB chunks.
+ */
+__attribute__((weak)) int32_t (*adrv9025_hal_CpuImageGet)(void *devHalCfg,
+		const char *imagePath,
+		const uint8_t **image,
+		uint32_t *byteCount) = NULL;
+__attribute__((weak)) int32_t (*adrv9025_hal_StreamImageGet)(void *devHalCfg,
+		const char *imagePath,
+		const uint8_t **image,
+		uint32_t *byteCount) = NULL;
+
 static int __adrv9025_of_get_param(void *out_value, void *in_value,
 				   uint32_t defval, uint32_t size, uint32_t min, uint32_t max)
 {
@@ -119,6 +119,10 @@ extern
 #define ADI_ADRV9025_CPU_BINARY_IMAGE_LOAD_CHUNK_SIZE_BYTES (1024) /*Please ensure that the CPU FW bin size is perfectly divisible by the chunk size*/
 #endif
 
+#ifndef ADI_ADRV9025_BINARY_IMAGE_BURST_SIZE_BYTES
+#define ADI_ADRV9025_BINARY_IMAGE_BURST_SIZE_BYTES (32*1024) /*Burst size of the CPU and Stream images written in place, see adrv9025_hal_CpuImageGet. Multiple of 4, at least 68*/
+#endif
+
 /* TODO: A few examples for timeout and interval values, remove once new code added */
 
 /* These values can be modified by the end user to adjust how active the SPI reads are
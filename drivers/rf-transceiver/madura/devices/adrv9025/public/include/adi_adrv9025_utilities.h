@@ -70,6 +70,9 @@ int32_t adi_adrv9025_ArmImageLoad(adi_adrv9025_Device_t* device,
 * in adi_adrv9025_user.h could potentially cause the stack to crash. Please optimize the chunk size
 * in accordance with the stack space available
 *
+* If the HAL sets adrv9025_hal_CpuImageGet and it returns the image for a path, the image is written
+* straight from that memory in ADI_ADRV9025_BINARY_IMAGE_BURST_SIZE_BYTES bursts, without reading the file.
+*
 * \param device Pointer to the ADRV9025 device data structure containing settings
 * \param fwImagePath is a string containing absolute path of the FW image to be programmed
 *
@@ -95,6 +98,9 @@ int32_t adi_adrv9025_CpuImageLoad(adi_adrv9025_Device_t* device,
 * in adi_adrv9025_user.h could potentially cause the stack to crash. Please optimize the chunk size
 * in accordance with the stack space available.
 *
+* If the HAL sets adrv9025_hal_StreamImageGet and it returns the image, the image is written straight
+* from that memory in ADI_ADRV9025_BINARY_IMAGE_BURST_SIZE_BYTES bursts, without reading the file.
+*
 * \param device Pointer to the ADRV9025 device data structure containing settings
 * \param streamImagePath is a string containing absolute path of the stream image to be programmed
 *
@@ -327,6 +327,61 @@ int32_t adi_adrv9025_StreamImageLoad(adi_adrv9025_Device_t *device, const char *
 
 #else
 
+/* Writes an image the HAL holds in memory straight from that memory, in
+ * bursts of ADI_ADRV9025_BINARY_IMAGE_BURST_SIZE_BYTES. cpuType is
+ * ADI_ADRV9025_CPU_TYPE_UNKNOWN for the stream image. */
+static int32_t adrv9025_InPlaceImageWrite(adi_adrv9025_Device_t* device,
+                                          adi_adrv9025_CpuType_e cpuType,
+                                          const char*            imagePath,
+                                          const uint8_t          image[],
+                                          uint32_t               byteCount,
+                                          uint32_t               maxByteCount)
+{
+    uint32_t offset    = 0u;
+    uint32_t burstSize = 0u;
+
+    /*Check that the image is not empty, does not exceed the maximum size and is a multiple of 4*/
+    if ((image == NULL) || (byteCount == 0u) || (byteCount > maxByteCount) || ((byteCount % 4u) != 0u))
+    {
+        ADI_ERROR_REPORT(&device->common,
+                         ADI_COMMON_ERRSRC_API,
+                         ADI_COMMON_ERR_INV_PARAM,
+                         ADI_COMMON_ACT_ERR_CHECK_PARAM,
+                         imagePath,
+                         "Invalid in place binary image. It must be non empty, within the maximum image size and a multiple of 4");
+        ADI_ERROR_RETURN(device->common.error.newAction);
+    }
+
+    for (offset = 0u; offset < byteCount; offset += burstSize)
+    {
+        burstSize = byteCount - offset;
+        if (burstSize > ADI_ADRV9025_BINARY_IMAGE_BURST_SIZE_BYTES)
+        {
+            burstSize = ADI_ADRV9025_BINARY_IMAGE_BURST_SIZE_BYTES;
+        }
+
+        if (cpuType == ADI_ADRV9025_CPU_TYPE_UNKNOWN)
+        {
+            /* The stream image is only read, the API just lacks the const qualifier */
+            adi_adrv9025_StreamImageWrite(device,
+                                          offset,
+                                          (uint8_t*)&image[offset],
+                                          burstSize);
+        }
+        else
+        {
+            adi_adrv9025_CpuImageWrite(device,
+                                       cpuType,
+                                       offset,
+                                       &image[offset],
+                                       burstSize);
+        }
+        ADI_ERROR_RETURN(device->common.error.newAction);
+    }
+
+    return device->common.error.newAction;
+}
+
 int32_t adi_adrv9025_ArmImageLoad(adi_adrv9025_Device_t* device,
                                   const char*            armImagePath)
 {
@@ -346,6 +401,7 @@ int32_t adi_adrv9025_CpuImageLoad(adi_adrv9025_Device_t* device,
     static const size_t BIN_ELEMENT_SIZE = 1;
 
     FILE*       fwImageFilePointer = NULL;
+    const uint8_t* image           = NULL;
     uint32_t    fileSize           = 0;
     uint32_t    numFileChunks      = 0;
     uint32_t    i                  = 0;
@@ -391,6 +447,25 @@ int32_t adi_adrv9025_CpuImageLoad(adi_adrv9025_Device_t* device,
     {
         char* fwImagePath = paths[j];
 
+        /*Write the image in place if the HAL holds it in memory*/
+        if ((adrv9025_hal_CpuImageGet != NULL) &&
+            (fwImagePath[0] != 0u) &&
+            (adrv9025_hal_CpuImageGet(device->common.devHalInfo,
+                                      fwImagePath,
+                                      &image,
+                                      &fileSize) == ADI_COMMON_ACT_NO_ACTION))
+        {
+            adrv9025_InPlaceImageWrite(device,
+                                       (adi_adrv9025_CpuType_e)j,
+                                       fwImagePath,
+                                       image,
+                                       fileSize,
+                                       ((adi_adrv9025_CpuType_e)j == ADI_ADRV9025_CPU_TYPE_C) ? ADI_ADRV9025_CPU_C_BINARY_IMAGE_FILE_SIZE_BYTES
+                                           : ADI_ADRV9025_CPU_D_BINARY_IMAGE_FILE_SIZE_BYTES);
+            ADI_ERROR_RETURN(device->common.error.newAction);
+            continue;
+        }
+
         /*Open ARM binary file*/
 #ifdef __GNUC__
         fwImageFilePointer = fopen(fwImagePath,
@@ -559,11 +634,12 @@ int32_t adi_adrv9025_StreamImageLoad(adi_adrv9025_Device_t* device,
 {
     static const size_t BIN_ELEMENT_SIZE = 1;
 
-    FILE*    streamImageFilePointer = NULL;
-    uint32_t fileSize               = 0;
-    uint32_t numFileChunks          = 0;
-    uint32_t i                      = 0;
-    uint8_t  streamBinaryImageBuffer[ADI_ADRV9025_STREAM_BINARY_IMAGE_LOAD_CHUNK_SIZE_BYTES];
+    FILE*          streamImageFilePointer = NULL;
+    const uint8_t* image                  = NULL;
+    uint32_t       fileSize               = 0;
+    uint32_t       numFileChunks          = 0;
+    uint32_t       i                      = 0;
+    uint8_t        streamBinaryImageBuffer[ADI_ADRV9025_STREAM_BINARY_IMAGE_LOAD_CHUNK_SIZE_BYTES];
 
     /* Check device pointer is not null */
     ADI_NULL_DEVICE_PTR_RETURN(device);
@@ -571,6 +647,24 @@ int32_t adi_adrv9025_StreamImageLoad(adi_adrv9025_Device_t* device,
     ADI_FUNCTION_ENTRY_LOG(&device->common,
                            ADI_COMMON_LOG_API);
 
+    /* Write the image in place if the HAL holds it in memory */
+    if ((adrv9025_hal_StreamImageGet != NULL) &&
+        (adrv9025_hal_StreamImageGet(device->common.devHalInfo,
+                                     streamImagePath,
+                                     &image,
+                                     &fileSize) == ADI_COMMON_ACT_NO_ACTION))
+    {
+        adrv9025_InPlaceImageWrite(device,
+                                   ADI_ADRV9025_CPU_TYPE_UNKNOWN,
+                                   streamImagePath,
+                                   image,
+                                   fileSize,
+                                   ADI_ADRV9025_STREAM_BINARY_IMAGE_FILE_SIZE_BYTES);
+        ADI_ERROR_RETURN(device->common.error.newAction);
+
+        return device->common.error.newAction;
+    }
+
     /* Open ARM binary file */
 #ifdef __GNUC__
     streamImageFilePointer = fopen(streamImagePath,
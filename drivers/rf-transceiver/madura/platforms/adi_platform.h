@@ -85,6 +85,22 @@ extern int32_t (*adi_hal_CustomSpiStreamRead)(void*          devHalCfg,
                                               uint8_t        numBytesofAddress,
                                               uint8_t        numBytesOfDataPerStream);
 
+/**
+ * Optional in place access to the CPU and Stream binary images. When a getter is set and succeeds for a path,
+ * adi_adrv9025_CpuImageLoad() / adi_adrv9025_StreamImageLoad() write the image straight from the returned
+ * memory in ADI_ADRV9025_BINARY_IMAGE_BURST_SIZE_BYTES bursts instead of reading the file in chunks.
+ * The no-OS driver (adrv9025.c) provides weak NULL definitions.
+ */
+extern int32_t (*adrv9025_hal_CpuImageGet)(void*           devHalCfg,
+                                           const char*     imagePath,
+                                           const uint8_t** image,
+                                           uint32_t*       byteCount);
+
+extern int32_t (*adrv9025_hal_StreamImageGet)(void*           devHalCfg,
+                                              const char*     imagePath,
+                                              const uint8_t** image,
+                                              uint32_t*       byteCount);
+
 /**
  * BBIC Logging functions
  */
@@ -31,6 +31,7 @@
  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *******************************************************************************/
 #include <stdint.h>
+#include <string.h>
 #include "no_os_error.h"
 #include "no_os_util.h"
 #include "no_os_print_log.h"
@@ -51,6 +52,7 @@
 #include "adi_adrv9001_fh_types.h"
 #include "adi_adrv9001_gpio.h"
 #include "adi_adrv9001_gpio_types.h"
+#include "adi_adrv9001_hal.h"
 #include "adi_adrv9001_orx.h"
 #include "adi_adrv9001_powermanagement.h"
 #include "adi_adrv9001_powermanagement_types.h"
@@ -94,6 +96,16 @@
 #define ADRV9002_HP_CLK_PLL_DAHZ	884736000
 #define ADRV9002_NO_EXT_LO             0xff
 
+/*
+ * Firmware images are written in bursts of this many bytes (multiple of 4).
+ * ADRV9002_ARM_IMAGE_CRC32 and ADRV9002_STREAM_IMAGE_CRC32 can also be set to
+ * have the loaded images checked against a known CRC32.
+ * Can be overridden from the project build flags.
+ */
+#ifndef ADRV9002_FW_BURST_SZ
+#define ADRV9002_FW_BURST_SZ		(32 * 1024)
+#endif
+
 /* Frequency hopping */
 #define ADRV9002_FH_TABLE_COL_SZ	5
 
@@ -658,9 +670,133 @@ static int adrv9002_power_mgmt_config(const struct adrv9002_rf_phy *phy)
 	return api_call(phy, adi_adrv9001_powermanagement_Configure, &power_mgmt);
 }
 
-static int adrv9002_digital_init(const struct adrv9002_rf_phy *phy)
+/*
+ * Optional HAL hooks, NULL unless the platform HAL defines them. Without them
+ * adrv9002_fw_load() uses the page by page loader of the API.
+ */
+__attribute__((weak)) int32_t (*adi_hal_ArmImageGet)(void *devHalCfg,
+		const char *armImagePath,
+		const uint8_t **image,
+		uint32_t *byteCount) = NULL;
+__attribute__((weak)) int32_t (*adi_hal_StreamImageGet)(void *devHalCfg,
+		const char *streamImagePath,
+		const uint8_t **image,
+		uint32_t *byteCount) = NULL;
+
+static const uint32_t adrv9002_crc32_lut[16] = {
+	0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+	0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+	0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+	0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+/* CRC32 (IEEE 802.3), can be chained over consecutive chunks */
+static uint32_t adrv9002_crc32(uint32_t crc, const uint8_t *buf, uint32_t len)
+{
+	crc = ~crc;
+	while (len--) {
+		crc ^= *buf++;
+		crc = (crc >> 4) ^ adrv9002_crc32_lut[crc & 0xf];
+		crc = (crc >> 4) ^ adrv9002_crc32_lut[crc & 0xf];
+	}
+
+	return ~crc;
+}
+
+static uint32_t adrv9002_elapsed_us(struct no_os_time start)
+{
+	struct no_os_time now = no_os_get_time();
+
+	return (now.s - start.s) * 1000000 + now.us - start.us;
+}
+
+/*
+ * Writes the ARM or stream image straight from the buffer handed out by the
+ * HAL in ADRV9002_FW_BURST_SZ bursts, so the DMA setup is done once per burst
+ * instead of once per page. The CRC32 is computed on each burst before it is
+ * sent and, if @exp_crc is given, checked once the last burst is out (the ARM
+ * is not started yet at this point). Falls back to the page by page loader if
+ * the HAL cannot hand out the whole image.
+ */
+static int adrv9002_fw_load(struct adrv9002_rf_phy *phy, bool arm,
+			    const char *path, int spi_mode,
+			    const uint32_t *exp_crc,
+			    struct adrv9002_fw_load_stats *stats)
+{
+	int32_t (*get)(void *devHalCfg, const char *path,
+		       const uint8_t **image, uint32_t *size);
+	void *hal = phy->adrv9001->common.devHalInfo;
+	struct no_os_time start;
+	const uint8_t *image;
+	uint32_t size, off, len;
+	int ret;
+
+	memset(stats, 0, sizeof(*stats));
+	get = arm ? adi_hal_ArmImageGet : adi_hal_StreamImageGet;
+
+	start = no_os_get_time();
+	if (!get || get(hal, path, &image, &size) || size < 8 || size % 4) {
+		if (arm)
+			ret = api_call(phy,
+				       adi_adrv9001_Utilities_ArmImage_Load,
+				       path, spi_mode);
+		else
+			ret = api_call(phy,
+				       adi_adrv9001_Utilities_StreamImage_Load,
+				       path, spi_mode);
+		stats->write_us = adrv9002_elapsed_us(start);
+
+		return ret;
+	}
+	stats->get_us = adrv9002_elapsed_us(start);
+
+	for (off = 0; off < size; off += len) {
+		len = no_os_min(size - off, (uint32_t)ADRV9002_FW_BURST_SZ);
+
+		start = no_os_get_time();
+		stats->crc = adrv9002_crc32(stats->crc, &image[off], len);
+		stats->crc_us += adrv9002_elapsed_us(start);
+
+		start = no_os_get_time();
+		if (arm)
+			ret = api_call(phy, adi_adrv9001_arm_Image_Write, off,
+				       &image[off], len, spi_mode);
+		else
+			ret = api_call(phy, adi_adrv9001_Stream_Image_Write,
+				       off, (uint8_t *)&image[off], len,
+				       spi_mode);
+		stats->write_us += adrv9002_elapsed_us(start);
+		if (ret)
+			return ret;
+
+		stats->bytes += len;
+	}
+
+	if (exp_crc && stats->crc != *exp_crc) {
+		pr_err("%s: CRC32 %08X, expected %08X\n", path, stats->crc,
+		       *exp_crc);
+		return -EBADMSG;
+	}
+
+	pr_debug("%s: %u bytes, get %u us, crc %u us, write %u us\n", path,
+		 stats->bytes, stats->get_us, stats->crc_us, stats->write_us);
+
+	return 0;
+}
+
+static int adrv9002_digital_init(struct adrv9002_rf_phy *phy)
 {
 	int spi_mode = ADI_ADRV9001_ARM_SINGLE_SPI_WRITE_MODE_STANDARD_BYTES_252;
+#ifdef ADRV9002_ARM_IMAGE_CRC32
+	static const uint32_t arm_crc[] = { ADRV9002_ARM_IMAGE_CRC32 };
+#else
+	static const uint32_t *arm_crc;
+#endif
+#ifdef ADRV9002_STREAM_IMAGE_CRC32
+	static const uint32_t stream_crc[] = { ADRV9002_STREAM_IMAGE_CRC32 };
+#else
+	static const uint32_t *stream_crc;
+#endif
 	int ret;
 	uint8_t tx_mask = 0;
 	int c;
@@ -681,14 +817,15 @@ static int adrv9002_digital_init(const struct adrv9002_rf_phy *phy)
 		ret = api_call(phy, adi_adrv9001_Stream_Image_Write, 0, phy->stream_buf,
 			       phy->stream_size, spi_mode);
 	else
-		ret = api_call(phy, adi_adrv9001_Utilities_StreamImage_Load,
-			       "Navassa_Stream.bin", spi_mode);
+		ret = adrv9002_fw_load(phy, false, "Navassa_Stream.bin",
+				       spi_mode, stream_crc,
+				       &phy->stream_stats);
 	if (ret)
 		return ret;
 
 	/* program arm firmware */
-	ret = api_call(phy, adi_adrv9001_Utilities_ArmImage_Load,
-		       "Navassa_EvaluationFw.bin", spi_mode);
+	ret = adrv9002_fw_load(phy, true, "Navassa_EvaluationFw.bin", spi_mode,
+			       arm_crc, &phy->arm_stats);
 	if (ret)
 		return ret;
 
@@ -208,6 +208,20 @@ struct adrv9002_ext_lo {
 	unsigned short divider;
 };
 
+/* statistics of the last firmware image load */
+struct adrv9002_fw_load_stats {
+	/* bytes written to the device */
+	uint32_t bytes;
+	/* CRC32 of the written image */
+	uint32_t crc;
+	/* time spent getting the image from the HAL */
+	uint32_t get_us;
+	/* time spent writing the image over SPI */
+	uint32_t write_us;
+	/* time spent computing the checksum */
+	uint32_t crc_us;
+};
+
 struct adrv9002_rf_phy {
 	const struct adrv9002_chip_info *chip;
 	struct spi_device		*spi;
@@ -222,6 +236,8 @@ struct adrv9002_rf_phy {
 	size_t                      	profile_len;
 	uint8_t				*stream_buf;
 	uint16_t			stream_size;
+	struct adrv9002_fw_load_stats	stream_stats;
+	struct adrv9002_fw_load_stats	arm_stats;
 	struct adrv9002_fh_bin_table	fh_table_bin_attr[ADRV9002_FH_BIN_ATTRS_CNT];
 	adi_adrv9001_FhCfg_t		fh;
 	struct adrv9002_rx_chan		rx_channels[ADRV9002_CHANN_MAX];
@@ -141,6 +141,42 @@ extern int32_t(*adi_hal_StreamImagePageGet)(void *devHalCfg,
                                             uint32_t pageSize, 
                                             uint8_t *rdBuff);
 
+/**
+ * \brief Retrieve the whole ARM firmware binary in place
+ *
+ * Optional. When set, the image is written to the device straight from the returned buffer in large bursts
+ * instead of being copied one page at a time through adi_hal_ArmImagePageGet. The no-OS driver (adrv9002.c)
+ * provides a weak NULL definition, so a HAL only defines this pointer if the image is memory mapped.
+ *
+ * \param[in]  devHalCfg        User-defined context variable
+ * \param[in]  armImagePath     The "file path" (or generally a string identifier) of the firmware binary
+ * \param[out] image            Pointer to the binary, valid until the load completes
+ * \param[out] byteCount        The size of the binary in bytes
+ *
+ * \returns 0 to indicate success, negative values to indicate error.
+ */
+extern int32_t(*adi_hal_ArmImageGet)(void *devHalCfg,
+                                     const char *armImagePath,
+                                     const uint8_t **image,
+                                     uint32_t *byteCount);
+
+/**
+ * \brief Retrieve the whole stream binary in place
+ *
+ * Optional, with a weak NULL definition as well. Same as adi_hal_ArmImageGet but for the stream binary.
+ *
+ * \param[in]  devHalCfg        User-defined context variable
+ * \param[in]  streamImagePath  The "file path" (or generally a string identifier) of the stream binary
+ * \param[out] image            Pointer to the binary, valid until the load completes
+ * \param[out] byteCount        The size of the binary in bytes
+ *
+ * \returns 0 to indicate success, negative values to indicate error.
+ */
+extern int32_t(*adi_hal_StreamImageGet)(void *devHalCfg,
+                                        const char *streamImagePath,
+                                        const uint8_t **image,
+                                        uint32_t *byteCount);
+
 /**
  * \brief Retrieve a row of the Rx or ORx gain table
  * 
@@ -41,6 +41,7 @@
 #include "no_os_delay.h"
 #include "no_os_error.h"
 #include "no_os_alloc.h"
+#include "no_os_util.h"
 
 /******************************************************************************/
 /********************** Macros and Constants Definitions **********************/
@@ -70,6 +71,7 @@
 #define STUFF_ARG			(0x00000000u)
 #define CMD8_ARG			(0x000001AAu)
 #define ACMD41_ARG			(0x40000000u)
+#define ACMD23_MAX_BLOCKS		(0x007FFFFFu)
 
 #define DATA_BLOCK_BITS			(9u)
 #define MASK_ADDR_IN_BLOCK		(DATA_BLOCK_LEN - 1u)
@@ -100,6 +102,8 @@ static int32_t wait_for_response(struct sd_desc *sd_desc, uint8_t *data_out)
 	ret = -1;
 	not_timeout = WAIT_RESP_TIMEOUT;
 	do {
+		/* Keep MOSI high, other values may be taken as a command */
+		*data_out = 0xFF;
 		if (0 != no_os_spi_write_and_read(sd_desc->spi_desc,
 						  data_out, 1))
 			break;
@@ -170,7 +174,8 @@ static int32_t send_command(struct sd_desc *sd_desc, struct cmd_desc *cmd_desc)
 		cmd_desc_local.response_len = R1_LEN;
 		if (0 != send_command(sd_desc, &cmd_desc_local))
 			return -1;
-		if (cmd_desc_local.response[0] != R1_IDLE_STATE) {
+		/* The card is idle during initialization and ready after */
+		if (cmd_desc_local.response[0] & ~R1_IDLE_STATE) {
 			DEBUG_MSG("Not the expected response for CMD55\n");
 			return -1;
 		}
@@ -222,8 +227,13 @@ static int32_t write_block(struct sd_desc *sd_desc, uint8_t *data,
 	if (0 != no_os_spi_write_and_read(sd_desc->spi_desc, sd_desc->buff, 1))
 		return -1;
 
-	/* Send data with CRC */
-	if (0 != no_os_spi_write_and_read(sd_desc->spi_desc, data, DATA_BLOCK_LEN))
+	/*
+	 * Send data with CRC. The SPI transfer overwrites the buffer with the
+	 * received bytes, so a copy is sent to keep the data of the caller.
+	 */
+	memcpy(sd_desc->block_buff, data, DATA_BLOCK_LEN);
+	if (0 != no_os_spi_write_and_read(sd_desc->spi_desc,
+					  sd_desc->block_buff, DATA_BLOCK_LEN))
 		return -1;
 	*((uint16_t *)sd_desc->buff) = 0xFFFF;
 	if (0 != no_os_spi_write_and_read(sd_desc->spi_desc, sd_desc->buff, CRC_LEN))
@@ -401,25 +411,79 @@ static int32_t read_multiple_blocks(struct sd_desc *sd_desc,
 }
 
 /**
- * Read data of size len from the specified address and store it in data.
- * This operation returns only when the read is complete
+ * Send the command starting a write of nb_of_blocks blocks
+ * @param sd_desc	- Instance of the SD card
+ * @param block		- First block to be written
+ * @param nb_of_blocks	- Number of blocks written, 0 for a multiple block
+ * 			  write of unknown length
+ * @param pre_erase	- Number of blocks to be pre-erased, 0 for none. The
+ * 			  card erases them ahead of the data instead of
+ * 			  stalling on each block.
+ * @return 0 in case of success, -1 otherwise.
+ */
+static int32_t start_write(struct sd_desc *sd_desc, uint64_t block,
+			   uint32_t nb_of_blocks, uint32_t pre_erase)
+{
+	struct cmd_desc	cmd_desc;
+
+	if (pre_erase) {
+		cmd_desc.cmd = ACMD(23);
+		cmd_desc.arg = no_os_min(pre_erase, ACMD23_MAX_BLOCKS);
+		cmd_desc.response_len = R1_LEN;
+		if (0 != send_command(sd_desc, &cmd_desc))
+			return -1;
+		if (cmd_desc.response[0] != R1_READY_STATE) {
+			DEBUG_MSG("Failed to set the pre-erase count\n");
+			return -1;
+		}
+	}
+
+	cmd_desc.cmd = (nb_of_blocks == 1) ? CMD(24) : CMD(25);
+	cmd_desc.arg = block;
+	cmd_desc.response_len = R1_LEN;
+	if (0 != send_command(sd_desc, &cmd_desc))
+		return -1;
+	if (cmd_desc.response[0] != R1_READY_STATE) {
+		DEBUG_MSG("Failed to write Data command\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+ * End a write started with start_write()
+ * @param sd_desc	- Instance of the SD card
+ * @param nb_of_blocks	- Number of blocks given to start_write()
+ * @return 0 in case of success, -1 otherwise.
+ */
+static int32_t stop_write(struct sd_desc *sd_desc, uint32_t nb_of_blocks)
+{
+	if (nb_of_blocks == 1)
+		return 0;
+
+	/* Send stop transmission token */
+	sd_desc->buff[0] = STOP_TRANSMISSION_TOKEN;
+	sd_desc->buff[1] = 0xFF;
+	if (0 != no_os_spi_write_and_read(sd_desc->spi_desc, sd_desc->buff, 2))
+		return -1;
+
+	return wait_until_not_busy(sd_desc);
+}
+
+/**
+ * Read data of size len from the specified address, without using the cache
  * @param sd_desc	- Instance of the SD card
  * @param data		- Where data will be read
  * @param address	- Address in memory from where data will be read
  * @param len		- Length in bytes of data to be read
  * @return 0 in case of success, -1 otherwise.
  */
-int32_t sd_read(struct sd_desc *sd_desc,
-		uint8_t *data, uint64_t address, uint64_t len)
+static int32_t read_uncached(struct sd_desc *sd_desc,
+			     uint8_t *data, uint64_t address, uint64_t len)
 {
 	struct cmd_desc	cmd_desc;
 
-	/* Initial checks */
-	if (data == NULL || address > sd_desc->memory_size ||
-	    len > sd_desc->memory_size ||
-	    address + len > sd_desc->memory_size)
-		return -1;
-
 	/* Send read command */
 	cmd_desc.cmd = (get_nb_of_blocks(address, len) == 1) ? CMD(17): CMD(18);
 	cmd_desc.arg = address >> DATA_BLOCK_BITS;;
@@ -452,68 +516,418 @@ int32_t sd_read(struct sd_desc *sd_desc,
 }
 
 /**
- * Write data of size len to the specified address
- * This operation returns only when the write is complete
+ * Write data of size len to the specified address, without using the cache
  * @param sd_desc	- Instance of the SD card
  * @param data		- Data to write
  * @param address	- Address in memory where data will be written
  * @param len		- Length of data in bytes
  * @return 0 in case of success, -1 otherwise.
  */
-int32_t sd_write(struct sd_desc *sd_desc, uint8_t *data, uint64_t address,
-		 uint64_t len)
+static int32_t write_uncached(struct sd_desc *sd_desc, uint8_t *data,
+			      uint64_t address, uint64_t len)
 {
-	struct cmd_desc	cmd_desc;
 	uint8_t		first_block[DATA_BLOCK_LEN] __attribute__ ((aligned));
 	uint8_t		last_block[DATA_BLOCK_LEN] __attribute__ ((aligned));
-
-	/* Initial checks */
-	if (data == NULL || address > sd_desc->memory_size ||
-	    len > sd_desc->memory_size || address + len > sd_desc->memory_size)
-		return -1;
+	uint32_t	nb_of_blocks = get_nb_of_blocks(address, len);
 
 	/* Read first and last block in memory if needed to be updated with user data and then written back                                                                        */
 	/* If not writing from the beginning of a block or */
 	if ((address & MASK_ADDR_IN_BLOCK) != 0 ||
 	    /* If writing from the beginning but not the full block */
 	    ((address & MASK_ADDR_IN_BLOCK) == 0 && len < DATA_BLOCK_LEN))
-		sd_read(sd_desc, first_block, address & MASK_BLOCK_NUMBER, DATA_BLOCK_LEN);
+		if (0 != read_uncached(sd_desc, first_block,
+				       address & MASK_BLOCK_NUMBER,
+				       DATA_BLOCK_LEN))
+			return -1;
 	/* If the last block is different from the first and */
 	if (((address + len - 1) & MASK_BLOCK_NUMBER) != (address & MASK_BLOCK_NUMBER)
 	    /* If reading less than the full block */
 	    && ((address + len - 1) & MASK_ADDR_IN_BLOCK) != MASK_ADDR_IN_BLOCK)
-		sd_read(sd_desc, last_block, (address + len - 1) & MASK_BLOCK_NUMBER,
-			DATA_BLOCK_LEN);
+		if (0 != read_uncached(sd_desc, last_block,
+				       (address + len - 1) & MASK_BLOCK_NUMBER,
+				       DATA_BLOCK_LEN))
+			return -1;
 
-	/* Send write command to SD */
-	cmd_desc.cmd = (get_nb_of_blocks(address, len) == 1) ? CMD(24): CMD(25);
-	cmd_desc.arg = address >> DATA_BLOCK_BITS; //Address of first block
-	cmd_desc.response_len = R1_LEN;
-	if (0 != send_command(sd_desc, &cmd_desc))
+	/* Send write command, pre-erasing the blocks of a multiple write */
+	if (0 != start_write(sd_desc, address >> DATA_BLOCK_BITS, nb_of_blocks,
+			     nb_of_blocks > 1 ? nb_of_blocks : 0))
 		return -1;
-	if (cmd_desc.response[0] != R1_READY_STATE) {
-		DEBUG_MSG("Failed to write Data command\n");
-		return -1;
-	}
 
 	/* Write blocks */
 	if (0 != write_multiple_blocks(sd_desc, data, address, len,
 				       first_block, last_block))
 		return -1;
 
-	/* Send stop transmission token */
-	if (get_nb_of_blocks(address, len) != 1) {
-		sd_desc->buff[0] = STOP_TRANSMISSION_TOKEN;
-		sd_desc->buff[1] = 0xFF;
-		if (0 != no_os_spi_write_and_read(sd_desc->spi_desc, sd_desc->buff, 2))
+	return stop_write(sd_desc, nb_of_blocks);
+}
+
+/**
+ * Find a block in the cache
+ * @param sd_desc	- Instance of the SD card
+ * @param block		- Number of the block
+ * @return The cache entry of the block or NULL if it is not cached.
+ */
+static struct sd_cache_entry *cache_find(struct sd_desc *sd_desc,
+		uint64_t block)
+{
+	uint32_t i;
+
+	for (i = 0; i < sd_desc->cache_blocks; i++)
+		if (sd_desc->cache[i].valid && sd_desc->cache[i].block == block)
+			return &sd_desc->cache[i];
+
+	return NULL;
+}
+
+/**
+ * Count the consecutive blocks not present in the cache
+ * @param sd_desc	- Instance of the SD card
+ * @param block		- First block
+ * @param max		- Maximum number of blocks to count
+ * @return Number of uncached blocks starting with block.
+ */
+static uint64_t cache_miss_run(struct sd_desc *sd_desc, uint64_t block,
+			       uint64_t max)
+{
+	uint64_t n;
+
+	for (n = 0; n < max; n++)
+		if (cache_find(sd_desc, block + n))
+			break;
+
+	return n;
+}
+
+/**
+ * Get the cache entry of a block, reusing the least recently used entry if
+ * the block is not cached. A dirty entry is written to the card before reuse.
+ * @param sd_desc	- Instance of the SD card
+ * @param block		- Number of the block
+ * @param load		- Read the block from the card if it is not cached.
+ * 			  Not needed when the entire block will be written.
+ * @param entry		- The cache entry of the block is stored here
+ * @return 0 in case of success, -1 otherwise.
+ */
+static int32_t cache_get(struct sd_desc *sd_desc, uint64_t block, bool load,
+			 struct sd_cache_entry **entry)
+{
+	struct sd_cache_entry	*e;
+	uint32_t		i;
+
+	e = cache_find(sd_desc, block);
+	if (!e) {
+		e = &sd_desc->cache[0];
+		for (i = 1; i < sd_desc->cache_blocks && e->valid; i++)
+			if (!sd_desc->cache[i].valid ||
+			    sd_desc->cache_clock - sd_desc->cache[i].last_use >
+			    sd_desc->cache_clock - e->last_use)
+				e = &sd_desc->cache[i];
+
+		if (e->valid && e->dirty &&
+		    0 != write_uncached(sd_desc, e->data,
+					e->block << DATA_BLOCK_BITS,
+					DATA_BLOCK_LEN))
 			return -1;
-		if (0 != wait_until_not_busy(sd_desc))
+
+		e->valid = false;
+		e->dirty = false;
+		if (load && 0 != read_uncached(sd_desc, e->data,
+					       block << DATA_BLOCK_BITS,
+					       DATA_BLOCK_LEN))
 			return -1;
+		e->block = block;
+		e->valid = true;
 	}
+	e->last_use = ++sd_desc->cache_clock;
+	*entry = e;
 
 	return 0;
 }
 
+/**
+ * End the multiple block write of an active stream, so other commands can be
+ * sent. The next sd_stream_write() starts a new one where the stream stopped.
+ * @param sd_desc	- Instance of the SD card
+ * @return 0 in case of success, -1 otherwise.
+ */
+static int32_t stream_pause(struct sd_desc *sd_desc)
+{
+	if (!sd_desc->stream_open)
+		return 0;
+
+	sd_desc->stream_open = false;
+
+	return stop_write(sd_desc, 0);
+}
+
+/**
+ * Read data of size len from the specified address and store it in data.
+ * Blocks present in the cache are not read again and single blocks are added
+ * to the cache. This operation returns only when the read is complete
+ * @param sd_desc	- Instance of the SD card
+ * @param data		- Where data will be read
+ * @param address	- Address in memory from where data will be read
+ * @param len		- Length in bytes of data to be read
+ * @return 0 in case of success, -1 otherwise.
+ */
+int32_t sd_read(struct sd_desc *sd_desc,
+		uint8_t *data, uint64_t address, uint64_t len)
+{
+	struct sd_cache_entry	*entry;
+	uint64_t		block;
+	uint64_t		n;
+	uint32_t		offset;
+
+	/* Initial checks */
+	if (data == NULL || address > sd_desc->memory_size ||
+	    len > sd_desc->memory_size ||
+	    address + len > sd_desc->memory_size)
+		return -1;
+
+	if (0 != stream_pause(sd_desc))
+		return -1;
+
+	if (!sd_desc->cache_blocks)
+		return read_uncached(sd_desc, data, address, len);
+
+	while (len) {
+		block = address >> DATA_BLOCK_BITS;
+		offset = address & MASK_ADDR_IN_BLOCK;
+		n = no_os_min(DATA_BLOCK_LEN - offset, len);
+		/* Read runs of uncached full blocks directly */
+		if (n == DATA_BLOCK_LEN) {
+			n = cache_miss_run(sd_desc, block,
+					   len >> DATA_BLOCK_BITS);
+			if (n > 1) {
+				n <<= DATA_BLOCK_BITS;
+				if (0 != read_uncached(sd_desc, data,
+						       address, n))
+					return -1;
+				goto next;
+			}
+			n = DATA_BLOCK_LEN;
+		}
+
+		if (0 != cache_get(sd_desc, block, true, &entry))
+			return -1;
+		memcpy(data, entry->data + offset, n);
+next:
+		data += n;
+		address += n;
+		len -= n;
+	}
+
+	return 0;
+}
+
+/**
+ * Write data of size len to the specified address.
+ * Writes of multiple full blocks are sent to the card, updating the blocks
+ * present in the cache. Other writes are only done in the cache and reach the
+ * card when the block is evicted or when sd_flush() is called.
+ * @param sd_desc	- Instance of the SD card
+ * @param data		- Data to write
+ * @param address	- Address in memory where data will be written
+ * @param len		- Length of data in bytes
+ * @return 0 in case of success, -1 otherwise.
+ */
+int32_t sd_write(struct sd_desc *sd_desc, uint8_t *data, uint64_t address,
+		 uint64_t len)
+{
+	struct sd_cache_entry	*entry;
+	uint64_t		block;
+	uint64_t		n;
+	uint32_t		offset;
+
+	/* Initial checks */
+	if (data == NULL || address > sd_desc->memory_size ||
+	    len > sd_desc->memory_size || address + len > sd_desc->memory_size)
+		return -1;
+
+	if (0 != stream_pause(sd_desc))
+		return -1;
+
+	if (!sd_desc->cache_blocks)
+		return write_uncached(sd_desc, data, address, len);
+
+	while (len) {
+		block = address >> DATA_BLOCK_BITS;
+		offset = address & MASK_ADDR_IN_BLOCK;
+		n = no_os_min(DATA_BLOCK_LEN - offset, len);
+		/* Write runs of uncached full blocks directly */
+		if (n == DATA_BLOCK_LEN) {
+			n = cache_miss_run(sd_desc, block,
+					   len >> DATA_BLOCK_BITS);
+			if (n > 1) {
+				n <<= DATA_BLOCK_BITS;
+				if (0 != write_uncached(sd_desc, data,
+							address, n))
+					return -1;
+				goto next;
+			}
+			n = DATA_BLOCK_LEN;
+		}
+
+		if (0 != cache_get(sd_desc, block, n != DATA_BLOCK_LEN, &entry))
+			return -1;
+		memcpy(entry->data + offset, data, n);
+		entry->dirty = true;
+next:
+		data += n;
+		address += n;
+		len -= n;
+	}
+
+	return 0;
+}
+
+/**
+ * Write the modified blocks of the cache to the card. Consecutive blocks are
+ * written with a single multiple block write.
+ * @param sd_desc	- Instance of the SD card
+ * @return 0 in case of success, -1 otherwise.
+ */
+int32_t sd_flush(struct sd_desc *sd_desc)
+{
+	struct sd_cache_entry	*first;
+	struct sd_cache_entry	*e;
+	uint32_t		nb_of_blocks;
+	uint32_t		i;
+
+	if (!sd_desc)
+		return -1;
+
+	if (0 != stream_pause(sd_desc))
+		return -1;
+
+	while (true) {
+		/* Find the first dirty block */
+		first = NULL;
+		for (i = 0; i < sd_desc->cache_blocks; i++) {
+			e = &sd_desc->cache[i];
+			if (e->valid && e->dirty &&
+			    (!first || e->block < first->block))
+				first = e;
+		}
+		if (!first)
+			return 0;
+
+		nb_of_blocks = 1;
+		while ((e = cache_find(sd_desc, first->block + nb_of_blocks)) &&
+		       e->dirty)
+			nb_of_blocks++;
+
+		if (0 != start_write(sd_desc, first->block, nb_of_blocks,
+				     nb_of_blocks > 1 ? nb_of_blocks : 0))
+			return -1;
+		for (i = 0; i < nb_of_blocks; i++) {
+			e = cache_find(sd_desc, first->block + i);
+			if (0 != write_block(sd_desc, e->data, nb_of_blocks))
+				return -1;
+			e->dirty = false;
+		}
+		if (0 != stop_write(sd_desc, nb_of_blocks))
+			return -1;
+	}
+}
+
+/**
+ * Start a stream of block writes. The multiple block write command is kept
+ * open across sd_stream_write() calls, so the card programs the data without
+ * the command overhead of separate writes.
+ * @param sd_desc	- Instance of the SD card
+ * @param address	- Address in memory where the stream starts. Must be
+ * 			  aligned to DATA_BLOCK_LEN.
+ * @param nb_blocks	- Number of blocks that will be written, if known. The
+ * 			  card pre-erases them. 0 for an open-ended stream.
+ * @return 0 in case of success, -1 otherwise.
+ */
+int32_t sd_stream_start(struct sd_desc *sd_desc, uint64_t address,
+			uint32_t nb_blocks)
+{
+	if (!sd_desc || (address & MASK_ADDR_IN_BLOCK) ||
+	    address >= sd_desc->memory_size ||
+	    ((uint64_t)nb_blocks << DATA_BLOCK_BITS) >
+	    sd_desc->memory_size - address)
+		return -1;
+
+	if (0 != sd_stream_stop(sd_desc))
+		return -1;
+
+	if (0 != start_write(sd_desc, address >> DATA_BLOCK_BITS, 0, nb_blocks))
+		return -1;
+
+	sd_desc->stream = true;
+	sd_desc->stream_open = true;
+	sd_desc->stream_block = address >> DATA_BLOCK_BITS;
+	sd_desc->stream_left = nb_blocks;
+
+	return 0;
+}
+
+/**
+ * Write the next blocks of a stream started with sd_stream_start().
+ * Cached copies of the written blocks are dropped.
+ * @param sd_desc	- Instance of the SD card
+ * @param data		- Data to write
+ * @param len		- Length of data in bytes. Must be a multiple of
+ * 			  DATA_BLOCK_LEN.
+ * @return 0 in case of success, -1 otherwise.
+ */
+int32_t sd_stream_write(struct sd_desc *sd_desc, uint8_t *data, uint64_t len)
+{
+	struct sd_cache_entry	*entry;
+	uint64_t		nb_of_blocks;
+
+	if (!sd_desc || !sd_desc->stream || !data ||
+	    (len & MASK_ADDR_IN_BLOCK))
+		return -1;
+
+	nb_of_blocks = len >> DATA_BLOCK_BITS;
+	if (sd_desc->stream_block + nb_of_blocks >
+	    sd_desc->memory_size >> DATA_BLOCK_BITS)
+		return -1;
+
+	/* Resume the stream if it was paused by another operation */
+	if (!sd_desc->stream_open) {
+		if (0 != start_write(sd_desc, sd_desc->stream_block, 0,
+				     sd_desc->stream_left))
+			return -1;
+		sd_desc->stream_open = true;
+	}
+
+	while (nb_of_blocks--) {
+		entry = cache_find(sd_desc, sd_desc->stream_block);
+		if (entry)
+			entry->valid = false;
+
+		if (0 != write_block(sd_desc, data, 0))
+			return -1;
+
+		data += DATA_BLOCK_LEN;
+		sd_desc->stream_block++;
+		if (sd_desc->stream_left)
+			sd_desc->stream_left--;
+	}
+
+	return 0;
+}
+
+/**
+ * End a stream started with sd_stream_start().
+ * @param sd_desc	- Instance of the SD card
+ * @return 0 in case of success, -1 otherwise.
+ */
+int32_t sd_stream_stop(struct sd_desc *sd_desc)
+{
+	if (!sd_desc)
+		return -1;
+
+	sd_desc->stream = false;
+
+	return stream_pause(sd_desc);
+}
+
 /**
  * Initialize an instance of SD card and stores it to the parameter desc
  * @param sd_desc	- Pointer where to store the instance of the SD
@@ -618,24 +1032,54 @@ int32_t sd_init(struct sd_desc **sd_desc, const struct sd_init_param *param)
 	local_desc->memory_size = ((uint64_t)c_size + 1) *
 				  ((uint64_t)DATA_BLOCK_LEN << 10u);
 
+	/* Allocate the block cache, with the data of all entries together */
+	if (param->cache_blocks) {
+		local_desc->cache = no_os_calloc(param->cache_blocks,
+						 sizeof(*local_desc->cache));
+		if (!local_desc->cache)
+			goto failure;
+		local_desc->cache[0].data = no_os_calloc(param->cache_blocks,
+					    DATA_BLOCK_LEN);
+		if (!local_desc->cache[0].data)
+			goto failure;
+		for (i = 1; i < param->cache_blocks; i++)
+			local_desc->cache[i].data = local_desc->cache[0].data +
+						    i * DATA_BLOCK_LEN;
+		local_desc->cache_blocks = param->cache_blocks;
+	}
+
 	*sd_desc = local_desc;
 
 	return 0;
 failure:
+	if (local_desc->cache)
+		no_os_free(local_desc->cache[0].data);
+	no_os_free(local_desc->cache);
 	no_os_free(local_desc);
 	return -1;
 }
 
 /**
  * Remove the initialize instance of SD card.
+ * An active stream is stopped and the cache is written to the card.
  * @param desc	- Instance of the SD card
  * @return 0 in case of success, -1 otherwise.
  */
 int32_t sd_remove(struct sd_desc *desc)
 {
+	int32_t ret;
+
 	if (desc == NULL)
 		return -1;
 
+	ret = sd_stream_stop(desc);
+	if (0 == ret)
+		ret = sd_flush(desc);
+
+	if (desc->cache)
+		no_os_free(desc->cache[0].data);
+	no_os_free(desc->cache);
 	no_os_free(desc);
-	return 0;
+
+	return ret;
 }
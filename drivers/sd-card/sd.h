@@ -79,6 +79,29 @@
 struct sd_init_param {
 	/** Descriptor of an initialized SPI channel */
 	struct no_os_spi_desc *spi_desc;
+	/**
+	 * Number of data blocks kept in the write-back cache. Writes smaller
+	 * than a block and single block accesses go through the cache, which
+	 * is written to the card by sd_flush(). 0 disables the cache.
+	 */
+	uint32_t cache_blocks;
+};
+
+/**
+ * @struct sd_cache_entry
+ * @brief Data block held in the cache of the driver
+ */
+struct sd_cache_entry {
+	/** Number of the cached block */
+	uint64_t	block;
+	/** Value of the access counter at the last access, used for LRU */
+	uint32_t	last_use;
+	/** Set when data holds the content of block */
+	bool		valid;
+	/** Set when data was modified and not yet written to the card */
+	bool		dirty;
+	/** Content of the block */
+	uint8_t		*data;
 };
 
 /**
@@ -94,6 +117,21 @@ struct sd_desc {
 	uint8_t		high_capacity;
 	/** Buffer used for the driver implementation */
 	uint8_t		buff[18];
+	/** Copy of the data block being sent */
+	uint8_t		block_buff[DATA_BLOCK_LEN];
+	/** Block cache, empty if cache_blocks is 0 */
+	struct sd_cache_entry	*cache;
+	uint32_t	cache_blocks;
+	/** Incremented on each cache access */
+	uint32_t	cache_clock;
+	/** Set between sd_stream_start() and sd_stream_stop() */
+	bool		stream;
+	/** Set while the multiple block write of the stream is in progress */
+	bool		stream_open;
+	/** Next block written by sd_stream_write() */
+	uint64_t	stream_block;
+	/** Blocks left from the announced stream length, 0 if unknown */
+	uint32_t	stream_left;
 };
 
 /**
@@ -126,6 +164,14 @@ int32_t sd_write(struct sd_desc *desc,
 		 uint8_t *data,
 		 uint64_t address,
 		 uint64_t len);
+int32_t sd_flush(struct sd_desc *desc);
+int32_t sd_stream_start(struct sd_desc *desc,
+			uint64_t address,
+			uint32_t nb_blocks);
+int32_t sd_stream_write(struct sd_desc *desc,
+			uint8_t *data,
+			uint64_t len);
+int32_t sd_stream_stop(struct sd_desc *desc);
 
 #endif /* __SD_H__ */
 
@@ -67,10 +67,32 @@
 /******************************************************************************/
 
 #define IIOD_PORT		30431
-#define MAX_SOCKET_TO_HANDLE	10
+/*
+ * Maximum time an idle network server blocks waiting for socket events,
+ * when the backend supports it. The server doesn't block while an async
+ * trigger has subscribers.
+ */
+#ifndef IIO_STEP_TIMEOUT_MS
+#define IIO_STEP_TIMEOUT_MS	100
+#endif
 #define REG_ACCESS_ATTRIBUTE	"direct_reg_access"
 #define IIOD_CONN_BUFFER_SIZE	0x1000
+/* Initial size of the buffer the xml is generated in. It grows as needed. */
+#ifndef IIO_XML_INITIAL_SIZE
+#define IIO_XML_INITIAL_SIZE	0x1000
+#endif
 #define NO_TRIGGER				(uint32_t)-1
+#define IIO_DEV_ID_PREFIX		"iio:device"
+#define IIO_BATCHED_READ_CTX_ATTR	"iiod_batched_read"
+#define IIO_METRICS_CTX_ATTR		"iiod_metrics"
+/*
+ * Space reserved in the xml for the value of the metrics context attribute.
+ * Can be overridden from the project build flags.
+ */
+#ifndef IIO_METRICS_VALUE_LEN
+#define IIO_METRICS_VALUE_LEN	1024
+#endif
+#define IIO_TRIG_ID_PREFIX		"trigger"
 
 #define NO_OS_STRINGIFY(x) #x
 #define NO_OS_TOSTRING(x) NO_OS_STRINGIFY(x)
@@ -181,6 +203,30 @@ struct iio_dev_priv {
 	struct iio_buffer_priv buffer;
 	/* Set to -1 when no trigger is set*/
 	uint32_t		trig_idx;
+	/* Channel ids (e.g. "voltage0"), computed once by iio_init */
+	char			**ch_ids;
+#ifdef IIO_METRICS
+	/* Number of buffer overruns reported to clients */
+	uint32_t		overruns;
+#endif
+};
+
+/**
+ * @struct iio_attr_index_entry
+ * @brief Entry of the hash table mapping a (device, attribute type, channel,
+ * attribute name) tuple to the attribute, so that attribute requests don't
+ * have to scan devices, channels and attributes.
+ */
+struct iio_attr_index_entry {
+	uint32_t	hash;
+	/* Device index + 1, 0 for an empty entry */
+	uint16_t	dev;
+	/* Channel index + 1, 0 for device, debug and buffer attributes */
+	uint16_t	ch;
+	/* Index in the attribute list */
+	uint16_t	attr;
+	/* enum iio_attr_type */
+	uint8_t		type;
 };
 
 /**
@@ -198,7 +244,18 @@ struct iio_trig_priv {
 	/** Trigger descriptor(describes type of trigger and its attributes) */
 	struct iio_trigger *descriptor;
 	/** Set to true when the triggering condition is met */
-	bool	triggered;
+	volatile bool	triggered;
+	/**
+	 * Devices using this trigger, updated when a trigger is set. Entries
+	 * are stored before nb_subs publishes them, so the trigger interrupt
+	 * may walk the list while it is being updated.
+	 */
+	struct iio_dev_priv	**subs;
+	volatile uint32_t	nb_subs;
+	/** Event counters */
+	volatile uint32_t	fired;
+	volatile uint32_t	handled;
+	volatile uint32_t	missed;
 };
 
 struct iio_desc {
@@ -207,12 +264,27 @@ struct iio_desc {
 	void			*phy_desc;
 	char			*xml_desc;
 	uint32_t		xml_size;
+	/* Set when xml_desc was provided in iio_init_param */
+	bool			xml_prebuilt;
 	struct iio_ctx_attr	*ctx_attrs;
 	uint32_t		nb_ctx_attr;
 	struct iio_dev_priv	*devs;
 	uint32_t		nb_devs;
 	struct iio_trig_priv	*trigs;
 	uint32_t		nb_trigs;
+	/* Storage of the subscriber lists of all the triggers */
+	struct iio_dev_priv	**trig_subs;
+	/* Set if the READMULTI iiod command is enabled */
+	bool			batched_read;
+#ifdef IIO_METRICS
+	/* Offset in xml_desc of the metrics value, 0 if not present */
+	uint32_t		metrics_of;
+	/* Metrics value being formatted, before it is copied to xml_desc */
+	char			metrics_buff[IIO_METRICS_VALUE_LEN + 1];
+#endif
+	/* Attribute hash table, its size is attr_index_mask + 1 */
+	struct iio_attr_index_entry	*attr_index;
+	uint32_t		attr_index_mask;
 	struct no_os_uart_desc	*uart_desc;
 	int (*recv)(void *conn, uint8_t *buf, uint32_t len);
 	int (*send)(void *conn, uint8_t *buf, uint32_t len);
@@ -222,6 +294,8 @@ struct iio_desc {
 	struct tcp_socket_desc	*current_sock;
 	/* Instance of server socket */
 	struct tcp_socket_desc	*server;
+	/* Set when connections are stepped based on socket readiness */
+	bool			event_driven;
 #endif
 };
 
@@ -229,6 +303,14 @@ struct iio_desc {
 /************************ Functions Definitions *******************************/
 /******************************************************************************/
 
+static inline void iio_count_overrun(struct iio_dev_priv *dev, int32_t ret)
+{
+#ifdef IIO_METRICS
+	if (ret == -NO_OS_EOVERRUN)
+		dev->overruns++;
+#endif
+}
+
 static inline int32_t _pop_conn(struct iio_desc *desc, uint32_t *conn_id)
 {
 	uint32_t size;
@@ -290,21 +372,20 @@ static inline void _print_ch_id(char *buff, struct iio_channel *ch)
 }
 
 /**
- * @brief Get channel ID from a list of channels.
- * @param channel - Channel name.
- * @param desc - Device descriptor
+ * @brief Get channel from the list of channels of a device.
+ * @param channel - Channel id.
+ * @param dev - Device.
  * @param ch_out - If "true" is output channel, if "false" is input channel.
- * @return Channel ID, or negative value if attribute is not found.
+ * @return Channel, or NULL if the channel is not found.
  */
 static inline struct iio_channel *iio_get_channel(const char *channel,
-		struct iio_device *desc, bool ch_out)
+		struct iio_dev_priv *dev, bool ch_out)
 {
+	struct iio_device *desc = dev->dev_descriptor;
 	int16_t i = 0;
-	char	ch_id[MAX_CHN_ID];
 
 	while (i < desc->num_ch) {
-		_print_ch_id(ch_id, &desc->channels[i]);
-		if (!strcmp(channel, ch_id) &&
+		if (!strcmp(channel, dev->ch_ids[i]) &&
 		    (desc->channels[i].ch_out == ch_out))
 			return &desc->channels[i];
 		i++;
@@ -314,7 +395,29 @@ static inline struct iio_channel *iio_get_channel(const char *channel,
 }
 
 /**
- * @brief Find interface with "device_name".
+ * @brief Parse the index out of an id such as "iio:device3".
+ * @param id - Id to parse.
+ * @param prefix - Expected prefix of the id.
+ * @param idx - Parsed index.
+ * @return true if id starts with prefix followed by a number.
+ */
+static bool iio_parse_id_idx(const char *id, const char *prefix,
+			     uint32_t *idx)
+{
+	size_t len = strlen(prefix);
+	char *end;
+
+	if (strncmp(id, prefix, len) || id[len] < '0' || id[len] > '9')
+		return false;
+
+	*idx = strtoul(id + len, &end, 10);
+
+	return *end == '\0';
+}
+
+/**
+ * @brief Find interface with "device_name". Device ids are generated from
+ * the device index, so the index is parsed instead of searched.
  * @param device_name - Device name.
  * @param iio_dev_privs - List of interfaces.
  * @return Interface pointer if interface is found, NULL otherwise.
@@ -324,12 +427,15 @@ static struct iio_dev_priv *get_iio_device(struct iio_desc *desc,
 {
 	uint32_t i;
 
-	for (i = 0; i < desc->nb_devs; i++) {
-		if (strcmp(desc->devs[i].dev_id, device_name) == 0)
-			return &desc->devs[i];
-	}
+	if (!iio_parse_id_idx(device_name, IIO_DEV_ID_PREFIX, &i) ||
+	    i >= desc->nb_devs)
+		return NULL;
 
-	return NULL;
+	/* Rejects ids such as "iio:device01" */
+	if (strcmp(desc->devs[i].dev_id, device_name))
+		return NULL;
+
+	return &desc->devs[i];
 }
 
 /**
@@ -343,12 +449,14 @@ static struct iio_trig_priv *get_iio_trig_device(struct iio_desc *desc,
 {
 	uint32_t i;
 
-	for (i = 0; i < desc->nb_trigs; i++) {
-		if (strcmp(desc->trigs[i].id, trigger_id) == 0)
-			return &desc->trigs[i];
-	}
+	if (!iio_parse_id_idx(trigger_id, IIO_TRIG_ID_PREFIX, &i) ||
+	    i >= desc->nb_trigs)
+		return NULL;
 
-	return NULL;
+	if (strcmp(desc->trigs[i].id, trigger_id))
+		return NULL;
+
+	return &desc->trigs[i];
 }
 
 /**
@@ -784,6 +892,318 @@ static struct iio_attribute *get_trig_attributes(enum iio_attr_type type,
 	return NULL;
 }
 
+#ifdef TEST
+/* Index entries visited by the attribute lookups, read by the unit tests */
+uint32_t iio_attr_index_probes;
+#endif
+
+/**
+ * @brief Hash an attribute index key with FNV-1a.
+ * @param dev - Device index.
+ * @param type - Attribute type.
+ * @param channel - Channel id, "" for non channel attributes.
+ * @param name - Attribute name.
+ * @return Hash of the key.
+ */
+static uint32_t iio_attr_hash(uint32_t dev, enum iio_attr_type type,
+			      const char *channel, const char *name)
+{
+	uint32_t hash = 2166136261u;
+
+	hash = (hash ^ dev) * 16777619u;
+	hash = (hash ^ type) * 16777619u;
+	while (*channel)
+		hash = (hash ^ (uint8_t)*channel++) * 16777619u;
+	/* Separator, so that ("ab", "c") and ("a", "bc") differ */
+	hash *= 16777619u;
+	while (*name)
+		hash = (hash ^ (uint8_t)*name++) * 16777619u;
+
+	return hash;
+}
+
+/**
+ * @brief Get the attribute referred by an attribute index entry.
+ * @param desc - IIO descriptor.
+ * @param entry - Used attribute index entry.
+ * @param ch - Set to the channel of the attribute, NULL if none.
+ * @return Attribute.
+ */
+static struct iio_attribute *iio_attr_index_get(struct iio_desc *desc,
+		struct iio_attr_index_entry *entry, struct iio_channel **ch)
+{
+	struct iio_dev_priv *dev = &desc->devs[entry->dev - 1];
+
+	*ch = NULL;
+	if (entry->ch)
+		*ch = &dev->dev_descriptor->channels[entry->ch - 1];
+
+	return &get_attributes(entry->type, dev, *ch)[entry->attr];
+}
+
+/**
+ * @brief Look up an attribute of a device in the attribute index.
+ * @param desc - IIO descriptor.
+ * @param dev - Device.
+ * @param type - Attribute type.
+ * @param channel - Channel id, ignored for non channel attributes.
+ * @param name - Attribute name.
+ * @param ch - Set to the channel of the attribute, NULL if none.
+ * @return Attribute, or NULL if the attribute is not found.
+ */
+static struct iio_attribute *iio_attr_index_find(struct iio_desc *desc,
+		struct iio_dev_priv *dev, enum iio_attr_type type,
+		const char *channel, const char *name, struct iio_channel **ch)
+{
+	struct iio_attr_index_entry *entry;
+	struct iio_attribute *attr;
+	uint32_t dev_idx = dev - desc->devs;
+	uint32_t hash, pos;
+	const char *ch_id;
+
+	if (!desc->attr_index)
+		return NULL;
+
+	if (type != IIO_ATTR_TYPE_CH_IN && type != IIO_ATTR_TYPE_CH_OUT)
+		channel = "";
+
+	hash = iio_attr_hash(dev_idx, type, channel, name);
+	pos = hash & desc->attr_index_mask;
+	for (entry = &desc->attr_index[pos]; entry->dev;
+	     pos = (pos + 1) & desc->attr_index_mask,
+	     entry = &desc->attr_index[pos]) {
+#ifdef TEST
+		iio_attr_index_probes++;
+#endif
+		if (entry->hash != hash || entry->dev != dev_idx + 1 ||
+		    entry->type != type)
+			continue;
+
+		ch_id = entry->ch ? dev->ch_ids[entry->ch - 1] : "";
+		attr = iio_attr_index_get(desc, entry, ch);
+		if (!strcmp(ch_id, channel) && !strcmp(attr->name, name))
+			return attr;
+	}
+
+	*ch = NULL;
+
+	return NULL;
+}
+
+/**
+ * @brief Add an attribute list to the attribute index. Attributes whose key
+ * is already in the index are skipped, so that lookups return the first
+ * match, like a linear search would.
+ * @param desc - IIO descriptor.
+ * @param dev_idx - Device index.
+ * @param type - Attribute type.
+ * @param ch_idx - Channel index + 1, 0 for non channel attributes.
+ * @param attributes - Attribute list.
+ */
+static void iio_attr_index_add(struct iio_desc *desc, uint32_t dev_idx,
+			       enum iio_attr_type type, uint32_t ch_idx,
+			       struct iio_attribute *attributes)
+{
+	struct iio_dev_priv *dev = &desc->devs[dev_idx];
+	struct iio_attr_index_entry *entry;
+	struct iio_channel *ch;
+	const char *ch_id;
+	uint32_t i, pos;
+
+	ch_id = ch_idx ? dev->ch_ids[ch_idx - 1] : "";
+	for (i = 0; attributes && attributes[i].name; i++) {
+		if (iio_attr_index_find(desc, dev, type, ch_id,
+					attributes[i].name, &ch))
+			continue;
+
+		pos = iio_attr_hash(dev_idx, type, ch_id, attributes[i].name);
+		entry = &desc->attr_index[pos & desc->attr_index_mask];
+		while (entry->dev) {
+			pos++;
+			entry = &desc->attr_index[pos & desc->attr_index_mask];
+		}
+
+		entry->hash = iio_attr_hash(dev_idx, type, ch_id,
+					    attributes[i].name);
+		entry->dev = dev_idx + 1;
+		entry->ch = ch_idx;
+		entry->attr = i;
+		entry->type = type;
+	}
+}
+
+/**
+ * @brief Count the attributes of an attribute list.
+ * @param attributes - Attribute list.
+ * @return Number of attributes.
+ */
+static uint32_t iio_attr_count(struct iio_attribute *attributes)
+{
+	uint32_t i = 0;
+
+	while (attributes && attributes[i].name)
+		i++;
+
+	return i;
+}
+
+/**
+ * @brief Compute the channel ids of a device, stored in a single allocation.
+ * @param dev - Device.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int iio_init_ch_ids(struct iio_dev_priv *dev)
+{
+	struct iio_device *device = dev->dev_descriptor;
+	char ch_id[MAX_CHN_ID];
+	uint32_t i, size;
+	char *pool;
+
+	if (!device->channels || !device->num_ch)
+		return 0;
+
+	size = device->num_ch * sizeof(*dev->ch_ids);
+	for (i = 0; i < device->num_ch; i++) {
+		_print_ch_id(ch_id, &device->channels[i]);
+		size += strlen(ch_id) + 1;
+	}
+
+	dev->ch_ids = (char **)no_os_calloc(1, size);
+	if (!dev->ch_ids)
+		return -ENOMEM;
+
+	pool = (char *)(dev->ch_ids + device->num_ch);
+	for (i = 0; i < device->num_ch; i++) {
+		dev->ch_ids[i] = pool;
+		_print_ch_id(pool, &device->channels[i]);
+		pool += strlen(pool) + 1;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Compute the channel ids of all devices and build the attribute
+ * index, so that attribute requests are served without scanning devices,
+ * channels and attribute lists and without formatting channel ids.
+ * @param desc - IIO descriptor.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int iio_init_attr_index(struct iio_desc *desc)
+{
+	struct iio_device *device;
+	struct iio_channel *ch;
+	uint32_t i, j, nb_attrs = 0, size;
+	int ret;
+
+	for (i = 0; i < desc->nb_devs; i++) {
+		ret = iio_init_ch_ids(&desc->devs[i]);
+		if (ret)
+			return ret;
+
+		device = desc->devs[i].dev_descriptor;
+		nb_attrs += iio_attr_count(device->attributes);
+		nb_attrs += iio_attr_count(device->debug_attributes);
+		nb_attrs += iio_attr_count(device->buffer_attributes);
+		for (j = 0; device->channels && j < device->num_ch; j++)
+			nb_attrs += iio_attr_count(device->channels[j].attributes);
+	}
+
+	/* Keep the load factor under 1/2 */
+	size = 4;
+	while (size < 2 * nb_attrs)
+		size <<= 1;
+
+	desc->attr_index = (struct iio_attr_index_entry *)no_os_calloc(size,
+			   sizeof(*desc->attr_index));
+	if (!desc->attr_index)
+		return -ENOMEM;
+	desc->attr_index_mask = size - 1;
+
+	for (i = 0; i < desc->nb_devs; i++) {
+		device = desc->devs[i].dev_descriptor;
+		iio_attr_index_add(desc, i, IIO_ATTR_TYPE_DEVICE, 0,
+				   device->attributes);
+		iio_attr_index_add(desc, i, IIO_ATTR_TYPE_DEBUG, 0,
+				   device->debug_attributes);
+		iio_attr_index_add(desc, i, IIO_ATTR_TYPE_BUFFER, 0,
+				   device->buffer_attributes);
+		for (j = 0; device->channels && j < device->num_ch; j++) {
+			ch = &device->channels[j];
+			iio_attr_index_add(desc, i, ch->ch_out ?
+					   IIO_ATTR_TYPE_CH_OUT :
+					   IIO_ATTR_TYPE_CH_IN,
+					   j + 1, ch->attributes);
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Free the resources allocated by iio_init_attr_index().
+ * @param desc - IIO descriptor.
+ */
+static void iio_remove_attr_index(struct iio_desc *desc)
+{
+	uint32_t i;
+
+	for (i = 0; desc->devs && i < desc->nb_devs; i++) {
+		no_os_free(desc->devs[i].ch_ids);
+		desc->devs[i].ch_ids = NULL;
+	}
+	no_os_free(desc->attr_index);
+	desc->attr_index = NULL;
+}
+
+/**
+ * @brief Read or write a named attribute of a device, found through the
+ * attribute index.
+ * @param desc - IIO descriptor.
+ * @param dev - Device.
+ * @param attr - Attribute to read or write.
+ * @param buf - Value buffer.
+ * @param len - Length of buf.
+ * @param is_write - If true, writes the attribute, otherwise reads it.
+ * @return Length of chars written/read or negative value in case of error.
+ */
+static int iio_rd_wr_indexed_attr(struct iio_desc *desc,
+				  struct iio_dev_priv *dev,
+				  struct iiod_attr *attr, char *buf,
+				  uint32_t len, bool is_write)
+{
+	struct iio_attribute *attribute;
+	struct iio_ch_info ch_info;
+	struct iio_channel *ch;
+
+	attribute = iio_attr_index_find(desc, dev, attr->type, attr->channel,
+					attr->name, &ch);
+	if (!attribute)
+		return -ENOENT;
+
+	if (ch) {
+		ch_info.ch_out = ch->ch_out;
+		ch_info.ch_num = ch->channel;
+		ch_info.type = ch->ch_type;
+		ch_info.differential = ch->diferential;
+		ch_info.address = ch->address;
+	}
+
+	if (is_write) {
+		if (!attribute->store)
+			return -ENOENT;
+		return attribute->store(dev->dev_instance, buf, len,
+					ch ? &ch_info : NULL,
+					attribute->priv);
+	}
+
+	if (!attribute->show)
+		return -ENOENT;
+
+	return attribute->show(dev->dev_instance, buf, len,
+			       ch ? &ch_info : NULL, attribute->priv);
+}
+
 /**
  * @brief Read global attribute of a device.
  * @param ctx - IIO instance and conn instance
@@ -815,10 +1235,13 @@ static int iio_read_attr(struct iiod_ctx *ctx, const char *device,
 			return -ENOENT;
 		}
 
+		if (attr->name[0] != '\0')
+			return iio_rd_wr_indexed_attr(ctx->instance, dev, attr,
+						      buf, len, 0);
+
 		if (attr->channel[0] != '\0') {
 			ch_out = attr->type == IIO_ATTR_TYPE_CH_OUT ? 1 : 0;
-			ch = iio_get_channel(attr->channel, dev->dev_descriptor,
-					     ch_out);
+			ch = iio_get_channel(attr->channel, dev, ch_out);
 			if (!ch)
 				return -ENOENT;
 			ch_info.ch_out = ch_out;
@@ -835,9 +1258,7 @@ static int iio_read_attr(struct iiod_ctx *ctx, const char *device,
 		params.len = len;
 		params.dev_instance = dev->dev_instance;
 		attributes = get_attributes(attr->type, dev, ch);
-		if (!strcmp(attr->name, ""))
-			return iio_read_all_attr(&params, attributes);
-		return iio_rd_wr_attribute(&params, attributes, attr->name, 0);
+		return iio_read_all_attr(&params, attributes);
 	}
 
 	/* IIO device with given name is not found, verify if it corresponds to a trigger */
@@ -891,10 +1312,13 @@ static int iio_write_attr(struct iiod_ctx *ctx, const char *device,
 			return -ENOENT;
 		}
 
+		if (attr->name[0] != '\0')
+			return iio_rd_wr_indexed_attr(ctx->instance, dev, attr,
+						      buf, len, 1);
+
 		if (attr->channel[0] != '\0') {
 			ch_out = attr->type == IIO_ATTR_TYPE_CH_OUT ? 1 : 0;
-			ch = iio_get_channel(attr->channel, dev->dev_descriptor,
-					     ch_out);
+			ch = iio_get_channel(attr->channel, dev, ch_out);
 			if (!ch)
 				return -ENOENT;
 
@@ -912,9 +1336,7 @@ static int iio_write_attr(struct iiod_ctx *ctx, const char *device,
 		params.len = len;
 		params.dev_instance = dev->dev_instance;
 		attributes = get_attributes(attr->type, dev, ch);
-		if (!strcmp(attr->name, ""))
-			return iio_write_all_attr(&params, attributes);
-		return iio_rd_wr_attribute(&params, attributes, attr->name, 1);
+		return iio_write_all_attr(&params, attributes);
 	}
 
 	/* IIO device with given name is not found, verify if it corresponds to a trigger */
@@ -977,6 +1399,51 @@ static uint32_t iio_get_trig_idx_by_name(struct iio_desc *desc,
 	return NO_TRIGGER;
 }
 
+/**
+ * @brief Set the trigger of a device and move the device to the subscriber
+ * list of that trigger, so that trigger events only walk the devices using it.
+ * @param desc     - IIO descriptor.
+ * @param dev      - IIO device.
+ * @param trig_idx - Trigger index or NO_TRIGGER to remove the trigger.
+ */
+static void iio_trig_attach(struct iio_desc *desc, struct iio_dev_priv *dev,
+			    uint32_t trig_idx)
+{
+	struct iio_trig_priv *trig;
+	uint32_t i, n;
+
+	if (dev->trig_idx == trig_idx)
+		return;
+
+	if (dev->trig_idx != NO_TRIGGER) {
+		trig = &desc->trigs[dev->trig_idx];
+		n = trig->nb_subs;
+		for (i = 0; i < n; i++) {
+			if (trig->subs[i] == dev) {
+				/*
+				 * Fill the hole before shrinking the list, a
+				 * concurrent walk then sees the moved entry
+				 * at worst twice but never a stale slot.
+				 */
+				trig->subs[i] = trig->subs[n - 1];
+				__sync_synchronize();
+				trig->nb_subs = n - 1;
+				break;
+			}
+		}
+	}
+
+	dev->trig_idx = trig_idx;
+	if (trig_idx != NO_TRIGGER) {
+		trig = &desc->trigs[trig_idx];
+		n = trig->nb_subs;
+		trig->subs[n] = dev;
+		/* Publish the entry only once it is visible */
+		__sync_synchronize();
+		trig->nb_subs = n + 1;
+	}
+}
+
 /**
  * @brief Searches for active trigger of the given device and returns trigger name.
  * @param ctx     - IIO instance and conn instance.
@@ -1043,7 +1510,7 @@ static int iio_set_trigger(struct iiod_ctx *ctx, const char *device,
 		return -ENODEV;
 
 	if (trigger[0] == '\0') {
-		dev->trig_idx = NO_TRIGGER;
+		iio_trig_attach(desc, dev, NO_TRIGGER);
 		return 0;
 	}
 
@@ -1051,7 +1518,7 @@ static int iio_set_trigger(struct iiod_ctx *ctx, const char *device,
 	if (i == NO_TRIGGER)
 		return -EINVAL;
 
-	dev->trig_idx = i;
+	iio_trig_attach(desc, dev, i);
 
 	return len;
 }
@@ -1062,22 +1529,94 @@ static int iio_set_trigger(struct iiod_ctx *ctx, const char *device,
  */
 static void iio_process_async_triggers(struct iio_desc *desc)
 {
+	struct iio_trig_priv *trig;
 	struct iio_dev_priv *dev;
-	uint32_t i;
+	uint32_t i, j, n;
 
-	for (i = 0; i < desc->nb_devs; i++) {
-		dev = desc->devs + i;
-		if (dev->trig_idx == NO_TRIGGER)
+	for (i = 0; i < desc->nb_trigs; i++) {
+		trig = desc->trigs + i;
+		if (!trig->triggered)
 			continue;
 
-		if (!desc->trigs[dev->trig_idx].triggered)
-			continue;
+		trig->triggered = false;
+		n = trig->nb_subs;
+		for (j = 0; j < n; j++) {
+			dev = trig->subs[j];
+			if (dev->dev_descriptor->trigger_handler)
+				dev->dev_descriptor->trigger_handler(&dev->dev_data);
+		}
+		trig->handled++;
+	}
+}
+
+/**
+ * @brief Searches for trigger name and returns the trigger index to be used
+ * with iio_process_trigger().
+ * @param desc         - IIO descriptor.
+ * @param trigger_name - Trigger name.
+ * @param trig_idx     - Trigger index.
+ *
+ * @return 0 in case of success, -ENOENT if the trigger doesn't exist.
+ */
+int iio_get_trigger_idx(struct iio_desc *desc, const char *trigger_name,
+			uint32_t *trig_idx)
+{
+	uint32_t i;
+
+	if (!desc || !trig_idx)
+		return -EINVAL;
+
+	i = iio_get_trig_idx_by_name(desc, trigger_name);
+	if (i == NO_TRIGGER)
+		return -ENOENT;
+
+	*trig_idx = i;
 
-		if (dev->dev_descriptor->trigger_handler) {
+	return 0;
+}
+
+/**
+ * @brief Processes a trigger event based on the trigger type (sync or async
+ * with the interrupt). Safe to be called from interrupt context; it only walks
+ * the devices subscribed to the trigger.
+ * @param desc     - IIO descriptor.
+ * @param trig_idx - Trigger index returned by iio_get_trigger_idx().
+ *
+ * @return ret - Result of the processing procedure.
+ */
+int iio_process_trigger(struct iio_desc *desc, uint32_t trig_idx)
+{
+	struct iio_trig_priv *trig;
+	struct iio_dev_priv *dev;
+	uint32_t i, n;
+
+	if (!desc || trig_idx >= desc->nb_trigs)
+		return -EINVAL;
+
+	trig = &desc->trigs[trig_idx];
+	trig->fired++;
+
+	n = trig->nb_subs;
+	if (!n) {
+		trig->missed++;
+		return 0;
+	}
+
+	if (!trig->descriptor->is_synchronous) {
+		if (trig->triggered)
+			trig->missed++;
+		trig->triggered = true;
+		return 0;
+	}
+
+	for (i = 0; i < n; i++) {
+		dev = trig->subs[i];
+		if (dev->dev_descriptor->trigger_handler)
 			dev->dev_descriptor->trigger_handler(&dev->dev_data);
-			desc->trigs[i].triggered = 0;
-		}
 	}
+	trig->handled++;
+
+	return 0;
 }
 
 /**
@@ -1090,29 +1629,41 @@ static void iio_process_async_triggers(struct iio_desc *desc)
  */
 int iio_process_trigger_type(struct iio_desc *desc, char *trigger_name)
 {
-	uint32_t i;
-	uint32_t trig_id;
-	struct iio_trig_priv *trig;
+	uint32_t trig_idx;
+
+	trig_idx = iio_get_trig_idx_by_name(desc, trigger_name);
+	if (trig_idx == NO_TRIGGER)
+		return -EINVAL;
 
-	trig_id = iio_get_trig_idx_by_name(desc, trigger_name);
+	return iio_process_trigger(desc, trig_idx);
+}
 
-	if (trig_id == NO_TRIGGER)
+/**
+ * @brief Get the event counters of a trigger.
+ * @param desc         - IIO descriptor.
+ * @param trigger_name - Trigger name.
+ * @param stats        - Filled with the trigger counters.
+ *
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int iio_get_trigger_stats(struct iio_desc *desc, const char *trigger_name,
+			  struct iio_trigger_stats *stats)
+{
+	struct iio_trig_priv *trig;
+	uint32_t trig_idx;
+	int ret;
+
+	if (!stats)
 		return -EINVAL;
 
-	struct iio_dev_priv *dev;
+	ret = iio_get_trigger_idx(desc, trigger_name, &trig_idx);
+	if (ret)
+		return ret;
 
-	for (i = 0; i < desc->nb_devs; i++) {
-		dev = desc->devs + i;
-		if (dev->trig_idx == trig_id) {
-			trig = &desc->trigs[trig_id];
-			if (trig->descriptor->is_synchronous) {
-				if (dev->dev_descriptor->trigger_handler)
-					dev->dev_descriptor->trigger_handler(&dev->dev_data);
-			} else {
-				trig->triggered = 1;
-			}
-		}
-	}
+	trig = &desc->trigs[trig_idx];
+	stats->fired = trig->fired;
+	stats->handled = trig->handled;
+	stats->missed = trig->missed;
 
 	return 0;
 }
@@ -1350,6 +1901,7 @@ static int iio_read_buffer(struct iiod_ctx *ctx, const char *device, char *buf,
 		return -EINVAL;
 
 	ret = no_os_cb_size(&dev->buffer.cb, &size);
+	iio_count_overrun(dev, ret);
 #ifdef IIO_IGNORE_BUFF_OVERRUN_ERR
 #warning Buffer overrun error checking is disabled.
 	if (ret != -NO_OS_EOVERRUN)
@@ -1363,6 +1915,7 @@ static int iio_read_buffer(struct iiod_ctx *ctx, const char *device, char *buf,
 
 
 	ret = no_os_cb_read(&dev->buffer.cb, buf, bytes);
+	iio_count_overrun(dev, ret);
 #ifdef IIO_IGNORE_BUFF_OVERRUN_ERR
 	if (ret != -NO_OS_EOVERRUN)
 #endif
@@ -1372,6 +1925,62 @@ static int iio_read_buffer(struct iiod_ctx *ctx, const char *device, char *buf,
 	return bytes;
 }
 
+/**
+ * @brief Get a contiguous span of the device buffer to be sent without copy.
+ * The span must be released with iio_release_buffer.
+ * @param ctx - IIO instance and conn instance
+ * @param device - String containing device name.
+ * @param buf - Where to store the address of the span.
+ * @param bytes - Maximum number of bytes requested.
+ * @return Length of the span or negative value in case of error.
+ */
+static int iio_get_buffer_span(struct iiod_ctx *ctx, const char *device,
+			       char **buf, uint32_t bytes)
+{
+	struct iio_dev_priv	*dev;
+	int32_t			ret;
+	uint32_t		size = 0;
+
+	dev = get_iio_device(ctx->instance, device);
+	if (!dev || !dev->buffer.initalized)
+		return -EINVAL;
+
+	ret = no_os_cb_prepare_async_read(&dev->buffer.cb, bytes, (void **)buf,
+					  &size);
+	iio_count_overrun(dev, ret);
+#ifdef IIO_IGNORE_BUFF_OVERRUN_ERR
+	if (ret != -NO_OS_EOVERRUN)
+#endif
+		if (NO_OS_IS_ERR_VALUE(ret)) {
+			/* Drop the span started after the overrun */
+			if (ret == -NO_OS_EOVERRUN)
+				no_os_cb_end_async_read(&dev->buffer.cb);
+
+			return ret;
+		}
+
+	if (!size)
+		return -EAGAIN;
+
+	return size;
+}
+
+/**
+ * @brief Release a span obtained with iio_get_buffer_span.
+ * @param ctx - IIO instance and conn instance
+ * @param device - String containing device name.
+ * @return 0 or negative value in case of error.
+ */
+static int iio_release_buffer(struct iiod_ctx *ctx, const char *device)
+{
+	struct iio_dev_priv	*dev;
+
+	dev = get_iio_device(ctx->instance, device);
+	if (!dev || !dev->buffer.initalized)
+		return -EINVAL;
+
+	return no_os_cb_end_async_read(&dev->buffer.cb);
+}
 
 /**
  * @brief Write chunk of data into RAM.
@@ -1406,6 +2015,27 @@ static int iio_write_buffer(struct iiod_ctx *ctx, const char *device,
 	return bytes;
 }
 
+/**
+ * @brief Get the size of a scan of a device.
+ * @param dev - Device descriptor.
+ * @param mask - Mask of the channels in the scan.
+ * @return Number of bytes of a scan, with the channels aligned to their size.
+ */
+uint32_t iio_get_bytes_per_scan(struct iio_device *dev, uint32_t mask)
+{
+	return bytes_per_scan(dev->channels, mask);
+}
+
+/**
+ * @brief Get the id of a channel, as found in the xml (e.g. "voltage0").
+ * @param ch - Channel.
+ * @param buf - Where to store the id, MAX_CHN_ID bytes long.
+ */
+void iio_get_channel_id(struct iio_channel *ch, char *buf)
+{
+	_print_ch_id(buf, ch);
+}
+
 int iio_buffer_get_block(struct iio_buffer *buffer, void **addr)
 {
 	uint32_t size;
@@ -1500,6 +2130,94 @@ close_socket:
 
 	return ret;
 }
+
+#if IIOD_MAX_CONNECTIONS + 1 > SOCKET_WAIT_MAX_SOCKS
+#error "SOCKET_WAIT_MAX_SOCKS must cover the server and IIOD_MAX_CONNECTIONS"
+#endif
+
+/*
+ * Async trigger events are handled only from iio_step() and a trigger that
+ * fires again before that is counted as missed, so the server must not block
+ * while any async trigger has subscribers.
+ */
+static bool iio_async_triggers_used(struct iio_desc *desc)
+{
+	uint32_t i;
+
+	for (i = 0; i < desc->nb_trigs; i++)
+		if (!desc->trigs[i].descriptor->is_synchronous &&
+		    desc->trigs[i].nb_subs)
+			return true;
+
+	return false;
+}
+
+/*
+ * Step the network connections based on socket readiness. Connections
+ * waiting for a new command are stepped only when their socket has data.
+ * When none of the connections has work in progress and no async trigger
+ * is in use, block until a socket is ready or IIO_STEP_TIMEOUT_MS expires.
+ */
+static int iio_step_events(struct iio_desc *desc)
+{
+	struct tcp_socket_desc *socks[IIOD_MAX_CONNECTIONS + 1];
+	bool ready[IIOD_MAX_CONNECTIONS + 1];
+	uint32_t conn_ids[IIOD_MAX_CONNECTIONS];
+	bool idle[IIOD_MAX_CONNECTIONS];
+	struct iiod_conn_data data;
+	uint32_t i, nb_conns;
+	int32_t timeout;
+	int32_t ret, err;
+
+	timeout = iio_async_triggers_used(desc) ? 0 : IIO_STEP_TIMEOUT_MS;
+	nb_conns = 0;
+	socks[0] = desc->server;
+	while (!_pop_conn(desc, &conn_ids[nb_conns])) {
+		iiod_conn_get(desc->iiod, conn_ids[nb_conns], &data);
+		socks[nb_conns + 1] = data.conn;
+		idle[nb_conns] = iiod_conn_is_idle(desc->iiod,
+						   conn_ids[nb_conns]);
+		if (!idle[nb_conns])
+			timeout = 0;
+		nb_conns++;
+	}
+
+	ret = socket_wait(socks, ready, nb_conns + 1, timeout);
+	if (NO_OS_IS_ERR_VALUE(ret)) {
+		for (i = 0; i < nb_conns; i++)
+			_push_conn(desc, conn_ids[i]);
+
+		return ret;
+	}
+
+	err = -EAGAIN;
+	for (i = 0; i < nb_conns; i++) {
+		if (idle[i] && !ready[i + 1]) {
+			_push_conn(desc, conn_ids[i]);
+			continue;
+		}
+
+		ret = iiod_conn_step(desc->iiod, conn_ids[i]);
+		if (ret == -ENOTCONN) {
+			iiod_conn_remove(desc->iiod, conn_ids[i], &data);
+			socket_remove(data.conn);
+			no_os_free(data.buf);
+		} else {
+			_push_conn(desc, conn_ids[i]);
+		}
+
+		if (ret != -EAGAIN)
+			err = ret;
+	}
+
+	if (ready[0]) {
+		ret = accept_network_clients(desc);
+		if (NO_OS_IS_ERR_VALUE(ret) && ret != -EAGAIN)
+			return ret;
+	}
+
+	return err;
+}
 #endif
 
 /**
@@ -1516,6 +2234,15 @@ int iio_step(struct iio_desc *desc)
 	iio_process_async_triggers(desc);
 
 #if defined(NO_OS_NETWORKING) || defined(NO_OS_LWIP_NETWORKING)
+	if (desc->server && desc->event_driven) {
+		ret = iio_step_events(desc);
+		if (ret != -ENOSYS)
+			return ret;
+
+		/* Backend can't wait on these sockets, poll them instead */
+		desc->event_driven = false;
+	}
+
 	if (desc->server) {
 		ret = accept_network_clients(desc);
 		if (NO_OS_IS_ERR_VALUE(ret) && ret != -EAGAIN)
@@ -1585,6 +2312,12 @@ static uint32_t iio_add_ctx_attr_in_xml(struct iio_desc *desc, char *buff,
 				      attr[j].value);
 		}
 
+	if (desc->batched_read)
+		i += snprintf(buff + i, no_os_max(n - i, 0),
+			      "<context-attribute name=\"%s\" value=\"1\" />",
+			      IIO_BATCHED_READ_CTX_ATTR);
+
+
 	return i;
 }
 
@@ -1760,54 +2493,200 @@ static uint32_t iio_generate_device_xml(struct iio_device *device, char *name,
 	return i;
 }
 
-static int32_t iio_init_xml(struct iio_desc *desc)
+/**
+ * @brief Make room for len more bytes (plus the terminating null) after the
+ * first of bytes of the xml buffer.
+ * @param desc - IIO descriptor.
+ * @param cap  - Size of desc->xml_desc, updated when the buffer grows.
+ * @param of   - Number of bytes used.
+ * @param len  - Number of bytes to make room for.
+ * @return 0 in case of success or negative value otherwise.
+ */
+static int32_t iio_xml_reserve(struct iio_desc *desc, uint32_t *cap,
+			       uint32_t of, uint32_t len)
+{
+	uint32_t new_cap;
+	char *buf;
+
+	if (of + len < *cap)
+		return 0;
+
+	new_cap = no_os_max(*cap * 2, of + len + 1);
+	buf = (char *)no_os_calloc(new_cap, sizeof(*buf));
+	if (!buf)
+		return -ENOMEM;
+
+	memcpy(buf, desc->xml_desc, of);
+	no_os_free(desc->xml_desc);
+	desc->xml_desc = buf;
+	*cap = new_cap;
+
+	return 0;
+}
+
+/**
+ * @brief Generate the xml fragment of a device straight at the end of the xml
+ * buffer. The fragment is only formatted a second time if the buffer had to
+ * grow.
+ * @param desc   - IIO descriptor.
+ * @param cap    - Size of desc->xml_desc, updated when the buffer grows.
+ * @param of     - Number of bytes used, updated with the fragment size.
+ * @param device - Device to describe.
+ * @param name   - Device name.
+ * @param id     - Device id.
+ * @return 0 in case of success or negative value otherwise.
+ */
+static int32_t iio_xml_add_device(struct iio_desc *desc, uint32_t *cap,
+				  uint32_t *of, struct iio_device *device,
+				  char *name, char *id)
+{
+	uint32_t len;
+	int32_t ret;
+
+	len = iio_generate_device_xml(device, name, id, desc->xml_desc + *of,
+				      *cap - *of);
+	if ((int32_t)len < 0)
+		return len;
+
+	if (*of + len >= *cap) {
+		ret = iio_xml_reserve(desc, cap, *of, len);
+		if (ret)
+			return ret;
+
+		len = iio_generate_device_xml(device, name, id,
+					      desc->xml_desc + *of, *cap - *of);
+	}
+	*of += len;
+
+	return 0;
+}
+
+#ifdef IIO_METRICS
+/**
+ * @brief Add the metrics context attribute at the end of the xml buffer, with
+ * IIO_METRICS_VALUE_LEN blanks as value, and record where the value starts so
+ * that iio_update_xml can fill it in.
+ * @param desc - IIO descriptor.
+ * @param cap  - Size of desc->xml_desc, updated when the buffer grows.
+ * @param of   - Number of bytes used, updated with the attribute size.
+ * @return 0 in case of success or negative value otherwise.
+ */
+static int32_t iio_xml_add_metrics(struct iio_desc *desc, uint32_t *cap,
+				   uint32_t *of)
+{
+	static const char start[] = "<context-attribute name=\""
+				    IIO_METRICS_CTX_ATTR "\" value=\"";
+	static const char end[] = "\" />";
+	int32_t ret;
+
+	ret = iio_xml_reserve(desc, cap, *of, sizeof(start) - 1 +
+			      IIO_METRICS_VALUE_LEN + sizeof(end) - 1);
+	if (ret)
+		return ret;
+
+	memcpy(desc->xml_desc + *of, start, sizeof(start) - 1);
+	*of += sizeof(start) - 1;
+
+	desc->metrics_of = *of;
+	memset(desc->xml_desc + *of, ' ', IIO_METRICS_VALUE_LEN);
+	*of += IIO_METRICS_VALUE_LEN;
+
+	memcpy(desc->xml_desc + *of, end, sizeof(end) - 1);
+	*of += sizeof(end) - 1;
+
+	return 0;
+}
+#endif
+
+/**
+ * @brief Generate the xml description of the context. Each device fragment is
+ * formatted once, straight into its place in the final buffer. When a
+ * prebuilt description is provided it is used as is.
+ * @param desc       - IIO descriptor.
+ * @param init_param - IIO init param.
+ * @return 0 in case of success or negative value otherwise.
+ */
+static int32_t iio_init_xml(struct iio_desc *desc,
+			    struct iio_init_param *init_param)
 {
 	struct iio_dev_priv *dev;
 	struct iio_trig_priv *trig;
 	struct iio_device dummy = { 0 };
-	uint32_t i, size, of;
+	uint32_t i, len, cap, of;
+	int32_t ret;
+	char *buf;
 
-	/* -2 because of the 0 character */
-	size = sizeof(header) + sizeof(header_end) - 2;
-	size += iio_add_ctx_attr_in_xml(desc, NULL, -1);
-	for (i = 0; i < desc->nb_devs; i++) {
-		dev = desc->devs + i;
-		size += iio_generate_device_xml(dev->dev_descriptor,
-						(char *)dev->name,
-						dev->dev_id, NULL, -1);
-	}
-	for (i = 0; i < desc->nb_trigs; i++) {
-		trig = desc->trigs + i;
-		dummy.attributes = trig->descriptor->attributes;
-		size += iio_generate_device_xml(&dummy, trig->name, trig->id,
-						NULL, -1);
+	if (init_param->xml) {
+		desc->xml_desc = (char *)init_param->xml;
+		desc->xml_size = init_param->xml_len;
+		desc->xml_prebuilt = true;
+
+		return 0;
 	}
 
-	desc->xml_desc = (char *)no_os_calloc(size + 1, sizeof(*desc->xml_desc));
+	cap = IIO_XML_INITIAL_SIZE;
+	desc->xml_desc = (char *)no_os_calloc(cap, sizeof(*desc->xml_desc));
 	if (!desc->xml_desc)
 		return -ENOMEM;
 
-	desc->xml_size = size;
+	of = 0;
+	ret = iio_xml_reserve(desc, &cap, of, sizeof(header) - 1);
+	if (ret)
+		goto error;
+	memcpy(desc->xml_desc, header, sizeof(header) - 1);
+	of += sizeof(header) - 1;
+
+	len = iio_add_ctx_attr_in_xml(desc, NULL, -1);
+	ret = iio_xml_reserve(desc, &cap, of, len);
+	if (ret)
+		goto error;
+	of += iio_add_ctx_attr_in_xml(desc, desc->xml_desc + of, cap - of);
+#ifdef IIO_METRICS
+	ret = iio_xml_add_metrics(desc, &cap, &of);
+	if (ret)
+		goto error;
+#endif
 
-	strcpy(desc->xml_desc, header);
-	of = sizeof(header) - 1;
-	of += iio_add_ctx_attr_in_xml(desc, desc->xml_desc + of, size - of);
 	for (i = 0; i < desc->nb_devs; i++) {
 		dev = desc->devs + i;
-		of += iio_generate_device_xml(dev->dev_descriptor,
-					      (char *)dev->name, dev->dev_id,
-					      desc->xml_desc + of, size - of);
+		ret = iio_xml_add_device(desc, &cap, &of, dev->dev_descriptor,
+					 (char *)dev->name, dev->dev_id);
+		if (ret)
+			goto error;
 	}
 	for (i = 0; i < desc->nb_trigs; i++) {
 		trig = desc->trigs + i;
 		dummy.attributes = trig->descriptor->attributes;
-		of += iio_generate_device_xml(&dummy, trig->name, trig->id,
-					      desc->xml_desc + of, size - of);
+		ret = iio_xml_add_device(desc, &cap, &of, &dummy, trig->name,
+					 trig->id);
+		if (ret)
+			goto error;
 	}
 
-	strcpy(desc->xml_desc + of, header_end);
+	ret = iio_xml_reserve(desc, &cap, of, sizeof(header_end) - 1);
+	if (ret)
+		goto error;
+	memcpy(desc->xml_desc + of, header_end, sizeof(header_end));
+	of += sizeof(header_end) - 1;
+
+	desc->xml_size = of;
+
+	/* Give back the unused part of the buffer */
+	if (cap > of + 1) {
+		buf = (char *)no_os_calloc(of + 1, sizeof(*buf));
+		if (buf) {
+			memcpy(buf, desc->xml_desc, of + 1);
+			no_os_free(desc->xml_desc);
+			desc->xml_desc = buf;
+		}
+	}
 
 	return 0;
+error:
+	no_os_free(desc->xml_desc);
+	desc->xml_desc = NULL;
+
+	return ret;
 }
 
 static int32_t iio_init_devs(struct iio_desc *desc,
@@ -1823,12 +2702,27 @@ static int32_t iio_init_devs(struct iio_desc *desc,
 	if (!desc->devs)
 		return -ENOMEM;
 
+	/* Each trigger can have all the devices as subscribers */
+	if (desc->nb_trigs && n) {
+		desc->trig_subs = (struct iio_dev_priv **)no_os_calloc(
+					  desc->nb_trigs * n, sizeof(*desc->trig_subs));
+		if (!desc->trig_subs) {
+			no_os_free(desc->devs);
+			return -ENOMEM;
+		}
+
+		for (i = 0; i < desc->nb_trigs; i++)
+			desc->trigs[i].subs = desc->trig_subs + i * n;
+	}
+
 	for (i = 0; i < n; i++) {
 		ndev = devs + i;
 		ldev = desc->devs + i;
 		ldev->dev_descriptor = ndev->dev_descriptor;
-		sprintf(ldev->dev_id, "iio:device%"PRIu32"", i);
-		ldev->trig_idx = iio_get_trig_idx_by_id(desc, ndev->trigger_id);
+		sprintf(ldev->dev_id, IIO_DEV_ID_PREFIX"%"PRIu32"", i);
+		ldev->trig_idx = NO_TRIGGER;
+		iio_trig_attach(desc, ldev,
+				iio_get_trig_idx_by_id(desc, ndev->trigger_id));
 		ldev->dev_instance = ndev->dev;
 		ldev->dev_data.dev = ndev->dev;
 		ldev->dev_data.buffer = &ldev->buffer.public;
@@ -1875,12 +2769,79 @@ static int32_t iio_init_trigs(struct iio_desc *desc,
 		trig_priv_iter->instance = trig_init_iter->trig;
 		trig_priv_iter->name = trig_init_iter->name;
 		trig_priv_iter->descriptor = trig_init_iter->descriptor;
-		sprintf(trig_priv_iter->id, "trigger%"PRIu32"", i);
+		sprintf(trig_priv_iter->id, IIO_TRIG_ID_PREFIX"%"PRIu32"", i);
 	}
 
 	return 0;
 }
 
+#ifdef IIO_METRICS
+/**
+ * @brief Write the current server metrics in the value of the metrics context
+ * attribute, so they are sent to the client with the xml.
+ * Format: "cmd=<count per command> perr=<n> rdbuf=<bytes> wrbuf=<bytes>
+ * ovr=<overruns per device> h<state>=<latency histogram>", with lists
+ * separated by commas and histograms trimmed of trailing empty buckets.
+ * The value is truncated if it doesn't fit in IIO_METRICS_VALUE_LEN.
+ * It is refreshed on every PRINT command, which libiio only sends when a
+ * context is created, and never reread afterwards: a client sees the metrics
+ * of the moment it connected, without the duration of the PRINT that fetched
+ * them, and must create a new context to get newer values.
+ * @param ctx - IIO instance and conn instance
+ * @return 0 in case of success or negative value otherwise.
+ */
+static int iio_update_xml(struct iiod_ctx *ctx)
+{
+	struct iio_desc *desc = ctx->instance;
+	struct iiod_metrics metrics;
+	char *buff = desc->metrics_buff;
+	int32_t n = sizeof(desc->metrics_buff);
+	int32_t i = 0;
+	uint32_t j, k, len;
+	int ret;
+
+	if (!desc->metrics_of)
+		return 0;
+
+	ret = iiod_get_metrics(desc->iiod, &metrics);
+	if (ret)
+		return ret;
+
+	i += snprintf(buff + i, no_os_max(n - i, 0), "cmd=");
+	for (j = 0; j < IIOD_METRICS_NB_CMDS; j++)
+		i += snprintf(buff + i, no_os_max(n - i, 0), "%s%"PRIu32,
+			      j ? "," : "", metrics.cmds[j]);
+
+	i += snprintf(buff + i, no_os_max(n - i, 0),
+		      " perr=%"PRIu32" rdbuf=%"PRIu64" wrbuf=%"PRIu64" ovr=",
+		      metrics.parse_errors, metrics.readbuf_bytes,
+		      metrics.writebuf_bytes);
+	for (j = 0; j < desc->nb_devs; j++)
+		i += snprintf(buff + i, no_os_max(n - i, 0), "%s%"PRIu32,
+			      j ? "," : "", desc->devs[j].overruns);
+
+	for (j = 0; j < IIOD_METRICS_NB_STATES; j++) {
+		len = IIOD_METRICS_HIST_LEN;
+		while (len && !metrics.state_hist[j][len - 1])
+			len--;
+
+		i += snprintf(buff + i, no_os_max(n - i, 0), " h%"PRIu32"=", j);
+		for (k = 0; k < len; k++)
+			i += snprintf(buff + i, no_os_max(n - i, 0),
+				      "%s%"PRIu32, k ? "," : "",
+				      metrics.state_hist[j][k]);
+	}
+
+	/* Overwrite the placeholder, without its terminator */
+	len = no_os_min(i, IIO_METRICS_VALUE_LEN);
+	memcpy(desc->xml_desc + desc->metrics_of, buff, len);
+	memset(desc->xml_desc + desc->metrics_of + len, ' ',
+	       IIO_METRICS_VALUE_LEN - len);
+
+	return 0;
+}
+#endif
+
 /**
  * @brief Set communication ops and read/write ops
  * @param desc - iio descriptor.
@@ -1904,6 +2865,7 @@ int iio_init(struct iio_desc **desc, struct iio_init_param *init_param)
 
 	ldesc->ctx_attrs = init_param->ctx_attrs;
 	ldesc->nb_ctx_attr = init_param->nb_ctx_attr;
+	ldesc->batched_read = init_param->batched_read;
 
 	ret = iio_init_trigs(ldesc, init_param->trigs, init_param->nb_trigs);
 	if (NO_OS_IS_ERR_VALUE(ret))
@@ -1913,10 +2875,14 @@ int iio_init(struct iio_desc **desc, struct iio_init_param *init_param)
 	if (NO_OS_IS_ERR_VALUE(ret))
 		goto free_desc;
 
-	ret = iio_init_xml(ldesc);
+	ret = iio_init_xml(ldesc, init_param);
 	if (NO_OS_IS_ERR_VALUE(ret))
 		goto free_trigs;
 
+	ret = iio_init_attr_index(ldesc);
+	if (NO_OS_IS_ERR_VALUE(ret))
+		goto free_xml;
+
 	/* device operations */
 	ops = &ldesc->iiod_ops;
 	ops->read_attr = iio_read_attr;
@@ -1926,18 +2892,24 @@ int iio_init(struct iio_desc **desc, struct iio_init_param *init_param)
 	ops->read_buffer = iio_read_buffer;
 	ops->write_buffer = iio_write_buffer;
 	ops->refill_buffer = iio_refill_buffer;
+	ops->get_buffer_span = iio_get_buffer_span;
+	ops->release_buffer = iio_release_buffer;
 	ops->push_buffer = iio_push_buffer;
 	ops->open = iio_open_dev;
 	ops->close = iio_close_dev;
 	ops->send = iio_send;
 	ops->recv = iio_recv;
 	ops->set_buffers_count = iio_set_buffers_count;
+#ifdef IIO_METRICS
+	ops->update_xml = iio_update_xml;
+#endif
 
 	iiod_param.instance = ldesc;
 	iiod_param.ops = ops;
 	iiod_param.xml = ldesc->xml_desc;
 	iiod_param.xml_len = ldesc->xml_size;
 	iiod_param.phy_type = init_param->phy_type;
+	iiod_param.batched_read = init_param->batched_read;
 
 	ret = iiod_init(&ldesc->iiod, &iiod_param);
 	if (NO_OS_IS_ERR_VALUE(ret))
@@ -1977,6 +2949,7 @@ int iio_init(struct iio_desc **desc, struct iio_init_param *init_param)
 		ret = socket_listen(ldesc->server, MAX_BACKLOG);
 		if (NO_OS_IS_ERR_VALUE(ret))
 			goto free_pylink;
+		ldesc->event_driven = !!ldesc->server->net->socket_wait;
 	}
 #endif
 	else if (init_param->phy_type == USE_LOCAL_BACKEND) {
@@ -2010,8 +2983,11 @@ free_conns:
 free_iiod:
 	iiod_remove(ldesc->iiod);
 free_xml:
-	no_os_free(ldesc->xml_desc);
+	iio_remove_attr_index(ldesc);
+	if (!ldesc->xml_prebuilt)
+		no_os_free(ldesc->xml_desc);
 free_trigs:
+	no_os_free(ldesc->trig_subs);
 	no_os_free(ldesc->trigs);
 free_devs:
 	no_os_free(ldesc->devs);
@@ -2046,9 +3022,12 @@ int iio_remove(struct iio_desc *desc)
 #endif
 	no_os_cb_remove(desc->conns);
 	iiod_remove(desc->iiod);
+	iio_remove_attr_index(desc);
 	no_os_free(desc->devs);
+	no_os_free(desc->trig_subs);
 	no_os_free(desc->trigs);
-	no_os_free(desc->xml_desc);
+	if (!desc->xml_prebuilt)
+		no_os_free(desc->xml_desc);
 	no_os_free(desc);
 
 	return 0;
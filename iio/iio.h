@@ -79,6 +79,19 @@ struct iio_trigger_init {
 	struct iio_trigger *descriptor;
 };
 
+/* Event counters of a trigger */
+struct iio_trigger_stats {
+	/* Events signaled with iio_process_trigger */
+	uint32_t fired;
+	/* Events for which the device trigger handlers were called */
+	uint32_t handled;
+	/*
+	 * Events dropped because no device was subscribed or, for asynchronous
+	 * triggers, because the previous event was not handled yet
+	 */
+	uint32_t missed;
+};
+
 /**
  * @struct iio_ctx_attr
  * @brief Structure holding the context attribute members
@@ -116,6 +129,21 @@ struct iio_init_param {
 	uint32_t nb_devs;
 	struct iio_trigger_init *trigs;
 	uint32_t nb_trigs;
+	/*
+	 * Optional prebuilt xml description of the context, e.g. captured with
+	 * PRINT from a previous run and built into the firmware. If set, it is
+	 * used as is instead of generating it from the devices, so it must
+	 * describe the same devs and trigs. It should exist until iio_remove
+	 * is called.
+	 */
+	const char *xml;
+	/* Size of xml in bytes, without the terminating null */
+	uint32_t xml_len;
+	/*
+	 * Accept the batched READMULTI command. Advertised to clients with the
+	 * "iiod_batched_read" context attribute.
+	 */
+	bool batched_read;
 };
 
 /******************************************************************************/
@@ -134,12 +162,26 @@ int iio_step(struct iio_desc *desc);
    (is_synchronous = true) or will be called from iio_step if trigger is
    asynchronous (is_synchronous = false) */
 int iio_process_trigger_type(struct iio_desc *desc, char *trigger_name);
+/* Same as iio_process_trigger_type, for a trigger index returned by
+   iio_get_trigger_idx. Only walks the devices subscribed to the trigger. */
+int iio_process_trigger(struct iio_desc *desc, uint32_t trig_idx);
+/* Resolve a trigger name to the index used by iio_process_trigger. */
+int iio_get_trigger_idx(struct iio_desc *desc, const char *trigger_name,
+			uint32_t *trig_idx);
+/* Get the event counters of a trigger. */
+int iio_get_trigger_stats(struct iio_desc *desc, const char *trigger_name,
+			  struct iio_trigger_stats *stats);
 
 int32_t iio_parse_value(char *buf, enum iio_val fmt,
 			int32_t *val, int32_t *val2);
 int iio_format_value(char *buf, uint32_t len, enum iio_val fmt,
 		     int32_t size, int32_t *vals);
 
+/* Get the size of a scan with the channels in mask. */
+uint32_t iio_get_bytes_per_scan(struct iio_device *dev, uint32_t mask);
+/* Get the id of a channel (e.g. "voltage0") in buf, MAX_CHN_ID bytes long. */
+void iio_get_channel_id(struct iio_channel *ch, char *buf);
+
 /* DMA buffer functions. */
 /* Get buffer addr where to write iio_buffer.size bytes */
 int iio_buffer_get_block(struct iio_buffer *buffer, void **addr);
@@ -297,7 +297,7 @@ int iio_app_init(struct iio_app_desc **app,
 		 struct iio_app_init_param app_init_param)
 {
 	struct iio_device_init *iio_init_devs = NULL;
-	struct iio_init_param iio_init_param;
+	struct iio_init_param iio_init_param = { 0 };
 	struct no_os_uart_desc *uart_desc;
 	struct iio_app_desc *application;
 	struct iio_data_buffer *buff;
@@ -392,6 +392,9 @@ int iio_app_init(struct iio_app_desc **app,
 	iio_init_param.nb_trigs = app_init_param.nb_trigs;
 	iio_init_param.ctx_attrs = app_init_param.ctx_attrs;
 	iio_init_param.nb_ctx_attr = app_init_param.nb_ctx_attr;
+	iio_init_param.xml = app_init_param.xml;
+	iio_init_param.xml_len = app_init_param.xml_len;
+	iio_init_param.batched_read = app_init_param.batched_read;
 
 	status = iio_init(&application->iio_desc, &iio_init_param);
 	if(status < 0)
@@ -119,6 +119,12 @@ struct iio_app_init_param {
 	int (*post_step_callback)(void *arg);
 	/** Function parameteres */
 	void *arg;
+	/** Optional prebuilt xml description of the context */
+	const char *xml;
+	/** Size of xml in bytes */
+	uint32_t xml_len;
+	/** Accept the batched READMULTI iiod command */
+	bool batched_read;
 
 #ifdef NO_OS_LWIP_NETWORKING
 	struct lwip_network_param lwip_param;
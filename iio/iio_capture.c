@@ -0,0 +1,536 @@
+/***************************************************************************//**
+ *   @file   iio_capture.c
+ *   @brief  Capture of an IIO device buffer to a file
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "no_os_alloc.h"
+#include "no_os_circular_buffer.h"
+#include "no_os_delay.h"
+#include "no_os_error.h"
+#include "no_os_util.h"
+#include "iio.h"
+#include "iiod.h"
+#include "iio_capture.h"
+
+#ifdef IIO_CAPTURE_POSIX
+#include <errno.h>
+#include <unistd.h>
+#endif
+
+#ifdef IIO_CAPTURE_FATFS
+#include "ff.h"
+#endif
+
+/******************************************************************************/
+/********************** Macros and Constants Definitions **********************/
+/******************************************************************************/
+
+#define IIO_CAPTURE_VERSION		1
+#define IIO_CAPTURE_DEFAULT_BLOCKS	2
+
+/******************************************************************************/
+/*************************** Types Declarations *******************************/
+/******************************************************************************/
+
+struct iio_capture_desc {
+	struct iio_capture_init_param	param;
+	/* Buffer given to the device, over the capture blocks */
+	struct iio_buffer		buffer;
+	struct no_os_circular_buffer	cb;
+	struct iio_device_data		dev_data;
+	/* Memory of the capture blocks */
+	int8_t				*blocks;
+	/* Size of a block in bytes */
+	uint32_t			block_size;
+	bool				started;
+	struct no_os_time		start;
+	struct iio_capture_stats	stats;
+};
+
+/******************************************************************************/
+/************************ Functions Definitions *******************************/
+/******************************************************************************/
+
+/**
+ * @brief Write a buffer entirely to the capture file.
+ * @param desc - Capture descriptor.
+ * @param buf - Data to be written.
+ * @param len - Length of data.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int iio_capture_write(struct iio_capture_desc *desc, const void *buf,
+			     uint32_t len)
+{
+	const uint8_t *data = buf;
+	int ret;
+
+	while (len) {
+		ret = desc->param.ops->write(desc->param.file, data, len);
+		if (ret < 0)
+			return ret;
+		if (!ret)
+			return -EIO;
+
+		data += ret;
+		len -= ret;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Generate the file header.
+ * @param desc - Capture descriptor.
+ * @param buff - Where to store the header. If NULL, only the length is
+ * computed.
+ * @param n - Size of buff.
+ * @param header_len - Value of the header_len field.
+ * @return Length of the header, without padding.
+ */
+static int32_t iio_capture_header(struct iio_capture_desc *desc, char *buff,
+				  int32_t n, uint32_t header_len)
+{
+	struct iio_device *dev = desc->param.dev_descriptor;
+	struct scan_type *type;
+	char ch_id[MAX_CHN_ID];
+	char dummy_buff[1];
+	int32_t i = 0;
+	uint32_t j;
+
+	if (!buff) {
+		buff = dummy_buff;
+		n = 0;
+	}
+
+	i += snprintf(buff + i, no_os_max(n - i, 0),
+		      "iio-capture %d\nheader_len %08"PRIu32"\ndevice %s\n"
+		      "scan_bytes %"PRIu32"\nchannels %"PRIu32"\n",
+		      IIO_CAPTURE_VERSION, header_len,
+		      desc->param.name ? desc->param.name : "",
+		      desc->buffer.bytes_per_scan,
+		      no_os_hweight32(desc->param.mask));
+
+	for (j = 0; j < dev->num_ch; j++) {
+		if (!(desc->param.mask & NO_OS_BIT(j)))
+			continue;
+
+		type = dev->channels[j].scan_type;
+		iio_get_channel_id(&dev->channels[j], ch_id);
+		i += snprintf(buff + i, no_os_max(n - i, 0),
+			      "channel %s %d %s:%c%d/%d>>%d\n", ch_id,
+			      dev->channels[j].scan_index,
+			      type->is_big_endian ? "be" : "le", type->sign,
+			      type->realbits, type->storagebits, type->shift);
+	}
+
+	i += snprintf(buff + i, no_os_max(n - i, 0), "data\n");
+
+	return i;
+}
+
+/**
+ * @brief Write the file header, padded to IIO_CAPTURE_HEADER_ALIGN bytes.
+ * @param desc - Capture descriptor.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int iio_capture_write_header(struct iio_capture_desc *desc)
+{
+	uint32_t header_len;
+	char *header;
+	int ret;
+
+	header_len = iio_capture_header(desc, NULL, 0, 0);
+	header_len = NO_OS_DIV_ROUND_UP(header_len, IIO_CAPTURE_HEADER_ALIGN) *
+		     IIO_CAPTURE_HEADER_ALIGN;
+
+	header = no_os_calloc(header_len + 1, sizeof(*header));
+	if (!header)
+		return -ENOMEM;
+
+	memset(header, ' ', header_len);
+	ret = iio_capture_header(desc, header, header_len + 1, header_len);
+	/* Replace the terminator by padding */
+	header[ret] = ' ';
+	header[header_len - 1] = '\n';
+
+	ret = iio_capture_write(desc, header, header_len);
+	no_os_free(header);
+
+	return ret;
+}
+
+/**
+ * @brief Let the device fill the next block, as iiod does on a buffer refill.
+ * @param desc - Capture descriptor.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int iio_capture_submit(struct iio_capture_desc *desc)
+{
+	struct iio_device *dev = desc->param.dev_descriptor;
+	void *buff;
+	int ret;
+
+	if (dev->submit) {
+		ret = dev->submit(&desc->dev_data);
+		return ret < 0 ? ret : 0;
+	}
+
+	if (!dev->read_dev)
+		return 0;
+
+	ret = iio_buffer_get_block(&desc->buffer, &buff);
+	if (NO_OS_IS_ERR_VALUE(ret))
+		return ret;
+
+	ret = dev->read_dev(desc->param.dev, buff, desc->buffer.samples);
+	if (NO_OS_IS_ERR_VALUE(ret))
+		return ret;
+
+	return iio_buffer_block_done(&desc->buffer);
+}
+
+/**
+ * @brief Write the filled blocks to the file.
+ * At most nb_blocks blocks are written, so that a producer running from
+ * interrupts can't keep the caller here.
+ * @param desc - Capture descriptor.
+ * @param partial - Also write the last, partially filled block.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int iio_capture_drain(struct iio_capture_desc *desc, bool partial)
+{
+	struct no_os_time now;
+	uint32_t i, size, len;
+	void *buf;
+	int ret;
+
+	for (i = 0; i < desc->param.nb_blocks; i++) {
+		ret = no_os_cb_size(&desc->cb, &size);
+		if (ret != -NO_OS_EOVERRUN && NO_OS_IS_ERR_VALUE(ret))
+			return ret;
+		if (!size || (size < desc->block_size && !partial))
+			break;
+
+		len = 0;
+		ret = no_os_cb_prepare_async_read(&desc->cb, desc->block_size,
+						  &buf, &len);
+		if (ret == -NO_OS_EOVERRUN)
+			/* The read position moved to the oldest valid data */
+			desc->stats.overruns++;
+		else if (NO_OS_IS_ERR_VALUE(ret))
+			return ret;
+		if (!len)
+			break;
+
+		ret = iio_capture_write(desc, buf, len);
+		no_os_cb_end_async_read(&desc->cb);
+		if (ret)
+			return ret;
+
+		now = no_os_get_time();
+		desc->stats.bytes += len;
+		desc->stats.blocks++;
+		desc->stats.elapsed_us = (uint64_t)(now.s - desc->start.s) *
+					 1000000 + now.us - desc->start.us;
+		/* One byte per microsecond is 1 MB/s */
+		if (desc->stats.elapsed_us)
+			desc->stats.mbytes_per_sec = desc->stats.bytes /
+						     desc->stats.elapsed_us;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Allocate the capture blocks.
+ * @param desc - Where to store the capture descriptor.
+ * @param param - Capture parameters.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int iio_capture_init(struct iio_capture_desc **desc,
+		     struct iio_capture_init_param *param)
+{
+	struct iio_capture_desc *ldesc;
+	uint32_t ch_mask;
+	uint32_t i;
+
+	if (!desc || !param || !param->dev_descriptor || !param->ops ||
+	    !param->ops->write || !param->samples)
+		return -EINVAL;
+
+	if (!param->dev_descriptor->num_ch ||
+	    param->dev_descriptor->num_ch > 32)
+		return -EINVAL;
+
+	ch_mask = 0xFFFFFFFF >> (32 - param->dev_descriptor->num_ch);
+	if (!param->mask || (param->mask & ~ch_mask))
+		return -EINVAL;
+
+	for (i = 0; i < param->dev_descriptor->num_ch; i++)
+		if ((param->mask & NO_OS_BIT(i)) &&
+		    !param->dev_descriptor->channels[i].scan_type)
+			return -EINVAL;
+
+	ldesc = (struct iio_capture_desc *)no_os_calloc(1, sizeof(*ldesc));
+	if (!ldesc)
+		return -ENOMEM;
+
+	ldesc->param = *param;
+	if (!ldesc->param.nb_blocks)
+		ldesc->param.nb_blocks = IIO_CAPTURE_DEFAULT_BLOCKS;
+
+	ldesc->buffer.active_mask = param->mask;
+	ldesc->buffer.bytes_per_scan =
+		iio_get_bytes_per_scan(param->dev_descriptor, param->mask);
+	ldesc->buffer.samples = param->samples;
+	ldesc->buffer.size = ldesc->buffer.bytes_per_scan * param->samples;
+	ldesc->buffer.dir = IIO_DIRECTION_INPUT;
+	ldesc->buffer.buf = &ldesc->cb;
+	ldesc->block_size = ldesc->buffer.size;
+
+	ldesc->blocks = (int8_t *)no_os_calloc(ldesc->param.nb_blocks,
+					       ldesc->block_size);
+	if (!ldesc->blocks) {
+		no_os_free(ldesc);
+		return -ENOMEM;
+	}
+
+	ldesc->dev_data.dev = param->dev;
+	ldesc->dev_data.buffer = &ldesc->buffer;
+
+	*desc = ldesc;
+
+	return 0;
+}
+
+/**
+ * @brief Free the resources allocated by iio_capture_init().
+ * The capture is stopped if it was started.
+ * @param desc - Capture descriptor.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int iio_capture_remove(struct iio_capture_desc *desc)
+{
+	int ret = 0;
+
+	if (!desc)
+		return -EINVAL;
+
+	if (desc->started)
+		ret = iio_capture_stop(desc);
+
+	no_os_free(desc->blocks);
+	no_os_free(desc);
+
+	return ret;
+}
+
+/**
+ * @brief Enable the device buffer and write the file header.
+ * @param desc - Capture descriptor.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int iio_capture_start(struct iio_capture_desc *desc)
+{
+	struct iio_device *dev;
+	int ret;
+
+	if (!desc || desc->started)
+		return -EINVAL;
+
+	dev = desc->param.dev_descriptor;
+	ret = no_os_cb_cfg(&desc->cb, desc->blocks,
+			   desc->block_size * desc->param.nb_blocks);
+	if (ret)
+		return ret;
+
+	memset(&desc->stats, 0, sizeof(desc->stats));
+
+	ret = iio_capture_write_header(desc);
+	if (ret)
+		return ret;
+
+	if (dev->pre_enable) {
+		ret = dev->pre_enable(desc->param.dev, desc->param.mask);
+		if (NO_OS_IS_ERR_VALUE(ret))
+			return ret;
+	}
+
+	desc->start = no_os_get_time();
+	desc->started = true;
+
+	return 0;
+}
+
+/**
+ * @brief Let the device fill a block and write the filled blocks to the file.
+ * Unless external_producer is set, the device submit callback, or read_dev,
+ * is called once. With an external producer, the device fills a block from
+ * interrupts while the previous one is written to the file.
+ * @param desc - Capture descriptor.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int iio_capture_step(struct iio_capture_desc *desc)
+{
+	int ret;
+
+	if (!desc || !desc->started)
+		return -EINVAL;
+
+	if (!desc->param.external_producer) {
+		ret = iio_capture_submit(desc);
+		if (ret)
+			return ret;
+	}
+
+	return iio_capture_drain(desc, false);
+}
+
+/**
+ * @brief Write the remaining data, disable the device buffer and sync the
+ * file.
+ * @param desc - Capture descriptor.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int iio_capture_stop(struct iio_capture_desc *desc)
+{
+	struct iio_device *dev;
+	int ret, ret2;
+
+	if (!desc || !desc->started)
+		return -EINVAL;
+
+	dev = desc->param.dev_descriptor;
+	desc->started = false;
+	if (dev->post_disable) {
+		ret = dev->post_disable(desc->param.dev);
+		if (NO_OS_IS_ERR_VALUE(ret))
+			return ret;
+	}
+
+	ret = iio_capture_drain(desc, true);
+	if (desc->param.ops->sync) {
+		ret2 = desc->param.ops->sync(desc->param.file);
+		if (!ret)
+			ret = ret2;
+	}
+
+	return ret;
+}
+
+/**
+ * @brief Get the buffer filled by external producers.
+ * Producers use it with iio_buffer_push_scan() or iio_buffer_get_block() and
+ * iio_buffer_block_done().
+ * @param desc - Capture descriptor.
+ * @return The device buffer, or NULL if desc is NULL.
+ */
+struct iio_buffer *iio_capture_get_buffer(struct iio_capture_desc *desc)
+{
+	if (!desc)
+		return NULL;
+
+	return &desc->buffer;
+}
+
+/**
+ * @brief Get the capture counters.
+ * @param desc - Capture descriptor.
+ * @param stats - Where to store the counters.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int iio_capture_get_stats(struct iio_capture_desc *desc,
+			  struct iio_capture_stats *stats)
+{
+	if (!desc || !stats)
+		return -EINVAL;
+
+	*stats = desc->stats;
+
+	return 0;
+}
+
+#ifdef IIO_CAPTURE_POSIX
+static int iio_capture_posix_write(void *file, const void *buf, uint32_t len)
+{
+	ssize_t ret;
+
+	ret = write(*(int *)file, buf, len);
+	if (ret < 0)
+		return -errno;
+
+	return ret;
+}
+
+static int iio_capture_posix_sync(void *file)
+{
+	if (fsync(*(int *)file))
+		return -errno;
+
+	return 0;
+}
+
+const struct iio_capture_ops iio_capture_posix_ops = {
+	.write = iio_capture_posix_write,
+	.sync = iio_capture_posix_sync,
+};
+#endif
+
+#ifdef IIO_CAPTURE_FATFS
+static int iio_capture_fatfs_write(void *file, const void *buf, uint32_t len)
+{
+	UINT written;
+
+	if (f_write((FIL *)file, buf, len, &written) != FR_OK)
+		return -EIO;
+
+	return written;
+}
+
+static int iio_capture_fatfs_sync(void *file)
+{
+	if (f_sync((FIL *)file) != FR_OK)
+		return -EIO;
+
+	return 0;
+}
+
+const struct iio_capture_ops iio_capture_fatfs_ops = {
+	.write = iio_capture_fatfs_write,
+	.sync = iio_capture_fatfs_sync,
+};
+#endif
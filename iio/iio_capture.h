@@ -0,0 +1,156 @@
+/***************************************************************************//**
+ *   @file   iio_capture.h
+ *   @brief  Header file of the IIO buffer to file capture
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef IIO_CAPTURE_H_
+#define IIO_CAPTURE_H_
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "iio_types.h"
+
+/******************************************************************************/
+/********************** Macros and Constants Definitions **********************/
+/******************************************************************************/
+
+/*
+ * The capture file starts with a text header, padded with spaces to a multiple
+ * of IIO_CAPTURE_HEADER_ALIGN bytes so that the data is aligned to the storage
+ * blocks. Lines are:
+ *	iio-capture 1
+ *	header_len <header length, the offset of the data>
+ *	device <device name>
+ *	scan_bytes <bytes per scan>
+ *	channels <number of channels>
+ *	channel <id> <scan index> <[be|le]:[s|u]bits/storagebits>>shift>
+ *	...
+ *	data
+ * The format of the channel type is the one of the Linux IIO scan elements.
+ * The data is a sequence of scans with the channels in the listed order.
+ */
+#define IIO_CAPTURE_HEADER_ALIGN	512
+
+/******************************************************************************/
+/*************************** Types Declarations *******************************/
+/******************************************************************************/
+
+struct iio_capture_desc;
+
+/* File operations, they should return a negative error code on failure */
+struct iio_capture_ops {
+	/* Write at most len bytes and return the number of bytes written */
+	int (*write)(void *file, const void *buf, uint32_t len);
+	/* Optional. Commit the written data to the storage */
+	int (*sync)(void *file);
+};
+
+struct iio_capture_init_param {
+	/* Device name, written in the header */
+	const char *name;
+	/* Device instance, passed to the device callbacks */
+	void *dev;
+	/* Device descriptor */
+	struct iio_device *dev_descriptor;
+	/* Mask of the captured channels */
+	uint32_t mask;
+	/* Number of scans of a block. Data is written to the file in blocks */
+	uint32_t samples;
+	/*
+	 * Number of blocks the device can fill while a block is written to the
+	 * file. Defaults to 2, the device filling one while the other is
+	 * written.
+	 */
+	uint32_t nb_blocks;
+	/* File where data is captured */
+	const struct iio_capture_ops *ops;
+	void *file;
+	/*
+	 * Set if the data is not produced by iio_capture_step() calling the
+	 * device submit or read_dev callback, but by trigger handlers or DMA
+	 * callbacks writing to the buffer given by iio_capture_get_buffer().
+	 */
+	bool external_producer;
+};
+
+struct iio_capture_stats {
+	/* Data bytes written to the file, without the header */
+	uint64_t bytes;
+	/* Number of file writes */
+	uint32_t blocks;
+	/*
+	 * Number of times the device overwrote data not yet written. Data is
+	 * lost around each overrun.
+	 */
+	uint32_t overruns;
+	/* Time from iio_capture_start() to the last write */
+	uint64_t elapsed_us;
+	/*
+	 * Sustained write throughput over elapsed_us, in MB/s (10^6 bytes),
+	 * rounded down. bytes / elapsed_us gives the exact value.
+	 */
+	uint32_t mbytes_per_sec;
+};
+
+/******************************************************************************/
+/************************ Functions Declarations ******************************/
+/******************************************************************************/
+
+/* Allocate the capture blocks. */
+int iio_capture_init(struct iio_capture_desc **desc,
+		     struct iio_capture_init_param *param);
+/* Free the resources allocated by iio_capture_init(). */
+int iio_capture_remove(struct iio_capture_desc *desc);
+/* Enable the device buffer and write the file header. */
+int iio_capture_start(struct iio_capture_desc *desc);
+/* Let the device fill a block and write the filled blocks to the file. */
+int iio_capture_step(struct iio_capture_desc *desc);
+/* Write the remaining data, disable the device buffer and sync the file. */
+int iio_capture_stop(struct iio_capture_desc *desc);
+/* Get the buffer filled by external producers. */
+struct iio_buffer *iio_capture_get_buffer(struct iio_capture_desc *desc);
+/* Get the capture counters. */
+int iio_capture_get_stats(struct iio_capture_desc *desc,
+			  struct iio_capture_stats *stats);
+
+#ifdef IIO_CAPTURE_POSIX
+/* File operations on a POSIX file descriptor. file points to an int */
+extern const struct iio_capture_ops iio_capture_posix_ops;
+#endif
+
+#ifdef IIO_CAPTURE_FATFS
+/* File operations on a FatFS file. file is a FIL pointer */
+extern const struct iio_capture_ops iio_capture_fatfs_ops;
+#endif
+
+#endif /* IIO_CAPTURE_H_ */
@@ -0,0 +1,335 @@
+/***************************************************************************//**
+ *   @file   iio_scan.c
+ *   @brief  Implementation of the IIO scan element conversion functions
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+#include <string.h>
+#include "no_os_error.h"
+#include "no_os_util.h"
+#include "iio_scan.h"
+
+/******************************************************************************/
+/************************ Functions Definitions *******************************/
+/******************************************************************************/
+
+/*
+ * The conversions are written as one simple loop per sample width, with the
+ * width dispatched once per block, so that the compiler can vectorize them
+ * (e.g. NEON or SSE) when the target supports it.
+ */
+
+/**
+ * @brief Unpack big endian samples, as read from most devices, into
+ * storagebits wide words in CPU endianness.
+ *
+ * @param type       - Scan type of the samples.
+ * @param dst        - Destination buffer, nb_samples storagebits wide words.
+ * @param src        - Source buffer, nb_samples * src_bytes bytes.
+ * @param src_bytes  - Size of a sample in src, at most storagebits / 8.
+ * @param nb_samples - Number of samples.
+ *
+ * @return ret       - 0 in case of success, negative error code otherwise.
+ */
+int iio_scan_unpack_be(const struct scan_type *type, void *dst,
+		       const uint8_t *src, uint8_t src_bytes,
+		       uint32_t nb_samples)
+{
+	uint16_t *dst16 = dst;
+	uint32_t *dst32 = dst;
+	uint32_t i, val;
+	uint8_t j;
+
+	if (!type || !dst || !src || !src_bytes ||
+	    src_bytes > type->storagebits / 8)
+		return -EINVAL;
+
+	switch (type->storagebits) {
+	case 8:
+		memcpy(dst, src, nb_samples);
+		return 0;
+	case 16:
+		if (src_bytes == 2) {
+			for (i = 0; i < nb_samples; i++)
+				dst16[i] = ((uint16_t)src[2 * i] << 8) |
+					   src[2 * i + 1];
+			return 0;
+		}
+		for (i = 0; i < nb_samples; i++)
+			dst16[i] = src[i];
+		return 0;
+	case 32:
+		if (src_bytes == 4) {
+			for (i = 0; i < nb_samples; i++)
+				dst32[i] = ((uint32_t)src[4 * i] << 24) |
+					   ((uint32_t)src[4 * i + 1] << 16) |
+					   ((uint32_t)src[4 * i + 2] << 8) |
+					   src[4 * i + 3];
+			return 0;
+		}
+		if (src_bytes == 3) {
+			for (i = 0; i < nb_samples; i++)
+				dst32[i] = ((uint32_t)src[3 * i] << 16) |
+					   ((uint32_t)src[3 * i + 1] << 8) |
+					   src[3 * i + 2];
+			return 0;
+		}
+		for (i = 0; i < nb_samples; i++) {
+			val = 0;
+			for (j = 0; j < src_bytes; j++)
+				val = (val << 8) | *src++;
+			dst32[i] = val;
+		}
+		return 0;
+	default:
+		return -EINVAL;
+	}
+}
+
+/**
+ * @brief Byte swap samples in place, to convert them between CPU endianness
+ * and the other one.
+ *
+ * @param type       - Scan type of the samples.
+ * @param buf        - Samples.
+ * @param nb_samples - Number of samples.
+ *
+ * @return ret       - 0 in case of success, negative error code otherwise.
+ */
+int iio_scan_swab(const struct scan_type *type, void *buf, uint32_t nb_samples)
+{
+	uint16_t *buf16 = buf;
+	uint32_t *buf32 = buf;
+	uint32_t i;
+
+	if (!type || !buf)
+		return -EINVAL;
+
+	switch (type->storagebits) {
+	case 8:
+		return 0;
+	case 16:
+		for (i = 0; i < nb_samples; i++)
+			buf16[i] = no_os_bswap_constant_16(buf16[i]);
+		return 0;
+	case 32:
+		for (i = 0; i < nb_samples; i++)
+			buf32[i] = no_os_bswap_constant_32(buf32[i]);
+		return 0;
+	default:
+		return -EINVAL;
+	}
+}
+
+/**
+ * @brief Replace samples in place by the realbits wide value found at shift,
+ * sign extended to storagebits for signed scan types and zero extended
+ * otherwise. Samples must be in CPU endianness.
+ *
+ * @param type       - Scan type of the samples.
+ * @param buf        - Samples.
+ * @param nb_samples - Number of samples.
+ *
+ * @return ret       - 0 in case of success, negative error code otherwise.
+ */
+int iio_scan_sign_extend(const struct scan_type *type, void *buf,
+			 uint32_t nb_samples)
+{
+	uint8_t *buf8 = buf;
+	uint16_t *buf16 = buf;
+	uint32_t *buf32 = buf;
+	uint8_t lshift, rshift;
+	uint32_t i;
+
+	if (!type || !buf || !type->realbits ||
+	    type->realbits + type->shift > type->storagebits)
+		return -EINVAL;
+
+	/* Move the value to the top of the word, then back to bit 0 */
+	lshift = type->storagebits - type->realbits - type->shift;
+	rshift = type->storagebits - type->realbits;
+
+	switch (type->storagebits) {
+	case 8:
+		if (type->sign == 's')
+			for (i = 0; i < nb_samples; i++)
+				buf8[i] = (int8_t)(buf8[i] << lshift) >> rshift;
+		else
+			for (i = 0; i < nb_samples; i++)
+				buf8[i] = (uint8_t)(buf8[i] << lshift) >>
+					  rshift;
+		return 0;
+	case 16:
+		if (type->sign == 's')
+			for (i = 0; i < nb_samples; i++)
+				buf16[i] = (int16_t)(buf16[i] << lshift) >>
+					   rshift;
+		else
+			for (i = 0; i < nb_samples; i++)
+				buf16[i] = (uint16_t)(buf16[i] << lshift) >>
+					   rshift;
+		return 0;
+	case 32:
+		if (type->sign == 's')
+			for (i = 0; i < nb_samples; i++)
+				buf32[i] = (int32_t)(buf32[i] << lshift) >>
+					   rshift;
+		else
+			for (i = 0; i < nb_samples; i++)
+				buf32[i] = (buf32[i] << lshift) >> rshift;
+		return 0;
+	default:
+		return -EINVAL;
+	}
+}
+
+/**
+ * @brief Copy the channels set in mask from a sample set holding all the
+ * channels, packing them in the order of the IIO buffer.
+ *
+ * @param dst    - Destination, room for the number of bits set in mask.
+ * @param src    - Sample set of nb_ch channels.
+ * @param mask   - Active channels mask.
+ * @param nb_ch  - Number of channels in src.
+ * @param bytes  - Size of a sample.
+ *
+ * @return ret   - Number of copied channels.
+ */
+uint32_t iio_scan_select(void *dst, const void *src, uint32_t mask,
+			 uint32_t nb_ch, uint8_t bytes)
+{
+	uint32_t all, i, k = 0;
+
+	nb_ch = no_os_min(nb_ch, 32);
+	all = nb_ch == 32 ? 0xFFFFFFFF : (1u << nb_ch) - 1;
+
+	/* All channels active, nothing to pack */
+	if ((mask & all) == all) {
+		memcpy(dst, src, nb_ch * bytes);
+		return nb_ch;
+	}
+
+	for (i = 0; i < nb_ch; i++) {
+		if (!(mask & (1u << i)))
+			continue;
+		memcpy((uint8_t *)dst + k * bytes,
+		       (const uint8_t *)src + i * bytes, bytes);
+		k++;
+	}
+
+	return k;
+}
+
+/**
+ * @brief Interleave per channel buffers into sample sets, as stored in an IIO
+ * buffer.
+ *
+ * @param dst        - Destination, nb_samples * nb_ch samples.
+ * @param srcs       - nb_ch buffers of nb_samples samples.
+ * @param nb_ch      - Number of channels.
+ * @param nb_samples - Number of samples per channel.
+ * @param bytes      - Size of a sample.
+ */
+void iio_scan_interleave(void *dst, const void * const *srcs, uint32_t nb_ch,
+			 uint32_t nb_samples, uint8_t bytes)
+{
+	uint8_t *dst8 = dst;
+	uint32_t ch, i;
+
+	for (ch = 0; ch < nb_ch; ch++) {
+		switch (bytes) {
+		case 1:
+			for (i = 0; i < nb_samples; i++)
+				((uint8_t *)dst)[i * nb_ch + ch] =
+					((const uint8_t *)srcs[ch])[i];
+			break;
+		case 2:
+			for (i = 0; i < nb_samples; i++)
+				((uint16_t *)dst)[i * nb_ch + ch] =
+					((const uint16_t *)srcs[ch])[i];
+			break;
+		case 4:
+			for (i = 0; i < nb_samples; i++)
+				((uint32_t *)dst)[i * nb_ch + ch] =
+					((const uint32_t *)srcs[ch])[i];
+			break;
+		default:
+			for (i = 0; i < nb_samples; i++)
+				memcpy(dst8 + (i * nb_ch + ch) * bytes,
+				       (const uint8_t *)srcs[ch] + i * bytes,
+				       bytes);
+			break;
+		}
+	}
+}
+
+/**
+ * @brief Split sample sets, as stored in an IIO buffer, into per channel
+ * buffers.
+ *
+ * @param dsts       - nb_ch buffers with room for nb_samples samples.
+ * @param src        - nb_samples * nb_ch samples.
+ * @param nb_ch      - Number of channels.
+ * @param nb_samples - Number of samples per channel.
+ * @param bytes      - Size of a sample.
+ */
+void iio_scan_deinterleave(void * const *dsts, const void *src, uint32_t nb_ch,
+			   uint32_t nb_samples, uint8_t bytes)
+{
+	const uint8_t *src8 = src;
+	uint32_t ch, i;
+
+	for (ch = 0; ch < nb_ch; ch++) {
+		switch (bytes) {
+		case 1:
+			for (i = 0; i < nb_samples; i++)
+				((uint8_t *)dsts[ch])[i] =
+					((const uint8_t *)src)[i * nb_ch + ch];
+			break;
+		case 2:
+			for (i = 0; i < nb_samples; i++)
+				((uint16_t *)dsts[ch])[i] =
+					((const uint16_t *)src)[i * nb_ch + ch];
+			break;
+		case 4:
+			for (i = 0; i < nb_samples; i++)
+				((uint32_t *)dsts[ch])[i] =
+					((const uint32_t *)src)[i * nb_ch + ch];
+			break;
+		default:
+			for (i = 0; i < nb_samples; i++)
+				memcpy((uint8_t *)dsts[ch] + i * bytes,
+				       src8 + (i * nb_ch + ch) * bytes, bytes);
+			break;
+		}
+	}
+}
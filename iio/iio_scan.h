@@ -0,0 +1,73 @@
+/***************************************************************************//**
+ *   @file   iio_scan.h
+ *   @brief  Header file of the IIO scan element conversion functions
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef IIO_SCAN_H_
+#define IIO_SCAN_H_
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+#include <stdint.h>
+#include "iio_types.h"
+
+/******************************************************************************/
+/************************ Functions Declarations ******************************/
+/******************************************************************************/
+/*
+ * Block conversions between the raw data of a device and IIO scan elements.
+ * Samples are 1, 2 or 4 bytes wide, as given by scan_type.storagebits, and
+ * are stored in CPU endianness unless specified otherwise.
+ */
+
+/* Unpack big endian samples of src_bytes bytes into storagebits words. */
+int iio_scan_unpack_be(const struct scan_type *type, void *dst,
+		       const uint8_t *src, uint8_t src_bytes,
+		       uint32_t nb_samples);
+/* Byte swap samples, to convert them to or from big endian. */
+int iio_scan_swab(const struct scan_type *type, void *buf,
+		  uint32_t nb_samples);
+/* Replace samples by the realbits value found at shift, sign extended for
+   signed scan types. */
+int iio_scan_sign_extend(const struct scan_type *type, void *buf,
+			 uint32_t nb_samples);
+/* Copy the channels set in mask from a sample set of nb_ch channels.
+   Returns the number of copied channels. */
+uint32_t iio_scan_select(void *dst, const void *src, uint32_t mask,
+			 uint32_t nb_ch, uint8_t bytes);
+/* Interleave nb_samples of each of the nb_ch srcs buffers into dst. */
+void iio_scan_interleave(void *dst, const void * const *srcs, uint32_t nb_ch,
+			 uint32_t nb_samples, uint8_t bytes);
+/* Split nb_samples interleaved sample sets of nb_ch channels into dsts. */
+void iio_scan_deinterleave(void * const *dsts, const void *src, uint32_t nb_ch,
+			   uint32_t nb_samples, uint8_t bytes);
+
+#endif /* IIO_SCAN_H_ */
@@ -44,6 +44,35 @@
 /******************************************************************************/
 /************************ Functions Definitions *******************************/
 /******************************************************************************/
+
+/**
+ * @brief Resolve the trigger name to a trigger index of iio_desc. The index is
+ * cached, so the lookup by name is only done once per IIO descriptor.
+ *
+ * @param iio_desc - IIO descriptor the trigger belongs to.
+ * @param name     - Trigger name.
+ * @param idx_desc - IIO descriptor for which trig_idx was resolved.
+ * @param trig_idx - Cached trigger index.
+ *
+ * @return ret     - 0 in case of success, negative error code otherwise.
+ */
+static int iio_trig_resolve(struct iio_desc *iio_desc, const char *name,
+			    struct iio_desc **idx_desc, uint32_t *trig_idx)
+{
+	int ret;
+
+	if (*idx_desc == iio_desc)
+		return 0;
+
+	ret = iio_get_trigger_idx(iio_desc, name, trig_idx);
+	if (ret)
+		return ret;
+
+	*idx_desc = iio_desc;
+
+	return 0;
+}
+
 #ifndef LINUX_PLATFORM
 /**
  * @brief Initialize hardware trigger.
@@ -114,6 +143,11 @@ int iio_trig_enable(void *trig)
 
 	struct iio_hw_trig *desc = trig;
 
+	/* Resolve the trigger index before the interrupt can fire. */
+	if (desc->iio_desc)
+		iio_trig_resolve(desc->iio_desc, desc->name, &desc->idx_desc,
+				 &desc->trig_idx);
+
 	return no_os_irq_enable(desc->irq_ctrl, desc->irq_id);
 }
 
@@ -147,7 +181,11 @@ void iio_hw_trig_handler(void *trig)
 
 	struct iio_hw_trig *desc = trig;
 
-	iio_process_trigger_type(desc->iio_desc, desc->name);
+	if (iio_trig_resolve(desc->iio_desc, desc->name, &desc->idx_desc,
+			     &desc->trig_idx))
+		return;
+
+	iio_process_trigger(desc->iio_desc, desc->trig_idx);
 }
 
 /**
@@ -213,8 +251,14 @@ int iio_sw_trig_handler(void *trig, char *buf, uint32_t len,
 		return -EINVAL;
 
 	struct iio_sw_trig *desc = trig;
+	int ret;
+
+	ret = iio_trig_resolve(desc->iio_desc, desc->name, &desc->idx_desc,
+			       &desc->trig_idx);
+	if (ret)
+		return ret;
 
-	return iio_process_trigger_type(desc->iio_desc, desc->name);
+	return iio_process_trigger(desc->iio_desc, desc->trig_idx);
 }
 
 /**
@@ -64,6 +64,10 @@ struct iio_hw_trig {
 	enum no_os_irq_trig_level irq_trig_lvl;
 	/** Device trigger name */
 	char name[TRIG_MAX_NAME_SIZE + 1];
+	/** Trigger index in idx_desc, so that events don't search by name */
+	uint32_t trig_idx;
+	/** IIO descriptor for which trig_idx was resolved */
+	struct iio_desc *idx_desc;
 };
 
 /**
@@ -107,6 +111,10 @@ struct iio_sw_trig {
 	struct iio_desc *iio_desc;
 	/** Device trigger name */
 	char name[TRIG_MAX_NAME_SIZE + 1];
+	/** Trigger index in idx_desc, so that events don't search by name */
+	uint32_t trig_idx;
+	/** IIO descriptor for which trig_idx was resolved */
+	struct iio_desc *idx_desc;
 };
 
 /**
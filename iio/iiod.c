@@ -42,9 +42,20 @@
 
 #include "no_os_error.h"
 #include "no_os_util.h"
+#ifdef IIO_METRICS
+#include "no_os_delay.h"
+#endif
 
 #define SET_DUMMY_IF_NULL(func, dummy) ((func) ? (func) : (dummy))
 
+#ifdef IIO_METRICS
+#define IIOD_METRICS_ADD(desc, field, val) ((desc)->metrics.field += (val))
+#else
+#define IIOD_METRICS_ADD(desc, field, val) do { } while (0)
+#endif
+/* Room for the longest return value of a READMULTI tuple and its newline */
+#define IIOD_READMULTI_HDR_LEN	12
+
 static char delim[] = " \r\n";
 
 
@@ -69,7 +80,8 @@ static struct iiod_str cmds[] = {
 	[IIOD_CMD_WRITEBUF]	= IIOD_STR("WRITEBUF"),
 	[IIOD_CMD_GETTRIG]	= IIOD_STR("GETTRIG"),
 	[IIOD_CMD_SETTRIG]	= IIOD_STR("SETTRIG"),
-	[IIOD_CMD_SET]		= IIOD_STR("SET")
+	[IIOD_CMD_SET]		= IIOD_STR("SET"),
+	[IIOD_CMD_READMULTI]	= IIOD_STR("READMULTI")
 };
 static const uint32_t priority_array[] = {
 	/* Order not tested, just personal expectation. Function can
@@ -87,11 +99,18 @@ static const uint32_t priority_array[] = {
 	IIOD_CMD_GETTRIG,
 	IIOD_CMD_SETTRIG,
 	IIOD_CMD_HELP,
-	IIOD_CMD_SET
+	IIOD_CMD_SET,
+	IIOD_CMD_READMULTI
 };
 
 static_assert(NO_OS_ARRAY_SIZE(cmds) == NO_OS_ARRAY_SIZE(priority_array),
 	      "Arrays must have the same size");
+#ifdef IIO_METRICS
+static_assert(IIOD_METRICS_NB_CMDS == IIOD_CMD_NB,
+	      "IIOD_METRICS_NB_CMDS must match the number of commands");
+static_assert(IIOD_METRICS_NB_STATES == IIOD_NB_STATES,
+	      "IIOD_METRICS_NB_STATES must match the number of states");
+#endif
 
 /* Set res->cmd to corresponding cmd and return the processed length of buf */
 static int32_t parse_cmd(const char *token, struct comand_desc *res)
@@ -243,6 +262,11 @@ int32_t iiod_parse_line(char *buf, struct comand_desc *res, char **ctx)
 		return 0;
 	case IIOD_CMD_TIMEOUT:
 		return parse_num(token, &res->timeout, 10);
+	case IIOD_CMD_READMULTI:
+		if (!token)
+			return -EINVAL;
+
+		return parse_num(token, &res->bytes_count, 10);
 	default:
 		break;
 	}
@@ -340,6 +364,12 @@ int32_t iiod_copy_ops(struct iiod_ops *ops, struct iiod_ops *new_ops)
 					       dummy_close);
 	ops->push_buffer = SET_DUMMY_IF_NULL(new_ops->push_buffer,
 					     dummy_close);
+	ops->update_xml = new_ops->update_xml;
+	/* Zero copy is used only if both ops are provided */
+	if (new_ops->get_buffer_span && new_ops->release_buffer) {
+		ops->get_buffer_span = new_ops->get_buffer_span;
+		ops->release_buffer = new_ops->release_buffer;
+	}
 
 	return 0;
 }
@@ -367,6 +397,7 @@ int32_t iiod_init(struct iiod_desc **desc, struct iiod_init_param *param)
 	ldesc->xml_len = param->xml_len;
 	ldesc->app_instance = param->instance;
 	ldesc->phy_type = param->phy_type;
+	ldesc->batched_read = param->batched_read;
 
 	*desc = ldesc;
 
@@ -423,7 +454,7 @@ int32_t iiod_conn_add(struct iiod_desc *desc, struct iiod_conn_data *data,
 int32_t iiod_conn_remove(struct iiod_desc *desc, uint32_t conn_id,
 			 struct iiod_conn_data *data)
 {
-	if (!desc || conn_id > IIOD_MAX_CONNECTIONS ||
+	if (!desc || conn_id >= IIOD_MAX_CONNECTIONS ||
 	    !desc->conns[conn_id].used)
 		return -EINVAL;
 	struct iiod_conn_priv *conn;
@@ -436,6 +467,37 @@ int32_t iiod_conn_remove(struct iiod_desc *desc, uint32_t conn_id,
 	return 0;
 }
 
+int32_t iiod_conn_get(struct iiod_desc *desc, uint32_t conn_id,
+		      struct iiod_conn_data *data)
+{
+	struct iiod_conn_priv *conn;
+
+	if (!desc || !data || conn_id >= IIOD_MAX_CONNECTIONS ||
+	    !desc->conns[conn_id].used)
+		return -EINVAL;
+
+	conn = &desc->conns[conn_id];
+	data->conn = conn->conn;
+	data->len = conn->payload_buf_len;
+	data->buf = conn->payload_buf;
+
+	return 0;
+}
+
+bool iiod_conn_is_idle(struct iiod_desc *desc, uint32_t conn_id)
+{
+	struct iiod_conn_priv *conn;
+
+	if (!desc || conn_id >= IIOD_MAX_CONNECTIONS ||
+	    !desc->conns[conn_id].used)
+		return false;
+
+	conn = &desc->conns[conn_id];
+
+	return conn->state == IIOD_READING_LINE && !conn->is_cyclic_buffer &&
+	       conn->rx_idx == conn->rx_len;
+}
+
 static int32_t call_op(struct iiod_ops *ops, struct comand_desc *data,
 		       struct iiod_ctx *ctx)
 {
@@ -461,6 +523,37 @@ static int32_t call_op(struct iiod_ops *ops, struct comand_desc *data,
 	return -EINVAL;
 }
 
+/* Number of received bytes still waiting in rx_buf */
+static inline uint32_t iiod_rx_avail(struct iiod_conn_priv *conn)
+{
+	return conn->rx_len - conn->rx_idx;
+}
+
+/*
+ * Refill rx_buf once it was fully consumed. The network backend returns
+ * whatever is available, so as much as fits is requested in one call. Other
+ * backends (e.g. UART) may block until len bytes arrive, so they are still
+ * read one byte at a time.
+ */
+static int32_t iiod_rx_fill(struct iiod_desc *desc, struct iiod_conn_priv *conn)
+{
+	struct iiod_ctx ctx = IIOD_CTX(desc, conn);
+	uint32_t len;
+	int32_t ret;
+
+	len = desc->phy_type == USE_NETWORK ? IIOD_RX_BUF_SIZE : 1;
+	ret = desc->ops.recv(&ctx, (uint8_t *)conn->rx_buf, len);
+	if (ret == 0)
+		return -EAGAIN;
+	if (NO_OS_IS_ERR_VALUE(ret))
+		return ret;
+
+	conn->rx_idx = 0;
+	conn->rx_len = ret;
+
+	return 0;
+}
+
 /*
  * Unload data from buf without blocking.
  * When done will return 0, if there is still data to be sent it will return
@@ -477,10 +570,16 @@ static int32_t rw_iiod_buff(struct iiod_desc *desc, struct iiod_conn_priv *conn,
 	len = buf->len - buf->idx;
 	if (len) {
 		tmp_buf = (uint8_t *)buf->buf + buf->idx;
-		if (flags & IIOD_WR)
+		if (flags & IIOD_WR) {
 			ret = desc->ops.send(&ctx, tmp_buf, len);
-		else
+		} else if (iiod_rx_avail(conn)) {
+			/* Payload bytes already received with the command */
+			ret = no_os_min((uint32_t)len, iiod_rx_avail(conn));
+			memcpy(tmp_buf, conn->rx_buf + conn->rx_idx, ret);
+			conn->rx_idx += ret;
+		} else {
 			ret = desc->ops.recv(&ctx, tmp_buf, len);
+		}
 		if (NO_OS_IS_ERR_VALUE(ret))
 			return ret;
 
@@ -531,6 +630,44 @@ static int32_t do_read_buff_delayed(struct iiod_desc *desc,
 	return 0;
 }
 
+/*
+ * Send spans of the device buffer directly on the connection, without
+ * copying them to payload_buf. A span is released only after it was fully
+ * sent or if the connection failed.
+ */
+static int32_t do_read_buff_zero_copy(struct iiod_desc *desc,
+				      struct iiod_conn_priv *conn)
+{
+	struct iiod_ctx ctx = IIOD_CTX(desc, conn);
+	int32_t ret;
+
+	if (conn->nb_buf.len == 0) {
+		ret = desc->ops.get_buffer_span(&ctx, conn->cmd_data.device,
+						&conn->nb_buf.buf,
+						conn->cmd_data.bytes_count);
+		if (NO_OS_IS_ERR_VALUE(ret))
+			return ret;
+
+		conn->nb_buf.len = ret;
+		conn->nb_buf.idx = 0;
+	}
+
+	ret = rw_iiod_buff(desc, conn, &conn->nb_buf, IIOD_WR);
+	if (ret == -EAGAIN)
+		return ret;
+
+	desc->ops.release_buffer(&ctx, conn->cmd_data.device);
+	if (NO_OS_IS_ERR_VALUE(ret))
+		return ret;
+
+	conn->cmd_data.bytes_count -= conn->nb_buf.len;
+	conn->nb_buf.len = 0;
+	if (conn->cmd_data.bytes_count)
+		return -EAGAIN;
+
+	return 0;
+}
+
 static int32_t do_read_buff(struct iiod_desc *desc, struct iiod_conn_priv *conn)
 {
 	struct iiod_ctx ctx;
@@ -540,8 +677,12 @@ static int32_t do_read_buff(struct iiod_desc *desc, struct iiod_conn_priv *conn)
 	 * When using the network backend wait for a whole buffer to be filled
 	 * before sending in order to reduce the ammount of network traffic.
 	 */
-	if (desc->phy_type == USE_NETWORK)
+	if (desc->phy_type == USE_NETWORK) {
+		if (desc->ops.get_buffer_span)
+			return do_read_buff_zero_copy(desc, conn);
+
 		return do_read_buff_delayed(desc, conn);
+	}
 
 	ctx = (struct iiod_ctx)IIOD_CTX(desc, conn);
 	if (conn->nb_buf.len == 0) {
@@ -605,6 +746,116 @@ static int32_t do_write_buff(struct iiod_desc *desc,
 	return 0;
 }
 
+/*
+ * Parse a READMULTI tuple in place: <device> [type [channel]] <attr>.
+ * device and the attr strings point in line.
+ */
+static int32_t iiod_parse_attr_tuple(char *line, const char **device,
+				     struct iiod_attr *attr)
+{
+	char *token, *ctx;
+	int32_t i;
+
+	*device = strtok_r(line, delim, &ctx);
+	if (!*device)
+		return -EINVAL;
+
+	attr->type = IIO_ATTR_TYPE_DEVICE;
+	attr->channel = "";
+	token = strtok_r(NULL, delim, &ctx);
+	if (token) {
+		for (i = 0; i < IIO_ATTR_TYPE_DEVICE; ++i) {
+			if (strcmp(token, attr_types_strs[i]) == 0) {
+				token = strtok_r(NULL, delim, &ctx);
+				attr->type = i;
+				break;
+			}
+		}
+	}
+
+	if (attr->type == IIO_ATTR_TYPE_CH_IN ||
+	    attr->type == IIO_ATTR_TYPE_CH_OUT) {
+		if (!token)
+			return -EINVAL;
+		attr->channel = token;
+		token = strtok_r(NULL, delim, &ctx);
+	}
+
+	attr->name = token ? token : "";
+
+	return 0;
+}
+
+/*
+ * Read all the tuples of a READMULTI request, stored in payload_buf, and
+ * build the answer in the rest of payload_buf so that it is sent at once.
+ * Each tuple is answered like a READ command. Tuples that don't fit in the
+ * buffer are not answered, res.val is set to the number of answered tuples.
+ */
+static void iiod_read_multi(struct iiod_desc *desc,
+			    struct iiod_conn_priv *conn)
+{
+	struct iiod_ctx ctx = IIOD_CTX(desc, conn);
+	char hdr[IIOD_READMULTI_HDR_LEN + 1];
+	char *line, *next, *end, *out, *out_end;
+	struct iiod_attr attr;
+	const char *device;
+	uint32_t count = 0;
+	int32_t ret, len, avail;
+
+	line = conn->payload_buf;
+	end = line + conn->cmd_data.bytes_count;
+	*end = '\0';
+	out = end + 1;
+	out_end = conn->payload_buf + conn->payload_buf_len;
+	conn->res.buf.buf = out;
+
+	for (; line < end; line = next) {
+		next = memchr(line, '\n', end - line);
+		if (!next)
+			next = end;
+		*next++ = '\0';
+		if (line[strspn(line, delim)] == '\0')
+			continue;
+
+		/*
+		 * The value is read after room for the header, then moved next
+		 * to it. One byte is kept for the newline after the value.
+		 */
+		avail = out_end - out - IIOD_READMULTI_HDR_LEN - 1;
+		if (avail < 1)
+			break;
+
+		ret = iiod_parse_attr_tuple(line, &device, &attr);
+		if (!NO_OS_IS_ERR_VALUE(ret))
+			ret = desc->ops.read_attr(&ctx, device, &attr,
+						  out + IIOD_READMULTI_HDR_LEN,
+						  avail);
+		if (!NO_OS_IS_ERR_VALUE(ret))
+			ret = no_os_min(ret, avail);
+
+		len = sprintf(hdr, "%"PRIi32"\n", ret);
+		if (!NO_OS_IS_ERR_VALUE(ret)) {
+			memmove(out + len, out + IIOD_READMULTI_HDR_LEN, ret);
+			memcpy(out, hdr, len);
+			out += len + ret;
+			*out++ = '\n';
+		} else {
+			memcpy(out, hdr, len);
+			out += len;
+		}
+		count++;
+	}
+
+	/* The last newline is added when the answer is sent */
+	if (out > conn->res.buf.buf)
+		out--;
+
+	conn->res.buf.len = out - conn->res.buf.buf;
+	conn->res.val = count;
+	conn->res.write_val = 1;
+}
+
 static int32_t iiod_run_cmd(struct iiod_desc *desc,
 			    struct iiod_conn_priv *conn)
 {
@@ -641,6 +892,8 @@ static int32_t iiod_run_cmd(struct iiod_desc *desc,
 
 		return -ENOTCONN;
 	case IIOD_CMD_PRINT:
+		if (desc->ops.update_xml)
+			desc->ops.update_xml(&ctx);
 		conn->res.val = desc->xml_len;
 		conn->res.write_val = 1;
 		conn->res.buf.buf = desc->xml;
@@ -676,6 +929,10 @@ static int32_t iiod_run_cmd(struct iiod_desc *desc,
 		conn->res.val = ret;
 		conn->res.write_val = 1;
 		break;
+	case IIOD_CMD_READMULTI:
+		iiod_read_multi(desc, conn);
+		conn->nb_buf.len = 0;
+		break;
 	case IIOD_CMD_READBUF:
 		conn->res.write_val = 1;
 		ret = desc->ops.refill_buffer(&ctx, data->device);
@@ -683,6 +940,7 @@ static int32_t iiod_run_cmd(struct iiod_desc *desc,
 			conn->res.val = ret;
 			break;
 		}
+		IIOD_METRICS_ADD(desc, readbuf_bytes, data->bytes_count);
 		conn->res.val = data->bytes_count;
 		ret = snprintf(conn->buf_mask, 10, "%08"PRIx32, conn->mask);
 		conn->res.buf.buf = conn->buf_mask;
@@ -702,34 +960,48 @@ static int32_t iiod_run_cmd(struct iiod_desc *desc,
 static int32_t iiod_read_line(struct iiod_desc *desc,
 			      struct iiod_conn_priv *conn)
 {
-	struct iiod_ctx ctx = {
-		.instance = desc->app_instance,
-		.conn = conn->conn
-	};
+	uint32_t avail, len;
+	char *start, *end;
 	int32_t ret;
-	char *ch;
 
-	while (conn->parser_idx < IIOD_PARSER_MAX_BUF_SIZE - 1) {
-		ch = conn->parser_buf + conn->parser_idx;
-		ret = desc->ops.recv(&ctx,(uint8_t *)ch, 1);
-		if (ret == -EAGAIN || ret == 0)
-			return -EAGAIN;
+	while (true) {
+		avail = iiod_rx_avail(conn);
+		if (!avail) {
+			ret = iiod_rx_fill(desc, conn);
+			if (ret == -EAGAIN)
+				return -EAGAIN;
 
-		if (NO_OS_IS_ERR_VALUE(ret))
-			goto end;
+			if (NO_OS_IS_ERR_VALUE(ret))
+				goto end;
+
+			continue;
+		}
+
+		start = conn->rx_buf + conn->rx_idx;
+		if (conn->parser_idx == 0 && (*start == '\n' || *start == '\r')) {
+			conn->rx_idx++;
+			continue;
+		}
 
-		if (conn->parser_idx == 0 && (*ch == '\n' || *ch == '\r'))
-			continue ;
+		end = memchr(start, '\n', avail);
+		len = end ? end - start + 1 : avail;
+		if (conn->parser_idx + len > IIOD_PARSER_MAX_BUF_SIZE - 1) {
+			/* Line too long, drop what was received */
+			conn->rx_idx = conn->rx_len;
+			ret = -EIO;
+			goto end;
+		}
 
-		++conn->parser_idx;
-		if (*ch == '\n') {
+		memcpy(conn->parser_buf + conn->parser_idx, start, len);
+		conn->parser_idx += len;
+		conn->rx_idx += len;
+		if (end) {
 			conn->parser_buf[conn->parser_idx] = '\0';
 			ret = 0;
 			goto end;
 		}
 	}
 
-	ret = -EIO;
 end:
 	conn->parser_idx = 0;
 	return ret;
@@ -762,11 +1034,27 @@ static int32_t iiod_run_state(struct iiod_desc *desc,
 				      &conn->strtok_ctx);
 		if (NO_OS_IS_ERR_VALUE(ret)) {
 			/* Parsing line failed */
+			IIOD_METRICS_ADD(desc, parse_errors, 1);
 			conn->res.write_val = 1;
 			conn->res.val = ret;
 			conn->state = IIOD_WRITING_CMD_RESULT;
-		} else if (conn->cmd_data.cmd == IIOD_CMD_WRITE) {
-			/* Special case. Attribute needs to be read */
+
+			return 0;
+		}
+
+		if (conn->cmd_data.cmd < IIOD_CMD_NB)
+			IIOD_METRICS_ADD(desc, cmds[conn->cmd_data.cmd], 1);
+		if (conn->cmd_data.cmd == IIOD_CMD_READMULTI &&
+			   (!desc->batched_read ||
+			    conn->cmd_data.bytes_count >=
+			    conn->payload_buf_len)) {
+			/* Extension not enabled or request too long */
+			conn->res.write_val = 1;
+			conn->res.val = -EINVAL;
+			conn->state = IIOD_WRITING_CMD_RESULT;
+		} else if (conn->cmd_data.cmd == IIOD_CMD_WRITE ||
+			   conn->cmd_data.cmd == IIOD_CMD_READMULTI) {
+			/* Special case. Attribute(s) need to be read */
 			conn->nb_buf.buf = conn->payload_buf;
 			conn->nb_buf.len = conn->cmd_data.bytes_count;
 			conn->nb_buf.idx = 0;
@@ -842,6 +1130,8 @@ static int32_t iiod_run_state(struct iiod_desc *desc,
 
 					return 0;
 				}
+				IIOD_METRICS_ADD(desc, writebuf_bytes,
+						 conn->cmd_data.bytes_count);
 				memset(&conn->res.buf, 0, sizeof(conn->res.buf));
 				conn->res.val = conn->cmd_data.bytes_count;
 				conn->cmd_data.cmd = IIOD_CMD_PRINT;
@@ -902,18 +1192,65 @@ static int32_t iiod_run_state(struct iiod_desc *desc,
 	}
 }
 
+#ifdef IIO_METRICS
+static uint64_t iiod_metrics_now_us(void)
+{
+	struct no_os_time t = no_os_get_time();
+
+	return (uint64_t)t.s * 1000000 + t.us;
+}
+
+/* Add the duration of a step of a connection to the histogram of its state */
+static void iiod_metrics_add_step(struct iiod_desc *desc, uint32_t state,
+				  uint64_t start_us)
+{
+	uint64_t elapsed;
+	uint32_t bin;
+
+	if (state >= IIOD_METRICS_NB_STATES)
+		return;
+
+	elapsed = iiod_metrics_now_us() - start_us;
+	for (bin = 0; elapsed && bin < IIOD_METRICS_HIST_LEN - 1; bin++)
+		elapsed >>= 1;
+
+	desc->metrics.state_hist[state][bin]++;
+}
+
+int32_t iiod_get_metrics(struct iiod_desc *desc, struct iiod_metrics *metrics)
+{
+	if (!desc || !metrics)
+		return -EINVAL;
+
+	*metrics = desc->metrics;
+
+	return 0;
+}
+#endif
+
 int32_t iiod_conn_step(struct iiod_desc *desc, uint32_t conn_id)
 {
 	struct iiod_conn_priv *conn;
 	int32_t ret;
+#ifdef IIO_METRICS
+	uint64_t start_us;
+	uint32_t state;
+#endif
 
-	if (!desc || conn_id > IIOD_MAX_CONNECTIONS ||
+	if (!desc || conn_id >= IIOD_MAX_CONNECTIONS ||
 	    !desc->conns[conn_id].used)
 		return -EINVAL;
 
 	conn = &desc->conns[conn_id];
 	do {
+#ifdef IIO_METRICS
+		state = conn->state;
+		start_us = iiod_metrics_now_us();
+		ret = iiod_run_state(desc, conn);
+		iiod_metrics_add_step(desc, state, start_us);
+#else
 		ret = iiod_run_state(desc, conn);
+#endif
 		if (ret == -EAGAIN)
 			return ret;
 		if (NO_OS_IS_ERR_VALUE(ret) || conn->state == IIOD_LINE_DONE)
@@ -39,8 +39,13 @@
 
 #include "iio.h"
 
-/* Maximum nomber of iiod connections to allocate simultaneously */
+/*
+ * Maximum nomber of iiod connections to allocate simultaneously.
+ * Can be overridden from the project build flags.
+ */
+#ifndef IIOD_MAX_CONNECTIONS
 #define IIOD_MAX_CONNECTIONS	10
+#endif
 #define IIOD_VERSION		"1.1.0000000"
 #define IIOD_VERSION_LEN	(sizeof(IIOD_VERSION) - 1)
 
@@ -116,6 +121,16 @@ struct iiod_ops {
 			   uint32_t bytes);
 	/* Called to notify that buffer must be refiiled */
 	int (*refill_buffer)(struct iiod_ctx *ctx, const char *device);
+	/*
+	 * Optional zero copy alternative to read_buffer.
+	 * Set buf to a contiguous span of at most bytes from the opened buffer
+	 * and return its length. The span is sent directly to the connection
+	 * and must remain valid until release_buffer is called.
+	 */
+	int (*get_buffer_span)(struct iiod_ctx *ctx, const char *device,
+			       char **buf, uint32_t bytes);
+	/* Release the span obtained with get_buffer_span */
+	int (*release_buffer)(struct iiod_ctx *ctx, const char *device);
 
 	/* Write data to opened buffer */
 	int (*write_buffer)(struct iiod_ctx *ctx, const char *device,
@@ -148,6 +163,12 @@ struct iiod_ops {
 	/* I don't know what this should be used for :) */
 	int (*set_buffers_count)(struct iiod_ctx *ctx, const char *device,
 				 uint32_t buffers_count);
+
+	/*
+	 * Optional. Called before the xml is sent for a PRINT command, to
+	 * update in place the values of dynamic context attributes.
+	 */
+	int (*update_xml)(struct iiod_ctx *ctx);
 };
 
 /*
@@ -156,6 +177,39 @@ struct iiod_ops {
  */
 struct iiod_desc;
 
+#ifdef IIO_METRICS
+/*
+ * Number of buckets of the latency histograms. Bucket 0 counts durations
+ * under 1us, bucket i durations in [2^(i - 1), 2^i) us and the last bucket
+ * also all the longer durations.
+ */
+#define IIOD_METRICS_HIST_LEN	16
+/* Number of commands and connection states, in protocol order */
+#define IIOD_METRICS_NB_CMDS	15
+#define IIOD_METRICS_NB_STATES	7
+
+/* Server instrumentation, enabled by building with IIO_METRICS */
+struct iiod_metrics {
+	/*
+	 * Commands received, in order: HELP, EXIT, PRINT, VERSION, TIMEOUT,
+	 * OPEN, CLOSE, READ, WRITE, READBUF, WRITEBUF, GETTRIG, SETTRIG, SET,
+	 * READMULTI
+	 */
+	uint32_t cmds[IIOD_METRICS_NB_CMDS];
+	/* Lines that could not be parsed as a command */
+	uint32_t parse_errors;
+	/* Bytes sent by READBUF and received by WRITEBUF commands */
+	uint64_t readbuf_bytes;
+	uint64_t writebuf_bytes;
+	/*
+	 * Histograms of the time spent in one step of a connection, for each
+	 * state: reading a line, running a command, writing the result,
+	 * moving buffer data, reading WRITE data, done, pushing a cyclic buffer
+	 */
+	uint32_t state_hist[IIOD_METRICS_NB_STATES][IIOD_METRICS_HIST_LEN];
+};
+#endif
+
 /* Parameter to initialize iiod_desc */
 struct iiod_init_param {
 	struct iiod_ops *ops;
@@ -170,6 +224,11 @@ struct iiod_init_param {
 	uint32_t xml_len;
 	/* Backend used by IIOD */
 	enum physical_link_type phy_type;
+	/*
+	 * Accept the READMULTI command, which reads a list of attributes in a
+	 * single request. Clients not aware of it are not affected.
+	 */
+	bool batched_read;
 };
 
 /* Initialize desc. */
@@ -186,7 +245,20 @@ int32_t iiod_conn_add(struct iiod_desc *desc, struct iiod_conn_data *data,
 /* Remove conn_id from iiod. Provided data is returned in data */
 int32_t iiod_conn_remove(struct iiod_desc *desc, uint32_t conn_id,
 			 struct iiod_conn_data *data);
+/* Get the data provided in iiod_conn_add for conn_id */
+int32_t iiod_conn_get(struct iiod_desc *desc, uint32_t conn_id,
+		      struct iiod_conn_data *data);
+/*
+ * Return true if conn_id is waiting for a new command and has no received
+ * data left to process. Such a connection doesn't need to be stepped until
+ * new data arrives.
+ */
+bool iiod_conn_is_idle(struct iiod_desc *desc, uint32_t conn_id);
 /* Advance in the state machine of a connection. Will not block */
 int32_t iiod_conn_step(struct iiod_desc *desc, uint32_t conn_id);
+#ifdef IIO_METRICS
+/* Get a snapshot of the server metrics */
+int32_t iiod_get_metrics(struct iiod_desc *desc, struct iiod_metrics *metrics);
+#endif
 
 #endif //IIOD_H
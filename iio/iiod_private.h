@@ -40,6 +40,8 @@
 #define IIOD_ENDL			0x2
 #define IIOD_RD				0x4
 #define IIOD_PARSER_MAX_BUF_SIZE	128
+/* Size of the per connection receive buffer used while parsing commands */
+#define IIOD_RX_BUF_SIZE		256
 
 #define IIOD_STR(cmd) {(cmd), sizeof(cmd) - 1}
 
@@ -71,7 +73,17 @@ enum iiod_cmd {
 	IIOD_CMD_WRITEBUF,
 	IIOD_CMD_GETTRIG,
 	IIOD_CMD_SETTRIG,
-	IIOD_CMD_SET
+	IIOD_CMD_SET,
+	/*
+	 * Extension, enabled with iiod_init_param.batched_read.
+	 * READMULTI <bytes> is followed by <bytes> of attribute tuples, one per
+	 * line, with the arguments of READ: <device> [DEBUG|BUFFER|INPUT <ch>|
+	 * OUTPUT <ch>] <attr>. The answer is the number of answered tuples
+	 * followed by the answer of a READ command for each of them.
+	 */
+	IIOD_CMD_READMULTI,
+	/* Number of commands */
+	IIOD_CMD_NB
 };
 
 /*
@@ -136,12 +148,24 @@ struct iiod_conn_priv {
 		IIOD_LINE_DONE,
 		/* Pushing  cyclic buffer until IIO device is closed  */
 		IIOD_PUSH_CYCLIC_BUFFER,
+		/* Number of states */
+		IIOD_NB_STATES
 	} state;
 
 	/* Buffer to store received line */
 	char parser_buf[IIOD_PARSER_MAX_BUF_SIZE];
 	/* Index in parser_buf. For nonblocking operation */
 	uint32_t parser_idx;
+	/*
+	 * Bytes received from the connection but not yet consumed. They are
+	 * kept between commands and used first for the following command or
+	 * for the WRITE/WRITEBUF payload.
+	 */
+	char rx_buf[IIOD_RX_BUF_SIZE];
+	/* Index of the first unconsumed byte in rx_buf */
+	uint32_t rx_idx;
+	/* Number of valid bytes in rx_buf */
+	uint32_t rx_len;
 	/* Buffer to store raw data (attributes or buffer data).*/
 	char *payload_buf;
 	/* Length of payload_buf_len */
@@ -173,6 +197,12 @@ struct iiod_desc {
 	uint32_t xml_len;
 	/* Backend used by IIOD */
 	enum physical_link_type phy_type;
+	/* Set if the READMULTI command is accepted */
+	bool batched_read;
+#ifdef IIO_METRICS
+	/* Server instrumentation */
+	struct iiod_metrics metrics;
+#endif
 };
 
 #endif //IIOD_PRIVATE_H
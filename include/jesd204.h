@@ -244,11 +244,37 @@ struct jesd204_topology_dev {
 	unsigned int		links_number;
 };
 
+/* no-OS specific */
+enum jesd204_fsm_mode {
+	/* all ops run one after the other, link by link */
+	JESD204_FSM_MODE_SERIAL,
+	/* the ops of each link run in their own thread (hosted targets) */
+	JESD204_FSM_MODE_PARALLEL,
+};
+
+/**
+ * @struct jesd204_op_timing
+ * @brief Time spent by one device in one state op during the last FSM run
+ * @param per_device_us:	time spent in the per_device callback
+ * @param per_link_us:		time spent in the per_link callback, all links
+ * @param links:		number of per_link calls
+ */
+struct jesd204_op_timing {
+	uint32_t	per_device_us;
+	uint32_t	per_link_us;
+	uint32_t	links;
+};
+
 /* no-OS specific */
 struct jesd204_topology {
 	struct jesd204_dev_top		*dev_top;
 	struct jesd204_topology_dev	*devs;
 	unsigned int			devs_number;
+	enum jesd204_fsm_mode		fsm_mode;
+	/* per_device op already run in the current state, one per device */
+	bool				*op_done;
+	/* [device][op] timing, the top device comes last */
+	struct jesd204_op_timing	*timing;
 };
 
 /* no-OS specific */
@@ -272,6 +298,16 @@ int jesd204_fsm_start(struct jesd204_topology *topology, unsigned int link_idx);
 /* no-OS specific */
 int jesd204_fsm_stop(struct jesd204_topology *topology, unsigned int link_idx);
 
+/* no-OS specific */
+int jesd204_fsm_set_mode(struct jesd204_topology *topology,
+			 enum jesd204_fsm_mode mode);
+
+/* no-OS specific */
+int jesd204_fsm_get_op_timing(struct jesd204_topology *topology,
+			      struct jesd204_dev *jdev,
+			      enum jesd204_dev_op op,
+			      struct jesd204_op_timing *timing);
+
 void *jesd204_dev_priv(struct jesd204_dev *jdev);
 
 int jesd204_link_get_lmfc_lemc_rate(struct jesd204_link *lnk,
@@ -50,4 +50,12 @@ int32_t no_os_axi_io_read(uint32_t base, uint32_t offset, uint32_t *data);
 /* AXI IO Write data */
 int32_t no_os_axi_io_write(uint32_t base, uint32_t offset, uint32_t data);
 
+/* AXI IO Read a block of consecutive registers */
+int32_t no_os_axi_io_read_block(uint32_t base, uint32_t offset,
+				uint32_t *data, uint32_t nb_regs);
+
+/* AXI IO Write a block of consecutive registers */
+int32_t no_os_axi_io_write_block(uint32_t base, uint32_t offset,
+				 const uint32_t *data, uint32_t nb_regs);
+
 #endif // _NO_OS_AXI_IO_H_
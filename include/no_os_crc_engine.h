@@ -0,0 +1,103 @@
+/***************************************************************************//**
+ *   @file   no_os_crc_engine.h
+ *   @brief  Header file of the table driven CRC engine.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _NO_OS_CRC_ENGINE_H_
+#define _NO_OS_CRC_ENGINE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define NO_OS_CRC_ENGINE_TABLE_SIZE	256
+
+/*
+ * no_os_crc8/16/24() hand buffers of at least this many bytes to the matching
+ * constant engine below, when their lookup table is for the same polynomial.
+ * Set to 0 to keep the byte-wise loops and leave the engine tables out of the
+ * link. Can be overridden from the project build flags.
+ */
+#ifndef NO_OS_CRC_ENGINE_MIN_LEN
+#define NO_OS_CRC_ENGINE_MIN_LEN	16
+#endif
+
+/**
+ * @enum no_os_crc_slices
+ * @brief Number of input bytes consumed per table lookup step. More slices
+ * trade table memory (1KB per slice) for speed on long buffers.
+ */
+enum no_os_crc_slices {
+	NO_OS_CRC_SLICE_BY_1 = 1,
+	NO_OS_CRC_SLICE_BY_4 = 4,
+	NO_OS_CRC_SLICE_BY_8 = 8,
+};
+
+/**
+ * @struct no_os_crc_engine
+ * @brief MSB-first CRC of 1 to 32 bits. The CRC register is kept left aligned
+ * in 32 bits, so the same tables and loops are used for every width.
+ */
+struct no_os_crc_engine {
+	/** CRC width in bits */
+	uint8_t width;
+	/** Polynomial in msb-first form, without the x^width term */
+	uint32_t polynomial;
+	/** Number of lookup tables */
+	enum no_os_crc_slices slices;
+	/** Lookup table k holds the CRC of a byte followed by k zero bytes */
+	const uint32_t (*table)[NO_OS_CRC_ENGINE_TABLE_SIZE];
+};
+
+/*
+ * Constant slice-by-4 engines for the polynomials used by the drivers. They
+ * live in flash and don't need to be initialized.
+ */
+/** CRC-8, poly = x^8 + x^2 + x^1 + 1 (0x07) */
+extern const struct no_os_crc_engine no_os_crc8_07_engine;
+/** CRC-8, poly = x^8 + x^5 + x^4 + 1 (0x31) */
+extern const struct no_os_crc_engine no_os_crc8_31_engine;
+/** CRC-16-CCITT, poly = x^16 + x^12 + x^5 + 1 (0x1021) */
+extern const struct no_os_crc_engine no_os_crc16_1021_engine;
+/** CRC-16, poly = 0x755B, used by AD7606 */
+extern const struct no_os_crc_engine no_os_crc16_755b_engine;
+/** CRC-24, poly = 0x5D6DCB, used by ADAS1000 */
+extern const struct no_os_crc_engine no_os_crc24_5d6dcb_engine;
+
+/* Allocate an engine and compute its lookup tables. */
+int no_os_crc_engine_init(struct no_os_crc_engine **engine, uint8_t width,
+			  uint32_t polynomial, enum no_os_crc_slices slices);
+/* Free an engine allocated with no_os_crc_engine_init(). */
+void no_os_crc_engine_remove(struct no_os_crc_engine *engine);
+/* Compute the CRC over a buffer of data. */
+uint32_t no_os_crc_engine_compute(const struct no_os_crc_engine *engine,
+				  const uint8_t *pdata, size_t nbytes,
+				  uint32_t crc);
+
+#endif // _NO_OS_CRC_ENGINE_H_
@@ -42,6 +42,15 @@
 #include "no_os_irq.h"
 #include "no_os_mutex.h"
 
+/*
+ * Number of SG list elements preallocated for each channel. Transfers are
+ * queued and completed from the DMA interrupt, so they don't go through the
+ * heap as long as they fit. Can be overridden from the project build flags.
+ */
+#ifndef NO_OS_DMA_SG_POOL_LEN
+#define NO_OS_DMA_SG_POOL_LEN	8
+#endif
+
 /**
  * @enum no_os_dma_xfer_type
  * @brief Supported transfer directions
@@ -38,6 +38,8 @@
 /******************************************************************************/
 
 #include <stdint.h>
+#include <stdbool.h>
+#include "no_os_pool.h"
 
 /******************************************************************************/
 /*************************** Types Declarations *******************************/
@@ -54,6 +56,32 @@ struct no_os_fifo_element {
 	char *data;
 	/** FIFO length */
 	uint32_t len;
+	/** Set if the element was allocated by the fifo, clear for elements
+	 *  provided by the user with no_os_fifo_push_elem() */
+	bool owned;
+};
+
+/**
+ * @struct no_os_fifo_desc
+ * @brief FIFO with O(1) insertion at the tail.
+ *
+ * Elements pushed with no_os_fifo_push() are allocated in a single block
+ * together with a copy of the data, taken from a pool sized at init time.
+ * Elements pushed with no_os_fifo_push_elem() are owned by the caller (they
+ * are usually embedded in a bigger structure) and are linked as they are,
+ * without any allocation or copy.
+ */
+struct no_os_fifo_desc {
+	/** First element, the next one to be popped */
+	struct no_os_fifo_element *head;
+	/** Last element */
+	struct no_os_fifo_element *tail;
+	/** Number of elements in the fifo */
+	uint32_t nb_elements;
+	/** Largest data length stored in a pool block */
+	uint32_t max_len;
+	/** Pool for the elements created by no_os_fifo_push() */
+	struct no_os_pool *pool;
 };
 
 /******************************************************************************/
@@ -67,4 +95,21 @@ int32_t no_os_fifo_insert(struct no_os_fifo_element **p_fifo, char *buff,
 /* Remove fifo head. */
 struct no_os_fifo_element *no_os_fifo_remove(struct no_os_fifo_element *p_fifo);
 
+/* Create a fifo with a pool of nb_elements elements of up to max_len bytes. */
+int no_os_fifo_desc_init(struct no_os_fifo_desc **fifo, uint32_t max_len,
+			 uint32_t nb_elements);
+/* Release all the elements and free the fifo. */
+void no_os_fifo_desc_remove(struct no_os_fifo_desc *fifo);
+/* Copy len bytes of buff in a new element added at the tail. */
+int no_os_fifo_push(struct no_os_fifo_desc *fifo, const char *buff,
+		    uint32_t len);
+/* Add a caller owned element at the tail, without copying its data. */
+void no_os_fifo_push_elem(struct no_os_fifo_desc *fifo,
+			  struct no_os_fifo_element *elem);
+/* Detach the head element. */
+struct no_os_fifo_element *no_os_fifo_pop(struct no_os_fifo_desc *fifo);
+/* Free an element returned by no_os_fifo_pop() if the fifo allocated it. */
+void no_os_fifo_release(struct no_os_fifo_desc *fifo,
+			struct no_os_fifo_element *elem);
+
 #endif // _NO_OS_FIFO_H_
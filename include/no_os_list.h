@@ -247,6 +247,9 @@ struct no_os_list_desc {
 int32_t no_os_list_init(struct no_os_list_desc **list_desc,
 			enum no_os_adapter_type type,
 			f_cmp comparator);
+int32_t no_os_list_init_pool(struct no_os_list_desc **list_desc,
+			     enum no_os_adapter_type type,
+			     f_cmp comparator, uint32_t nb_elements);
 int32_t no_os_list_remove(struct no_os_list_desc *list_desc);
 int32_t no_os_list_get_size(struct no_os_list_desc *list_desc,
 			    uint32_t *out_size);
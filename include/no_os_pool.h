@@ -0,0 +1,93 @@
+/***************************************************************************//**
+ *   @file   no_os_pool.h
+ *   @brief  Header file of fixed size block pool
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _NO_OS_POOL_H_
+#define _NO_OS_POOL_H_
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************/
+/*************************** Types Declarations *******************************/
+/******************************************************************************/
+
+/**
+ * @struct no_os_pool
+ * @brief Preallocated set of equally sized blocks.
+ *
+ * All the blocks are carved from a single allocation done at init time and
+ * the free ones are chained through their first word, so allocating and
+ * freeing a block is O(1) and never touches the heap. When the pool runs out
+ * of blocks, no_os_pool_alloc() falls back to no_os_calloc() and
+ * no_os_pool_free() gives such blocks back to the heap.
+ */
+struct no_os_pool {
+	/** Storage of the blocks */
+	uint8_t		*mem;
+	/** First free block */
+	void		*free_list;
+	/** Size of a block in bytes, rounded up to pointer alignment */
+	uint32_t	block_size;
+	/** Number of blocks in the pool */
+	uint32_t	nb_blocks;
+	/** Number of pool blocks currently in use */
+	uint32_t	nb_used;
+	/** Highest value reached by nb_used */
+	uint32_t	peak_used;
+	/** Number of allocations served from the pool */
+	uint32_t	nb_alloc;
+	/** Number of allocations that fell back to the heap */
+	uint32_t	nb_heap_alloc;
+};
+
+/******************************************************************************/
+/************************ Functions Declarations ******************************/
+/******************************************************************************/
+
+/* Allocate a pool of nb_blocks blocks of block_size bytes. */
+int no_os_pool_init(struct no_os_pool **pool, uint32_t block_size,
+		    uint32_t nb_blocks);
+/* Free the pool. All the blocks must have been given back. */
+void no_os_pool_remove(struct no_os_pool *pool);
+
+/* Get a zeroed block from the pool, or from the heap if the pool is empty. */
+void *no_os_pool_alloc(struct no_os_pool *pool);
+/* Give back a block obtained with no_os_pool_alloc(). */
+void no_os_pool_free(struct no_os_pool *pool, void *block);
+/* Check if block belongs to the pool storage. */
+bool no_os_pool_owns(struct no_os_pool *pool, void *block);
+
+#endif // _NO_OS_POOL_H_
@@ -214,6 +214,23 @@ struct no_os_spi_desc {
 	struct no_os_spi_desc *parent;
 };
 
+/**
+ * @struct no_os_spi_batch
+ * @brief Messages queued for a SPI descriptor and sent with a single
+ * no_os_spi_transfer() call. Chip select is only released between two
+ * messages when the first one has cs_change set.
+ */
+struct no_os_spi_batch {
+	/** SPI descriptor the messages are sent on */
+	struct no_os_spi_desc *desc;
+	/** Queued messages */
+	struct no_os_spi_msg *msgs;
+	/** Number of queued messages */
+	uint32_t len;
+	/** Maximum number of queued messages */
+	uint32_t capacity;
+};
+
 /**
  * @struct no_os_spi_platform_ops
  * @brief Structure holding SPI function pointers that point to the platform
@@ -276,6 +293,20 @@ int32_t no_os_spi_transfer_dma_async(struct no_os_spi_desc *desc,
 				     void (*callback)(void *),
 				     void *ctx);
 
+/* Allocate a batch of messages to be sent on desc. */
+int32_t no_os_spi_batch_init(struct no_os_spi_batch **batch,
+			     struct no_os_spi_desc *desc, uint32_t capacity);
+
+/* Queue a message. A full batch is flushed first. */
+int32_t no_os_spi_batch_add(struct no_os_spi_batch *batch,
+			    const struct no_os_spi_msg *msg);
+
+/* Send all the queued messages in a single transfer. */
+int32_t no_os_spi_batch_flush(struct no_os_spi_batch *batch);
+
+/* Free the resources allocated by no_os_spi_batch_init(). */
+int32_t no_os_spi_batch_remove(struct no_os_spi_batch *batch);
+
 /* Initialize SPI bus descriptor*/
 int32_t no_os_spibus_init(const struct no_os_spi_init_param *param);
 
@@ -0,0 +1,106 @@
+/***************************************************************************//**
+ *   @file   no_os_spsc_ring.h
+ *   @brief  Lock-free single producer, single consumer byte ring.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef _NO_OS_SPSC_RING_H_
+#define _NO_OS_SPSC_RING_H_
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+/******************************************************************************/
+/*************************** Types Declarations *******************************/
+/******************************************************************************/
+
+/**
+ * @struct no_os_spsc_ring
+ * @brief Lock-free byte ring for one producer and one consumer.
+ *
+ * The producer (e.g. an RX interrupt) only updates head and the consumer only
+ * updates tail. Both indexes run freely and are masked on access, so the whole
+ * size can be used. The producer publishes data with a release store on head,
+ * the consumer frees space with a release store on tail.
+ */
+struct no_os_spsc_ring {
+	/** Data storage */
+	uint8_t			*buff;
+	/** Size of buff in bytes. Power of two. */
+	uint32_t		size;
+	/** Producer index */
+	atomic_uint_least32_t	head;
+	/** Consumer index */
+	atomic_uint_least32_t	tail;
+};
+
+/******************************************************************************/
+/************************ Functions Declarations ******************************/
+/******************************************************************************/
+
+/* Allocate a ring of size bytes. size must be a power of two. */
+int no_os_spsc_ring_init(struct no_os_spsc_ring **ring, uint32_t size);
+/* Free the ring and its storage */
+void no_os_spsc_ring_remove(struct no_os_spsc_ring *ring);
+
+/* Number of bytes available for reading */
+uint32_t no_os_spsc_ring_count(struct no_os_spsc_ring *ring);
+/* Number of bytes available for writing */
+uint32_t no_os_spsc_ring_space(struct no_os_spsc_ring *ring);
+
+/* Producer: write one byte */
+int no_os_spsc_ring_put(struct no_os_spsc_ring *ring, uint8_t c);
+/* Producer: write up to len bytes, return the number of bytes written */
+uint32_t no_os_spsc_ring_write_n(struct no_os_spsc_ring *ring,
+				 const void *data, uint32_t len);
+/* Producer: get the largest contiguous free span */
+uint32_t no_os_spsc_ring_peek_write(struct no_os_spsc_ring *ring,
+				    uint8_t **span);
+/* Producer: publish len bytes written in the span */
+void no_os_spsc_ring_commit_write(struct no_os_spsc_ring *ring, uint32_t len);
+
+/* Consumer: read one byte */
+int no_os_spsc_ring_get(struct no_os_spsc_ring *ring, uint8_t *c);
+/* Consumer: read up to len bytes, return the number of bytes read */
+uint32_t no_os_spsc_ring_read_n(struct no_os_spsc_ring *ring, void *data,
+				uint32_t len);
+/* Consumer: get the largest contiguous span of available data */
+uint32_t no_os_spsc_ring_peek_read(struct no_os_spsc_ring *ring,
+				   uint8_t **span);
+/* Consumer: release len bytes read from the span */
+void no_os_spsc_ring_commit_read(struct no_os_spsc_ring *ring, uint32_t len);
+/* Consumer: drop all the available data */
+void no_os_spsc_ring_flush(struct no_os_spsc_ring *ring);
+
+#endif // _NO_OS_SPSC_RING_H_
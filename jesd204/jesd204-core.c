@@ -96,6 +96,17 @@ int jesd204_topology_init(struct jesd204_topology **topology,
 	top->devs_number = devs_number - 1;
 	top->devs = (struct jesd204_topology_dev *)no_os_calloc(1,
 			top->devs_number * sizeof(*top->devs));
+	top->op_done = (bool *)no_os_calloc(devs_number, sizeof(*top->op_done));
+	top->timing = (struct jesd204_op_timing *)no_os_calloc(devs_number *
+			__JESD204_MAX_OPS, sizeof(*top->timing));
+	if ((top->devs_number && !top->devs) || !top->op_done || !top->timing) {
+		no_os_free(top->timing);
+		no_os_free(top->op_done);
+		no_os_free(top->devs);
+		no_os_free(top->dev_top);
+		no_os_free(top);
+		return -ENOMEM;
+	}
 
 	for (i = 0; i < devs_number; i++) {
 		if (devs[i].is_top_device) {
@@ -125,6 +136,8 @@ int jesd204_topology_remove(struct jesd204_topology *topology)
 	if (!topology)
 		return -EINVAL;
 
+	no_os_free(topology->timing);
+	no_os_free(topology->op_done);
 	no_os_free(topology->dev_top);
 	no_os_free(topology);
 
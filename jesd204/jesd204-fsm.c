@@ -4,51 +4,269 @@
  * Copyright (c) 2022 Analog Devices Inc.
  */
 
+#include <string.h>
+#ifdef LINUX_PLATFORM
+#include <pthread.h>
+#endif
 #include "no_os_error.h"
+#include "no_os_delay.h"
 #include "jesd204-priv.h"
 
+/* no-OS specific */
+static struct jesd204_dev *jesd204_fsm_dev(struct jesd204_topology *topology,
+		unsigned int dev)
+{
+	if (dev == topology->devs_number)
+		return topology->dev_top->jdev;
+
+	return topology->devs[dev].jdev;
+}
+
+/* no-OS specific */
+static const struct jesd204_state_op *jesd204_fsm_op(
+	struct jesd204_topology *topology, unsigned int dev,
+	enum jesd204_dev_op op)
+{
+	return &jesd204_fsm_dev(topology, dev)->dev_data->state_ops[op];
+}
+
+#ifdef JESD204_FSM_TIMING
+static uint32_t jesd204_fsm_elapsed_us(struct no_os_time start)
+{
+	struct no_os_time now = no_os_get_time();
+
+	return (now.s - start.s) * 1000000 + now.us - start.us;
+}
+#endif
+
+/* no-OS specific */
+static void jesd204_fsm_per_device(struct jesd204_topology *topology,
+				   unsigned int dev, enum jesd204_dev_op op,
+				   enum jesd204_state_op_reason reason)
+{
+#ifdef JESD204_FSM_TIMING
+	struct no_os_time start = no_os_get_time();
+#endif
+
+	jesd204_fsm_op(topology, dev, op)->per_device(
+		jesd204_fsm_dev(topology, dev), reason);
+
+#ifdef JESD204_FSM_TIMING
+	topology->timing[dev * __JESD204_MAX_OPS + op].per_device_us +=
+		jesd204_fsm_elapsed_us(start);
+#endif
+}
+
+/* no-OS specific */
+static void jesd204_fsm_per_link(struct jesd204_topology *topology,
+				 unsigned int dev, enum jesd204_dev_op op,
+				 enum jesd204_state_op_reason reason,
+				 unsigned int lnk_id)
+{
+	struct jesd204_dev_top *jdev_top = topology->dev_top;
+#ifdef JESD204_FSM_TIMING
+	struct jesd204_op_timing *timing;
+	struct no_os_time start = no_os_get_time();
+#endif
+
+	jesd204_fsm_op(topology, dev, op)->per_link(
+		jesd204_fsm_dev(topology, dev), reason,
+		&jdev_top->active_links[lnk_id].link);
+
+#ifdef JESD204_FSM_TIMING
+	timing = &topology->timing[dev * __JESD204_MAX_OPS + op];
+	timing->per_link_us += jesd204_fsm_elapsed_us(start);
+	timing->links++;
+#endif
+}
+
+/* no-OS specific */
+static void jesd204_fsm_run_dev(struct jesd204_topology *topology,
+				unsigned int dev, enum jesd204_dev_op op,
+				enum jesd204_state_op_reason reason,
+				unsigned int lnk_id)
+{
+	struct jesd204_topology_dev *tdev = &topology->devs[dev];
+	const struct jesd204_state_op *state_op;
+	unsigned int lnk_dev;
+
+	state_op = jesd204_fsm_op(topology, dev, op);
+	for (lnk_dev = 0; lnk_dev < tdev->links_number; lnk_dev++) {
+		if (tdev->link_ids[lnk_dev] !=
+		    topology->dev_top->link_ids[lnk_id])
+			continue;
+
+		if (state_op->per_device && !topology->op_done[dev]) {
+			jesd204_fsm_per_device(topology, dev, op, reason);
+			topology->op_done[dev] = true;
+		}
+		if (state_op->per_link)
+			jesd204_fsm_per_link(topology, dev, op, reason, lnk_id);
+	}
+}
+
+/* no-OS specific */
+static void jesd204_fsm_start_top_link(struct jesd204_topology *topology,
+				       enum jesd204_dev_op op,
+				       enum jesd204_state_op_reason reason,
+				       unsigned int lnk_id)
+{
+	unsigned int top = topology->devs_number;
+	const struct jesd204_state_op *state_op;
+
+	state_op = jesd204_fsm_op(topology, top, op);
+	if (!state_op->per_link)
+		return;
+
+	jesd204_fsm_per_link(topology, top, op, reason, lnk_id);
+	if (state_op->post_state_sysref)
+		jesd204_sysref_async(topology->dev_top->jdev);
+}
+
+#ifdef LINUX_PLATFORM
+/* no-OS specific */
+static bool jesd204_fsm_dev_on_link(struct jesd204_topology *topology,
+				    unsigned int dev, unsigned int lnk_id)
+{
+	struct jesd204_topology_dev *tdev = &topology->devs[dev];
+	unsigned int lnk_dev;
+
+	for (lnk_dev = 0; lnk_dev < tdev->links_number; lnk_dev++)
+		if (tdev->link_ids[lnk_dev] ==
+		    topology->dev_top->link_ids[lnk_id])
+			return true;
+
+	return false;
+}
+
+/* no-OS specific */
+struct jesd204_fsm_link_job {
+	struct jesd204_topology		*topology;
+	pthread_mutex_t			*lock;
+	pthread_t			thread;
+	enum jesd204_dev_op		op;
+	enum jesd204_state_op_reason	reason;
+	unsigned int			lnk_id;
+};
+
+/*
+ * Runs the ops of one link. Devices found only on this link are driven
+ * without locking, devices shared with other links (and the top device)
+ * are serialized through the topology lock.
+ */
+static void *jesd204_fsm_link_thread(void *arg)
+{
+	struct jesd204_fsm_link_job *job = arg;
+	struct jesd204_topology *topology = job->topology;
+	bool shared;
+	int dev;
+
+	for (dev = 0; dev < topology->devs_number; dev++) {
+		if (!jesd204_fsm_dev_on_link(topology, dev, job->lnk_id))
+			continue;
+
+		shared = topology->devs[dev].links_number > 1;
+		if (shared)
+			pthread_mutex_lock(job->lock);
+		jesd204_fsm_run_dev(topology, dev, job->op, job->reason,
+				      job->lnk_id);
+		if (shared)
+			pthread_mutex_unlock(job->lock);
+	}
+
+	pthread_mutex_lock(job->lock);
+	jesd204_fsm_start_top_link(topology, job->op, job->reason,
+				   job->lnk_id);
+	pthread_mutex_unlock(job->lock);
+
+	return NULL;
+}
+
+/* no-OS specific */
+static void jesd204_fsm_start_links_parallel(struct jesd204_topology *topology,
+		enum jesd204_dev_op op,
+		enum jesd204_state_op_reason reason)
+{
+	struct jesd204_fsm_link_job jobs[JESD204_MAX_LINKS];
+	unsigned int num_links = topology->dev_top->num_links;
+	pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+	bool started[JESD204_MAX_LINKS];
+	unsigned int lnk_id;
+
+	for (lnk_id = 0; lnk_id < num_links; lnk_id++) {
+		jobs[lnk_id].topology = topology;
+		jobs[lnk_id].lock = &lock;
+		jobs[lnk_id].op = op;
+		jobs[lnk_id].reason = reason;
+		jobs[lnk_id].lnk_id = lnk_id;
+		started[lnk_id] = !pthread_create(&jobs[lnk_id].thread, NULL,
+						  jesd204_fsm_link_thread,
+						  &jobs[lnk_id]);
+		/* no thread available, run this link in place */
+		if (!started[lnk_id])
+			jesd204_fsm_link_thread(&jobs[lnk_id]);
+	}
+
+	for (lnk_id = 0; lnk_id < num_links; lnk_id++)
+		if (started[lnk_id])
+			pthread_join(jobs[lnk_id].thread, NULL);
+
+	pthread_mutex_destroy(&lock);
+}
+#endif
+
+/* no-OS specific */
+static void jesd204_fsm_start_links(struct jesd204_topology *topology,
+				    enum jesd204_dev_op op,
+				    enum jesd204_state_op_reason reason)
+{
+	unsigned int lnk_id;
+	int dev;
+
+#ifdef LINUX_PLATFORM
+	if (topology->fsm_mode == JESD204_FSM_MODE_PARALLEL &&
+	    topology->dev_top->num_links > 1) {
+		jesd204_fsm_start_links_parallel(topology, op, reason);
+		return;
+	}
+#endif
+
+	for (lnk_id = 0; lnk_id < topology->dev_top->num_links; lnk_id++) {
+		for (dev = 0; dev < topology->devs_number; dev++)
+			jesd204_fsm_run_dev(topology, dev, op, reason,
+					    lnk_id);
+		jesd204_fsm_start_top_link(topology, op, reason, lnk_id);
+	}
+}
+
+/* no-OS specific */
+static void jesd204_fsm_reset_timing(struct jesd204_topology *topology)
+{
+	memset(topology->timing, 0, (topology->devs_number + 1) *
+	       __JESD204_MAX_OPS * sizeof(*topology->timing));
+}
+
 /* no-OS specific */
 int jesd204_fsm_start(struct jesd204_topology *topology, unsigned int link_idx)
 {
 	enum jesd204_state_op_reason reason = JESD204_STATE_OP_REASON_INIT;
 	struct jesd204_dev_top *jdev_top = topology->dev_top;
-	bool per_device_op_done[16];
+	unsigned int top = topology->devs_number;
+	const struct jesd204_state_op *state_op;
 	enum jesd204_dev_op op;
-	int lnk_dev;
-	int lnk_id;
-	int dev;
+
+	jesd204_fsm_reset_timing(topology);
 
 	for (op = 0; op < __JESD204_MAX_OPS; op++) {
-		for (dev = 0; dev < topology->devs_number; dev++)
-			per_device_op_done[dev] = false;
-
-		for (lnk_id = 0; lnk_id < jdev_top->num_links; lnk_id++) {
-			for (dev = 0; dev < topology->devs_number; dev++) {
-				for (lnk_dev = 0; lnk_dev < topology->devs[dev].links_number; lnk_dev++) {
-					if (topology->devs[dev].link_ids[lnk_dev] == jdev_top->link_ids[lnk_id]) {
-						if (topology->devs[dev].jdev->dev_data->state_ops[op].per_device
-						    && !per_device_op_done[dev]) {
-							topology->devs[dev].jdev->dev_data->state_ops[op].per_device(
-								topology->devs[dev].jdev, reason);
-							per_device_op_done[dev] = true;
-						}
-						if (topology->devs[dev].jdev->dev_data->state_ops[op].per_link)
-							topology->devs[dev].jdev->dev_data->state_ops[op].per_link(
-								topology->devs[dev].jdev, reason,
-								&jdev_top->active_links[lnk_id].link);
-					}
-				}
-			}
-			if (jdev_top->jdev->dev_data->state_ops[op].per_link) {
-				jdev_top->jdev->dev_data->state_ops[op].per_link(jdev_top->jdev, reason,
-						&jdev_top->active_links[lnk_id].link);
-				if (jdev_top->jdev->dev_data->state_ops[op].post_state_sysref)
-					jesd204_sysref_async(jdev_top->jdev);
-			}
-		}
-		if (jdev_top->jdev->dev_data->state_ops[op].per_device) {
-			jdev_top->jdev->dev_data->state_ops[op].per_device(jdev_top->jdev, reason);
-			if (jdev_top->jdev->dev_data->state_ops[op].post_state_sysref)
+		memset(topology->op_done, 0,
+		       topology->devs_number * sizeof(*topology->op_done));
+
+		jesd204_fsm_start_links(topology, op, reason);
+
+		state_op = jesd204_fsm_op(topology, top, op);
+		if (state_op->per_device) {
+			jesd204_fsm_per_device(topology, top, op, reason);
+			if (state_op->post_state_sysref)
 				jesd204_sysref_async(jdev_top->jdev);
 		}
 	}
@@ -61,41 +279,81 @@ int jesd204_fsm_stop(struct jesd204_topology *topology, unsigned int link_idx)
 {
 	enum jesd204_state_op_reason reason = JESD204_STATE_OP_REASON_UNINIT;
 	struct jesd204_dev_top *jdev_top = topology->dev_top;
-	bool per_device_op_done[16];
-	int lnk_dev;
+	unsigned int top = topology->devs_number;
 	int lnk_id;
 	int dev;
 	int op;
 
+	jesd204_fsm_reset_timing(topology);
+
 	for (op = __JESD204_MAX_OPS - 1; op >= 0; op--) {
-		for (dev = topology->devs_number - 1; dev >= 0 ; dev--)
-			per_device_op_done[dev] = false;
+		memset(topology->op_done, 0,
+		       topology->devs_number * sizeof(*topology->op_done));
 
-		if (jdev_top->jdev->dev_data->state_ops[op].per_device)
-			jdev_top->jdev->dev_data->state_ops[op].per_device(jdev_top->jdev, reason);
+		if (jesd204_fsm_op(topology, top, op)->per_device)
+			jesd204_fsm_per_device(topology, top, op, reason);
 
 		for (lnk_id = jdev_top->num_links - 1; lnk_id >= 0; lnk_id--) {
-			if (jdev_top->jdev->dev_data->state_ops[op].per_link)
-				jdev_top->jdev->dev_data->state_ops[op].per_link(jdev_top->jdev, reason,
-						&jdev_top->active_links[lnk_id].link);
-			for (dev = topology->devs_number - 1; dev >= 0; dev--) {
-				for (lnk_dev = topology->devs[dev].links_number - 1; lnk_dev >= 0; lnk_dev--) {
-					if (topology->devs[dev].link_ids[lnk_dev] == jdev_top->link_ids[lnk_id]) {
-						if (topology->devs[dev].jdev->dev_data->state_ops[op].per_device
-						    && !per_device_op_done[dev]) {
-							topology->devs[dev].jdev->dev_data->state_ops[op].per_device(
-								topology->devs[dev].jdev, reason);
-							per_device_op_done[dev] = true;
-						}
-						if (topology->devs[dev].jdev->dev_data->state_ops[op].per_link)
-							topology->devs[dev].jdev->dev_data->state_ops[op].per_link(
-								topology->devs[dev].jdev, reason,
-								&jdev_top->active_links[lnk_id].link);
-					}
-				}
-			}
+			if (jesd204_fsm_op(topology, top, op)->per_link)
+				jesd204_fsm_per_link(topology, top, op, reason,
+						     lnk_id);
+			for (dev = topology->devs_number - 1; dev >= 0; dev--)
+				jesd204_fsm_run_dev(topology, dev, op, reason,
+						    lnk_id);
 		}
 	}
 
 	return 0;
 }
+
+/* no-OS specific */
+int jesd204_fsm_set_mode(struct jesd204_topology *topology,
+			 enum jesd204_fsm_mode mode)
+{
+	if (!topology)
+		return -EINVAL;
+
+	switch (mode) {
+	case JESD204_FSM_MODE_SERIAL:
+		break;
+	case JESD204_FSM_MODE_PARALLEL:
+#ifdef LINUX_PLATFORM
+		break;
+#else
+		return -ENOSYS;
+#endif
+	default:
+		return -EINVAL;
+	}
+
+	topology->fsm_mode = mode;
+
+	return 0;
+}
+
+/* no-OS specific */
+int jesd204_fsm_get_op_timing(struct jesd204_topology *topology,
+			      struct jesd204_dev *jdev,
+			      enum jesd204_dev_op op,
+			      struct jesd204_op_timing *timing)
+{
+#ifdef JESD204_FSM_TIMING
+	unsigned int dev;
+
+	if (!topology || !jdev || !timing || op >= __JESD204_MAX_OPS)
+		return -EINVAL;
+
+	for (dev = 0; dev <= topology->devs_number; dev++) {
+		if (jesd204_fsm_dev(topology, dev) != jdev)
+			continue;
+
+		*timing = topology->timing[dev * __JESD204_MAX_OPS + op];
+
+		return 0;
+	}
+
+	return -ENODEV;
+#else
+	return -ENOSYS;
+#endif
+}
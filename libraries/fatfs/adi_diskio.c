@@ -162,7 +162,11 @@ DRESULT disk_ioctl (
 	switch(pdrv) {
 	case DEV_SD:
 		switch (cmd){
-		case CTRL_SYNC: return RES_OK;
+		case CTRL_SYNC:
+			/* Write the blocks held in the driver cache */
+			if (0 != sd_flush(sd_desc))
+				return RES_ERROR;
+			return RES_OK;
 		case GET_SECTOR_COUNT:
 			*(LBA_t *)buff = sd_desc->memory_size / DATA_BLOCK_LEN;
 			return RES_OK;
@@ -44,7 +44,9 @@
 #include <assert.h>
 #include "no_os_error.h"
 #include "no_os_util.h"
+#include "no_os_alloc.h"
 #include <unistd.h>
+#include <poll.h>
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <arpa/inet.h>
@@ -259,6 +261,36 @@ static int32_t linux_socket_accept(void *desc, uint32_t sock_id,
 	return 0;
 }
 
+/** @brief See \ref network_interface.socket_wait */
+static int32_t linux_socket_wait(void *desc, uint32_t *sock_ids, bool *ready,
+				 uint32_t nb_socks, int32_t timeout_ms)
+{
+	struct pollfd fds[SOCKET_WAIT_MAX_SOCKS];
+	uint32_t i;
+	int32_t ret;
+
+	if (nb_socks > SOCKET_WAIT_MAX_SOCKS)
+		return -EINVAL;
+
+	for (i = 0; i < nb_socks; i++) {
+		fds[i].fd = sock_ids[i];
+		fds[i].events = POLLIN;
+	}
+
+	do {
+		ret = poll(fds, nb_socks, timeout_ms);
+	} while (ret < 0 && errno == EINTR);
+
+	if (ret < 0)
+		return -errno;
+
+	/* Errors and hang ups are reported by the following recv/accept */
+	for (i = 0; i < nb_socks; i++)
+		ready[i] = !!fds[i].revents;
+
+	return ret;
+}
+
 struct network_interface linux_net = {
 	.socket_open = (int32_t (*)(void *, uint32_t *, enum socket_protocol,
 				    uint32_t)) linux_socket_open,
@@ -271,7 +303,8 @@ struct network_interface linux_net = {
 	.socket_recvfrom = (int32_t (*)(void *, uint32_t, void *, uint32_t, struct socket_address* from))linux_socket_recvfrom,
 	.socket_bind = (int32_t (*)(void *, uint32_t, uint16_t))linux_socket_bind,
 	.socket_listen = (int32_t (*)(void *, uint32_t, uint32_t))linux_socket_listen,
-	.socket_accept= (int32_t (*)(void *, uint32_t, uint32_t*))linux_socket_accept
+	.socket_accept= (int32_t (*)(void *, uint32_t, uint32_t*))linux_socket_accept,
+	.socket_wait = linux_socket_wait
 };
 
 #endif
@@ -60,40 +60,102 @@
 static uint8_t lwip_buff[ADIN1110_LWIP_BUFF_SIZE];
 
 /**
- * @brief Read a frame from the RX FIFO.
+ * @brief Get the segments of a pbuf chain.
+ * @param p - the pbuf chain.
+ * @param sg - the segments.
+ * @return the number of segments, 0 if the chain has more than ADIN1110_MAX_SG.
+ */
+static uint32_t adin1110_pbuf_sg(struct pbuf *p, struct adin1110_sg *sg)
+{
+	uint32_t n = 0;
+
+	for (; p; p = p->next) {
+		if (!p->len)
+			continue;
+		if (n == ADIN1110_MAX_SG)
+			return 0;
+
+		sg[n].buf = p->payload;
+		sg[n].len = p->len;
+		n++;
+	}
+
+	return n;
+}
+
+/**
+ * @brief Read a frame from the RX FIFO straight into a pbuf chain.
  * @param desc - ADIN1110 descriptor.
- * @param p - the received pbuf.
  * @param len - length of the frame.
+ * @param p - the received pbuf.
+ * @param next_len - length of the next frame, 0 if there is none.
  * @return 0 in case of success, negative error otherwise.
  */
-static int adin1110_read_frames(struct adin1110_desc *desc, struct pbuf **p,
-				uint32_t *len)
+static int adin1110_read_frame(struct adin1110_desc *desc, uint32_t len,
+			       struct pbuf **p, uint32_t *next_len)
 {
-	struct adin1110_eth_buff mac_buff = {0};
+	struct adin1110_sg sg[ADIN1110_MAX_SG];
+	uint32_t nb_sg;
 	int ret;
 
-	mac_buff.payload = &lwip_buff[ADIN1110_ETH_HDR_LEN];
+	*p = pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
+	if (!*p)
+		return -ENOMEM;
 
-	ret = adin1110_read_fifo(desc, 0, &mac_buff);
+	nb_sg = adin1110_pbuf_sg(*p, sg);
+	if (nb_sg) {
+		ret = adin1110_read_fifo_sg(desc, 0, len, sg, nb_sg, next_len);
+	} else {
+		/* Chain too long, read the frame in lwip_buff first */
+		sg[0].buf = lwip_buff;
+		sg[0].len = len;
+		ret = adin1110_read_fifo_sg(desc, 0, len, sg, 1, next_len);
+		if (!ret)
+			pbuf_take(*p, lwip_buff, len);
+	}
 	if (ret)
-		return ret;
+		pbuf_free(*p);
 
-	*len = mac_buff.len;
-	if (!mac_buff.len)
-		return 0;
+	return ret;
+}
 
-	memcpy(lwip_buff, mac_buff.mac_dest, ADIN1110_ETH_HDR_LEN);
-	*p = pbuf_alloc(PBUF_RAW, mac_buff.len, PBUF_POOL);
-	if (!*p)
-		return -ENOMEM;
+/**
+ * @brief Drain a frame that doesn't fit in lwip_buff from the RX FIFO and
+ * count it as dropped. The frame is read in lwip_buff sized pieces and
+ * discarded. A length that doesn't fit even that way can't be a valid frame,
+ * so the RX FIFO is cleared instead.
+ * @param desc - ADIN1110 descriptor.
+ * @param len - length of the frame.
+ * @param next_len - length of the next frame, 0 if there is none.
+ * @return 0 in case of success, negative error otherwise.
+ */
+static int adin1110_drop_frame(struct adin1110_desc *desc, uint32_t len,
+			       uint32_t *next_len)
+{
+	struct adin1110_sg sg[ADIN1110_MAX_SG];
+	uint32_t i;
 
-	pbuf_take(*p, lwip_buff, mac_buff.len);
+	LINK_STATS_INC(link.lenerr);
+	LINK_STATS_INC(link.drop);
 
-	return 0;
+	if (len > ADIN1110_MAX_SG * ADIN1110_LWIP_BUFF_SIZE) {
+		*next_len = 0;
+		return adin1110_reg_write(desc, ADIN1110_FIFO_CLR_REG,
+					  ADIN1110_FIFO_CLR_RX_MASK);
+	}
+
+	for (i = 0; i < ADIN1110_MAX_SG; i++) {
+		sg[i].buf = lwip_buff;
+		sg[i].len = ADIN1110_LWIP_BUFF_SIZE;
+	}
+
+	return adin1110_read_fifo_sg(desc, 0, len, sg, ADIN1110_MAX_SG,
+				     next_len);
 }
 
 /**
- * @brief Read all the frames from the RX FIFO.
+ * @brief Read all the frames from the RX FIFO. The frame size of the next
+ * frame is read along with each frame.
  * @param desc - lwip sockets layer specific descriptor.
  * @param data - netif to RX data.
  * @return 0 in case of success, negative error otherwise.
@@ -109,20 +171,30 @@ static int32_t adin1110_step(struct lwip_network_desc *desc, void *data)
 	netif_desc = desc->lwip_netif;
 	mac_desc = desc->mac_desc;
 
-	do {
-		ret = adin1110_read_frames(mac_desc, &p, &len);
+	ret = adin1110_read_fifo_len(mac_desc, 0, &len);
+	if (ret)
+		return ret;
+
+	while (len) {
+		if (len > ADIN1110_LWIP_BUFF_SIZE) {
+			ret = adin1110_drop_frame(mac_desc, len, &len);
+			if (ret)
+				return ret;
+
+			continue;
+		}
+
+		ret = adin1110_read_frame(mac_desc, len, &p, &len);
 		if (ret)
 			return ret;
 
-		if (len) {
-			LINK_STATS_INC(link.recv);
-			ret = netif_desc->input(p, netif_desc);
-			if (ret) {
-				if (p->ref)
-					pbuf_free(p);
-			}
+		LINK_STATS_INC(link.recv);
+		ret = netif_desc->input(p, netif_desc);
+		if (ret) {
+			if (p->ref)
+				pbuf_free(p);
 		}
-	} while(len);
+	}
 
 	return 0;
 }
@@ -137,21 +209,23 @@ static int32_t adin1110_netif_output(struct netif *net, struct pbuf *p)
 {
 	struct lwip_network_desc *lwip_desc;
 	struct adin1110_desc *mac_desc;
-	struct adin1110_eth_buff buff;
-	uint32_t frame_len;
+	struct adin1110_sg sg[ADIN1110_MAX_SG];
+	uint32_t nb_sg;
 
 	lwip_desc = net->state;
 	mac_desc = lwip_desc->mac_desc;
 
 	LINK_STATS_INC(link.xmit);
-	frame_len = pbuf_copy_partial(p, lwip_buff, p->tot_len, 0);
-
-	memcpy(&buff.mac_dest, lwip_buff, ADIN1110_ETH_HDR_LEN);
 
-	buff.len = frame_len;
-	buff.payload = &lwip_buff[ADIN1110_ETH_HDR_LEN];
+	/* The chain is sent in place, unless it has too many segments */
+	nb_sg = adin1110_pbuf_sg(p, sg);
+	if (!nb_sg) {
+		sg[0].buf = lwip_buff;
+		sg[0].len = pbuf_copy_partial(p, lwip_buff, p->tot_len, 0);
+		nb_sg = 1;
+	}
 
-	return adin1110_write_fifo(mac_desc, 0, &buff);
+	return adin1110_write_fifo_sg(mac_desc, 0, sg, nb_sg);
 }
 
 /**
@@ -40,6 +40,19 @@
 /******************************************************************************/
 
 #include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************/
+/********************** Macros and Constants Definitions **********************/
+/******************************************************************************/
+
+/*
+ * Maximum number of sockets waited on by one socket_wait() call.
+ * Can be overridden from the project build flags.
+ */
+#ifndef SOCKET_WAIT_MAX_SOCKS
+#define SOCKET_WAIT_MAX_SOCKS	16
+#endif
 
 /******************************************************************************/
 /*************************** Types Declarations *******************************/
@@ -212,6 +225,24 @@ struct network_interface {
 	 */
 	int32_t (*socket_accept)(void *net, uint32_t sock_id,
 				 uint32_t *client_socket_id);
+
+	/**
+	 * @brief Wait until at least one of the sockets is ready.
+	 *
+	 * Optional. A socket is ready when data can be received from it or,
+	 * for a listening socket, when a connection can be accepted.
+	 * @param net - Network interface
+	 * @param sock_ids - Ids of the sockets to wait for
+	 * @param ready - Set to true for each socket that is ready
+	 * @param nb_socks - Number of sockets in sock_ids, at most
+	 *		     SOCKET_WAIT_MAX_SOCKS
+	 * @param timeout_ms - Maximum time to wait. Negative to wait forever.
+	 * @return
+	 *  - Number of ready sockets : On success
+	 *  - \ref Negative error code on failure
+	 */
+	int32_t (*socket_wait)(void *net, uint32_t *sock_ids, bool *ready,
+			       uint32_t nb_socks, int32_t timeout_ms);
 };
 
 #endif
@@ -455,3 +455,42 @@ int32_t socket_accept(struct tcp_socket_desc *desc,
 	return 0;
 }
 
+/**
+ * @brief Wait until at least one of the sockets is ready.
+ *
+ * All the sockets must use the same network interface.
+ * @param descs - Sockets to wait for
+ * @param ready - Set to true for each socket that is ready
+ * @param nb_socks - Number of sockets, at most SOCKET_WAIT_MAX_SOCKS
+ * @param timeout_ms - Maximum time to wait. Negative to wait forever.
+ * @return
+ *  - Number of ready sockets : On success
+ *  - -ENOSYS : The network interface doesn't support waiting
+ *  - \ref Negative error code on failure
+ */
+int32_t socket_wait(struct tcp_socket_desc **descs, bool *ready,
+		    uint32_t nb_socks, int32_t timeout_ms)
+{
+	struct network_interface	*net;
+	uint32_t			ids[SOCKET_WAIT_MAX_SOCKS];
+	uint32_t			i;
+
+	if (!descs || !ready || !nb_socks || nb_socks > SOCKET_WAIT_MAX_SOCKS)
+		return -EINVAL;
+
+	net = descs[0]->net;
+	if (!net->socket_wait)
+		return -ENOSYS;
+
+	for (i = 0; i < nb_socks; i++) {
+#ifndef DISABLE_SECURE_SOCKET
+		/* Decrypted data may be pending inside mbedtls */
+		if (descs[i]->secure)
+			return -ENOSYS;
+#endif
+		ids[i] = descs[i]->id;
+	}
+
+	return net->socket_wait(net->net, ids, ready, nb_socks, timeout_ms);
+}
+
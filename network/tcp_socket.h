@@ -164,4 +164,8 @@ int32_t socket_listen(struct tcp_socket_desc *desc, uint32_t back_log);
 int32_t socket_accept(struct tcp_socket_desc *desc,
 		      struct tcp_socket_desc **new_client);
 
+/* Wait until at least one of the sockets is ready */
+int32_t socket_wait(struct tcp_socket_desc **descs, bool *ready,
+		    uint32_t nb_socks, int32_t timeout_ms);
+
 #endif
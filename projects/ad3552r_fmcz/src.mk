@@ -28,13 +28,17 @@ SRCS += $(NO-OS)/util/no_os_util.c \
         $(NO-OS)/util/no_os_mutex.c \
         $(NO-OS)/util/no_os_sin_lut.c \
         $(NO-OS)/util/no_os_crc8.c \
+        $(NO-OS)/util/no_os_crc_engine.c \
+        $(NO-OS)/util/no_os_crc_tables.c \
 	$(DRIVERS)/api/no_os_spi.c \
         $(DRIVERS)/api/no_os_gpio.c \
         $(NO-OS)/util/no_os_util.c
 ifeq (y,$(strip $(IIOD)))
 SRCS += $(DRIVERS)/api/no_os_uart.c \
 	$(DRIVERS)/api/no_os_irq.c \
+	$(NO-OS)/util/no_os_spsc_ring.c \
 	$(NO-OS)/util/no_os_lf256fifo.c \
+	$(NO-OS)/util/no_os_pool.c \
 	$(NO-OS)/util/no_os_list.c \
 	$(NO-OS)/util/no_os_fifo.c \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.c \
@@ -48,6 +52,7 @@ INCS += $(INCLUDE)/no_os_timer.h \
 	$(INCLUDE)/no_os_delay.h \
 	$(INCLUDE)/no_os_error.h \
 	$(INCLUDE)/no_os_crc8.h \
+	$(INCLUDE)/no_os_crc_engine.h \
 	$(INCLUDE)/no_os_print_log.h \
 	$(INCLUDE)/no_os_spi.h \
 	$(INCLUDE)/no_os_util.h \
@@ -73,8 +78,10 @@ SRCS += $(PLATFORM_DRIVERS)/xilinx_axi_io.c \
 
 ifeq (y,$(strip $(IIOD)))
 INCS += $(INCLUDE)/no_os_uart.h \
+	$(INCLUDE)/no_os_spsc_ring.h \
 	$(INCLUDE)/no_os_lf256fifo.h \
 	$(INCLUDE)/no_os_irq.h \
+	$(INCLUDE)/no_os_pool.h \
 	$(INCLUDE)/no_os_list.h \
 	$(INCLUDE)/no_os_fifo.h \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h \
@@ -20,6 +20,7 @@ SRCS += $(PLATFORM_DRIVERS)/xilinx_spi.c \
 	$(PLATFORM_DRIVERS)/xilinx_gpio.c \
 	$(PLATFORM_DRIVERS)/xilinx_gpio_irq.c \
 	$(PLATFORM_DRIVERS)/xilinx_delay.c \
+	$(NO-OS)/util/no_os_pool.c \
 	$(NO-OS)/util/no_os_list.c \
 	$(NO-OS)/util/no_os_util.c \
 	$(NO-OS)/util/no_os_alloc.c \
@@ -41,4 +42,5 @@ INCS += $(INCLUDE)/no_os_spi.h \
 	$(INCLUDE)/no_os_alloc.h \
 	$(INCLUDE)/no_os_mutex.h \
 	$(INCLUDE)/no_os_print_log.h \
+	$(INCLUDE)/no_os_pool.h \
 	$(INCLUDE)/no_os_list.h
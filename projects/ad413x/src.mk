@@ -21,9 +21,12 @@ SRCS += $(PLATFORM_DRIVERS)/xilinx_spi.c \
 	$(PLATFORM_DRIVERS)/xilinx_gpio_irq.c \
 	$(PLATFORM_DRIVERS)/xilinx_delay.c \
 	$(NO-OS)/util/no_os_alloc.c \
+	$(NO-OS)/util/no_os_pool.c \
 	$(NO-OS)/util/no_os_list.c \
 	$(NO-OS)/util/no_os_util.c \
 	$(NO-OS)/util/no_os_crc8.c \
+	$(NO-OS)/util/no_os_crc_engine.c \
+	$(NO-OS)/util/no_os_crc_tables.c \
 	$(NO-OS)/util/no_os_mutex.c
 
 INCS += $(DRIVERS)/afe/ad413x/ad413x.h
@@ -40,8 +43,10 @@ INCS += $(INCLUDE)/no_os_spi.h \
 	$(INCLUDE)/no_os_irq.h \
 	$(INCLUDE)/no_os_util.h \
 	$(INCLUDE)/no_os_print_log.h \
+	$(INCLUDE)/no_os_pool.h \
 	$(INCLUDE)/no_os_list.h \
 	$(INCLUDE)/no_os_crc8.h \
+	$(INCLUDE)/no_os_crc_engine.h \
 	$(INCLUDE)/no_os_alloc.h \
 	$(INCLUDE)/no_os_mutex.h
 
@@ -50,13 +55,17 @@ LIBRARIES += iio
 SRCS += $(DRIVERS)/afe/ad413x/iio_ad413x.c \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.c \
 	$(NO-OS)/iio/iio_app/iio_app.c \
+	$(NO-OS)/util/no_os_pool.c \
 	$(NO-OS)/util/no_os_fifo.c \
+	$(NO-OS)/util/no_os_spsc_ring.c \
 	$(NO-OS)/util/no_os_lf256fifo.c \
 	$(DRIVERS)/api/no_os_uart.c
 INCS += $(DRIVERS)/afe/ad413x/iio_ad413x.h \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h \
 	$(NO-OS)/iio/iio_app/iio_app.h \
+	$(INCLUDE)/no_os_pool.h \
 	$(INCLUDE)/no_os_fifo.h \
 	$(INCLUDE)/no_os_uart.h \
+	$(INCLUDE)/no_os_spsc_ring.h \
 	$(INCLUDE)/no_os_lf256fifo.h
 endif
@@ -26,7 +26,9 @@ SRCS += $(NO-OS)/util/no_os_util.c \
 	$(NO-OS)/util/no_os_alloc.c \
 	$(NO-OS)/util/no_os_mutex.c \
 	$(NO-OS)/util/no_os_circular_buffer.c \
+	$(NO-OS)/util/no_os_pool.c \
 	$(NO-OS)/util/no_os_list.c \
+	$(NO-OS)/util/no_os_spsc_ring.c \
 	$(NO-OS)/util/no_os_lf256fifo.c \
 	$(NO-OS)/util/no_os_fifo.c
 
@@ -38,6 +40,7 @@ INCS +=	$(INCLUDE)/no_os_axi_io.h \
 	$(INCLUDE)/no_os_delay.h \
 	$(INCLUDE)/no_os_irq.h \
 	$(INCLUDE)/no_os_uart.h \
+	$(INCLUDE)/no_os_spsc_ring.h \
 	$(INCLUDE)/no_os_lf256fifo.h \
 	$(INCLUDE)/no_os_util.h \
 	$(INCLUDE)/no_os_units.h \
@@ -47,7 +50,9 @@ INCS +=	$(INCLUDE)/no_os_axi_io.h \
 	$(INCLUDE)/no_os_timer.h \
 	$(INCLUDE)/no_os_circular_buffer.h \
 	$(INCLUDE)/no_os_print_log.h \
+	$(INCLUDE)/no_os_pool.h \
 	$(INCLUDE)/no_os_list.h \
+	$(INCLUDE)/no_os_spsc_ring.h \
 	$(INCLUDE)/no_os_lf256fifo.h \
 	$(INCLUDE)/no_os_irq.h \
 	$(INCLUDE)/no_os_fifo.h
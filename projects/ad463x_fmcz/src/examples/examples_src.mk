@@ -28,4 +28,5 @@ INCS += $(DRIVERS)/adc/ad463x/ad463x.h
 SRCS += $(DRIVERS)/adc/ad463x/ad463x.c
 
 INCS += $(INCLUDE)/no_os_list.h \
+        $(INCLUDE)/no_os_pool.h \
         $(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
@@ -14,12 +14,14 @@ SRCS += $(PROJECT)/src/platform/$(PLATFORM)/parameters.c
 
 SRCS += $(DRIVERS)/api/no_os_uart.c		\
 	$(DRIVERS)/api/no_os_gpio.c		\
+	$(NO-OS)/util/no_os_pool.c		\
 	$(NO-OS)/util/no_os_list.c		\
 	$(NO-OS)/util/no_os_util.c		\
 	$(NO-OS)/util/no_os_alloc.c		\
 	$(NO-OS)/util/no_os_mutex.c		\
 	$(NO-OS)/util/no_os_circular_buffer.c	\
 	$(NO-OS)/util/no_os_list.c		\
+	$(NO-OS)/util/no_os_spsc_ring.c		\
 	$(NO-OS)/util/no_os_lf256fifo.c		\
 	$(NO-OS)/util/no_os_fifo.c		\
 	$(DRIVERS)/api/no_os_spi.c		\
@@ -28,8 +30,10 @@ SRCS += $(DRIVERS)/api/no_os_uart.c		\
 INCS += $(INCLUDE)/no_os_delay.h	\
 	$(INCLUDE)/no_os_gpio.h		\
 	$(INCLUDE)/no_os_error.h	\
+	$(INCLUDE)/no_os_pool.h		\
 	$(INCLUDE)/no_os_fifo.h		\
 	$(INCLUDE)/no_os_irq.h		\
+	$(INCLUDE)/no_os_spsc_ring.h	\
 	$(INCLUDE)/no_os_lf256fifo.h	\
 	$(INCLUDE)/no_os_list.h		\
 	$(INCLUDE)/no_os_dma.h		\
@@ -7,6 +7,7 @@ IIOD=y
 SRC_DIRS += $(NO-OS)/iio/iio_app
 
 INCS += $(INCLUDE)/no_os_list.h \
+	$(INCLUDE)/no_os_pool.h \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
 endif
 
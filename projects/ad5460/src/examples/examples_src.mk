@@ -23,4 +23,5 @@ INCS += $(PROJECT)/src/examples/current_output_example/current_output_example.h
 endif
 
 INCS += $(INCLUDE)/no_os_list.h \
+	$(INCLUDE)/no_os_pool.h \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
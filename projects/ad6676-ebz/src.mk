@@ -39,9 +39,11 @@ SRCS +=	$(PLATFORM_DRIVERS)/xilinx_axi_io.c \
 ifeq (y,$(strip $(IIOD)))
 LIBRARIES += iio
 SRCS += $(NO-OS)/util/no_os_fifo.c \
+	$(NO-OS)/util/no_os_pool.c \
 	$(NO-OS)/util/no_os_list.c \
 	$(DRIVERS)/axi_core/iio_axi_adc/iio_axi_adc.c \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.c \
+	$(NO-OS)/util/no_os_spsc_ring.c \
 	$(NO-OS)/util/no_os_lf256fifo.c \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_irq.c \
 	$(DRIVERS)/api/no_os_uart.c \
@@ -75,8 +77,10 @@ INCS +=	$(INCLUDE)/no_os_axi_io.h \
 	$(NO-OS)/jesd204/jesd204-priv.h
 ifeq (y,$(strip $(IIOD)))
 INCS += $(INCLUDE)/no_os_fifo.h \
+	$(INCLUDE)/no_os_pool.h \
 	$(INCLUDE)/no_os_irq.h \
 	$(INCLUDE)/no_os_uart.h \
+	$(INCLUDE)/no_os_spsc_ring.h \
 	$(INCLUDE)/no_os_lf256fifo.h \
 	$(INCLUDE)/no_os_list.h \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_irq.h \
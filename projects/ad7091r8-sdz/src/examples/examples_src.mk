@@ -7,6 +7,7 @@ CFLAGS += -DAD7091R8_DEV
 endif
 
 INCS += $(INCLUDE)/no_os_list.h \
+		$(INCLUDE)/no_os_pool.h \
 		$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
 
 ifeq (y,$(strip $(BASIC_EXAMPLE)))
@@ -41,5 +42,6 @@ INCS += $(DRIVERS)/adc/ad7091r8/iio_ad7091r8.h
 SRCS += $(DRIVERS)/adc/ad7091r8/iio_ad7091r8.c
 
 INCS += $(INCLUDE)/no_os_list.h \
+		$(INCLUDE)/no_os_pool.h \
 		$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
 endif
@@ -30,9 +30,11 @@ ifeq (y,$(strip $(IIOD)))
 LIBRARIES += iio
 SRC_DIRS += $(NO-OS)/iio/iio_app
 SRCS += $(PLATFORM_DRIVERS)/$(PLATFORM)_uart.c \
+	$(NO-OS)/util/no_os_spsc_ring.c \
 	$(NO-OS)/util/no_os_lf256fifo.c \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_irq.c \
 	$(DRIVERS)/api/no_os_irq.c \
+	$(NO-OS)/util/no_os_pool.c \
 	$(NO-OS)/util/no_os_fifo.c \
 	$(DRIVERS)/api/no_os_uart.c \
 	$(NO-OS)/util/no_os_list.c	
@@ -53,6 +55,7 @@ INCS +=	$(INCLUDE)/no_os_axi_io.h \
 	$(INCLUDE)/no_os_delay.h \
 	$(INCLUDE)/no_os_irq.h \
 	$(INCLUDE)/no_os_uart.h \
+	$(INCLUDE)/no_os_spsc_ring.h \
 	$(INCLUDE)/no_os_lf256fifo.h \
 	$(INCLUDE)/no_os_pwm.h \
 	$(INCLUDE)/no_os_util.h \
@@ -60,5 +63,6 @@ INCS +=	$(INCLUDE)/no_os_axi_io.h \
 	$(INCLUDE)/no_os_mutex.h
 ifeq (y,$(strip $(IIOD)))
 INCS += $(INCLUDE)/no_os_fifo.h \
+	$(INCLUDE)/no_os_pool.h \
 	$(INCLUDE)/no_os_list.h
 endif
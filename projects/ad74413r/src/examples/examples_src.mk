@@ -28,5 +28,6 @@ SRCS += $(NO-OS)/iio/iio_trigger.c
 INCS += $(NO-OS)/iio/iio_trigger.h
 
 INCS += $(INCLUDE)/no_os_list.h \
+	$(INCLUDE)/no_os_pool.h \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
 endif
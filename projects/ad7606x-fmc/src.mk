@@ -25,6 +25,7 @@ INCS += $(DRIVERS)/adc/ad7606/ad7606.h
 SRCS += $(DRIVERS)/adc/ad7606/ad7606.c
 
 SRCS += $(DRIVERS)/api/no_os_uart.c     \
+        $(NO-OS)/util/no_os_pool.c      \
         $(NO-OS)/util/no_os_fifo.c      \
         $(NO-OS)/util/no_os_list.c      \
         $(NO-OS)/util/no_os_util.c      \
@@ -35,13 +36,17 @@ SRCS += $(DRIVERS)/api/no_os_uart.c     \
         $(NO-OS)/util/no_os_crc8.c      \
         $(NO-OS)/util/no_os_crc16.c     \
         $(NO-OS)/util/no_os_crc24.c     \
+        $(NO-OS)/util/no_os_crc_engine.c \
+        $(NO-OS)/util/no_os_crc_tables.c \
         $(NO-OS)/util/no_os_util.c
 
 
 INCS += $(INCLUDE)/no_os_delay.h     \
         $(INCLUDE)/no_os_error.h     \
+        $(INCLUDE)/no_os_pool.h      \
         $(INCLUDE)/no_os_fifo.h      \
         $(INCLUDE)/no_os_irq.h       \
+        $(INCLUDE)/no_os_spsc_ring.h \
         $(INCLUDE)/no_os_lf256fifo.h \
         $(INCLUDE)/no_os_list.h      \
         $(INCLUDE)/no_os_dma.h       \
@@ -59,6 +64,7 @@ INCS += $(INCLUDE)/no_os_delay.h     \
         $(INCLUDE)/no_os_crc8.h      \
         $(INCLUDE)/no_os_crc16.h     \
         $(INCLUDE)/no_os_crc24.h     \
+        $(INCLUDE)/no_os_crc_engine.h \
         $(INCLUDE)/no_os_print_log.h
 
 INCS += $(DRIVERS)/axi_core/axi_adc_core/axi_adc_core.h \
@@ -19,4 +19,5 @@ SRCS += $(DRIVERS)/adc/ad7616/iio_ad7616.c \
 endif
 
 INCS += $(INCLUDE)/no_os_list.h \
+	$(INCLUDE)/no_os_pool.h \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
@@ -12,6 +12,7 @@ INCS += $(PROJECT)/src/platform/$(PLATFORM)/parameters.h
 SRCS += $(PROJECT)/src/platform/$(PLATFORM)/parameters.c
 
 SRCS += $(DRIVERS)/api/no_os_uart.c     \
+        $(NO-OS)/util/no_os_pool.c      \
         $(NO-OS)/util/no_os_fifo.c      \
         $(NO-OS)/util/no_os_list.c      \
         $(NO-OS)/util/no_os_util.c      \
@@ -23,8 +24,10 @@ SRCS += $(DRIVERS)/api/no_os_uart.c     \
 
 INCS += $(INCLUDE)/no_os_delay.h     \
         $(INCLUDE)/no_os_error.h     \
+        $(INCLUDE)/no_os_pool.h      \
         $(INCLUDE)/no_os_fifo.h      \
         $(INCLUDE)/no_os_irq.h       \
+        $(INCLUDE)/no_os_spsc_ring.h \
         $(INCLUDE)/no_os_lf256fifo.h \
         $(INCLUDE)/no_os_list.h      \
         $(INCLUDE)/no_os_dma.h      \
@@ -21,4 +21,5 @@ INCS += $(DRIVERS)/adc/ad796x/ad796x.h
 SRCS += $(DRIVERS)/adc/ad796x/ad796x.c
 
 INCS += $(INCLUDE)/no_os_list.h \
+        $(INCLUDE)/no_os_pool.h \
         $(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
@@ -15,7 +15,8 @@ INCS += $(INCLUDE)/no_os_circular_buffer.h \
 	$(PLATFORM_DRIVERS)/xilinx_timer.h  \
 	$(PLATFORM_DRIVERS)/rtc_extra.h
 
-SRCS += $(NO-OS)/util/no_os_lf256fifo.c  \
+SRCS += $(NO-OS)/util/no_os_spsc_ring.c \
+	$(NO-OS)/util/no_os_lf256fifo.c  \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.c \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_irq.c
 
@@ -74,18 +74,22 @@ INCS +=	$(INCLUDE)/no_os_axi_io.h \
 	$(NO-OS)/jesd204/jesd204-priv.h
 ifeq (y,$(strip $(IIOD)))
 SRCS += $(NO-OS)/util/no_os_fifo.c \
+	$(NO-OS)/util/no_os_pool.c \
 	$(DRIVERS)/axi_core/iio_axi_adc/iio_axi_adc.c \
 	$(NO-OS)/iio/iio_app/iio_app.c \
 	$(NO-OS)/util/no_os_list.c \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.c \
+	$(NO-OS)/util/no_os_spsc_ring.c \
 	$(NO-OS)/util/no_os_lf256fifo.c \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_irq.c \
 	$(DRIVERS)/api/no_os_irq.c \
 	$(DRIVERS)/api/no_os_uart.c
 
 INCS += $(INCLUDE)/no_os_fifo.h \
+	$(INCLUDE)/no_os_pool.h \
 	$(INCLUDE)/no_os_irq.h \
 	$(INCLUDE)/no_os_uart.h \
+	$(INCLUDE)/no_os_spsc_ring.h \
 	$(INCLUDE)/no_os_lf256fifo.h \
 	$(INCLUDE)/no_os_list.h \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_irq.h \
@@ -21,12 +21,16 @@ SRC_DIRS += $(DRIVERS)/axi_core/iio_axi_adc \
 		$(NO-OS)/iio/iio_app
 
 SRCS	+= $(PLATFORM_DRIVERS)/$(PLATFORM)_uart.c \
+		$(NO-OS)/util/no_os_spsc_ring.c \
 		$(NO-OS)/util/no_os_lf256fifo.c \
 		$(PLATFORM_DRIVERS)/$(PLATFORM)_irq.c \
 		$(DRIVERS)/api/no_os_uart.c \
+		$(NO-OS)/util/no_os_pool.c \
 		$(NO-OS)/util/no_os_list.c 
 INCS	+= $(INCLUDE)/no_os_uart.h \
+		$(INCLUDE)/no_os_spsc_ring.h \
 		$(INCLUDE)/no_os_lf256fifo.h \
+		$(INCLUDE)/no_os_pool.h \
 		$(INCLUDE)/no_os_list.h \
 		$(INCLUDE)/no_os_irq.h \
 		$(PLATFORM_DRIVERS)/$(PLATFORM)_irq.h \
@@ -39,14 +39,17 @@ CFLAGS += -DNO_OS_NETWORKING \
 		-DDISABLE_SECURE_SOCKET
 SRCS += $(NO-OS)/network/linux_socket/linux_socket.c \
 		$(NO-OS)/network/tcp_socket.c \
+	$(NO-OS)/util/no_os_spsc_ring.c \
 	$(NO-OS)/util/no_os_lf256fifo.c \
 	$(PLATFORM_DRIVERS)/linux_uart.c
 else
 SRCS += $(PLATFORM_DRIVERS)/$(PLATFORM)_uart.c \
+	$(NO-OS)/util/no_os_spsc_ring.c \
 	$(NO-OS)/util/no_os_lf256fifo.c
 endif
 
 SRCS += $(NO-OS)/util/no_os_fifo.c \
+	$(NO-OS)/util/no_os_pool.c \
 	$(NO-OS)/util/no_os_list.c \
 	$(DRIVERS)/rf-transceiver/ad9361/iio_ad9361.c \
 	$(DRIVERS)/axi_core/iio_axi_adc/iio_axi_adc.c \
@@ -69,6 +72,7 @@ ifeq (linux,$(strip $(PLATFORM)))
 CFLAGS += -DPLATFORM_MB
 INCS +=	$(PLATFORM_DRIVERS)/linux_spi.h \
 	$(PLATFORM_DRIVERS)/linux_gpio.h \
+	$(INCLUDE)/no_os_spsc_ring.h \
 	$(INCLUDE)/no_os_lf256fifo.h \
 	$(PLATFORM_DRIVERS)/linux_uart.h
 endif
@@ -91,7 +95,9 @@ INCS += $(NO-OS)/network/tcp_socket.h \
 endif
 
 INCS += $(INCLUDE)/no_os_fifo.h \
+	$(INCLUDE)/no_os_pool.h \
 	$(INCLUDE)/no_os_uart.h \
+	$(INCLUDE)/no_os_spsc_ring.h \
 	$(INCLUDE)/no_os_lf256fifo.h \
 	$(INCLUDE)/no_os_list.h \
 	$(DRIVERS)/rf-transceiver/ad9361/iio_ad9361.h \
@@ -986,7 +986,7 @@ int main(void)
 	/**
 	 * iio application configurations.
 	 */
-	struct iio_init_param iio_init_par;
+	struct iio_init_param iio_init_par = { 0 };
 
 	/**
 	 * UART init params
@@ -7,6 +7,7 @@ SRC_DIRS += $(NO-OS)/iio/iio_app
 SRC_DIRS += $(INCLUDE)
 
 SRCS += $(NO-OS)/util/no_os_util.c \
+	$(NO-OS)/util/no_os_pool.c \
 	$(NO-OS)/util/no_os_list.c \
 	$(NO-OS)/util/no_os_alloc.c \
 	$(NO-OS)/util/no_os_mutex.c \
@@ -21,12 +22,14 @@ SRCS += $(NO-OS)/util/no_os_util.c \
 	$(DRIVERS)/platform/$(PLATFORM)/$(PLATFORM)_timer.c \
 	$(DRIVERS)/platform/$(PLATFORM)/$(PLATFORM)_rtc.c \
 	$(DRIVERS)/platform/$(PLATFORM)/$(PLATFORM)_delay.c \
+	$(NO-OS)/util/no_os_spsc_ring.c \
 	$(NO-OS)/util/no_os_lf256fifo.c \
 	$(DRIVERS)/platform/$(PLATFORM)/$(PLATFORM)_uart.c
 
 INCS += $(INCLUDE)/no_os_spi.h \
 	$(INCLUDE)/no_os_irq.h \
 	$(INCLUDE)/no_os_uart.h \
+	$(INCLUDE)/no_os_spsc_ring.h \
 	$(INCLUDE)/no_os_lf256fifo.h \
 	$(INCLUDE)/no_os_alloc.h \
 	$(INCLUDE)/no_os_mutex.h \
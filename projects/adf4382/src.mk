@@ -17,8 +17,10 @@ SRCS += $(DRIVERS)/api/no_os_uart.c     \
 	$(DRIVERS)/api/no_os_irq.c 	\
 	$(DRIVERS)/api/no_os_timer.c	\
         $(DRIVERS)/api/no_os_dma.c      \
+        $(NO-OS)/util/no_os_pool.c      \
         $(NO-OS)/util/no_os_fifo.c      \
 	$(NO-OS)/util/no_os_mutex.c     \
+	$(NO-OS)/util/no_os_spsc_ring.c \
 	$(NO-OS)/util/no_os_lf256fifo.c \
         $(NO-OS)/util/no_os_list.c      \
         $(NO-OS)/util/no_os_util.c      \
@@ -29,8 +31,10 @@ INCS += $(INCLUDE)/no_os_delay.h     \
 	$(INCLUDE)/no_os_gpio.h      \
 	$(INCLUDE)/no_os_mutex.h     \
 	$(INCLUDE)/no_os_spi.h       \
+        $(INCLUDE)/no_os_pool.h      \
         $(INCLUDE)/no_os_fifo.h      \
         $(INCLUDE)/no_os_irq.h       \
+        $(INCLUDE)/no_os_spsc_ring.h \
         $(INCLUDE)/no_os_lf256fifo.h \
         $(INCLUDE)/no_os_list.h      \
 	$(INCLUDE)/no_os_print_log.h \
@@ -18,5 +18,6 @@ INCS += $(DRIVERS)/frequency/adf4382/iio_adf4382.h
 SRCS += $(DRIVERS)/frequency/adf4382/iio_adf4382.c
 
 INCS += $(INCLUDE)/no_os_list.h \
+		$(INCLUDE)/no_os_pool.h \
 		$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
 endif
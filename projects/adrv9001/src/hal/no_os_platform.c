@@ -418,22 +418,35 @@ int32_t no_os_ssi_reset(void* devHalCfg)
 	return ADI_COMMON_ERR_OK;
 }
 
-int32_t no_os_image_page_get(void *devHalCfg, const char *ImagePath,
-			     uint32_t pageIndex, uint32_t pageSize, uint8_t *rdBuff)
+int32_t no_os_image_get(void *devHalCfg, const char *ImagePath,
+			const uint8_t **image, uint32_t *size)
 {
-	unsigned char *bin;
 	if (!strcmp(ImagePath, "Navassa_EvaluationFw.bin")) {
-		if ((pageIndex * pageSize) > sizeof(Navassa_EvaluationFw_bin))
-			return -EINVAL;
-
-		bin = Navassa_EvaluationFw_bin;
+		*image = Navassa_EvaluationFw_bin;
+		*size = sizeof(Navassa_EvaluationFw_bin);
 	} else if (!strcmp(ImagePath, "Navassa_Stream.bin")) {
-		if ((pageIndex * pageSize) > sizeof(Navassa_Stream_bin))
-			return -EINVAL;
-		bin = Navassa_Stream_bin;
+		*image = Navassa_Stream_bin;
+		*size = sizeof(Navassa_Stream_bin);
 	} else
 		return ADI_COMMON_ERR_INV_PARAM;
 
+	return ADI_COMMON_ERR_OK;
+}
+
+int32_t no_os_image_page_get(void *devHalCfg, const char *ImagePath,
+			     uint32_t pageIndex, uint32_t pageSize, uint8_t *rdBuff)
+{
+	const uint8_t *bin;
+	uint32_t size;
+	int32_t ret;
+
+	ret = no_os_image_get(devHalCfg, ImagePath, &bin, &size);
+	if (ret)
+		return ret;
+
+	if ((pageIndex * pageSize) > size)
+		return -EINVAL;
+
 	memcpy(rdBuff, &bin[pageIndex * pageSize], pageSize);
 
 	return ADI_COMMON_ERR_OK;
@@ -538,6 +551,12 @@ int32_t (*adi_hal_ArmImagePageGet)(void *devHalCfg, const char *ImagePath,
 				   uint32_t pageIndex, uint32_t pageSize, uint8_t *rdBuff) = no_os_image_page_get;
 int32_t (*adi_hal_StreamImagePageGet)(void *devHalCfg, const char *ImagePath,
 				      uint32_t pageIndex, uint32_t pageSize, uint8_t *rdBuff) = no_os_image_page_get;
+int32_t (*adi_hal_ArmImageGet)(void *devHalCfg, const char *ImagePath,
+			       const uint8_t **image,
+			       uint32_t *size) = no_os_image_get;
+int32_t (*adi_hal_StreamImageGet)(void *devHalCfg, const char *ImagePath,
+				  const uint8_t **image,
+				  uint32_t *size) = no_os_image_get;
 int32_t (*adi_hal_RxGainTableEntryGet)(void *devHalCfg,
 				       const char *rxGainTablePath, uint16_t lineCount, uint8_t *gainIndex,
 				       uint8_t *rxFeGain,
@@ -583,6 +583,29 @@ int32_t no_os_image_page_get(void *devHalCfg, const char *ImagePath,
 	return ADI_COMMON_ERR_OK;
 }
 
+/*
+ * Hand out the binary images linked in the firmware, so that the API writes
+ * them in place, in large bursts.
+ */
+static int32_t no_os_image_get(void *devHalCfg, const char *imagePath,
+			       const uint8_t **image, uint32_t *byteCount)
+{
+	if (!strcmp(imagePath, "ADRV9025_FW.bin")) {
+		*image = ADRV9025_FW_bin;
+		*byteCount = sizeof(ADRV9025_FW_bin);
+	} else if (!strcmp(imagePath, "ADRV9025_DPDCORE_FW.bin")) {
+		*image = ADRV9025_DPDCORE_FW_bin;
+		*byteCount = sizeof(ADRV9025_DPDCORE_FW_bin);
+	} else if (!strcmp(imagePath, ADRV9025_STREAM_IMAGE_FILE)) {
+		*image = stream_image_bin;
+		*byteCount = sizeof(stream_image_bin);
+	} else {
+		return ADI_COMMON_ERR_INV_PARAM;
+	}
+
+	return ADI_COMMON_ERR_OK;
+}
+
 /*
  * Function pointer assignment for default configuration
  */
@@ -647,6 +670,10 @@ int32_t (*adi_hal_ArmImagePageGet)(void *devHalCfg, const char *ImagePath,
 				   uint32_t pageIndex, uint32_t pageSize, uint8_t *rdBuff) = no_os_image_page_get;
 int32_t (*adi_hal_StreamImagePageGet)(void *devHalCfg, const char *ImagePath,
 				      uint32_t pageIndex, uint32_t pageSize, uint8_t *rdBuff) = no_os_image_page_get;
+int32_t (*adrv9025_hal_CpuImageGet)(void *devHalCfg, const char *imagePath,
+				   const uint8_t **image, uint32_t *byteCount) = no_os_image_get;
+int32_t (*adrv9025_hal_StreamImageGet)(void *devHalCfg, const char *imagePath,
+				      const uint8_t **image, uint32_t *byteCount) = no_os_image_get;
 
 long int ftell (FILE *stream)
 {
@@ -675,26 +702,21 @@ FILE* __fopen(const char * filename, const char *mode)
 		profile.end = profile.start + strlen(profile.data);
 	} else if (!strcmp(filename,
 			   ADRV9025_STREAM_IMAGE_FILE)) {
-		length = sizeof(stream_image_bin);
-		temp = (unsigned char *)no_os_calloc(length, sizeof(unsigned char));
-		memcpy(temp, stream_image_bin, length);
-		profile.data = temp;
-		profile.start = profile.ptr = profile.data;
-		profile.end = profile.start + length;
+		/*
+		 * Binary images are read in place, no copy. Only used if the
+		 * API can't get them through adrv9025_hal_*ImageGet.
+		 */
+		profile.data = NULL;
+		profile.start = profile.ptr = (char *)stream_image_bin;
+		profile.end = profile.start + sizeof(stream_image_bin);
 	} else if (!strcmp(filename, "ADRV9025_FW.bin")) {
-		length = sizeof(ADRV9025_FW_bin);
-		temp = (unsigned char *)no_os_calloc(length, sizeof(unsigned char));
-		memcpy(temp, ADRV9025_FW_bin, sizeof(ADRV9025_FW_bin));
-		profile.data = temp;
-		profile.start = profile.ptr = profile.data;
-		profile.end = profile.start + length;
+		profile.data = NULL;
+		profile.start = profile.ptr = (char *)ADRV9025_FW_bin;
+		profile.end = profile.start + sizeof(ADRV9025_FW_bin);
 	} else if (!strcmp(filename, "ADRV9025_DPDCORE_FW.bin")) {
-		length = sizeof(ADRV9025_DPDCORE_FW_bin);
-		temp = (unsigned char *)no_os_calloc(length, sizeof(unsigned char));
-		memcpy(temp, ADRV9025_DPDCORE_FW_bin, sizeof(ADRV9025_DPDCORE_FW_bin));
-		profile.data = temp;
-		profile.start = profile.ptr = profile.data;
-		profile.end = profile.start + length;
+		profile.data = NULL;
+		profile.start = profile.ptr = (char *)ADRV9025_DPDCORE_FW_bin;
+		profile.end = profile.start + sizeof(ADRV9025_DPDCORE_FW_bin);
 	} else if (!strcmp(filename, "ADRV9025_RxGainTable.h")) {
 		length = strlen(ADRV9025_RxGainTable_text);
 		temp = (unsigned char *)no_os_calloc(length, sizeof(unsigned char));
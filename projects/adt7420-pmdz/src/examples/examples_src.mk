@@ -18,5 +18,6 @@ INCS += $(DRIVERS)/temperature/adt7420/iio_adt7420.h
 SRCS += $(DRIVERS)/temperature/adt7420/iio_adt7420.c 
 
 INCS += $(INCLUDE)/no_os_list.h \
+		$(INCLUDE)/no_os_pool.h \
 		$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
 endif
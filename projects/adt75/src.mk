@@ -13,6 +13,7 @@ SRCS += $(PROJECT)/src/platform/$(PLATFORM)/parameters.c
 
 INCS += $(INCLUDE)/no_os_delay.h     		\
 		$(INCLUDE)/no_os_error.h     	\
+		$(INCLUDE)/no_os_pool.h     	\
 		$(INCLUDE)/no_os_list.h     	\
 		$(INCLUDE)/no_os_gpio.h      	\
 		$(INCLUDE)/no_os_print_log.h 	\
@@ -21,19 +22,22 @@ INCS += $(INCLUDE)/no_os_delay.h     		\
 		$(INCLUDE)/no_os_dma.h       	\
 		$(INCLUDE)/no_os_rtc.h       	\
 		$(INCLUDE)/no_os_uart.h      	\
+		$(INCLUDE)/no_os_spsc_ring.h 	\
 		$(INCLUDE)/no_os_lf256fifo.h 	\
 		$(INCLUDE)/no_os_util.h 	\
 		$(INCLUDE)/no_os_units.h        \
 		$(INCLUDE)/no_os_alloc.h        \
                 $(INCLUDE)/no_os_mutex.h
 
-SRCS += $(NO-OS)/util/no_os_lf256fifo.c 	\
+SRCS += $(NO-OS)/util/no_os_spsc_ring.c \
+	$(NO-OS)/util/no_os_lf256fifo.c 	\
 		$(DRIVERS)/api/no_os_i2c.c  	\
 		$(DRIVERS)/api/no_os_uart.c  	\
 		$(DRIVERS)/api/no_os_irq.c  	\
 		$(DRIVERS)/api/no_os_dma.c  	\
 		$(DRIVERS)/api/no_os_gpio.c  	\
 		$(NO-OS)/util/no_os_util.c	\
+		$(NO-OS)/util/no_os_pool.c      \
 		$(NO-OS)/util/no_os_list.c      \
 		$(NO-OS)/util/no_os_alloc.c 	\
 		$(NO-OS)/util/no_os_mutex.c
@@ -21,5 +21,6 @@ SRCS += $(DRIVERS)/temperature/adt75/iio_adt75.c
 INCS += $(DRIVERS)/temperature/adt75/iio_adt75.h
 
 INCS += $(INCLUDE)/no_os_list.h \
+	$(INCLUDE)/no_os_pool.h \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
 endif
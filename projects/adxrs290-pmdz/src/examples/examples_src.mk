@@ -30,4 +30,5 @@ SRCS += $(DRIVERS)/gyro/adxrs290/iio_adxrs290.c \
 	$(DRIVERS)/gyro/adxrs290/iio_adxrs290_trig.c
 
 INCS += $(INCLUDE)/no_os_list.h
+INCS += $(INCLUDE)/no_os_pool.h
 endif
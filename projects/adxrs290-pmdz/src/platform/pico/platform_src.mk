@@ -13,5 +13,6 @@ SRCS += $(PLATFORM_DRIVERS)/pico_delay.c    \
         $(PLATFORM_DRIVERS)/pico_timer.c    \
         $(PLATFORM_DRIVERS)/pico_uart.c
 
-SRCS += $(NO-OS)/util/no_os_lf256fifo.c \
+SRCS += $(NO-OS)/util/no_os_spsc_ring.c \
+	$(NO-OS)/util/no_os_lf256fifo.c \
         $(DRIVERS)/api/no_os_irq.c
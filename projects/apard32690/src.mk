@@ -11,8 +11,10 @@ SRCS += $(DRIVERS)/api/no_os_uart.c     \
 	$(DRIVERS)/api/no_os_gpio.c     	\
 	$(DRIVERS)/api/no_os_timer.c     	\
 	$(DRIVERS)/api/no_os_dma.c     	\
+        $(NO-OS)/util/no_os_pool.c      \
         $(NO-OS)/util/no_os_fifo.c      \
         $(NO-OS)/util/no_os_list.c      \
+        $(NO-OS)/util/no_os_spsc_ring.c \
         $(NO-OS)/util/no_os_lf256fifo.c \
         $(NO-OS)/util/no_os_util.c      \
         $(NO-OS)/util/no_os_alloc.c     \
@@ -20,6 +22,7 @@ SRCS += $(DRIVERS)/api/no_os_uart.c     \
 
 INCS += $(INCLUDE)/no_os_delay.h     \
         $(INCLUDE)/no_os_error.h     \
+        $(INCLUDE)/no_os_pool.h      \
         $(INCLUDE)/no_os_fifo.h      \
         $(INCLUDE)/no_os_spi.h      \
         $(INCLUDE)/no_os_init.h      \
@@ -30,6 +33,7 @@ INCS += $(INCLUDE)/no_os_delay.h     \
         $(INCLUDE)/no_os_irq.h       \
         $(INCLUDE)/no_os_dma.h       \
         $(INCLUDE)/no_os_gpio.h       \
+        $(INCLUDE)/no_os_spsc_ring.h \
         $(INCLUDE)/no_os_lf256fifo.h \
         $(INCLUDE)/no_os_list.h      \
         $(INCLUDE)/no_os_uart.h      \
@@ -2,7 +2,10 @@ ifeq (y,$(strip $(APARD32690_ADIN1110_STANDALONE_EXAMPLE)))
 CFLAGS += -DAPARD32690_ADIN1110_STANDALONE_EXAMPLE
 SRCS += $(DRIVERS)/net/adin1110/adin1110.c
 SRCS += $(NO-OS)/util/no_os_crc8.c
+SRCS += $(NO-OS)/util/no_os_crc_engine.c
+SRCS += $(NO-OS)/util/no_os_crc_tables.c
 INCS += $(INCLUDE)/no_os_crc8.h
+INCS += $(INCLUDE)/no_os_crc_engine.h
 INCS += $(DRIVERS)/net/adin1110/adin1110.h
 
 SRC_DIRS += $(PROJECT)/src/examples/adin1110_standalone_example
@@ -14,11 +17,14 @@ LIBRARIES += lwip
 CFLAGS += -DNO_OS_STATIC_IP
 CFLAGS += -DNO_OS_LWIP_NETWORKING
 INCS += $(INCLUDE)/no_os_crc8.h
+INCS += $(INCLUDE)/no_os_crc_engine.h
 INCS += $(DRIVERS)/net/adin1110/adin1110.h
 INCS += $(NO-OS)/network/lwip_raw_socket/netdevs/adin1110/lwip_adin1110.h
 SRCS += $(NO-OS)/network/lwip_raw_socket/netdevs/adin1110/lwip_adin1110.c
 SRCS += $(DRIVERS)/net/adin1110/adin1110.c
 SRCS += $(NO-OS)/util/no_os_crc8.c
+SRCS += $(NO-OS)/util/no_os_crc_engine.c
+SRCS += $(NO-OS)/util/no_os_crc_tables.c
 
 SRC_DIRS += $(PROJECT)/src/examples/tcp_echo_server_example
 endif
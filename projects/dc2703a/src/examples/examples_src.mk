@@ -17,5 +17,6 @@ INCS += $(DRIVERS)/power/lt8491/iio_lt8491.h
 SRCS += $(DRIVERS)/power/lt8491/iio_lt8491.c
 
 INCS += $(INCLUDE)/no_os_list.h \
+		$(INCLUDE)/no_os_pool.h \
 		$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
 endif
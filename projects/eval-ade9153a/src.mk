@@ -10,7 +10,9 @@ INCS += $(INCLUDE)/no_os_alloc.h		\
 	$(INCLUDE)/no_os_timer.h      \
 	$(INCLUDE)/no_os_mutex.h		\
 	$(INCLUDE)/no_os_util.h			\
+	$(INCLUDE)/no_os_spsc_ring.h		\
 	$(INCLUDE)/no_os_lf256fifo.h		\
+	$(INCLUDE)/no_os_pool.h			\
 	$(INCLUDE)/no_os_list.h			\
 	$(INCLUDE)/no_os_irq.h			\
 	$(INCLUDE)/no_os_units.h \
@@ -18,6 +20,7 @@ INCS += $(INCLUDE)/no_os_alloc.h		\
 	$(INCLUDE)/no_os_alloc.h \
 	$(INCLUDE)/no_os_crc8.h \
 	$(INCLUDE)/no_os_crc16.h \
+	$(INCLUDE)/no_os_crc_engine.h \
 	$(INCLUDE)/no_os_uart.h			\
 	$(INCLUDE)/no_os_pwm.h			\
 	$(INCLUDE)/no_os_dma.h \
@@ -33,11 +36,15 @@ INCS += $(INCLUDE)/no_os_alloc.h		\
 SRCS +=	$(NO-OS)/util/no_os_alloc.c		\
 	$(DRIVERS)/api/no_os_gpio.c \
 	$(NO-OS)/util/no_os_mutex.c		\
+	$(NO-OS)/util/no_os_spsc_ring.c		\
 	$(NO-OS)/util/no_os_lf256fifo.c		\
+	$(NO-OS)/util/no_os_pool.c		\
 	$(NO-OS)/util/no_os_list.c		\
 	$(NO-OS)/util/no_os_util.c		\
 	$(NO-OS)/util/no_os_crc8.c \
 	$(NO-OS)/util/no_os_crc16.c \
+	$(NO-OS)/util/no_os_crc_engine.c \
+	$(NO-OS)/util/no_os_crc_tables.c \
 	$(DRIVERS)/api/no_os_irq.c		\
 	$(DRIVERS)/api/no_os_uart.c		\
 	$(DRIVERS)/api/no_os_pwm.c		\
@@ -10,9 +10,11 @@ INCS += $(INCLUDE)/no_os_delay.h     \
 	$(INCLUDE)/no_os_spi.h       \
 	$(INCLUDE)/no_os_irq.h      \
 	$(INCLUDE)/no_os_dma.h      \
+	$(INCLUDE)/no_os_pool.h      \
 	$(INCLUDE)/no_os_list.h      \
 	$(INCLUDE)/no_os_timer.h      \
 	$(INCLUDE)/no_os_uart.h      \
+	$(INCLUDE)/no_os_spsc_ring.h \
 	$(INCLUDE)/no_os_lf256fifo.h \
 	$(INCLUDE)/no_os_util.h \
 	$(INCLUDE)/no_os_units.h \
@@ -41,6 +43,7 @@ SRCS += $(DRIVERS)/api/no_os_gpio.c \
 	$(DRIVERS)/meter/ade9430/ade9430.c \
 	$(DRIVERS)/rtc/pcf85263/pcf85263.c \
 	$(DRIVERS)/api/no_os_i2c.c  \
+	$(NO-OS)/util/no_os_spsc_ring.c \
 	$(NO-OS)/util/no_os_lf256fifo.c \
 	$(DRIVERS)/api/no_os_gpio.c  \
 	$(DRIVERS)/api/no_os_irq.c  \
@@ -49,6 +52,7 @@ SRCS += $(DRIVERS)/api/no_os_gpio.c \
 	$(DRIVERS)/api/no_os_uart.c  \
 	$(DRIVERS)/api/no_os_timer.c  \
 	$(DRIVERS)/api/no_os_trng.c  \
+	$(NO-OS)/util/no_os_pool.c \
 	$(NO-OS)/util/no_os_list.c \
 	$(NO-OS)/util/no_os_util.c	\
 	$(NO-OS)/util/no_os_circular_buffer.c \
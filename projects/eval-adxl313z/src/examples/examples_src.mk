@@ -18,5 +18,6 @@ INCS += $(DRIVERS)/accel/adxl313/iio_adxl313.h
 SRCS += $(DRIVERS)/accel/adxl313/iio_adxl313.c
 
 INCS += $(INCLUDE)/no_os_list.h \
+		$(INCLUDE)/no_os_pool.h \
 		$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
 endif
@@ -48,5 +48,6 @@ SRCS += $(DRIVERS)/accel/adxl355/iio_adxl355_trig.c
 endif
 
 INCS += $(INCLUDE)/no_os_list.h \
+		$(INCLUDE)/no_os_pool.h \
 		$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
 endif
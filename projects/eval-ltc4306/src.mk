@@ -19,22 +19,26 @@ INCS += $(INCLUDE)/no_os_delay.h        \
         $(INCLUDE)/no_os_i2c.h          \
         $(INCLUDE)/no_os_irq.h          \
         $(INCLUDE)/no_os_init.h          \
+        $(INCLUDE)/no_os_pool.h         \
         $(INCLUDE)/no_os_list.h         \
         $(INCLUDE)/no_os_dma.h         \
         $(INCLUDE)/no_os_uart.h         \
         $(INCLUDE)/no_os_timer.h        \
+        $(INCLUDE)/no_os_spsc_ring.h    \
         $(INCLUDE)/no_os_lf256fifo.h    \
         $(INCLUDE)/no_os_util.h         \
         $(INCLUDE)/no_os_units.h        \
         $(INCLUDE)/no_os_alloc.h        \
         $(INCLUDE)/no_os_mutex.h  
 
-SRCS += $(NO-OS)/util/no_os_lf256fifo.c \
+SRCS += $(NO-OS)/util/no_os_spsc_ring.c \
+	$(NO-OS)/util/no_os_lf256fifo.c \
         $(DRIVERS)/api/no_os_irq.c      \
         $(DRIVERS)/api/no_os_dma.c      \
         $(DRIVERS)/api/no_os_timer.c    \
         $(DRIVERS)/api/no_os_i2c.c      \
         $(DRIVERS)/api/no_os_uart.c     \
+        $(NO-OS)/util/no_os_pool.c      \
         $(NO-OS)/util/no_os_list.c      \
         $(NO-OS)/util/no_os_util.c      \
         $(NO-OS)/util/no_os_alloc.c     \
@@ -9,8 +9,10 @@ SRCS += $(DRIVERS)/api/no_os_uart.c     			\
 	$(DRIVERS)/api/no_os_irq.c     				\
 	$(DRIVERS)/api/no_os_dma.c     				\
 	$(DRIVERS)/api/no_os_gpio.c     			\
+        $(NO-OS)/util/no_os_pool.c      			\
         $(NO-OS)/util/no_os_fifo.c      			\
         $(NO-OS)/util/no_os_list.c      			\
+        $(NO-OS)/util/no_os_spsc_ring.c 			\
         $(NO-OS)/util/no_os_lf256fifo.c 			\
         $(NO-OS)/util/no_os_util.c      			\
         $(NO-OS)/util/no_os_alloc.c     			\
@@ -18,9 +20,11 @@ SRCS += $(DRIVERS)/api/no_os_uart.c     			\
 
 INCS += $(INCLUDE)/no_os_delay.h     				\
         $(INCLUDE)/no_os_error.h     				\
+        $(INCLUDE)/no_os_pool.h      				\
         $(INCLUDE)/no_os_fifo.h      				\
         $(INCLUDE)/no_os_gpio.h      				\
         $(INCLUDE)/no_os_irq.h       				\
+        $(INCLUDE)/no_os_spsc_ring.h 				\
         $(INCLUDE)/no_os_lf256fifo.h 				\
         $(INCLUDE)/no_os_list.h      				\
         $(INCLUDE)/no_os_uart.h      				\
@@ -61,9 +65,13 @@ EXTRA_MATH_PQM = ${PQLIB_PATH}/libadi_pqlib_cm4_gcc.a
 endif
 
 INCS += $(INCLUDE)/no_os_crc8.h
+INCS += $(INCLUDE)/no_os_crc_engine.h
 SRCS += $(NO-OS)/util/no_os_crc8.c
+SRCS += $(NO-OS)/util/no_os_crc_engine.c
+SRCS += $(NO-OS)/util/no_os_crc_tables.c
 
 INCS += $(INCLUDE)/no_os_list.h \
+        $(INCLUDE)/no_os_pool.h \
         $(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
 
 EXTRA_FILES +=	$(EXTRA_MATH_PQM) ${EXTRA_MATH_LIB}
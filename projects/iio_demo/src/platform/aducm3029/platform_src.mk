@@ -14,7 +14,8 @@ INCS += $(INCLUDE)/no_os_circular_buffer.h \
 	$(PLATFORM_DRIVERS)/aducm3029_timer.h  \
 	$(PLATFORM_DRIVERS)/aducm3029_rtc.h
 
-SRCS += $(NO-OS)/util/no_os_lf256fifo.c  \
+SRCS += $(NO-OS)/util/no_os_spsc_ring.c \
+	$(NO-OS)/util/no_os_lf256fifo.c  \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.c \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_irq.c \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_timer.c
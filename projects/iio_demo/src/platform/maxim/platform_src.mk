@@ -16,6 +16,7 @@ INCS += $(INCLUDE)/no_os_irq.h
 SRCS += $(DRIVERS)/api/no_os_irq.c
 SRCS += $(DRIVERS)/api/no_os_timer.c
 
+SRCS += $(NO-OS)/util/no_os_spsc_ring.c
 SRCS += $(NO-OS)/util/no_os_lf256fifo.c
 
 ifeq '$(NO_OS_USB_UART)' 'y'
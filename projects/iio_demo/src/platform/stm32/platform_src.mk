@@ -13,6 +13,7 @@ SRCS += $(PLATFORM_DRIVERS)/stm32_delay.c     \
 
 ICNS += $(INCLUDE)/no_os_irq.h
 
-SRCS += $(NO-OS)/util/no_os_lf256fifo.c \
+SRCS += $(NO-OS)/util/no_os_spsc_ring.c \
+	$(NO-OS)/util/no_os_lf256fifo.c \
         $(DRIVERS)/api/no_os_timer.c    \
         $(DRIVERS)/api/no_os_irq.c
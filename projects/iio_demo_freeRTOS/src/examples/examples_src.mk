@@ -15,4 +15,5 @@ SRCS += $(DRIVERS)/adc/adc_demo/iio_adc_demo.c \
         $(DRIVERS)/dac/dac_demo/iio_dac_demo.c
 
 INCS += $(INCLUDE)/no_os_list.h \
+        $(INCLUDE)/no_os_pool.h \
         $(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
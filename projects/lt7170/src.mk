@@ -13,6 +13,7 @@ SRCS += $(PROJECT)/src/platform/$(PLATFORM)/parameters.c
 
 INCS += $(INCLUDE)/no_os_delay.h     		\
 		$(INCLUDE)/no_os_error.h     	\
+		$(INCLUDE)/no_os_pool.h     	\
 		$(INCLUDE)/no_os_list.h     	\
 		$(INCLUDE)/no_os_gpio.h      	\
 		$(INCLUDE)/no_os_dma.h      	\
@@ -22,14 +23,17 @@ INCS += $(INCLUDE)/no_os_delay.h     		\
 		$(INCLUDE)/no_os_pwm.h       	\
 		$(INCLUDE)/no_os_rtc.h       	\
 		$(INCLUDE)/no_os_uart.h      	\
+		$(INCLUDE)/no_os_spsc_ring.h 	\
 		$(INCLUDE)/no_os_lf256fifo.h 	\
 		$(INCLUDE)/no_os_util.h 	\
 		$(INCLUDE)/no_os_units.h        \
 		$(INCLUDE)/no_os_alloc.h        \
                 $(INCLUDE)/no_os_mutex.h	\
-		$(INCLUDE)/no_os_crc8.h	
+		$(INCLUDE)/no_os_crc8.h \
+		$(INCLUDE)/no_os_crc_engine.h
 
-SRCS += $(NO-OS)/util/no_os_lf256fifo.c 	\
+SRCS += $(NO-OS)/util/no_os_spsc_ring.c \
+	$(NO-OS)/util/no_os_lf256fifo.c 	\
 		$(DRIVERS)/api/no_os_i2c.c  	\
 		$(DRIVERS)/api/no_os_dma.c  	\
 		$(DRIVERS)/api/no_os_uart.c  	\
@@ -37,10 +41,13 @@ SRCS += $(NO-OS)/util/no_os_lf256fifo.c 	\
 		$(DRIVERS)/api/no_os_gpio.c  	\
 		$(DRIVERS)/api/no_os_pwm.c	\
 		$(NO-OS)/util/no_os_util.c	\
+		$(NO-OS)/util/no_os_pool.c      \
 		$(NO-OS)/util/no_os_list.c      \
 		$(NO-OS)/util/no_os_alloc.c 	\
 		$(NO-OS)/util/no_os_mutex.c	\
-		$(NO-OS)/util/no_os_crc8.c
+		$(NO-OS)/util/no_os_crc8.c \
+		$(NO-OS)/util/no_os_crc_engine.c \
+		$(NO-OS)/util/no_os_crc_tables.c
 
 INCS += $(DRIVERS)/power/lt7170/lt7170.h
 SRCS += $(DRIVERS)/power/lt7170/lt7170.c
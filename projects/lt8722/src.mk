@@ -13,14 +13,17 @@ SRCS += $(PROJECT)/src/platform/$(PLATFORM)/parameters.c
 
 INCS += $(INCLUDE)/no_os_delay.h		\
 		$(INCLUDE)/no_os_error.h   		\
+		$(INCLUDE)/no_os_pool.h    		\
 		$(INCLUDE)/no_os_list.h    		\
 		$(INCLUDE)/no_os_util.h 		\
 		$(INCLUDE)/no_os_units.h		\
 		$(INCLUDE)/no_os_alloc.h		\
 		$(INCLUDE)/no_os_mutex.h		\
+		$(INCLUDE)/no_os_spsc_ring.h	\
 		$(INCLUDE)/no_os_lf256fifo.h	\
 		$(INCLUDE)/no_os_print_log.h 	\
 		$(INCLUDE)/no_os_crc8.h			\
+		$(INCLUDE)/no_os_crc_engine.h			\
 		$(INCLUDE)/no_os_irq.h			\
 		$(INCLUDE)/no_os_dma.h      	\
 		$(INCLUDE)/no_os_uart.h     	\
@@ -29,11 +32,15 @@ INCS += $(INCLUDE)/no_os_delay.h		\
 		
 
 SRCS += $(NO-OS)/util/no_os_util.c		\
+		$(NO-OS)/util/no_os_pool.c		\
 		$(NO-OS)/util/no_os_list.c		\
 		$(NO-OS)/util/no_os_alloc.c		\
 		$(NO-OS)/util/no_os_mutex.c		\
+		$(NO-OS)/util/no_os_spsc_ring.c	\
 		$(NO-OS)/util/no_os_lf256fifo.c	\
 		$(NO-OS)/util/no_os_crc8.c		\
+		$(NO-OS)/util/no_os_crc_engine.c		\
+		$(NO-OS)/util/no_os_crc_tables.c		\
 		$(DRIVERS)/api/no_os_irq.c		\
 		$(DRIVERS)/api/no_os_dma.c	 	\
 		$(DRIVERS)/api/no_os_uart.c		\
@@ -17,6 +17,7 @@ SRCS += $(NO-OS)/iio/iio_app/iio_app.c	\
 	$(DRIVERS)/power/lt8722/iio_lt8722.c	\
 	$(NO-OS)/iio/iio.c	\
 	$(NO-OS)/iio/iiod.c	\
+	$(NO-OS)/util/no_os_pool.c \
 	$(NO-OS)/util/no_os_fifo.c
 
 INCS += $(NO-OS)/iio/iio_app/iio_app.h	\
@@ -24,5 +25,6 @@ INCS += $(NO-OS)/iio/iio_app/iio_app.h	\
 	$(NO-OS)/iio/iio.h	\
 	$(NO-OS)/iio/iiod.h	\
 	$(NO-OS)/iio/iio_types.h	\
+	$(NO-OS)/include/no_os_pool.h \
 	$(NO-OS)/include/no_os_fifo.h
 endif
@@ -17,5 +17,6 @@ INCS += $(DRIVERS)/temperature/ltc2983/iio_ltc2983.h
 SRCS += $(DRIVERS)/temperature/ltc2983/iio_ltc2983.c
 
 INCS += $(INCLUDE)/no_os_list.h \
+		$(INCLUDE)/no_os_pool.h \
 		$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
 endif
@@ -5,4 +5,5 @@ INCS += $(PROJECT)/src/examples/basic/basic_example.h
 endif
 
 INCS += $(INCLUDE)/no_os_list.h \
+		$(INCLUDE)/no_os_pool.h \
 		$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
@@ -18,9 +18,11 @@ INCS += $(INCLUDE)/no_os_delay.h		\
 	$(INCLUDE)/no_os_gpio.h			\
 	$(INCLUDE)/no_os_alloc.h		\
 	$(INCLUDE)/no_os_irq.h			\
+	$(INCLUDE)/no_os_pool.h			\
 	$(INCLUDE)/no_os_list.h			\
 	$(INCLUDE)/no_os_dma.h			\
 	$(INCLUDE)/no_os_uart.h			\
+	$(INCLUDE)/no_os_spsc_ring.h		\
 	$(INCLUDE)/no_os_lf256fifo.h		\
 	$(INCLUDE)/no_os_util.h			\
 	$(INCLUDE)/no_os_units.h		\
@@ -31,8 +33,10 @@ SRCS += $(DRIVERS)/api/no_os_spi.c		\
 	$(DRIVERS)/api/no_os_irq.c		\
 	$(DRIVERS)/api/no_os_gpio.c		\
 	$(DRIVERS)/api/no_os_dma.c		\
+	$(NO-OS)/util/no_os_pool.c		\
 	$(NO-OS)/util/no_os_list.c		\
 	$(NO-OS)/util/no_os_alloc.c		\
+	$(NO-OS)/util/no_os_spsc_ring.c		\
 	$(NO-OS)/util/no_os_lf256fifo.c		\
 	$(NO-OS)/util/no_os_mutex.c		\
 	$(NO-OS)/util/no_os_util.c		
@@ -17,5 +17,6 @@ INCS += $(DRIVERS)/temperature/max31827/iio_max31827.h
 SRCS += $(DRIVERS)/temperature/max31827/iio_max31827.c
 
 INCS += $(INCLUDE)/no_os_list.h \
+		$(INCLUDE)/no_os_pool.h \
 		$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
 endif
@@ -17,5 +17,6 @@ INCS += $(DRIVERS)/temperature/max31855/iio_max31855.h
 SRCS += $(DRIVERS)/temperature/max31855/iio_max31855.c 
 
 INCS += $(INCLUDE)/no_os_list.h \
+		$(INCLUDE)/no_os_pool.h \
 		$(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
 endif
@@ -17,12 +17,16 @@ SRCS += $(DRIVERS)/api/no_os_uart.c     \
 	$(DRIVERS)/api/no_os_timer.c     	\
 	$(DRIVERS)/api/no_os_dma.c     	\
 	$(DRIVERS)/api/no_os_i2c.c  \
+        $(NO-OS)/util/no_os_pool.c      \
         $(NO-OS)/util/no_os_list.c      \
+        $(NO-OS)/util/no_os_spsc_ring.c \
         $(NO-OS)/util/no_os_lf256fifo.c \
         $(NO-OS)/util/no_os_util.c      \
         $(NO-OS)/util/no_os_alloc.c     \
         $(NO-OS)/util/no_os_mutex.c     \
-        $(NO-OS)/util/no_os_crc8.c
+        $(NO-OS)/util/no_os_crc8.c \
+        $(NO-OS)/util/no_os_crc_engine.c \
+        $(NO-OS)/util/no_os_crc_tables.c
 
 INCS += $(INCLUDE)/no_os_delay.h     \
         $(INCLUDE)/no_os_error.h     \
@@ -31,14 +35,17 @@ INCS += $(INCLUDE)/no_os_delay.h     \
         $(INCLUDE)/no_os_gpio.h      \
         $(INCLUDE)/no_os_irq.h       \
         $(INCLUDE)/no_os_dma.h       \
+        $(INCLUDE)/no_os_spsc_ring.h \
         $(INCLUDE)/no_os_lf256fifo.h \
+        $(INCLUDE)/no_os_pool.h      \
         $(INCLUDE)/no_os_list.h      \
         $(INCLUDE)/no_os_uart.h      \
         $(INCLUDE)/no_os_util.h      \
 	$(INCLUDE)/no_os_i2c.h       \
         $(INCLUDE)/no_os_alloc.h     \
         $(INCLUDE)/no_os_mutex.h     \
-        $(INCLUDE)/no_os_crc8.h
+        $(INCLUDE)/no_os_crc8.h \
+        $(INCLUDE)/no_os_crc_engine.h
 
 INCS += $(DRIVERS)/power/max42500/max42500.h
 SRCS += $(DRIVERS)/power/max42500/max42500.c
@@ -31,4 +31,5 @@ INCS += $(DRIVERS)/adc/pulsar_adc/pulsar_adc.h
 SRCS += $(DRIVERS)/adc/pulsar_adc/pulsar_adc.c
 
 INCS += $(INCLUDE)/no_os_list.h \
+        $(INCLUDE)/no_os_pool.h \
         $(PLATFORM_DRIVERS)/$(PLATFORM)_uart.h
@@ -34,11 +34,15 @@ SRCS += $(DRIVERS)/api/no_os_gpio.c \
 	$(DRIVERS)/net/iio_max24287.c \
 	$(DRIVERS)/adc/adm1177/adm1177.c \
 	$(DRIVERS)/adc/adm1177/iio_adm1177.c \
+	$(NO-OS)/util/no_os_spsc_ring.c \
 	$(NO-OS)/util/no_os_lf256fifo.c \
 	$(NO-OS)/util/no_os_util.c \
 	$(NO-OS)/util/no_os_alloc.c \
+	$(NO-OS)/util/no_os_pool.c \
 	$(NO-OS)/util/no_os_list.c \
 	$(NO-OS)/util/no_os_crc8.c \
+	$(NO-OS)/util/no_os_crc_engine.c \
+	$(NO-OS)/util/no_os_crc_tables.c \
 	$(NO-OS)/util/no_os_pid.c \
 	$(NO-OS)/util/no_os_mutex.c \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_delay.c
@@ -73,12 +77,15 @@ INCS += $(INCLUDE)/no_os_gpio.h \
 	$(INCLUDE)/no_os_util.h \
 	$(INCLUDE)/no_os_alloc.h \
 	$(INCLUDE)/no_os_units.h \
+	$(INCLUDE)/no_os_pool.h \
 	$(INCLUDE)/no_os_list.h \
 	$(INCLUDE)/no_os_crc8.h \
+	$(INCLUDE)/no_os_crc_engine.h \
 	$(INCLUDE)/no_os_pid.h \
 	$(INCLUDE)/no_os_print_log.h \
 	$(INCLUDE)/no_os_delay.h \
 	$(PLATFORM_DRIVERS)/$(PLATFORM)_delay.h \
+	$(INCLUDE)/no_os_spsc_ring.h \
 	$(INCLUDE)/no_os_lf256fifo.h \
 	$(INCLUDE)/no_os_mutex.h
 
@@ -0,0 +1,283 @@
+/***************************************************************************//**
+ *   @file   test_ad9361_regcache.c
+ *   @brief  Unit tests of the AD9361 register cache
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "ad9361.h"
+#include "ad9361_api.h"
+#include "ad9361_util.h"
+#include "no_os_spi.h"
+#include "no_os_mutex.h"
+#include "no_os_alloc.h"
+#include "no_os_util.h"
+#include "mock_no_os_delay.h"
+#include "mock_no_os_gpio.h"
+#include "mock_axi_adc_core.h"
+#include <string.h>
+
+TEST_FILE("ad9361_conv.c")
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+#define MODEL_NB_REGS		0x400
+#define TEST_REFCLK_HZ		40000000
+#define TEST_LO_HZ		2400000000ULL
+/* Same gain table band as TEST_LO_HZ, only the synthesizer words change */
+#define TEST_RETUNE_LO_HZ	2410000000ULL
+#define TEST_GAIN_DB		30
+#define TEST_RETUNE_GAIN_DB	40
+
+extern struct gain_table_info ad9361_adi_gt_info[];
+
+/*
+ * Register model of the AD9361. Every SPI transfer is counted, the VCO lock
+ * bits always read back as set so the synthesizers lock on the first poll.
+ */
+static struct ad9361_model {
+	uint8_t regs[MODEL_NB_REGS];
+	uint32_t nb_xfers;
+} model;
+
+static struct no_os_spibus_desc spi_bus;
+static struct no_os_spi_desc spi_desc;
+static struct no_os_clk refin;
+static struct ad9361_rf_phy *phy;
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+/* Decode the 16 bit instruction word, multi byte accesses count downwards */
+static int32_t model_write_and_read(struct no_os_spi_desc *desc,
+				    uint8_t *data, uint16_t bytes_number)
+{
+	uint16_t cmd = (data[0] << 8) | data[1];
+	uint32_t reg = cmd & 0x3FF;
+	uint16_t i;
+
+	model.nb_xfers++;
+	for (i = 2; i < bytes_number; i++, reg--) {
+		if (cmd & 0x8000) {
+			model.regs[reg] = data[i];
+			continue;
+		}
+		data[i] = model.regs[reg];
+		if (reg == REG_RX_CP_OVERRANGE_VCO_LOCK ||
+		    reg == REG_TX_CP_OVERRANGE_VCO_LOCK)
+			data[i] |= VCO_LOCK;
+	}
+
+	return 0;
+}
+
+static const struct no_os_spi_platform_ops model_spi_ops = {
+	.write_and_read = model_write_and_read,
+};
+
+static struct ad9361_rf_phy *phy_create(bool cached)
+{
+	struct ad9361_rf_phy *p;
+
+	p = no_os_calloc(1, sizeof(*p));
+	TEST_ASSERT_NOT_NULL(p);
+	p->pdata = no_os_calloc(1, sizeof(*p->pdata));
+	TEST_ASSERT_NOT_NULL(p->pdata);
+
+	p->spi = &spi_desc;
+	p->clk_refin = &refin;
+	p->gt_info = ad9361_adi_gt_info;
+	p->current_table = -1;
+	p->pdata->rx2tx2 = true;
+
+	if (cached)
+		TEST_ASSERT_EQUAL_INT(0, ad9361_regcache_init(p));
+
+	TEST_ASSERT_EQUAL_INT(0, ad9361_register_clocks(p));
+	TEST_ASSERT_EQUAL_INT(0, no_os_clk_set_rate(p,
+			      p->ref_clk_scale[RX_REFCLK], TEST_REFCLK_HZ));
+
+	return p;
+}
+
+static void phy_destroy(struct ad9361_rf_phy *p)
+{
+	ad9361_regcache_remove(p);
+	ad9361_unregister_clocks(p);
+	no_os_free(p->pdata);
+	no_os_free(p);
+}
+
+static uint32_t stats_transfers(const struct ad9361_regcache_stats *s)
+{
+	return s->spi_reads + s->spi_writes;
+}
+
+static uint32_t stats_saved(const struct ad9361_regcache_stats *s)
+{
+	return s->reads_saved + s->writes_saved;
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	memset(&model, 0, sizeof(model));
+	spi_desc.bus = &spi_bus;
+	spi_desc.platform_ops = &model_spi_ops;
+	refin.rate = TEST_REFCLK_HZ;
+	phy = NULL;
+
+	no_os_udelay_Ignore();
+	no_os_mdelay_Ignore();
+}
+
+void tearDown(void)
+{
+	if (phy)
+		phy_destroy(phy);
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+void test_ad9361_regcache_init_remove(void)
+{
+	struct ad9361_regcache_stats stats;
+
+	phy = phy_create(false);
+	TEST_ASSERT_EQUAL_INT(-ENODEV, ad9361_regcache_get_stats(phy, &stats));
+
+	TEST_ASSERT_EQUAL_INT(0, ad9361_regcache_init(phy));
+	TEST_ASSERT_NOT_NULL(phy->regcache);
+	TEST_ASSERT_EQUAL_INT(0, ad9361_regcache_get_stats(phy, &stats));
+
+	ad9361_regcache_remove(phy);
+	TEST_ASSERT_NULL(phy->regcache);
+	TEST_ASSERT_EQUAL_INT(-ENODEV, ad9361_regcache_get_stats(phy, &stats));
+}
+
+void test_ad9361_regcache_rx_lo_freq(void)
+{
+	uint8_t expected[MODEL_NB_REGS];
+	struct ad9361_regcache_stats before, after;
+	uint32_t uncached, cached, start;
+
+	/* Reference run straight to the hardware */
+	phy = phy_create(false);
+	TEST_ASSERT_EQUAL_INT(0, ad9361_set_rx_lo_freq(phy, TEST_LO_HZ));
+	start = model.nb_xfers;
+	TEST_ASSERT_EQUAL_INT(0, ad9361_set_rx_lo_freq(phy, TEST_RETUNE_LO_HZ));
+	uncached = model.nb_xfers - start;
+	memcpy(expected, model.regs, sizeof(expected));
+	phy_destroy(phy);
+
+	memset(&model, 0, sizeof(model));
+	phy = phy_create(true);
+	TEST_ASSERT_EQUAL_INT(0, ad9361_set_rx_lo_freq(phy, TEST_LO_HZ));
+	TEST_ASSERT_EQUAL_INT(0, ad9361_regcache_get_stats(phy, &before));
+	start = model.nb_xfers;
+	TEST_ASSERT_EQUAL_INT(0, ad9361_set_rx_lo_freq(phy, TEST_RETUNE_LO_HZ));
+	cached = model.nb_xfers - start;
+	TEST_ASSERT_EQUAL_INT(0, ad9361_regcache_get_stats(phy, &after));
+
+	/* The cache must not change what ends up in the device */
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, model.regs, MODEL_NB_REGS);
+
+	/* Every transfer on the bus is accounted for */
+	TEST_ASSERT_EQUAL_UINT32(cached,
+				 stats_transfers(&after) -
+				 stats_transfers(&before));
+	/* and every access the cache absorbed is one less transfer */
+	TEST_ASSERT_GREATER_THAN_UINT32(before.reads_saved, after.reads_saved);
+	TEST_ASSERT_GREATER_THAN_UINT32(before.writes_saved,
+					after.writes_saved);
+	TEST_ASSERT_EQUAL_UINT32(uncached - cached,
+				 stats_saved(&after) - stats_saved(&before));
+}
+
+void test_ad9361_regcache_rx_rf_gain(void)
+{
+	uint8_t expected[MODEL_NB_REGS];
+	struct ad9361_regcache_stats before, after;
+	uint32_t uncached, cached, start;
+
+	/* The gain update needs the gain table of the LO band */
+	phy = phy_create(false);
+	TEST_ASSERT_EQUAL_INT(0, ad9361_set_rx_lo_freq(phy, TEST_LO_HZ));
+	TEST_ASSERT_EQUAL_INT(0, ad9361_set_rx_rf_gain(phy, 0, TEST_GAIN_DB));
+	start = model.nb_xfers;
+	TEST_ASSERT_EQUAL_INT(0, ad9361_set_rx_rf_gain(phy, 0, TEST_GAIN_DB));
+	TEST_ASSERT_EQUAL_INT(0, ad9361_set_rx_rf_gain(phy, 0,
+			      TEST_RETUNE_GAIN_DB));
+	uncached = model.nb_xfers - start;
+	memcpy(expected, model.regs, sizeof(expected));
+	phy_destroy(phy);
+
+	memset(&model, 0, sizeof(model));
+	phy = phy_create(true);
+	TEST_ASSERT_EQUAL_INT(0, ad9361_set_rx_lo_freq(phy, TEST_LO_HZ));
+	TEST_ASSERT_EQUAL_INT(0, ad9361_set_rx_rf_gain(phy, 0, TEST_GAIN_DB));
+
+	/* Setting the same gain again is served from the cache */
+	TEST_ASSERT_EQUAL_INT(0, ad9361_regcache_get_stats(phy, &before));
+	start = model.nb_xfers;
+	TEST_ASSERT_EQUAL_INT(0, ad9361_set_rx_rf_gain(phy, 0, TEST_GAIN_DB));
+	TEST_ASSERT_EQUAL_UINT32(start, model.nb_xfers);
+	TEST_ASSERT_EQUAL_INT(0, ad9361_regcache_get_stats(phy, &after));
+	TEST_ASSERT_GREATER_THAN_UINT32(before.writes_saved,
+					after.writes_saved);
+
+	/* A new gain only writes the index */
+	TEST_ASSERT_EQUAL_INT(0, ad9361_set_rx_rf_gain(phy, 0,
+			      TEST_RETUNE_GAIN_DB));
+	cached = model.nb_xfers - start;
+	TEST_ASSERT_EQUAL_INT(0, ad9361_regcache_get_stats(phy, &after));
+
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, model.regs, MODEL_NB_REGS);
+	TEST_ASSERT_EQUAL_UINT32(cached,
+				 stats_transfers(&after) -
+				 stats_transfers(&before));
+	TEST_ASSERT_LESS_THAN_UINT32(uncached, cached);
+	TEST_ASSERT_EQUAL_UINT32(uncached - cached,
+				 stats_saved(&after) - stats_saved(&before));
+}
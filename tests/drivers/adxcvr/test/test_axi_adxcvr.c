@@ -0,0 +1,509 @@
+/***************************************************************************//**
+ *   @file   test_axi_adxcvr.c
+ *   @brief  Unit tests of the ADXCVR batched and broadcast DRP writes
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "axi_adxcvr.h"
+#include "xilinx_transceiver.h"
+#include "no_os_alloc.h"
+#include "no_os_util.h"
+#include "mock_no_os_axi_io.h"
+#include "mock_no_os_delay.h"
+#include "mock_no_os_clk.h"
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+#define MODEL_BASE		0x44a60000
+#define MODEL_MAX_LANES		16
+#define MODEL_DRP_REGS		0x1000
+/* Legacy (1.0) core, the transceiver type comes from the SYNTH register */
+#define MODEL_VERSION		0x00100000
+
+#define MODEL_REG_VERSION	0x0000
+#define MODEL_REG_SYNTH		0x0024
+#define MODEL_REG_DRP_SEL	0x0040
+#define MODEL_REG_DRP_CTRL	0x0044
+#define MODEL_REG_DRP_STATUS	0x0048
+#define MODEL_DRP_CHANNEL	0x20
+#define MODEL_DRP_WR		NO_OS_BIT(28)
+#define MODEL_DRP_BUSY		NO_OS_BIT(16)
+
+/*
+ * Software model of the ADXCVR DRP interfaces. Index 0 is the common (QPLL)
+ * interface, index 1 the channel interface. A write with the broadcast
+ * select goes to every lane of the link, unless the model plays a core without
+ * broadcast support, which writes nothing. The status register reports busy
+ * for busy_polls reads after every access, then the read data.
+ */
+static struct adxcvr_model {
+	uint16_t regs[2][MODEL_MAX_LANES][MODEL_DRP_REGS];
+	uint32_t sel[2];
+	uint32_t addr[2];
+	uint32_t busy[2];
+	uint32_t busy_polls;
+	uint32_t synth;
+	bool broadcast;
+	uint32_t nb_reads;
+	uint32_t nb_writes;
+	uint32_t nb_broadcasts;
+	uint32_t sleep_ms;
+} model;
+
+/* DRP contents written by the lane by lane reference */
+static uint16_t ref_regs[2][MODEL_MAX_LANES][MODEL_DRP_REGS];
+
+struct xcvr_config {
+	const char *name;
+	uint32_t legacy_type;
+	uint32_t sys_clk_sel;
+	uint32_t out_clk_sel;
+	uint32_t lane_rate_khz;
+	uint32_t ref_rate_khz;
+	/* AXI accesses of one RX set_rate, per lane and batched, 8/16 lanes */
+	uint32_t per_lane_axi[2];
+	uint32_t batched_axi[2];
+};
+
+static const struct xcvr_config configs[] = {
+	{
+		"GTH4 CPLL", XILINX_XCVR_LEGACY_TYPE_US_GTH4,
+		ADXCVR_SYS_CLK_CPLL, ADXCVR_REFCLK, 5000000, 125000,
+		{ 288, 576 }, { 204, 396 },
+	}, {
+		"GTY4 QPLL0 PROGDIV", XILINX_XCVR_LEGACY_TYPE_US_GTY4,
+		ADXCVR_SYS_CLK_QPLL0, ADXCVR_PROGDIV_CLK, 10000000, 250000,
+		{ 318, 636 }, { 234, 456 },
+	}, {
+		"GTX2 QPLL", XILINX_XCVR_LEGACY_TYPE_S7_GTX2,
+		ADXCVR_SYS_CLK_QPLL0, ADXCVR_REFCLK, 10000000, 250000,
+		{ 480, 960 }, { 333, 645 },
+	},
+};
+
+static const uint32_t lane_counts[] = { 8, 16 };
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+static int32_t model_read(uint32_t base, uint32_t offset, uint32_t *data,
+			  int num_calls)
+{
+	uint32_t i = (offset & MODEL_DRP_CHANNEL) ? 1 : 0;
+	uint32_t sel;
+
+	TEST_ASSERT_EQUAL_UINT32(MODEL_BASE, base);
+
+	model.nb_reads++;
+	if (offset == MODEL_REG_VERSION) {
+		*data = MODEL_VERSION;
+		return 0;
+	}
+	if (offset == MODEL_REG_SYNTH) {
+		*data = model.synth;
+		return 0;
+	}
+
+	switch (offset & ~MODEL_DRP_CHANNEL) {
+	case MODEL_REG_DRP_STATUS:
+		if (model.busy[i]) {
+			model.busy[i]--;
+			*data = MODEL_DRP_BUSY;
+			break;
+		}
+		/* Nothing is read back through the broadcast select */
+		sel = model.sel[i];
+		if (sel == ADXCVR_BROADCAST) {
+			*data = 0;
+			break;
+		}
+		TEST_ASSERT_LESS_THAN_UINT32(MODEL_MAX_LANES, sel);
+		*data = model.regs[i][sel][model.addr[i]];
+		break;
+	default:
+		*data = 0;
+		break;
+	}
+
+	return 0;
+}
+
+static int32_t model_write(uint32_t base, uint32_t offset, uint32_t data,
+			   int num_calls)
+{
+	uint32_t i = (offset & MODEL_DRP_CHANNEL) ? 1 : 0;
+	uint32_t lane;
+
+	TEST_ASSERT_EQUAL_UINT32(MODEL_BASE, base);
+
+	model.nb_writes++;
+	switch (offset & ~MODEL_DRP_CHANNEL) {
+	case MODEL_REG_DRP_SEL:
+		model.sel[i] = data & 0xff;
+		break;
+	case MODEL_REG_DRP_CTRL:
+		model.addr[i] = (data >> 16) & 0xfff;
+		model.busy[i] = model.busy_polls;
+		if (!(data & MODEL_DRP_WR))
+			break;
+
+		if (i && model.sel[i] == ADXCVR_BROADCAST) {
+			model.nb_broadcasts++;
+			if (!model.broadcast)
+				break;
+			for (lane = 0; lane < (model.synth & 0xff); lane++)
+				model.regs[i][lane][model.addr[i]] = data;
+			break;
+		}
+
+		TEST_ASSERT_LESS_THAN_UINT32(MODEL_MAX_LANES, model.sel[i]);
+		model.regs[i][model.sel[i]][model.addr[i]] = data;
+		break;
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+static void model_mdelay(uint32_t msecs, int num_calls)
+{
+	model.sleep_ms += msecs;
+}
+
+/*
+ * Fill the DRP space with a pattern. With vary_lanes, the odd registers start
+ * from different contents on every lane, so their partial updates can't be
+ * broadcast.
+ */
+static void model_seed(bool vary_lanes)
+{
+	uint32_t i, lane, reg, val;
+
+	for (i = 0; i < 2; i++)
+		for (lane = 0; lane < MODEL_MAX_LANES; lane++)
+			for (reg = 0; reg < MODEL_DRP_REGS; reg++) {
+				val = reg * 0x9e37 + i * 7;
+				if (vary_lanes && (reg & 1))
+					val += lane * 0x1111;
+				model.regs[i][lane][reg] = val;
+			}
+}
+
+static void model_reset_counters(void)
+{
+	model.nb_reads = 0;
+	model.nb_writes = 0;
+	model.nb_broadcasts = 0;
+	model.sleep_ms = 0;
+}
+
+static struct adxcvr *xcvr_create(const struct xcvr_config *cfg,
+				  uint32_t num_lanes, bool set_rate)
+{
+	struct adxcvr_init init = {
+		.name = "test_xcvr",
+		.base = MODEL_BASE,
+		.sys_clk_sel = cfg->sys_clk_sel,
+		.out_clk_sel = cfg->out_clk_sel,
+		.lpm_enable = true,
+	};
+	struct adxcvr *xcvr;
+
+	if (set_rate) {
+		init.lane_rate_khz = cfg->lane_rate_khz;
+		init.ref_rate_khz = cfg->ref_rate_khz;
+	}
+
+	/* RX link with a QPLL */
+	model.synth = num_lanes | (cfg->legacy_type << 16) | NO_OS_BIT(20);
+
+	TEST_ASSERT_EQUAL_INT32(0, adxcvr_init(&xcvr, &init));
+	TEST_ASSERT_EQUAL_UINT32(num_lanes, xcvr->num_lanes);
+	TEST_ASSERT_FALSE(xcvr->tx_enable);
+
+	return xcvr;
+}
+
+/* Lane by lane LPM/DFE setup, as done by adxcvr_init() before batching */
+static void ref_lpm_dfe_mode(struct adxcvr *xcvr)
+{
+	struct xilinx_xcvr *xlx = &xcvr->xlx_xcvr;
+	uint32_t i;
+	int ret;
+
+	for (i = 0; i < xcvr->num_lanes; i++) {
+		ret = xilinx_xcvr_configure_lpm_dfe_mode(xlx,
+				ADXCVR_DRP_PORT_CHANNEL(i), xcvr->lpm_enable);
+		TEST_ASSERT_EQUAL_INT(0, ret);
+	}
+}
+
+/*
+ * Lane by lane RX set_rate, as done before the DRP writes were batched:
+ * every writer goes straight to the DRP since no batch is open.
+ */
+static void ref_set_rate(struct adxcvr *xcvr, uint32_t rate,
+			 uint32_t parent_rate)
+{
+	struct xilinx_xcvr *xlx = &xcvr->xlx_xcvr;
+	struct xilinx_xcvr_cpll_config cpll_conf;
+	struct xilinx_xcvr_qpll_config qpll_conf;
+	uint32_t out_div, prog_div, div, clk25_div;
+	uint32_t i, port;
+	int ret;
+
+	clk25_div = NO_OS_DIV_ROUND_CLOSEST(parent_rate, 25000);
+
+	if (xcvr->cpll_enable)
+		ret = xilinx_xcvr_calc_cpll_config(xlx, parent_rate, rate,
+						   &cpll_conf, &out_div);
+	else
+		ret = xilinx_xcvr_calc_qpll_config(xlx, xcvr->sys_clk_sel,
+						   parent_rate, rate,
+						   &qpll_conf, &out_div);
+	TEST_ASSERT_EQUAL_INT(0, ret);
+
+	for (i = 0; i < xcvr->num_lanes; i++) {
+		port = ADXCVR_DRP_PORT_CHANNEL(i);
+
+		ret = 0;
+		if (xcvr->cpll_enable)
+			ret = xilinx_xcvr_cpll_write_config(xlx, port,
+							    &cpll_conf);
+		else if (i % 4 == 0)
+			ret = xilinx_xcvr_qpll_write_config(xlx,
+					xcvr->sys_clk_sel,
+					ADXCVR_DRP_PORT_COMMON(i), &qpll_conf);
+		TEST_ASSERT_EQUAL_INT(0, ret);
+
+		ret = xilinx_xcvr_write_out_div(xlx, port, out_div, -1);
+		TEST_ASSERT_EQUAL_INT(0, ret);
+
+		if (xcvr->out_clk_sel == ADXCVR_PROGDIV_CLK) {
+			div = 1;
+			if (!xilinx_xcvr_write_prog_div_rate(xlx, port, 2, -1))
+				div = 2;
+			/* 8b10b, the prog_div fits the GTY4 range of 100 */
+			prog_div = NO_OS_DIV_ROUND_CLOSEST(40 * out_div,
+							   2 * div);
+			ret = xilinx_xcvr_write_prog_div(xlx, port, prog_div,
+							 -1);
+			TEST_ASSERT_EQUAL_INT(0, ret);
+		}
+
+		ret = xilinx_xcvr_configure_cdr(xlx, port, rate, out_div,
+						xcvr->lpm_enable);
+		TEST_ASSERT_EQUAL_INT(0, ret);
+
+		ret = xilinx_xcvr_write_rx_clk25_div(xlx, port, clk25_div);
+		TEST_ASSERT_EQUAL_INT(0, ret);
+	}
+}
+
+/*
+ * Configure the transceiver lane by lane, then through adxcvr_init() with a
+ * lane rate (batched LPM/DFE setup and set_rate) from the same starting
+ * contents. Both must leave the same DRP contents.
+ */
+static void check_matches_per_lane(const struct xcvr_config *cfg,
+				   uint32_t num_lanes, bool vary_lanes,
+				   bool broadcast)
+{
+	struct adxcvr *xcvr;
+
+	model.broadcast = broadcast;
+
+	/* adxcvr_init() without a lane rate only sets the LPM/DFE mode */
+	xcvr = xcvr_create(cfg, num_lanes, false);
+	model_seed(vary_lanes);
+	model_reset_counters();
+	ref_lpm_dfe_mode(xcvr);
+	ref_set_rate(xcvr, cfg->lane_rate_khz, cfg->ref_rate_khz);
+	TEST_ASSERT_EQUAL_UINT32(0, model.nb_broadcasts);
+	memcpy(ref_regs, model.regs, sizeof(ref_regs));
+	adxcvr_remove(xcvr);
+
+	model_seed(vary_lanes);
+	xcvr = xcvr_create(cfg, num_lanes, true);
+	TEST_ASSERT_EQUAL_UINT32(cfg->lane_rate_khz, xcvr->lane_rate_khz);
+	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(ref_regs, model.regs,
+					 sizeof(ref_regs), cfg->name);
+	TEST_ASSERT_NOT_EQUAL(0, model.nb_broadcasts);
+	TEST_ASSERT_EQUAL(!broadcast, xcvr->xlx_xcvr.drp_batch.no_broadcast);
+	adxcvr_remove(xcvr);
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	memset(&model, 0, sizeof(model));
+	model.broadcast = true;
+
+	no_os_axi_io_read_StubWithCallback(model_read);
+	no_os_axi_io_write_StubWithCallback(model_write);
+	no_os_mdelay_StubWithCallback(model_mdelay);
+	no_os_udelay_Ignore();
+}
+
+void tearDown(void) {}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+/* Every lane starts from the same contents, most writes are broadcast */
+void test_batched_matches_per_lane_equal_lanes(void)
+{
+	uint32_t c, l;
+
+	for (c = 0; c < NO_OS_ARRAY_SIZE(configs); c++)
+		for (l = 0; l < NO_OS_ARRAY_SIZE(lane_counts); l++)
+			check_matches_per_lane(&configs[c], lane_counts[l],
+					       false, true);
+}
+
+/* Partial updates of lanes with different contents are written per lane */
+void test_batched_matches_per_lane_different_lanes(void)
+{
+	uint32_t c, l;
+
+	for (c = 0; c < NO_OS_ARRAY_SIZE(configs); c++)
+		for (l = 0; l < NO_OS_ARRAY_SIZE(lane_counts); l++)
+			check_matches_per_lane(&configs[c], lane_counts[l],
+					       true, true);
+}
+
+/* A core ignoring the broadcast select is fixed up from the read back */
+void test_batched_matches_per_lane_without_broadcast(void)
+{
+	uint32_t c, l;
+
+	for (c = 0; c < NO_OS_ARRAY_SIZE(configs); c++)
+		for (l = 0; l < NO_OS_ARRAY_SIZE(lane_counts); l++) {
+			check_matches_per_lane(&configs[c], lane_counts[l],
+					       false, false);
+			check_matches_per_lane(&configs[c], lane_counts[l],
+					       true, false);
+		}
+}
+
+/* Once a broadcast missed a lane, the transceiver doesn't try it again */
+void test_no_broadcast_is_sticky(void)
+{
+	const struct xcvr_config *cfg = &configs[0];
+	struct adxcvr *xcvr;
+
+	model.broadcast = false;
+	model_seed(false);
+	xcvr = xcvr_create(cfg, 8, true);
+	TEST_ASSERT_TRUE(xcvr->xlx_xcvr.drp_batch.no_broadcast);
+
+	model_reset_counters();
+	TEST_ASSERT_EQUAL_INT(0, adxcvr_clk_set_rate(xcvr, cfg->lane_rate_khz,
+			      cfg->ref_rate_khz));
+	TEST_ASSERT_EQUAL_UINT32(0, model.nb_broadcasts);
+	adxcvr_remove(xcvr);
+}
+
+/* AXI accesses of one set_rate, lane by lane and batched */
+void test_set_rate_axi_accesses(void)
+{
+	const struct xcvr_config *cfg;
+	struct adxcvr *xcvr;
+	uint32_t c, l, per_lane, batched;
+	char msg[96];
+
+	for (c = 0; c < NO_OS_ARRAY_SIZE(configs); c++) {
+		cfg = &configs[c];
+		for (l = 0; l < NO_OS_ARRAY_SIZE(lane_counts); l++) {
+			model_seed(false);
+			xcvr = xcvr_create(cfg, lane_counts[l], false);
+
+			model_reset_counters();
+			ref_set_rate(xcvr, cfg->lane_rate_khz,
+				     cfg->ref_rate_khz);
+			per_lane = model.nb_reads + model.nb_writes;
+
+			model_reset_counters();
+			TEST_ASSERT_EQUAL_INT(0, adxcvr_clk_set_rate(xcvr,
+					      cfg->lane_rate_khz,
+					      cfg->ref_rate_khz));
+			batched = model.nb_reads + model.nb_writes;
+			adxcvr_remove(xcvr);
+
+			snprintf(msg, sizeof(msg),
+				 "%s, %u lanes: %u AXI accesses per lane, %u batched",
+				 cfg->name, (unsigned int)lane_counts[l],
+				 (unsigned int)per_lane, (unsigned int)batched);
+			TEST_MESSAGE(msg);
+			TEST_ASSERT_EQUAL_UINT32_MESSAGE(cfg->per_lane_axi[l],
+							 per_lane, msg);
+			TEST_ASSERT_EQUAL_UINT32_MESSAGE(cfg->batched_axi[l],
+							 batched, msg);
+		}
+	}
+}
+
+/* A busy DRP is polled, not waited for with 1 ms sleeps */
+void test_set_rate_busy_drp_does_not_sleep(void)
+{
+	const struct xcvr_config *cfg = &configs[0];
+	struct adxcvr *xcvr;
+
+	model_seed(false);
+	xcvr = xcvr_create(cfg, 16, false);
+
+	model.busy_polls = 2;
+	model_reset_counters();
+	TEST_ASSERT_EQUAL_INT(0, adxcvr_clk_set_rate(xcvr, cfg->lane_rate_khz,
+			      cfg->ref_rate_khz));
+	TEST_ASSERT_EQUAL_UINT32(0, model.sleep_ms);
+
+	/* A DRP that never gets idle still times out */
+	model.busy_polls = UINT32_MAX;
+	TEST_ASSERT_TRUE(adxcvr_clk_set_rate(xcvr, cfg->lane_rate_khz,
+					     cfg->ref_rate_khz) < 0);
+	TEST_ASSERT_NOT_EQUAL(0, model.sleep_ms);
+	adxcvr_remove(xcvr);
+}
@@ -0,0 +1,498 @@
+/***************************************************************************//**
+ *   @file   test_axi_dmac.c
+ *   @brief  Unit tests of the AXI DMAC transfer queue against a register model
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "axi_dmac.h"
+#include "no_os_alloc.h"
+#include "no_os_util.h"
+#include "mock_no_os_axi_io.h"
+#include "mock_no_os_delay.h"
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+#define MODEL_BASE		0x7c420000
+/* Largest burst the model accepts, X_LENGTH is 12 bits wide. */
+#define MODEL_MAX_LENGTH	0xfff
+/* Destination and source data paths are 64 bits wide. */
+#define MODEL_INTF_DESC		0x606
+#define MODEL_BYTES_PER_TICK	8
+/* One tick per register access, no_os_udelay(1) lasts this many ticks. */
+#define MODEL_TICKS_PER_US	10
+#define MODEL_MAX_BURSTS	256
+
+#define TEST_NB_XFERS		48
+
+/* Burst accepted by the model through AXI_DMAC_REG_TRANSFER_SUBMIT. */
+struct model_burst {
+	uint32_t id;
+	uint32_t dest;
+	uint32_t len;
+};
+
+/*
+ * Software model of a DEV_TO_MEM AXI DMAC: a 4 entry hardware queue, 2 bit
+ * transfer IDs, TRANSFER_DONE bits and the SOT/EOT interrupts. Time advances
+ * by one tick on each register access and on each microsecond of
+ * no_os_udelay(). The interrupt handler is called between two register
+ * accesses, as soon as an unmasked interrupt is pending, so it can preempt
+ * any driver code that touches the DMAC.
+ */
+static struct dmac_model {
+	uint32_t regs[0x500 / 4];
+	uint32_t irq_pending;
+	uint32_t next_id;
+	uint32_t done;
+	struct model_burst queue[AXI_DMAC_HW_QUEUE_DEPTH];
+	uint32_t queue_count;
+	uint32_t progress;
+	struct model_burst log[MODEL_MAX_BURSTS];
+	uint32_t nb_log;
+	uint32_t nb_done;
+	/* Ticks with an empty hardware queue while bursts are expected. */
+	uint32_t expected;
+	uint64_t ticks;
+	uint64_t idle_ticks;
+	/* Interrupt handler and the state of the line one access ago. */
+	void (*isr)(void *);
+	struct axi_dmac *dmac;
+	bool line;
+	bool in_isr;
+	uint32_t nb_isr;
+} model;
+
+static struct axi_dma_transfer xfers[TEST_NB_XFERS];
+static struct axi_dma_transfer *completed[TEST_NB_XFERS];
+static uint32_t nb_completed;
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+static uint32_t model_reg(uint32_t offset)
+{
+	return model.regs[offset / 4];
+}
+
+static void model_tick(void)
+{
+	struct model_burst *burst = &model.queue[0];
+
+	model.ticks++;
+	if (!(model_reg(AXI_DMAC_REG_CTRL) & AXI_DMAC_CTRL_ENABLE))
+		return;
+
+	if (!model.queue_count) {
+		if (model.nb_done < model.expected)
+			model.idle_ticks++;
+		return;
+	}
+
+	model.progress += MODEL_BYTES_PER_TICK;
+	if (model.progress < burst->len)
+		return;
+
+	model.done |= NO_OS_BIT(burst->id);
+	model.irq_pending |= AXI_DMAC_IRQ_EOT;
+	model.nb_done++;
+	model.progress = 0;
+	model.queue_count--;
+	memmove(&model.queue[0], &model.queue[1],
+		model.queue_count * sizeof(model.queue[0]));
+	if (model.queue_count)
+		model.irq_pending |= AXI_DMAC_IRQ_SOT;
+}
+
+/*
+ * An interrupt is taken when the line is asserted now or was asserted on the
+ * previous access, the latter being an interrupt already on its way to the
+ * CPU when the driver masked it.
+ */
+static void model_irq(void)
+{
+	bool line = model.irq_pending & ~model_reg(AXI_DMAC_REG_IRQ_MASK);
+	bool take = line || model.line;
+
+	model.line = line;
+	if (!model.isr || model.in_isr || !take)
+		return;
+
+	model.in_isr = true;
+	model.nb_isr++;
+	model.isr(model.dmac);
+	model.in_isr = false;
+}
+
+static void model_submit(void)
+{
+	struct model_burst *burst = &model.queue[model.queue_count];
+
+	if (model.queue_count == AXI_DMAC_HW_QUEUE_DEPTH)
+		return;
+
+	burst->id = model.next_id;
+	burst->dest = model_reg(AXI_DMAC_REG_DEST_ADDRESS);
+	burst->len = model_reg(AXI_DMAC_REG_X_LENGTH) + 1;
+	if (model.nb_log < MODEL_MAX_BURSTS)
+		model.log[model.nb_log++] = *burst;
+
+	model.done &= ~NO_OS_BIT(burst->id);
+	model.next_id = (model.next_id + 1) & AXI_DMAC_TRANSFER_ID_MASK;
+	if (!model.queue_count)
+		model.irq_pending |= AXI_DMAC_IRQ_SOT;
+	model.queue_count++;
+}
+
+static int32_t model_read(uint32_t base, uint32_t offset, uint32_t *data,
+			  int num_calls)
+{
+	TEST_ASSERT_EQUAL_UINT32(MODEL_BASE, base);
+
+	model_tick();
+	switch (offset) {
+	case AXI_DMAC_REG_IRQ_PENDING:
+		*data = model.irq_pending;
+		break;
+	case AXI_DMAC_REG_INTF_DESC:
+		*data = MODEL_INTF_DESC;
+		break;
+	case AXI_DMAC_REG_TRANSFER_ID:
+		*data = model.next_id;
+		break;
+	case AXI_DMAC_REG_TRANSFER_SUBMIT:
+		*data = model.queue_count == AXI_DMAC_HW_QUEUE_DEPTH ?
+			AXI_DMAC_QUEUE_FULL : 0;
+		break;
+	case AXI_DMAC_REG_SRC_ADDRESS:
+		/* The source is a device, not memory mapped. */
+		*data = 0;
+		break;
+	case AXI_DMAC_REG_X_LENGTH:
+		*data = model_reg(offset) & MODEL_MAX_LENGTH;
+		break;
+	case AXI_DMAC_REG_TRANSFER_DONE:
+		*data = model.done;
+		break;
+	default:
+		*data = model_reg(offset);
+		break;
+	}
+	model_irq();
+
+	return 0;
+}
+
+static int32_t model_write(uint32_t base, uint32_t offset, uint32_t data,
+			   int num_calls)
+{
+	TEST_ASSERT_EQUAL_UINT32(MODEL_BASE, base);
+
+	model_tick();
+	switch (offset) {
+	case AXI_DMAC_REG_IRQ_PENDING:
+		model.irq_pending &= ~data;
+		break;
+	case AXI_DMAC_REG_TRANSFER_SUBMIT:
+		if (data & AXI_DMAC_TRANSFER_SUBMIT)
+			model_submit();
+		break;
+	case AXI_DMAC_REG_CTRL:
+		model.regs[offset / 4] = data;
+		if (!(data & AXI_DMAC_CTRL_ENABLE)) {
+			model.queue_count = 0;
+			model.progress = 0;
+		}
+		break;
+	default:
+		model.regs[offset / 4] = data;
+		break;
+	}
+	model_irq();
+
+	return 0;
+}
+
+static void model_udelay(uint32_t usecs, int num_calls)
+{
+	uint32_t i;
+
+	for (i = 0; i < usecs * MODEL_TICKS_PER_US; i++) {
+		model_tick();
+		model_irq();
+	}
+}
+
+static void queue_complete(void *ctx, struct axi_dma_transfer *xfer)
+{
+	TEST_ASSERT_EQUAL_PTR(&model, ctx);
+	TEST_ASSERT_LESS_THAN_UINT32(TEST_NB_XFERS, nb_completed);
+	completed[nb_completed++] = xfer;
+}
+
+static struct axi_dmac *model_init(enum use_irq irq_option)
+{
+	struct axi_dmac_init init = {
+		.name = "rx_dmac",
+		.base = MODEL_BASE,
+		.irq_option = irq_option,
+	};
+	struct axi_dmac *dmac;
+
+	memset(&model, 0, sizeof(model));
+	memset(xfers, 0, sizeof(xfers));
+	nb_completed = 0;
+
+	no_os_axi_io_read_StubWithCallback(model_read);
+	no_os_axi_io_write_StubWithCallback(model_write);
+	no_os_udelay_StubWithCallback(model_udelay);
+
+	TEST_ASSERT_EQUAL_INT32(0, axi_dmac_init(&dmac, &init));
+	TEST_ASSERT_EQUAL_INT(DMA_DEV_TO_MEM, dmac->direction);
+	TEST_ASSERT_EQUAL_UINT32(MODEL_MAX_LENGTH, dmac->max_length);
+	model.dmac = dmac;
+
+	return dmac;
+}
+
+/* Sizes cycle through one, two and three bursts. */
+static uint32_t xfer_size(uint32_t i)
+{
+	return (i % 3 + 1) * 0xc00 + 8 * i;
+}
+
+/* Bursts done within a few register accesses, so EOT fires all the time. */
+static uint32_t xfer_size_short(uint32_t i)
+{
+	return (i % 8 + 1) * MODEL_BYTES_PER_TICK;
+}
+
+static uint32_t xfer_bursts(uint32_t size)
+{
+	return NO_OS_DIV_ROUND_UP(size, MODEL_MAX_LENGTH + 1);
+}
+
+/*
+ * Queue TEST_NB_XFERS transfers, waiting for the oldest one whenever the
+ * software queue is full, then wait for the remaining ones.
+ */
+static void run_queue(struct axi_dmac *dmac, uint32_t (*size)(uint32_t))
+{
+	uint32_t i, oldest = 0, dest = 0x10000000;
+	int32_t ret;
+
+	for (i = 0; i < TEST_NB_XFERS; i++) {
+		xfers[i].size = size(i);
+		xfers[i].dest_addr = dest;
+		dest += 0x10000;
+		model.expected += xfer_bursts(xfers[i].size);
+	}
+
+	TEST_ASSERT_EQUAL_INT32(0, axi_dmac_queue_start(dmac, queue_complete,
+				&model));
+	for (i = 0; i < TEST_NB_XFERS; i++) {
+		while ((ret = axi_dmac_queue_submit(dmac, &xfers[i])) == -EBUSY)
+			TEST_ASSERT_EQUAL_INT32(0, axi_dmac_queue_wait(dmac,
+						&xfers[oldest++], 100));
+		TEST_ASSERT_EQUAL_INT32(0, ret);
+	}
+	while (oldest < TEST_NB_XFERS)
+		TEST_ASSERT_EQUAL_INT32(0, axi_dmac_queue_wait(dmac,
+					&xfers[oldest++], 100));
+}
+
+/* Every transfer completes once, in order, and its bursts tile it. */
+static void check_queue(void)
+{
+	uint32_t i, b = 0, offset;
+
+	TEST_ASSERT_EQUAL_UINT32(TEST_NB_XFERS, nb_completed);
+	TEST_ASSERT_EQUAL_UINT32(model.expected, model.nb_log);
+	TEST_ASSERT_EQUAL_UINT32(model.expected, model.nb_done);
+	for (i = 0; i < TEST_NB_XFERS; i++) {
+		TEST_ASSERT_EQUAL_PTR(&xfers[i], completed[i]);
+		TEST_ASSERT_TRUE(xfers[i].transfer_done);
+		for (offset = 0; offset < xfers[i].size; b++) {
+			TEST_ASSERT_EQUAL_HEX32(xfers[i].dest_addr + offset,
+						model.log[b].dest);
+			TEST_ASSERT_LESS_OR_EQUAL_UINT32(MODEL_MAX_LENGTH + 1,
+							 model.log[b].len);
+			offset += model.log[b].len;
+		}
+		TEST_ASSERT_EQUAL_UINT32(xfers[i].size, offset);
+	}
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+void test_axi_dmac_queue_polled(void)
+{
+	struct axi_dmac *dmac = model_init(IRQ_DISABLED);
+
+	run_queue(dmac, xfer_size);
+	check_queue();
+	TEST_ASSERT_EQUAL_UINT32(0, model.nb_isr);
+
+	axi_dmac_remove(dmac);
+}
+
+/*
+ * The handler may fire between any two register accesses of submit, including
+ * right after the EOT interrupt was masked.
+ */
+void test_axi_dmac_queue_irq(void)
+{
+	struct axi_dmac *dmac = model_init(IRQ_ENABLED);
+
+	model.isr = axi_dmac_queue_isr;
+	run_queue(dmac, xfer_size);
+	check_queue();
+	TEST_ASSERT_NOT_EQUAL(0, model.nb_isr);
+	TEST_ASSERT_EQUAL_HEX32(AXI_DMAC_IRQ_SOT,
+				model_reg(AXI_DMAC_REG_IRQ_MASK));
+	TEST_ASSERT_FALSE(dmac->queue.busy);
+
+	axi_dmac_remove(dmac);
+}
+
+void test_axi_dmac_queue_irq_short(void)
+{
+	struct axi_dmac *dmac = model_init(IRQ_ENABLED);
+
+	model.isr = axi_dmac_queue_isr;
+	run_queue(dmac, xfer_size_short);
+	check_queue();
+
+	axi_dmac_remove(dmac);
+}
+
+void test_axi_dmac_queue_rejects(void)
+{
+	struct axi_dmac *dmac = model_init(IRQ_DISABLED);
+	struct axi_dma_transfer xfer = {
+		.size = 0x100,
+		.dest_addr = 0x10000004,
+	};
+
+	TEST_ASSERT_EQUAL_INT32(0, axi_dmac_queue_start(dmac, NULL, NULL));
+	/* Not aligned to the 64 bit destination data path. */
+	TEST_ASSERT_EQUAL_INT32(-EINVAL, axi_dmac_queue_submit(dmac, &xfer));
+	xfer.dest_addr = 0x10000000;
+	xfer.cyclic = CYCLIC;
+	TEST_ASSERT_EQUAL_INT32(-EINVAL, axi_dmac_queue_submit(dmac, &xfer));
+	xfer.cyclic = NO;
+	xfer.size = 0;
+	TEST_ASSERT_EQUAL_INT32(-EINVAL, axi_dmac_queue_submit(dmac, &xfer));
+	TEST_ASSERT_EQUAL_UINT32(0, model.nb_log);
+
+	axi_dmac_remove(dmac);
+}
+
+/*
+ * Hardware idle time between bursts, with the queue versus one
+ * axi_dmac_transfer_start()/axi_dmac_transfer_wait_completion() at a time.
+ */
+void test_axi_dmac_queue_benchmark(void)
+{
+	struct axi_dmac *dmac = model_init(IRQ_DISABLED);
+	uint64_t legacy_ticks, legacy_idle;
+	uint32_t i, oldest;
+	char msg[128];
+
+	for (i = 0; i < TEST_NB_XFERS; i++) {
+		xfers[i].size = 0x1000;
+		xfers[i].dest_addr = 0x10000000 + i * 0x1000;
+	}
+	model.expected = TEST_NB_XFERS;
+	for (i = 0; i < TEST_NB_XFERS; i++) {
+		TEST_ASSERT_EQUAL_INT32(0, axi_dmac_transfer_start(dmac,
+					&xfers[i]));
+		TEST_ASSERT_EQUAL_INT32(0,
+					axi_dmac_transfer_wait_completion(dmac,
+							100));
+	}
+	legacy_ticks = model.ticks;
+	legacy_idle = model.idle_ticks;
+	axi_dmac_remove(dmac);
+
+	dmac = model_init(IRQ_DISABLED);
+	for (i = 0; i < TEST_NB_XFERS; i++) {
+		xfers[i].size = 0x1000;
+		xfers[i].dest_addr = 0x10000000 + i * 0x1000;
+	}
+	model.expected = TEST_NB_XFERS;
+	TEST_ASSERT_EQUAL_INT32(0, axi_dmac_queue_start(dmac, NULL, NULL));
+	for (i = 0; i < TEST_NB_XFERS; i++) {
+		/* The oldest transfer still in the software queue. */
+		oldest = i - (AXI_DMAC_SW_QUEUE_DEPTH - 1);
+		while (axi_dmac_queue_submit(dmac, &xfers[i]) == -EBUSY)
+			TEST_ASSERT_EQUAL_INT32(0, axi_dmac_queue_wait(dmac,
+						&xfers[oldest], 100));
+	}
+	TEST_ASSERT_EQUAL_INT32(0, axi_dmac_queue_wait(dmac,
+				&xfers[TEST_NB_XFERS - 1], 100));
+
+	snprintf(msg, sizeof(msg),
+		 "%u x 4 KiB: start/wait %llu ticks (%llu idle), "
+		 "queue %llu ticks (%llu idle)",
+		 TEST_NB_XFERS, (unsigned long long)legacy_ticks,
+		 (unsigned long long)legacy_idle,
+		 (unsigned long long)model.ticks,
+		 (unsigned long long)model.idle_ticks);
+	TEST_MESSAGE(msg);
+	TEST_ASSERT_LESS_THAN_UINT64(legacy_idle, model.idle_ticks);
+	TEST_ASSERT_LESS_THAN_UINT64(legacy_ticks, model.ticks);
+
+	axi_dmac_remove(dmac);
+}
@@ -0,0 +1,463 @@
+/***************************************************************************//**
+ *   @file   test_linux_gpio.c
+ *   @brief  Unit tests of the Linux GPIO character device backend
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "no_os_gpio.h"
+#include "no_os_irq.h"
+#include "no_os_alloc.h"
+#include "no_os_util.h"
+#include "linux_gpio.h"
+#include "linux_gpio_irq.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <string.h>
+#include <unistd.h>
+#include <linux/gpio.h>
+
+TEST_FILE("linux_delay.c")
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+#define TEST_CHIP		2
+#define TEST_LINE		5
+#define TEST_IRQ_LINE		3
+#define TEST_CHIP_LINES		8
+#define MAX_EVENTS		4
+
+/*
+ * Model of a GPIO chip behind the character device. The chip is backed by
+ * /dev/null and every line request by a pipe, so that close(), poll() and
+ * read() work unchanged. Edge events are queued by writing them to the pipe.
+ */
+static struct gpio_chip_model {
+	char path[32];
+	int chip_fd;
+	uint32_t nb_lines;
+	/* Last line request and its pipe */
+	struct gpio_v2_line_request req;
+	int req_fd;
+	int event_fd;
+	/* Last configuration and values written to the request */
+	struct gpio_v2_line_config config;
+	struct gpio_v2_line_values set;
+	/* Flags and values of the requested lines */
+	uint64_t flags;
+	uint64_t bits;
+	uint32_t nb_ioctls;
+} chip;
+
+static struct {
+	struct no_os_irq_ctrl_desc *irq;
+	struct linux_gpio_irq_event events[MAX_EVENTS];
+	uint32_t nb_events;
+} irq_ctx;
+
+int __real_open(const char *path, int flags, ...);
+int __real_ioctl(int fd, unsigned long request, ...);
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+int __wrap_open(const char *path, int flags, ...)
+{
+	va_list args;
+	mode_t mode;
+
+	if (!strncmp(path, "/dev/gpiochip", strlen("/dev/gpiochip"))) {
+		strcpy(chip.path, path);
+		chip.chip_fd = __real_open("/dev/null", O_RDWR);
+		return chip.chip_fd;
+	}
+
+	va_start(args, flags);
+	mode = va_arg(args, int);
+	va_end(args);
+
+	return __real_open(path, flags, mode);
+}
+
+int __wrap_ioctl(int fd, unsigned long request, ...)
+{
+	struct gpio_v2_line_request *req;
+	struct gpio_v2_line_values *values;
+	struct gpio_v2_line_info *info;
+	struct gpiochip_info *chip_info;
+	int fds[2];
+	va_list args;
+	void *arg;
+
+	va_start(args, request);
+	arg = va_arg(args, void *);
+	va_end(args);
+
+	chip.nb_ioctls++;
+	switch (request) {
+	case GPIO_GET_CHIPINFO_IOCTL:
+		TEST_ASSERT_EQUAL_INT(chip.chip_fd, fd);
+		chip_info = arg;
+		chip_info->lines = chip.nb_lines;
+		return 0;
+	case GPIO_V2_GET_LINE_IOCTL:
+		TEST_ASSERT_EQUAL_INT(chip.chip_fd, fd);
+		TEST_ASSERT_EQUAL_INT(0, pipe(fds));
+		if (chip.event_fd >= 0)
+			close(chip.event_fd);
+		req = arg;
+		req->fd = fds[0];
+		chip.req = *req;
+		chip.req_fd = fds[0];
+		chip.event_fd = fds[1];
+		chip.flags = req->config.flags;
+		return 0;
+	case GPIO_V2_LINE_SET_CONFIG_IOCTL:
+		TEST_ASSERT_EQUAL_INT(chip.req_fd, fd);
+		memcpy(&chip.config, arg, sizeof(chip.config));
+		chip.flags = chip.config.flags;
+		return 0;
+	case GPIO_V2_LINE_SET_VALUES_IOCTL:
+		TEST_ASSERT_EQUAL_INT(chip.req_fd, fd);
+		values = arg;
+		chip.set = *values;
+		chip.bits = (chip.bits & ~values->mask) |
+			    (values->bits & values->mask);
+		return 0;
+	case GPIO_V2_LINE_GET_VALUES_IOCTL:
+		TEST_ASSERT_EQUAL_INT(chip.req_fd, fd);
+		values = arg;
+		values->bits = chip.bits & values->mask;
+		return 0;
+	case GPIO_V2_GET_LINEINFO_IOCTL:
+		TEST_ASSERT_EQUAL_INT(chip.chip_fd, fd);
+		info = arg;
+		TEST_ASSERT_EQUAL_UINT32(chip.req.offsets[0], info->offset);
+		info->flags = chip.flags;
+		return 0;
+	default:
+		errno = ENOTTY;
+		return -1;
+	}
+}
+
+/* Queue an edge event on the last requested line */
+static void chip_push_event(uint64_t timestamp_ns, bool rising,
+			    uint32_t seqno)
+{
+	struct gpio_v2_line_event ev;
+
+	memset(&ev, 0, sizeof(ev));
+	ev.timestamp_ns = timestamp_ns;
+	ev.id = rising ? GPIO_V2_LINE_EVENT_RISING_EDGE :
+		GPIO_V2_LINE_EVENT_FALLING_EDGE;
+	ev.offset = chip.req.offsets[0];
+	ev.seqno = seqno;
+	ev.line_seqno = seqno;
+
+	TEST_ASSERT_EQUAL_INT(sizeof(ev), write(chip.event_fd, &ev,
+						sizeof(ev)));
+}
+
+/* Record the event that triggered the callback, like an application would */
+static void irq_callback(void *ctx)
+{
+	TEST_ASSERT_EQUAL_PTR(&irq_ctx, ctx);
+	TEST_ASSERT_LESS_THAN_UINT32(MAX_EVENTS, irq_ctx.nb_events);
+	TEST_ASSERT_EQUAL_INT(0, linux_gpio_irq_get_event(irq_ctx.irq,
+			      TEST_IRQ_LINE,
+			      &irq_ctx.events[irq_ctx.nb_events]));
+	irq_ctx.nb_events++;
+}
+
+static struct no_os_gpio_desc *cdev_get(enum no_os_gpio_pull_up pull)
+{
+	struct no_os_gpio_init_param param = {
+		.port = TEST_CHIP,
+		.number = TEST_LINE,
+		.pull = pull,
+		.platform_ops = &linux_gpio_cdev_ops,
+	};
+	struct no_os_gpio_desc *desc;
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_gpio_get(&desc, &param));
+
+	return desc;
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	memset(&chip, 0, sizeof(chip));
+	chip.chip_fd = -1;
+	chip.req_fd = -1;
+	chip.event_fd = -1;
+	chip.nb_lines = TEST_CHIP_LINES;
+	memset(&irq_ctx, 0, sizeof(irq_ctx));
+}
+
+void tearDown(void)
+{
+	if (chip.event_fd >= 0)
+		close(chip.event_fd);
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+void test_linux_gpio_cdev_request(void)
+{
+	struct no_os_gpio_desc *desc;
+
+	desc = cdev_get(NO_OS_PULL_UP);
+	TEST_ASSERT_EQUAL_STRING("/dev/gpiochip2", chip.path);
+	TEST_ASSERT_EQUAL_UINT32(1, chip.req.num_lines);
+	TEST_ASSERT_EQUAL_UINT32(TEST_LINE, chip.req.offsets[0]);
+	TEST_ASSERT_EQUAL_STRING("no-os", chip.req.consumer);
+	/* The kernel only takes a bias together with a direction */
+	TEST_ASSERT_EQUAL_UINT64(GPIO_V2_LINE_FLAG_INPUT |
+				 GPIO_V2_LINE_FLAG_BIAS_PULL_UP,
+				 chip.req.config.flags);
+	TEST_ASSERT_EQUAL_UINT32(0, chip.req.config.num_attrs);
+	TEST_ASSERT_EQUAL_INT(0, no_os_gpio_remove(desc));
+
+	/* Without a pull configuration the line keeps its direction */
+	desc = cdev_get(NO_OS_PULL_NONE);
+	TEST_ASSERT_EQUAL_UINT64(0, chip.req.config.flags);
+	TEST_ASSERT_EQUAL_INT(0, no_os_gpio_remove(desc));
+}
+
+void test_linux_gpio_cdev_direction_value(void)
+{
+	struct no_os_gpio_desc *desc;
+	uint8_t val;
+
+	desc = cdev_get(NO_OS_PULL_DOWN);
+
+	/* Direction and value in a single SET_CONFIG, keeping the bias */
+	TEST_ASSERT_EQUAL_INT(0, no_os_gpio_direction_output(desc,
+			      NO_OS_GPIO_HIGH));
+	TEST_ASSERT_EQUAL_UINT64(GPIO_V2_LINE_FLAG_OUTPUT |
+				 GPIO_V2_LINE_FLAG_BIAS_PULL_DOWN,
+				 chip.config.flags);
+	TEST_ASSERT_EQUAL_UINT32(1, chip.config.num_attrs);
+	TEST_ASSERT_EQUAL_UINT32(GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES,
+				 chip.config.attrs[0].attr.id);
+	TEST_ASSERT_EQUAL_UINT64(1, chip.config.attrs[0].attr.values);
+	TEST_ASSERT_EQUAL_UINT64(1, chip.config.attrs[0].mask);
+	TEST_ASSERT_EQUAL_INT(0, no_os_gpio_get_direction(desc, &val));
+	TEST_ASSERT_EQUAL_UINT8(NO_OS_GPIO_OUT, val);
+
+	/* One ioctl per value access */
+	chip.nb_ioctls = 0;
+	TEST_ASSERT_EQUAL_INT(0, no_os_gpio_set_value(desc, NO_OS_GPIO_LOW));
+	TEST_ASSERT_EQUAL_UINT64(1, chip.set.mask);
+	TEST_ASSERT_EQUAL_UINT64(0, chip.set.bits);
+	TEST_ASSERT_EQUAL_INT(0, no_os_gpio_get_value(desc, &val));
+	TEST_ASSERT_EQUAL_UINT8(NO_OS_GPIO_LOW, val);
+	TEST_ASSERT_EQUAL_INT(0, no_os_gpio_set_value(desc, NO_OS_GPIO_HIGH));
+	TEST_ASSERT_EQUAL_UINT64(1, chip.set.bits);
+	TEST_ASSERT_EQUAL_INT(0, no_os_gpio_get_value(desc, &val));
+	TEST_ASSERT_EQUAL_UINT8(NO_OS_GPIO_HIGH, val);
+	TEST_ASSERT_EQUAL_UINT32(4, chip.nb_ioctls);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_gpio_direction_input(desc));
+	TEST_ASSERT_EQUAL_UINT64(GPIO_V2_LINE_FLAG_INPUT |
+				 GPIO_V2_LINE_FLAG_BIAS_PULL_DOWN,
+				 chip.config.flags);
+	TEST_ASSERT_EQUAL_UINT32(0, chip.config.num_attrs);
+	TEST_ASSERT_EQUAL_INT(0, no_os_gpio_get_direction(desc, &val));
+	TEST_ASSERT_EQUAL_UINT8(NO_OS_GPIO_IN, val);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_gpio_remove(desc));
+}
+
+void test_linux_gpio_lines_request(void)
+{
+	const uint32_t offsets[] = {4, 9, 2};
+	struct linux_gpio_lines_init_param param = {
+		.chip = 1,
+		.offsets = offsets,
+		.nb_lines = NO_OS_ARRAY_SIZE(offsets),
+		.out_mask = NO_OS_BIT(0) | NO_OS_BIT(2),
+		.values = NO_OS_BIT(0),
+		.pull = NO_OS_PULL_UP,
+	};
+	struct linux_gpio_lines *lines;
+
+	TEST_ASSERT_EQUAL_INT(0, linux_gpio_lines_get(&lines, &param));
+	TEST_ASSERT_EQUAL_STRING("/dev/gpiochip1", chip.path);
+	TEST_ASSERT_EQUAL_UINT32(3, chip.req.num_lines);
+	TEST_ASSERT_EQUAL_UINT32_ARRAY(offsets, chip.req.offsets, 3);
+	TEST_ASSERT_EQUAL_UINT64(GPIO_V2_LINE_FLAG_INPUT |
+				 GPIO_V2_LINE_FLAG_BIAS_PULL_UP,
+				 chip.req.config.flags);
+
+	/* The outputs override the direction and get their initial values */
+	TEST_ASSERT_EQUAL_UINT32(2, chip.req.config.num_attrs);
+	TEST_ASSERT_EQUAL_UINT32(GPIO_V2_LINE_ATTR_ID_FLAGS,
+				 chip.req.config.attrs[0].attr.id);
+	TEST_ASSERT_EQUAL_UINT64(GPIO_V2_LINE_FLAG_OUTPUT |
+				 GPIO_V2_LINE_FLAG_BIAS_PULL_UP,
+				 chip.req.config.attrs[0].attr.flags);
+	TEST_ASSERT_EQUAL_UINT64(param.out_mask,
+				 chip.req.config.attrs[0].mask);
+	TEST_ASSERT_EQUAL_UINT32(GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES,
+				 chip.req.config.attrs[1].attr.id);
+	TEST_ASSERT_EQUAL_UINT64(param.values,
+				 chip.req.config.attrs[1].attr.values);
+	TEST_ASSERT_EQUAL_UINT64(param.out_mask,
+				 chip.req.config.attrs[1].mask);
+
+	TEST_ASSERT_EQUAL_INT(0, linux_gpio_lines_remove(lines));
+
+	param.nb_lines = 0;
+	TEST_ASSERT_EQUAL_INT(-EINVAL, linux_gpio_lines_get(&lines, &param));
+	param.nb_lines = LINUX_GPIO_LINES_MAX + 1;
+	TEST_ASSERT_EQUAL_INT(-EINVAL, linux_gpio_lines_get(&lines, &param));
+}
+
+void test_linux_gpio_lines_bitmap(void)
+{
+	uint32_t offsets[40];
+	struct linux_gpio_lines_init_param param = {
+		.chip = TEST_CHIP,
+		.offsets = offsets,
+		.nb_lines = NO_OS_ARRAY_SIZE(offsets),
+		.out_mask = NO_OS_GENMASK_ULL(39, 32) | NO_OS_GENMASK_ULL(3, 0),
+	};
+	struct linux_gpio_lines *lines;
+	uint64_t mask, bits, expected;
+	uint32_t i;
+
+	for (i = 0; i < NO_OS_ARRAY_SIZE(offsets); i++)
+		offsets[i] = i;
+	TEST_ASSERT_EQUAL_INT(0, linux_gpio_lines_get(&lines, &param));
+	TEST_ASSERT_EQUAL_UINT32(40, chip.req.num_lines);
+	chip.bits = 0x00F0F0F0F0ull;
+
+	/* Lines on both sides of bit 31 in a single ioctl */
+	chip.nb_ioctls = 0;
+	mask = NO_OS_BIT_ULL(39) | NO_OS_BIT_ULL(0);
+	TEST_ASSERT_EQUAL_INT(0, linux_gpio_lines_set(lines, mask,
+			      NO_OS_BIT_ULL(39)));
+	TEST_ASSERT_EQUAL_UINT32(1, chip.nb_ioctls);
+	TEST_ASSERT_EQUAL_UINT64(mask, chip.set.mask);
+	TEST_ASSERT_EQUAL_UINT64(NO_OS_BIT_ULL(39), chip.set.bits);
+	/* The other lines keep their values */
+	expected = 0x80F0F0F0F0ull & ~NO_OS_BIT_ULL(0);
+	TEST_ASSERT_EQUAL_UINT64(expected, chip.bits);
+
+	chip.nb_ioctls = 0;
+	mask = NO_OS_GENMASK_ULL(39, 32) | NO_OS_GENMASK_ULL(7, 4);
+	TEST_ASSERT_EQUAL_INT(0, linux_gpio_lines_get_values(lines, mask,
+			      &bits));
+	TEST_ASSERT_EQUAL_UINT32(1, chip.nb_ioctls);
+	TEST_ASSERT_EQUAL_UINT64(expected & mask, bits);
+
+	TEST_ASSERT_EQUAL_INT(0, linux_gpio_lines_remove(lines));
+}
+
+void test_linux_gpio_irq_events(void)
+{
+	struct no_os_irq_init_param param = {
+		.irq_ctrl_id = TEST_CHIP,
+		.platform_ops = &linux_gpio_irq_ops,
+	};
+	struct no_os_callback_desc cb = {
+		.callback = irq_callback,
+		.ctx = &irq_ctx,
+	};
+	struct no_os_irq_ctrl_desc *irq;
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_irq_ctrl_init(&irq, &param));
+	irq_ctx.irq = irq;
+	TEST_ASSERT_EQUAL_STRING("/dev/gpiochip2", chip.path);
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_irq_enable(irq, TEST_CHIP_LINES));
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_irq_register_callback(irq,
+			      TEST_IRQ_LINE, &cb));
+	TEST_ASSERT_EQUAL_INT(0, no_os_irq_trigger_level_set(irq,
+			      TEST_IRQ_LINE, NO_OS_IRQ_EDGE_BOTH));
+	TEST_ASSERT_EQUAL_INT(-ENOTSUP, no_os_irq_trigger_level_set(irq,
+			      TEST_IRQ_LINE, NO_OS_IRQ_LEVEL_HIGH));
+	TEST_ASSERT_EQUAL_INT(0, no_os_irq_enable(irq, TEST_IRQ_LINE));
+	TEST_ASSERT_EQUAL_UINT32(1, chip.req.num_lines);
+	TEST_ASSERT_EQUAL_UINT32(TEST_IRQ_LINE, chip.req.offsets[0]);
+	TEST_ASSERT_EQUAL_UINT64(GPIO_V2_LINE_FLAG_INPUT |
+				 GPIO_V2_LINE_FLAG_EDGE_RISING |
+				 GPIO_V2_LINE_FLAG_EDGE_FALLING,
+				 chip.req.config.flags);
+
+	TEST_ASSERT_EQUAL_INT(0, linux_gpio_irq_poll(irq, 0));
+	TEST_ASSERT_EQUAL_UINT32(0, irq_ctx.nb_events);
+
+	/* One callback per edge, with the kernel timestamp of that edge */
+	chip_push_event(1000, true, 1);
+	chip_push_event(2500, false, 2);
+	TEST_ASSERT_EQUAL_INT(2, linux_gpio_irq_poll(irq, 0));
+	TEST_ASSERT_EQUAL_UINT32(2, irq_ctx.nb_events);
+	TEST_ASSERT_EQUAL_UINT64(1000, irq_ctx.events[0].timestamp_ns);
+	TEST_ASSERT_TRUE(irq_ctx.events[0].rising);
+	TEST_ASSERT_EQUAL_UINT32(1, irq_ctx.events[0].seqno);
+	TEST_ASSERT_EQUAL_UINT64(2500, irq_ctx.events[1].timestamp_ns);
+	TEST_ASSERT_FALSE(irq_ctx.events[1].rising);
+	TEST_ASSERT_EQUAL_UINT32(2, irq_ctx.events[1].seqno);
+
+	/* Events stay queued while the controller is disabled */
+	TEST_ASSERT_EQUAL_INT(0, no_os_irq_global_disable(irq));
+	chip_push_event(4000, true, 3);
+	TEST_ASSERT_EQUAL_INT(0, linux_gpio_irq_poll(irq, 0));
+	TEST_ASSERT_EQUAL_UINT32(2, irq_ctx.nb_events);
+	TEST_ASSERT_EQUAL_INT(0, no_os_irq_global_enable(irq));
+	TEST_ASSERT_EQUAL_INT(1, linux_gpio_irq_poll(irq, 0));
+	TEST_ASSERT_EQUAL_UINT32(3, irq_ctx.nb_events);
+	TEST_ASSERT_EQUAL_UINT64(4000, irq_ctx.events[2].timestamp_ns);
+
+	/* A disabled line releases its request and is no longer polled */
+	TEST_ASSERT_EQUAL_INT(0, no_os_irq_disable(irq, TEST_IRQ_LINE));
+	TEST_ASSERT_EQUAL_INT(0, linux_gpio_irq_poll(irq, 0));
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_irq_ctrl_remove(irq));
+}
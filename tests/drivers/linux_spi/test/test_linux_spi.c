@@ -0,0 +1,422 @@
+/***************************************************************************//**
+ *   @file   test_linux_spi.c
+ *   @brief  Unit tests of the Linux spidev transfers and SPI batches
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+
+
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "no_os_spi.h"
+#include "no_os_mutex.h"
+#include "no_os_alloc.h"
+#include "no_os_util.h"
+#include "linux_spi.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <string.h>
+#include <unistd.h>
+#include <linux/spi/spidev.h>
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+#define TEST_BUS		1
+#define TEST_CS			2
+#define TEST_SPEED_HZ		1000000
+/* Transfer array entries allocated by linux_spi_init() */
+#define TEST_PREALLOC_MSGS	16
+/* Largest number of messages accepted by a single SPI_IOC_MESSAGE ioctl */
+#define TEST_MAX_MSGS		\
+	(((1 << _IOC_SIZEBITS) - 1) / sizeof(struct spi_ioc_transfer))
+
+/*
+ * Model of a spidev, backed by /dev/null so that close() works unchanged.
+ * Each SPI_IOC_MESSAGE ioctl records its transfers and answers with the
+ * inverted tx bytes.
+ */
+static struct spidev_model {
+	char path[32];
+	int fd;
+	/* Settings written to the spidev */
+	uint8_t mode;
+	uint8_t bits_per_word;
+	uint32_t max_speed_hz;
+	uint32_t nb_cfg_ioctls;
+	/* Last SPI_IOC_MESSAGE ioctl */
+	uint32_t nb_msg_ioctls;
+	uint32_t nb_msgs;
+	const struct spi_ioc_transfer *tr_array;
+	struct spi_ioc_transfer tr[TEST_MAX_MSGS];
+	/* When not 0, the next SPI_IOC_MESSAGE ioctl fails with this errno */
+	int fail_errno;
+} spidev;
+
+static struct no_os_spi_msg msgs[TEST_MAX_MSGS + 1];
+static uint8_t tx[TEST_MAX_MSGS + 1][2];
+static uint8_t rx[TEST_MAX_MSGS + 1][2];
+
+int __real_open(const char *path, int flags, ...);
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+int __wrap_open(const char *path, int flags, ...)
+{
+	va_list args;
+	mode_t mode;
+
+	if (!strncmp(path, "/dev/spidev", strlen("/dev/spidev"))) {
+		strcpy(spidev.path, path);
+		spidev.fd = __real_open("/dev/null", O_RDWR);
+		return spidev.fd;
+	}
+
+	va_start(args, flags);
+	mode = va_arg(args, int);
+	va_end(args);
+
+	return __real_open(path, flags, mode);
+}
+
+int __wrap_ioctl(int fd, unsigned long request, ...)
+{
+	const struct spi_ioc_transfer *tr;
+	uint8_t *tx_buf, *rx_buf;
+	va_list args;
+	uint32_t i, j;
+	void *arg;
+
+	va_start(args, request);
+	arg = va_arg(args, void *);
+	va_end(args);
+
+	TEST_ASSERT_EQUAL_INT(spidev.fd, fd);
+	switch (request) {
+	case SPI_IOC_WR_MODE:
+		spidev.mode = *(uint8_t *)arg;
+		spidev.nb_cfg_ioctls++;
+		return 0;
+	case SPI_IOC_WR_BITS_PER_WORD:
+		spidev.bits_per_word = *(uint8_t *)arg;
+		spidev.nb_cfg_ioctls++;
+		return 0;
+	case SPI_IOC_WR_MAX_SPEED_HZ:
+		spidev.max_speed_hz = *(uint32_t *)arg;
+		spidev.nb_cfg_ioctls++;
+		return 0;
+	default:
+		break;
+	}
+
+	if (_IOC_TYPE(request) != SPI_IOC_MAGIC || _IOC_NR(request) != 0 ||
+	    _IOC_DIR(request) != _IOC_WRITE) {
+		errno = ENOTTY;
+		return -1;
+	}
+
+	spidev.nb_msg_ioctls++;
+	if (spidev.fail_errno) {
+		errno = spidev.fail_errno;
+		spidev.fail_errno = 0;
+		return -1;
+	}
+
+	tr = arg;
+	spidev.tr_array = tr;
+	spidev.nb_msgs = _IOC_SIZE(request) / sizeof(*tr);
+	TEST_ASSERT_LESS_OR_EQUAL_UINT32(TEST_MAX_MSGS, spidev.nb_msgs);
+	memcpy(spidev.tr, tr, spidev.nb_msgs * sizeof(*tr));
+
+	for (i = 0; i < spidev.nb_msgs; i++) {
+		tx_buf = (uint8_t *)(uintptr_t)tr[i].tx_buf;
+		rx_buf = (uint8_t *)(uintptr_t)tr[i].rx_buf;
+		for (j = 0; rx_buf && j < tr[i].len; j++)
+			rx_buf[j] = tx_buf ? ~tx_buf[j] : 0;
+	}
+
+	return 0;
+}
+
+static struct no_os_spi_desc *spidev_get(void)
+{
+	struct no_os_spi_init_param param = {
+		.device_id = TEST_BUS,
+		.chip_select = TEST_CS,
+		.max_speed_hz = TEST_SPEED_HZ,
+		.mode = NO_OS_SPI_MODE_3,
+		.platform_ops = &linux_spi_ops,
+	};
+	struct no_os_spi_desc *desc;
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_init(&desc, &param));
+
+	return desc;
+}
+
+/* Fill the first len messages with two byte register accesses */
+static void msgs_fill(uint32_t len, bool cs_change)
+{
+	uint32_t i;
+
+	memset(msgs, 0, sizeof(msgs));
+	for (i = 0; i < len; i++) {
+		tx[i][0] = i;
+		tx[i][1] = i >> 8;
+		msgs[i].tx_buff = tx[i];
+		msgs[i].rx_buff = rx[i];
+		msgs[i].bytes_number = sizeof(tx[i]);
+		msgs[i].cs_change = cs_change;
+	}
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	memset(&spidev, 0, sizeof(spidev));
+	spidev.fd = -1;
+	memset(rx, 0, sizeof(rx));
+}
+
+void tearDown(void) {}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+void test_linux_spi_init(void)
+{
+	struct no_os_spi_desc *desc;
+
+	desc = spidev_get();
+	TEST_ASSERT_EQUAL_STRING("/dev/spidev1.2", spidev.path);
+	TEST_ASSERT_EQUAL_UINT32(3, spidev.nb_cfg_ioctls);
+	TEST_ASSERT_EQUAL_UINT8(NO_OS_SPI_MODE_3, spidev.mode);
+	TEST_ASSERT_EQUAL_UINT8(8, spidev.bits_per_word);
+	TEST_ASSERT_EQUAL_UINT32(TEST_SPEED_HZ, spidev.max_speed_hz);
+
+	/* Only the settings which changed are written again */
+	msgs_fill(1, false);
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_transfer(desc, msgs, 1));
+	TEST_ASSERT_EQUAL_UINT32(3, spidev.nb_cfg_ioctls);
+	desc->max_speed_hz = TEST_SPEED_HZ / 2;
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_transfer(desc, msgs, 1));
+	TEST_ASSERT_EQUAL_UINT32(4, spidev.nb_cfg_ioctls);
+	TEST_ASSERT_EQUAL_UINT32(TEST_SPEED_HZ / 2, spidev.max_speed_hz);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_remove(desc));
+}
+
+void test_linux_spi_transfer(void)
+{
+	struct no_os_spi_desc *desc;
+	uint32_t i;
+
+	desc = spidev_get();
+	msgs_fill(3, false);
+	msgs[0].cs_change = 1;
+	msgs[0].cs_change_delay = 5;
+	msgs[1].tx_buff = NULL;
+	/* Ignored, spidev releases chip select at the end of the ioctl */
+	msgs[2].cs_change = 1;
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_transfer(desc, msgs, 3));
+	TEST_ASSERT_EQUAL_UINT32(1, spidev.nb_msg_ioctls);
+	TEST_ASSERT_EQUAL_UINT32(3, spidev.nb_msgs);
+	for (i = 0; i < 3; i++) {
+		TEST_ASSERT_EQUAL_PTR(msgs[i].tx_buff,
+				      (void *)(uintptr_t)spidev.tr[i].tx_buf);
+		TEST_ASSERT_EQUAL_PTR(msgs[i].rx_buff,
+				      (void *)(uintptr_t)spidev.tr[i].rx_buf);
+		TEST_ASSERT_EQUAL_UINT32(2, spidev.tr[i].len);
+	}
+	TEST_ASSERT_EQUAL_UINT8(1, spidev.tr[0].cs_change);
+	TEST_ASSERT_EQUAL_UINT16(5, spidev.tr[0].word_delay_usecs);
+	TEST_ASSERT_EQUAL_UINT8(0, spidev.tr[1].cs_change);
+	TEST_ASSERT_EQUAL_UINT8(0, spidev.tr[2].cs_change);
+
+	/* The received data lands in the rx buffers of the messages */
+	TEST_ASSERT_EQUAL_HEX8(0xff, rx[0][0]);
+	TEST_ASSERT_EQUAL_HEX8(0x00, rx[1][0]);
+	TEST_ASSERT_EQUAL_HEX8(0xfd, rx[2][0]);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_remove(desc));
+}
+
+void test_linux_spi_transfer_prealloc(void)
+{
+	const struct spi_ioc_transfer *tr;
+	struct no_os_spi_desc *desc;
+
+	desc = spidev_get();
+	msgs_fill(TEST_PREALLOC_MSGS + 1, true);
+
+	/* Up to the preallocated size the same transfer array is reused */
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_transfer(desc, msgs, 1));
+	tr = spidev.tr_array;
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_transfer(desc, msgs,
+			      TEST_PREALLOC_MSGS));
+	TEST_ASSERT_EQUAL_PTR(tr, spidev.tr_array);
+	TEST_ASSERT_EQUAL_UINT32(TEST_PREALLOC_MSGS, spidev.nb_msgs);
+
+	/* It grows once, then the larger array is reused */
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_transfer(desc, msgs,
+			      TEST_PREALLOC_MSGS + 1));
+	TEST_ASSERT_NOT_EQUAL(tr, spidev.tr_array);
+	tr = spidev.tr_array;
+	TEST_ASSERT_EQUAL_UINT32(TEST_PREALLOC_MSGS + 1, spidev.nb_msgs);
+	TEST_ASSERT_EQUAL_UINT8(1, spidev.tr[TEST_PREALLOC_MSGS - 1].cs_change);
+	TEST_ASSERT_EQUAL_UINT8(0, spidev.tr[TEST_PREALLOC_MSGS].cs_change);
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_transfer(desc, msgs, 2));
+	TEST_ASSERT_EQUAL_PTR(tr, spidev.tr_array);
+	TEST_ASSERT_EQUAL_UINT32(4, spidev.nb_msg_ioctls);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_remove(desc));
+}
+
+void test_linux_spi_transfer_too_big(void)
+{
+	struct no_os_spi_desc *desc;
+
+	desc = spidev_get();
+	msgs_fill(TEST_MAX_MSGS + 1, true);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_transfer(desc, msgs,
+			      TEST_MAX_MSGS));
+	TEST_ASSERT_EQUAL_UINT32(1, spidev.nb_msg_ioctls);
+	TEST_ASSERT_EQUAL_UINT32(TEST_MAX_MSGS, spidev.nb_msgs);
+	TEST_ASSERT_EQUAL_HEX8((uint8_t)~(TEST_MAX_MSGS - 1),
+			       rx[TEST_MAX_MSGS - 1][0]);
+
+	/* The list is not split, chip select would be released in between */
+	TEST_ASSERT_EQUAL_INT(-E2BIG, no_os_spi_transfer(desc, msgs,
+			      TEST_MAX_MSGS + 1));
+	TEST_ASSERT_EQUAL_UINT32(1, spidev.nb_msg_ioctls);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_remove(desc));
+}
+
+void test_linux_spi_transfer_error(void)
+{
+	struct no_os_spi_desc *desc;
+
+	desc = spidev_get();
+	msgs_fill(2, true);
+
+	spidev.fail_errno = EIO;
+	TEST_ASSERT_EQUAL_INT(-EIO, no_os_spi_transfer(desc, msgs, 2));
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_transfer(desc, msgs, 2));
+	TEST_ASSERT_EQUAL_UINT32(2, spidev.nb_msg_ioctls);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_remove(desc));
+}
+
+void test_no_os_spi_batch(void)
+{
+	struct no_os_spi_batch *batch;
+	struct no_os_spi_desc *desc;
+	uint32_t i;
+
+	desc = spidev_get();
+	msgs_fill(6, true);
+	msgs[4].cs_change = 0;
+
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_spi_batch_init(&batch, desc, 0));
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_batch_init(&batch, desc, 4));
+
+	/* Queued messages are only sent when the batch is full or flushed */
+	for (i = 0; i < 4; i++)
+		TEST_ASSERT_EQUAL_INT(0, no_os_spi_batch_add(batch, &msgs[i]));
+	TEST_ASSERT_EQUAL_UINT32(0, spidev.nb_msg_ioctls);
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_batch_add(batch, &msgs[4]));
+	TEST_ASSERT_EQUAL_UINT32(1, spidev.nb_msg_ioctls);
+	TEST_ASSERT_EQUAL_UINT32(4, spidev.nb_msgs);
+	TEST_ASSERT_EQUAL_UINT8(1, spidev.tr[2].cs_change);
+	TEST_ASSERT_EQUAL_UINT8(0, spidev.tr[3].cs_change);
+	TEST_ASSERT_EQUAL_PTR(tx[3], (void *)(uintptr_t)spidev.tr[3].tx_buf);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_batch_add(batch, &msgs[5]));
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_batch_flush(batch));
+	TEST_ASSERT_EQUAL_UINT32(2, spidev.nb_msg_ioctls);
+	TEST_ASSERT_EQUAL_UINT32(2, spidev.nb_msgs);
+	/* Chip select is kept between the two messages of one access */
+	TEST_ASSERT_EQUAL_UINT8(0, spidev.tr[0].cs_change);
+	TEST_ASSERT_EQUAL_PTR(tx[4], (void *)(uintptr_t)spidev.tr[0].tx_buf);
+	TEST_ASSERT_EQUAL_PTR(tx[5], (void *)(uintptr_t)spidev.tr[1].tx_buf);
+
+	/* Nothing to send */
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_batch_flush(batch));
+	TEST_ASSERT_EQUAL_UINT32(2, spidev.nb_msg_ioctls);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_batch_remove(batch));
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_remove(desc));
+}
+
+void test_no_os_spi_batch_error(void)
+{
+	struct no_os_spi_batch *batch;
+	struct no_os_spi_desc *desc;
+	uint32_t i;
+
+	desc = spidev_get();
+	msgs_fill(TEST_MAX_MSGS + 1, true);
+
+	/* A failed flush still empties the batch */
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_batch_init(&batch, desc, 2));
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_batch_add(batch, &msgs[0]));
+	spidev.fail_errno = EIO;
+	TEST_ASSERT_EQUAL_INT(-EIO, no_os_spi_batch_flush(batch));
+	TEST_ASSERT_EQUAL_UINT32(0, batch->len);
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_batch_flush(batch));
+	TEST_ASSERT_EQUAL_UINT32(1, spidev.nb_msg_ioctls);
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_batch_remove(batch));
+
+	/* A batch larger than the spidev limit fails when it is flushed */
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_batch_init(&batch, desc,
+			      TEST_MAX_MSGS + 1));
+	for (i = 0; i < TEST_MAX_MSGS + 1; i++)
+		TEST_ASSERT_EQUAL_INT(0, no_os_spi_batch_add(batch, &msgs[i]));
+	TEST_ASSERT_EQUAL_INT(-E2BIG, no_os_spi_batch_flush(batch));
+	TEST_ASSERT_EQUAL_UINT32(1, spidev.nb_msg_ioctls);
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_batch_remove(batch));
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_spi_remove(desc));
+}
@@ -0,0 +1,229 @@
+/***************************************************************************//**
+ *   @file   test_linux_timer.c
+ *   @brief  Callback, stop and jitter tests of the Linux timer.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "no_os_timer.h"
+#include "no_os_delay.h"
+#include "no_os_mutex.h"
+#include "linux_timer.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+TEST_FILE("linux_delay.c")
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+/* 1 kHz timer, 500 periods */
+#define JITTER_FREQ_HZ		1000000
+#define JITTER_TICKS		1000
+#define JITTER_PERIOD_NS	1000000ull
+#define JITTER_SAMPLES		500
+
+static struct no_os_timer_desc *timer;
+static uint64_t stamps[JITTER_SAMPLES];
+static volatile uint32_t nb_calls;
+static volatile bool in_callback;
+static uint32_t stop_after;
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+static void jitter_callback(void *ctx)
+{
+	if (nb_calls < JITTER_SAMPLES)
+		stamps[nb_calls] = no_os_get_time_ns();
+	nb_calls++;
+}
+
+/* Callback that outlives the period, to be caught by a stop */
+static void slow_callback(void *ctx)
+{
+	in_callback = true;
+	nb_calls++;
+	no_os_mdelay(20);
+	in_callback = false;
+}
+
+static void self_stop_callback(void *ctx)
+{
+	if (++nb_calls == stop_after)
+		no_os_timer_stop(timer);
+}
+
+static void timer_init(void (*callback)(void *ctx))
+{
+	struct linux_timer_init_param linux_param = {
+		.callback = callback,
+	};
+	struct no_os_timer_init_param param = {
+		.id = 0,
+		.freq_hz = JITTER_FREQ_HZ,
+		.ticks_count = JITTER_TICKS,
+		.platform_ops = &linux_timer_ops,
+		.extra = &linux_param,
+	};
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_timer_init(&timer, &param));
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	nb_calls = 0;
+	in_callback = false;
+	timer = NULL;
+}
+
+void tearDown(void)
+{
+	if (timer)
+		no_os_timer_remove(timer);
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+void test_linux_timer_get_time_ns(void)
+{
+	uint64_t start, end;
+	struct no_os_time t;
+
+	start = no_os_get_time_ns();
+	no_os_mdelay(10);
+	end = no_os_get_time_ns();
+
+	TEST_ASSERT_GREATER_OR_EQUAL(10000000ull, end - start);
+
+	/* no_os_get_time() reads the same clock */
+	t = no_os_get_time();
+	TEST_ASSERT_LESS_OR_EQUAL(1000000ull,
+				  t.s * 1000000ull + t.us - end / 1000);
+}
+
+void test_linux_timer_stop_waits_for_callback(void)
+{
+	uint32_t calls;
+
+	timer_init(slow_callback);
+	TEST_ASSERT_EQUAL_INT(0, no_os_timer_start(timer));
+
+	while (!in_callback)
+		usleep(100);
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_timer_stop(timer));
+	TEST_ASSERT_FALSE(in_callback);
+
+	/* Expirations pending when it stopped are not delivered */
+	calls = nb_calls;
+	no_os_mdelay(50);
+	TEST_ASSERT_EQUAL_UINT32(calls, nb_calls);
+}
+
+void test_linux_timer_stop_from_callback(void)
+{
+	stop_after = 5;
+	timer_init(self_stop_callback);
+	TEST_ASSERT_EQUAL_INT(0, no_os_timer_start(timer));
+
+	while (nb_calls < stop_after)
+		usleep(100);
+	no_os_mdelay(20);
+
+	TEST_ASSERT_EQUAL_UINT32(stop_after, nb_calls);
+}
+
+void test_linux_timer_jitter(void)
+{
+	uint64_t periods[JITTER_SAMPLES - 1];
+	uint64_t start, elapsed, err, max_err = 0, sum_err = 0;
+	uint32_t i, n, calls;
+	char msg[160];
+
+	timer_init(jitter_callback);
+
+	start = no_os_get_time_ns();
+	TEST_ASSERT_EQUAL_INT(0, no_os_timer_start(timer));
+	while (nb_calls < JITTER_SAMPLES)
+		usleep(1000);
+	TEST_ASSERT_EQUAL_INT(0, no_os_timer_stop(timer));
+	elapsed = no_os_get_time_ns() - start;
+	calls = nb_calls;
+
+	n = JITTER_SAMPLES - 1;
+	for (i = 0; i < n; i++) {
+		periods[i] = stamps[i + 1] - stamps[i];
+		err = periods[i] > JITTER_PERIOD_NS ?
+		      periods[i] - JITTER_PERIOD_NS :
+		      JITTER_PERIOD_NS - periods[i];
+		sum_err += err;
+		if (err > max_err)
+			max_err = err;
+	}
+	qsort(periods, n, sizeof(periods[0]), cmp_u64);
+
+	snprintf(msg, sizeof(msg),
+		 "%u periods of %llu ns: mean |err| %llu ns, "
+		 "max |err| %llu ns, min %llu ns, median %llu ns, p99 %llu ns",
+		 n, JITTER_PERIOD_NS, sum_err / n, max_err, periods[0],
+		 periods[n / 2], periods[n * 99 / 100]);
+	TEST_MESSAGE(msg);
+
+	/* Late expirations are delivered, none is lost */
+	TEST_ASSERT_LESS_OR_EQUAL(elapsed / JITTER_PERIOD_NS + 1, calls);
+	TEST_ASSERT_GREATER_OR_EQUAL(elapsed / JITTER_PERIOD_NS - 2, calls);
+	/* The mean period doesn't drift */
+	TEST_ASSERT_LESS_THAN(JITTER_PERIOD_NS / 100,
+			      (stamps[n] - stamps[0]) / n > JITTER_PERIOD_NS ?
+			      (stamps[n] - stamps[0]) / n - JITTER_PERIOD_NS :
+			      JITTER_PERIOD_NS - (stamps[n] - stamps[0]) / n);
+}
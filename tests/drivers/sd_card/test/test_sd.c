@@ -0,0 +1,339 @@
+/***************************************************************************//**
+ *   @file   test_sd.c
+ *   @brief  Unit tests of the SD card driver against the Linux SD card emulator
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "sd.h"
+#include "linux_sd_emu.h"
+#include "no_os_spi.h"
+#include "no_os_mutex.h"
+#include "no_os_alloc.h"
+#include "no_os_util.h"
+#include "mock_no_os_delay.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+#define TEST_IMAGE		"test_sd.img"
+#define TEST_CARD_SIZE		(2u << 20)
+#define TEST_MAX_LEN		40000
+#define TEST_NB_OPS		300
+
+#define BENCH_ITERATIONS	200
+/* Sectors of the FAT and of the directory rewritten by each iteration */
+#define BENCH_FAT_ADDR		(10 * DATA_BLOCK_LEN)
+#define BENCH_DIR_ADDR		(20 * DATA_BLOCK_LEN)
+#define BENCH_DATA_ADDR		(1000 * DATA_BLOCK_LEN)
+#define BENCH_CHUNK_BLOCKS	4
+#define BENCH_CHUNK_LEN		(BENCH_CHUNK_BLOCKS * DATA_BLOCK_LEN)
+#define BENCH_CACHE_BLOCKS	16
+
+enum bench_mode {
+	/* Each iteration reads the FAT and directory sectors, writes 4 data
+	 * blocks and writes both sectors back, like a FatFS f_write/f_sync */
+	BENCH_FATFS,
+	/* Each iteration writes 4 consecutive blocks with sd_write() */
+	BENCH_SD_WRITE,
+	/* The same blocks written through a single stream */
+	BENCH_STREAM,
+};
+
+static uint8_t ref[TEST_CARD_SIZE];
+static uint8_t image[TEST_CARD_SIZE];
+static uint8_t buf[TEST_MAX_LEN];
+static uint8_t chk[TEST_MAX_LEN];
+
+static struct no_os_spi_desc *spi;
+static struct sd_desc *sd;
+static uint32_t delay_ms;
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+static void count_mdelay(uint32_t msecs, int num_calls)
+{
+	delay_ms += msecs;
+}
+
+static void card_init(uint32_t busy_polls, uint32_t erased_busy_polls,
+		      uint32_t cache_blocks)
+{
+	struct linux_sd_emu_init_param emu_param = {
+		.path = TEST_IMAGE,
+		.size = TEST_CARD_SIZE,
+		.busy_polls = busy_polls,
+		.erased_busy_polls = erased_busy_polls,
+	};
+	struct no_os_spi_init_param spi_param = {
+		.platform_ops = &linux_sd_emu_ops,
+		.extra = &emu_param,
+	};
+	struct sd_init_param sd_param = {
+		.cache_blocks = cache_blocks,
+	};
+
+	remove(TEST_IMAGE);
+	TEST_ASSERT_EQUAL_INT32(0, no_os_spi_init(&spi, &spi_param));
+
+	sd_param.spi_desc = spi;
+	TEST_ASSERT_EQUAL_INT32(0, sd_init(&sd, &sd_param));
+	TEST_ASSERT_EQUAL_UINT64(TEST_CARD_SIZE, sd->memory_size);
+}
+
+static void card_remove(void)
+{
+	if (sd)
+		sd_remove(sd);
+	if (spi)
+		no_os_spi_remove(spi);
+	sd = NULL;
+	spi = NULL;
+}
+
+static void fill_random(uint8_t *data, uint32_t len)
+{
+	uint32_t i;
+
+	for (i = 0; i < len; i++)
+		data[i] = rand();
+}
+
+/* Check the image file against the reference, blocks never written are 0 */
+static void check_image(void)
+{
+	FILE *f;
+	size_t len;
+
+	f = fopen(TEST_IMAGE, "rb");
+	TEST_ASSERT_NOT_NULL(f);
+	len = fread(image, 1, sizeof(image), f);
+	fclose(f);
+
+	memset(image + len, 0, sizeof(image) - len);
+	TEST_ASSERT_EQUAL_MEMORY(ref, image, sizeof(ref));
+}
+
+static void bench_run(const char *name, enum bench_mode mode,
+		      uint32_t cache_blocks, struct linux_sd_emu_stats *stats)
+{
+	struct linux_sd_emu_stats start;
+	uint64_t addr;
+	char msg[120];
+	uint32_t i;
+
+	/* 2 busy bytes after each block, none after pre-erased blocks */
+	card_init(2, 0, cache_blocks);
+	TEST_ASSERT_EQUAL_INT32(0, linux_sd_emu_get_stats(spi, &start));
+	delay_ms = 0;
+
+	if (mode == BENCH_STREAM)
+		TEST_ASSERT_EQUAL_INT32(0, sd_stream_start(sd, BENCH_DATA_ADDR,
+					BENCH_ITERATIONS * BENCH_CHUNK_BLOCKS));
+
+	for (i = 0; i < BENCH_ITERATIONS; i++) {
+		addr = BENCH_DATA_ADDR + i * BENCH_CHUNK_LEN;
+		switch (mode) {
+		case BENCH_FATFS:
+			TEST_ASSERT_EQUAL_INT32(0, sd_read(sd, chk,
+							   BENCH_FAT_ADDR,
+							   DATA_BLOCK_LEN));
+			TEST_ASSERT_EQUAL_INT32(0, sd_read(sd, chk,
+							   BENCH_DIR_ADDR,
+							   DATA_BLOCK_LEN));
+			TEST_ASSERT_EQUAL_INT32(0, sd_write(sd, buf, addr,
+							    BENCH_CHUNK_LEN));
+			TEST_ASSERT_EQUAL_INT32(0, sd_write(sd, buf,
+							    BENCH_FAT_ADDR,
+							    DATA_BLOCK_LEN));
+			TEST_ASSERT_EQUAL_INT32(0, sd_write(sd, buf,
+							    BENCH_DIR_ADDR,
+							    DATA_BLOCK_LEN));
+			break;
+		case BENCH_SD_WRITE:
+			TEST_ASSERT_EQUAL_INT32(0, sd_write(sd, buf, addr,
+							    BENCH_CHUNK_LEN));
+			break;
+		case BENCH_STREAM:
+			TEST_ASSERT_EQUAL_INT32(0, sd_stream_write(sd, buf,
+					BENCH_CHUNK_LEN));
+			break;
+		}
+	}
+
+	if (mode == BENCH_STREAM)
+		TEST_ASSERT_EQUAL_INT32(0, sd_stream_stop(sd));
+	TEST_ASSERT_EQUAL_INT32(0, sd_flush(sd));
+
+	TEST_ASSERT_EQUAL_INT32(0, linux_sd_emu_get_stats(spi, stats));
+	stats->commands -= start.commands;
+	stats->blocks_read -= start.blocks_read;
+	stats->blocks_written -= start.blocks_written;
+	stats->busy_polls -= start.busy_polls;
+
+	snprintf(msg, sizeof(msg),
+		 "%-24s %5u cmds, %4u blocks read, %4u written, %4u ms busy",
+		 name, stats->commands, stats->blocks_read,
+		 stats->blocks_written, delay_ms);
+	TEST_MESSAGE(msg);
+
+	card_remove();
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	no_os_mdelay_StubWithCallback(count_mdelay);
+	delay_ms = 0;
+	srand(1);
+}
+
+void tearDown(void)
+{
+	card_remove();
+	remove(TEST_IMAGE);
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+/**
+ * @brief Random unaligned reads and writes through the cache, with a stream
+ * interrupted by a read, end up on the card once flushed.
+ */
+void test_sd_read_write(void)
+{
+	uint64_t addr;
+	uint32_t len;
+	uint32_t i;
+	uint32_t j;
+
+	memset(ref, 0, sizeof(ref));
+	card_init(3, 1, 8);
+
+	for (i = 0; i < TEST_NB_OPS; i++) {
+		addr = rand() % (TEST_CARD_SIZE - TEST_MAX_LEN);
+		len = 1 + rand() % ((rand() & 3) ? 600 : TEST_MAX_LEN - 1);
+
+		if (rand() & 1) {
+			fill_random(buf, len);
+			TEST_ASSERT_EQUAL_INT32(0, sd_write(sd, buf, addr,
+							    len));
+			memcpy(ref + addr, buf, len);
+		} else {
+			TEST_ASSERT_EQUAL_INT32(0, sd_read(sd, chk, addr, len));
+			TEST_ASSERT_EQUAL_MEMORY(ref + addr, chk, len);
+		}
+
+		if (i != TEST_NB_OPS / 2)
+			continue;
+
+		/* 10 writes of 5 blocks, more than the 40 announced */
+		addr = 1000 * DATA_BLOCK_LEN;
+		TEST_ASSERT_EQUAL_INT32(0, sd_stream_start(sd, addr, 40));
+		for (j = 0; j < 10; j++) {
+			len = 5 * DATA_BLOCK_LEN;
+			fill_random(buf, len);
+			TEST_ASSERT_EQUAL_INT32(0, sd_stream_write(sd, buf,
+						len));
+			memcpy(ref + addr + j * len, buf, len);
+
+			if (j != 4)
+				continue;
+			TEST_ASSERT_EQUAL_INT32(0, sd_read(sd, chk, addr, 100));
+			TEST_ASSERT_EQUAL_MEMORY(ref + addr, chk, 100);
+		}
+		TEST_ASSERT_EQUAL_INT32(0, sd_stream_stop(sd));
+	}
+
+	TEST_ASSERT_EQUAL_INT32(0, sd_flush(sd));
+	card_remove();
+	check_image();
+}
+
+/**
+ * @brief FatFS-like iterations, with and without the block cache. The cache
+ * keeps the FAT and directory sectors, which are only written back by the
+ * final flush.
+ */
+void test_sd_benchmark_cache(void)
+{
+	struct linux_sd_emu_stats uncached;
+	struct linux_sd_emu_stats cached;
+
+	bench_run("fatfs-like, no cache", BENCH_FATFS, 0, &uncached);
+	bench_run("fatfs-like, 16 blocks", BENCH_FATFS, BENCH_CACHE_BLOCKS,
+		  &cached);
+
+	TEST_ASSERT_EQUAL_UINT32(1400, uncached.commands);
+	TEST_ASSERT_EQUAL_UINT32(400, uncached.blocks_read);
+	TEST_ASSERT_EQUAL_UINT32(1200, uncached.blocks_written);
+	TEST_ASSERT_EQUAL_UINT32(604, cached.commands);
+	TEST_ASSERT_EQUAL_UINT32(2, cached.blocks_read);
+	/* The data blocks and the 2 sectors, once */
+	TEST_ASSERT_EQUAL_UINT32(BENCH_ITERATIONS * BENCH_CHUNK_BLOCKS + 2,
+				 cached.blocks_written);
+}
+
+/**
+ * @brief 800 blocks written in 4 block chunks, with sd_write() and with a
+ * single stream kept open across the calls.
+ */
+void test_sd_benchmark_stream(void)
+{
+	struct linux_sd_emu_stats writes;
+	struct linux_sd_emu_stats stream;
+
+	bench_run("800 blocks, sd_write()", BENCH_SD_WRITE, 0, &writes);
+	bench_run("800 blocks, stream", BENCH_STREAM, 0, &stream);
+
+	/* CMD55, ACMD23 and CMD25 for each chunk */
+	TEST_ASSERT_EQUAL_UINT32(3 * BENCH_ITERATIONS, writes.commands);
+	TEST_ASSERT_EQUAL_UINT32(3, stream.commands);
+	TEST_ASSERT_EQUAL_UINT32(BENCH_ITERATIONS * BENCH_CHUNK_BLOCKS,
+				 writes.blocks_written);
+	TEST_ASSERT_EQUAL_UINT32(BENCH_ITERATIONS * BENCH_CHUNK_BLOCKS,
+				 stream.blocks_written);
+}
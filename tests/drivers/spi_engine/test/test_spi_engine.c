@@ -0,0 +1,489 @@
+/***************************************************************************//**
+ *   @file   test_spi_engine.c
+ *   @brief  Unit tests of the SPI engine program cache and continuous offload
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "spi_engine.h"
+#include "spi_engine_private.h"
+#include "no_os_alloc.h"
+#include "no_os_util.h"
+#include "mock_no_os_axi_io.h"
+#include "mock_axi_dmac.h"
+#include "mock_sleep.h"
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+#define MODEL_BASE		0x44a00000
+#define MODEL_RX_DMA_BASE	0x44a30000
+/* 32 bit engine, version 1.3.0 */
+#define MODEL_DATA_WIDTH	32
+#define MODEL_VERSION		0x010300
+#define MODEL_FIFO_DEPTH	64
+#define MODEL_MEM_DEPTH		64
+
+#define TEST_REF_CLK_HZ		100000000
+#define TEST_SPEED_HZ		10000000
+#define TEST_CHIP_SELECT	1
+
+#define BENCH_TRANSFERS		100000
+#define BENCH_CAPTURES		1000
+/* One more message shape than programs in the cache, so every lookup misses */
+#define BENCH_SHAPES		(SPI_ENGINE_PROGRAM_CACHE_DEPTH + 1)
+
+/*
+ * Software model of the SPI engine registers. Words written to the SDO FIFO
+ * come back inverted from the SDI FIFO, the SYNC id register follows the last
+ * SYNC instruction written to the command FIFO. The offload memories keep
+ * their content until the offload reset is asserted.
+ */
+static struct spi_engine_model {
+	uint32_t cmds[MODEL_FIFO_DEPTH];
+	uint32_t nb_cmds;
+	uint32_t sdo[MODEL_FIFO_DEPTH];
+	uint32_t sdo_head;
+	uint32_t sdo_tail;
+	uint32_t sync_id;
+	uint32_t offload_cmds[MODEL_MEM_DEPTH];
+	uint32_t nb_offload_cmds;
+	uint32_t offload_sdo[MODEL_MEM_DEPTH];
+	uint32_t nb_offload_sdo;
+	uint32_t offload_ctrl;
+	uint32_t nb_offload_resets;
+	uint32_t nb_writes;
+	uint32_t nb_reads;
+	uint64_t sleep_us;
+	uint32_t nb_dma_starts;
+	uint32_t dma_size;
+} model;
+
+static struct no_os_spi_desc *desc;
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+static int32_t model_read(uint32_t base, uint32_t offset, uint32_t *data,
+			  int num_calls)
+{
+	TEST_ASSERT_EQUAL_UINT32(MODEL_BASE, base);
+
+	model.nb_reads++;
+	switch (offset) {
+	case SPI_ENGINE_REG_VERSION:
+		*data = MODEL_VERSION;
+		break;
+	case SPI_ENGINE_REG_DATA_WIDTH:
+		*data = MODEL_DATA_WIDTH;
+		break;
+	case SPI_ENGINE_REG_SYNC_ID:
+		*data = model.sync_id;
+		break;
+	case SPI_ENGINE_REG_SDI_DATA_FIFO:
+		TEST_ASSERT_TRUE(model.sdo_tail != model.sdo_head);
+		*data = ~model.sdo[model.sdo_tail++ % MODEL_FIFO_DEPTH];
+		break;
+	default:
+		*data = 0;
+		break;
+	}
+
+	return 0;
+}
+
+static int32_t model_write(uint32_t base, uint32_t offset, uint32_t data,
+			   int num_calls)
+{
+	TEST_ASSERT_EQUAL_UINT32(MODEL_BASE, base);
+
+	model.nb_writes++;
+	switch (offset) {
+	case SPI_ENGINE_REG_CMD_FIFO:
+		model.cmds[model.nb_cmds++ % MODEL_FIFO_DEPTH] = data;
+		if ((data & 0xff00) == SPI_ENGINE_CMD_SYNC(0))
+			model.sync_id = data & 0xff;
+		break;
+	case SPI_ENGINE_REG_SDO_DATA_FIFO:
+		model.sdo[model.sdo_head++ % MODEL_FIFO_DEPTH] = data;
+		break;
+	case SPI_ENGINE_REG_OFFLOAD_CTRL(0):
+		model.offload_ctrl = data;
+		break;
+	case SPI_ENGINE_REG_OFFLOAD_RESET(0):
+		if (!data)
+			break;
+		model.nb_offload_cmds = 0;
+		model.nb_offload_sdo = 0;
+		model.nb_offload_resets++;
+		break;
+	case SPI_ENGINE_REG_OFFLOAD_CMD_MEM(0):
+		TEST_ASSERT_LESS_THAN(MODEL_MEM_DEPTH, model.nb_offload_cmds);
+		model.offload_cmds[model.nb_offload_cmds++] = data;
+		break;
+	case SPI_ENGINE_REG_OFFLOAD_SDO_MEM(0):
+		TEST_ASSERT_LESS_THAN(MODEL_MEM_DEPTH, model.nb_offload_sdo);
+		model.offload_sdo[model.nb_offload_sdo++] = data;
+		break;
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+static int model_usleep(unsigned long useconds, int num_calls)
+{
+	model.sleep_us += useconds;
+
+	return 0;
+}
+
+static int32_t model_dmac_init(struct axi_dmac **dmac,
+			       const struct axi_dmac_init *init, int num_calls)
+{
+	TEST_ASSERT_EQUAL_UINT32(MODEL_RX_DMA_BASE, init->base);
+
+	*dmac = no_os_calloc(1, sizeof(**dmac));
+	TEST_ASSERT_NOT_NULL(*dmac);
+	(*dmac)->base = init->base;
+	(*dmac)->width_src = 4;
+
+	return 0;
+}
+
+static int32_t model_dmac_remove(struct axi_dmac *dmac, int num_calls)
+{
+	no_os_free(dmac);
+
+	return 0;
+}
+
+static int32_t model_dmac_start(struct axi_dmac *dmac,
+				struct axi_dma_transfer *xfer, int num_calls)
+{
+	model.nb_dma_starts++;
+	model.dma_size = xfer->size;
+
+	return 0;
+}
+
+static void model_clear_counts(void)
+{
+	model.nb_cmds = 0;
+	model.nb_writes = 0;
+	model.nb_reads = 0;
+	model.sleep_us = 0;
+	model.nb_dma_starts = 0;
+}
+
+static int32_t offload_init(bool continuous)
+{
+	struct spi_engine_offload_init_param param = {
+		.rx_dma_baseaddr = MODEL_RX_DMA_BASE,
+		.offload_config = OFFLOAD_RX_EN,
+		.continuous = continuous,
+	};
+
+	return spi_engine_offload_init(desc, &param);
+}
+
+static int32_t offload_capture(uint32_t *data)
+{
+	uint32_t cmds[] = {CS_LOW, WRITE_READ(2), CS_HIGH};
+	struct spi_engine_offload_message msg = {
+		.commands = cmds,
+		.no_commands = NO_OS_ARRAY_SIZE(cmds),
+		.commands_data = data,
+		.rx_addr = 0x800000,
+	};
+
+	return spi_engine_offload_transfer(desc, msg, 16);
+}
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static void bench_report(const char *name, uint64_t ns, uint32_t nb,
+			 uint32_t writes, uint64_t sleep_us)
+{
+	char msg[120];
+
+	snprintf(msg, sizeof(msg),
+		 "%-24s %5llu ns/call, %3u writes/call, %4llu us sleep/call",
+		 name, (unsigned long long)(ns / nb), writes / nb,
+		 (unsigned long long)(sleep_us / nb));
+	TEST_MESSAGE(msg);
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	struct spi_engine_init_param eng_param = {
+		.ref_clk_hz = TEST_REF_CLK_HZ,
+		.type = SPI_ENGINE,
+		.spi_engine_baseaddr = MODEL_BASE,
+		.data_width = 8,
+	};
+	struct no_os_spi_init_param param = {
+		.max_speed_hz = TEST_SPEED_HZ,
+		.chip_select = TEST_CHIP_SELECT,
+		.mode = NO_OS_SPI_MODE_0,
+		.extra = &eng_param,
+	};
+
+	memset(&model, 0, sizeof(model));
+	no_os_axi_io_read_StubWithCallback(model_read);
+	no_os_axi_io_write_StubWithCallback(model_write);
+	usleep_StubWithCallback(model_usleep);
+	axi_dmac_init_StubWithCallback(model_dmac_init);
+	axi_dmac_remove_StubWithCallback(model_dmac_remove);
+	axi_dmac_transfer_start_StubWithCallback(model_dmac_start);
+	axi_dmac_transfer_wait_completion_IgnoreAndReturn(0);
+
+	TEST_ASSERT_EQUAL_INT32(0, spi_engine_init(&desc, &param));
+	model_clear_counts();
+}
+
+void tearDown(void)
+{
+	spi_engine_remove(desc);
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+/**
+ * @brief A transfer served from the program cache writes the same commands as
+ * the one that compiled the program, except for the rolling SYNC id.
+ */
+void test_spi_engine_program_cache(void)
+{
+	uint32_t expected[] = {
+		SPI_ENGINE_CMD_CONFIG(SPI_ENGINE_CMD_REG_CONFIG, 0),
+		SPI_ENGINE_CMD_CONFIG(SPI_ENGINE_CMD_DATA_TRANSFER_LEN, 8),
+		SPI_ENGINE_CMD_CONFIG(SPI_ENGINE_CMD_REG_CLK_DIV, 4),
+		SPI_ENGINE_CMD_ASSERT(0, 0xff),
+		SPI_ENGINE_CMD_ASSERT(0, 0xff ^ NO_OS_BIT(TEST_CHIP_SELECT)),
+		SPI_ENGINE_CMD_TRANSFER(SPI_ENGINE_INSTRUCTION_TRANSFER_RW, 2),
+		SPI_ENGINE_CMD_ASSERT(0, 0xff),
+	};
+	uint8_t data[3];
+	uint32_t i;
+
+	for (i = 0; i < 2; i++) {
+		data[0] = 0x12;
+		data[1] = 0x34;
+		data[2] = 0x56 + i;
+		model.nb_cmds = 0;
+
+		TEST_ASSERT_EQUAL_INT32(0, spi_engine_write_and_read(desc, data,
+					sizeof(data)));
+
+		TEST_ASSERT_EQUAL_UINT32(NO_OS_ARRAY_SIZE(expected) + 1,
+					 model.nb_cmds);
+		TEST_ASSERT_EQUAL_UINT32_ARRAY(expected, model.cmds,
+					       NO_OS_ARRAY_SIZE(expected));
+		TEST_ASSERT_EQUAL_HEX32(SPI_ENGINE_CMD_SYNC(model.sync_id),
+					model.cmds[NO_OS_ARRAY_SIZE(expected)]);
+		TEST_ASSERT_EQUAL_HEX8(0xed, data[0]);
+		TEST_ASSERT_EQUAL_HEX8(0xcb, data[1]);
+		TEST_ASSERT_EQUAL_HEX8(0xa9 - i, data[2]);
+	}
+}
+
+/**
+ * @brief A cached program is not reused once the engine configuration it was
+ * compiled for changes.
+ */
+void test_spi_engine_program_cache_config(void)
+{
+	uint8_t data[2] = {0};
+
+	TEST_ASSERT_EQUAL_INT32(0, spi_engine_write_and_read(desc, data,
+				sizeof(data)));
+
+	spi_engine_set_speed(desc, TEST_SPEED_HZ / 2);
+	model.nb_cmds = 0;
+	TEST_ASSERT_EQUAL_INT32(0, spi_engine_write_and_read(desc, data,
+				sizeof(data)));
+	TEST_ASSERT_EQUAL_HEX32(SPI_ENGINE_CMD_CONFIG(
+					SPI_ENGINE_CMD_REG_CLK_DIV, 9),
+				model.cmds[2]);
+
+	spi_engine_set_transfer_width(desc, 16);
+	model.nb_cmds = 0;
+	TEST_ASSERT_EQUAL_INT32(0, spi_engine_write_and_read(desc, data,
+				sizeof(data)));
+	TEST_ASSERT_EQUAL_HEX32(SPI_ENGINE_CMD_CONFIG(
+					SPI_ENGINE_CMD_DATA_TRANSFER_LEN, 16),
+				model.cmds[1]);
+	/* Two bytes are now a single 16 bit word */
+	TEST_ASSERT_EQUAL_HEX32(SPI_ENGINE_CMD_TRANSFER(
+					SPI_ENGINE_INSTRUCTION_TRANSFER_RW, 0),
+				model.cmds[5]);
+}
+
+/**
+ * @brief Without continuous mode every capture reloads the offload module and
+ * waits for it to settle.
+ */
+void test_spi_engine_offload(void)
+{
+	uint32_t data[] = {0xa5, 0x5a};
+	uint32_t i;
+
+	for (i = 0; i < 2; i++) {
+		TEST_ASSERT_EQUAL_INT32(0, offload_init(false));
+		model_clear_counts();
+		TEST_ASSERT_EQUAL_INT32(0, offload_capture(data));
+
+		TEST_ASSERT_EQUAL_UINT32(i + 1, model.nb_offload_resets);
+		/* Configuration, 3 commands and the SYNC */
+		TEST_ASSERT_EQUAL_UINT32(7, model.nb_offload_cmds);
+		TEST_ASSERT_EQUAL_UINT32(2, model.nb_offload_sdo);
+		TEST_ASSERT_EQUAL_UINT32_ARRAY(data, model.offload_sdo, 2);
+		TEST_ASSERT_EQUAL_UINT32(1, model.offload_ctrl);
+		TEST_ASSERT_EQUAL_UINT32(1, model.nb_dma_starts);
+		TEST_ASSERT_EQUAL_UINT32(4 * 2 * 16, model.dma_size);
+		TEST_ASSERT_EQUAL_UINT64(1000, model.sleep_us);
+	}
+}
+
+/**
+ * @brief In continuous mode a capture with the same program and SDO data only
+ * re-enables the offload module, even after FIFO transfers in between. New
+ * SDO data reloads it.
+ */
+void test_spi_engine_offload_continuous(void)
+{
+	uint32_t data[] = {0xa5, 0x5a};
+	uint8_t buf[2] = {0};
+
+	TEST_ASSERT_EQUAL_INT32(0, offload_init(true));
+	TEST_ASSERT_EQUAL_INT32(0, offload_capture(data));
+	TEST_ASSERT_EQUAL_UINT32(1, model.nb_offload_resets);
+	TEST_ASSERT_EQUAL_UINT32(7, model.nb_offload_cmds);
+	TEST_ASSERT_EQUAL_UINT64(0, model.sleep_us);
+
+	/* FIFO transfers disable the offload module but keep its memories */
+	TEST_ASSERT_EQUAL_INT32(0, spi_engine_write_and_read(desc, buf,
+				sizeof(buf)));
+	TEST_ASSERT_EQUAL_UINT32(0, model.offload_ctrl);
+
+	TEST_ASSERT_EQUAL_INT32(0, offload_init(true));
+	model_clear_counts();
+	TEST_ASSERT_EQUAL_INT32(0, offload_capture(data));
+	TEST_ASSERT_EQUAL_UINT32(1, model.nb_offload_resets);
+	TEST_ASSERT_EQUAL_UINT32(1, model.nb_writes);
+	TEST_ASSERT_EQUAL_UINT32(1, model.offload_ctrl);
+	TEST_ASSERT_EQUAL_UINT32(1, model.nb_dma_starts);
+	TEST_ASSERT_EQUAL_UINT32(4 * 2 * 16, model.dma_size);
+
+	data[1] = 0x66;
+	TEST_ASSERT_EQUAL_INT32(0, offload_capture(data));
+	TEST_ASSERT_EQUAL_UINT32(2, model.nb_offload_resets);
+	TEST_ASSERT_EQUAL_UINT32_ARRAY(data, model.offload_sdo, 2);
+
+	/* Leaving continuous mode reloads the offload module */
+	TEST_ASSERT_EQUAL_INT32(0, offload_init(false));
+	TEST_ASSERT_EQUAL_INT32(0, offload_capture(data));
+	TEST_ASSERT_EQUAL_UINT32(3, model.nb_offload_resets);
+}
+
+/**
+ * @brief Cost of a register transfer served from the program cache and of one
+ * that misses it, and of an offload capture with and without continuous mode.
+ * The mocked bus costs nothing, so the time is the driver's own overhead.
+ */
+void test_spi_engine_benchmark(void)
+{
+	uint8_t data[BENCH_SHAPES] = {0};
+	uint32_t buf[] = {0xa5, 0x5a};
+	uint64_t start;
+	uint32_t i;
+
+	start = now_ns();
+	for (i = 0; i < BENCH_TRANSFERS; i++)
+		spi_engine_write_and_read(desc, data, 2);
+	bench_report("transfer, cache hit", now_ns() - start, BENCH_TRANSFERS,
+		     model.nb_writes, model.sleep_us);
+
+	model_clear_counts();
+	start = now_ns();
+	for (i = 0; i < BENCH_TRANSFERS; i++)
+		spi_engine_write_and_read(desc, data, 2 + i % BENCH_SHAPES);
+	bench_report("transfer, cache miss", now_ns() - start, BENCH_TRANSFERS,
+		     model.nb_writes, model.sleep_us);
+
+	model_clear_counts();
+	start = now_ns();
+	for (i = 0; i < BENCH_CAPTURES; i++) {
+		offload_init(false);
+		offload_capture(buf);
+	}
+	bench_report("offload capture", now_ns() - start, BENCH_CAPTURES,
+		     model.nb_writes, model.sleep_us);
+	TEST_ASSERT_EQUAL_UINT64(1000ull * BENCH_CAPTURES, model.sleep_us);
+	TEST_ASSERT_EQUAL_UINT32(12 * BENCH_CAPTURES, model.nb_writes);
+
+	model_clear_counts();
+	start = now_ns();
+	for (i = 0; i < BENCH_CAPTURES; i++) {
+		offload_init(true);
+		offload_capture(buf);
+	}
+	bench_report("offload capture, cont.", now_ns() - start,
+		     BENCH_CAPTURES, model.nb_writes, model.sleep_us);
+	TEST_ASSERT_EQUAL_UINT64(0, model.sleep_us);
+	/* Only the first capture loads the offload module */
+	TEST_ASSERT_EQUAL_UINT32(12 + BENCH_CAPTURES - 1, model.nb_writes);
+}
@@ -0,0 +1,337 @@
+/***************************************************************************//**
+ *   @file   test_iio_attr_lookup.c
+ *   @brief  Microbenchmark of the indexed IIO attribute lookup.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "iio.h"
+#include "iiod.h"
+#include "mock_no_os_uart.h"
+#include "no_os_util.h"
+#include <errno.h>
+#include <stdio.h>
+#include <time.h>
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+/* Sized like an ad9081 / adrv9009 context */
+#define NB_DEVS			4
+#define NB_CHANNELS		64
+#define NB_ATTRS		8
+#define BENCH_CMDS		20000
+#define SESSION_MAX_LEN		(BENCH_CMDS * 64)
+
+static const char * const attr_names[NB_ATTRS] = {
+	"raw", "scale", "offset", "sampling_frequency", "hardwaregain",
+	"calibbias", "rf_bandwidth", "filter_fir_en",
+};
+
+static struct iio_attribute dev_attrs[NB_ATTRS + 1];
+static struct iio_attribute ch_attrs[NB_ATTRS + 1];
+static struct iio_channel channels[NB_CHANNELS];
+static struct iio_device iio_devs[NB_DEVS];
+static struct iio_device_init devs_init[NB_DEVS];
+static uint32_t dev_ids[NB_DEVS];
+static char dev_names[NB_DEVS][16];
+
+static char session[SESSION_MAX_LEN];
+static uint32_t session_len;
+static uint32_t session_cmds;
+static uint32_t rx_idx;
+
+static char answer[0x1000];
+static uint32_t answer_len;
+static uint32_t sent_lines;
+static uint32_t show_calls;
+
+static char conn_buf[0x1000];
+
+/* Attribute index entries visited by the lookups, counted by iio.c */
+extern uint32_t iio_attr_index_probes;
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+/* Answer with the device, channel and attribute the request resolved to */
+static int lookup_show(void *device, char *buf, uint32_t len,
+		       const struct iio_ch_info *channel, intptr_t priv)
+{
+	show_calls++;
+
+	if (!channel)
+		return snprintf(buf, len, "%u.dev.%d", *(uint32_t *)device,
+				(int)priv);
+
+	return snprintf(buf, len, "%u.%d.%d", *(uint32_t *)device,
+			channel->ch_num, (int)priv);
+}
+
+static int lookup_recv(void *conn, uint8_t *buf, uint32_t len)
+{
+	if (rx_idx == session_len)
+		return -EAGAIN;
+
+	len = no_os_min(len, session_len - rx_idx);
+	memcpy(buf, session + rx_idx, len);
+	rx_idx += len;
+
+	return len;
+}
+
+static int lookup_send(void *conn, uint8_t *buf, uint32_t len)
+{
+	uint32_t i;
+
+	for (i = 0; i < len; i++)
+		if (buf[i] == '\n')
+			sent_lines++;
+
+	if (answer_len + len < sizeof(answer)) {
+		memcpy(answer + answer_len, buf, len);
+		answer_len += len;
+		answer[answer_len] = '\0';
+	}
+
+	return len;
+}
+
+static void lookup_setup_attrs(struct iio_attribute *attrs)
+{
+	uint32_t i;
+
+	for (i = 0; i < NB_ATTRS; i++) {
+		attrs[i].name = attr_names[i];
+		attrs[i].priv = i;
+		attrs[i].show = lookup_show;
+	}
+	attrs[NB_ATTRS].name = NULL;
+}
+
+/* Build a context of nb_devs devices with nb_ch input voltage channels */
+static struct iio_desc *lookup_init(uint32_t nb_devs, uint32_t nb_ch)
+{
+	struct iio_local_backend backend = {
+		.local_backend_event_read = lookup_recv,
+		.local_backend_event_write = lookup_send,
+		.local_backend_buff = conn_buf,
+		.local_backend_buff_len = sizeof(conn_buf),
+	};
+	struct iio_init_param param = {
+		.phy_type = USE_LOCAL_BACKEND,
+		.local_backend = &backend,
+		.devs = devs_init,
+		.nb_devs = nb_devs,
+	};
+	struct iio_desc *desc;
+	uint32_t i;
+
+	lookup_setup_attrs(dev_attrs);
+	lookup_setup_attrs(ch_attrs);
+
+	for (i = 0; i < NB_CHANNELS; i++) {
+		channels[i].ch_type = IIO_VOLTAGE;
+		channels[i].channel = i;
+		channels[i].scan_index = i;
+		channels[i].indexed = true;
+		channels[i].attributes = ch_attrs;
+	}
+
+	for (i = 0; i < nb_devs; i++) {
+		iio_devs[i].num_ch = nb_ch;
+		iio_devs[i].channels = channels;
+		iio_devs[i].attributes = dev_attrs;
+		dev_ids[i] = i;
+		sprintf(dev_names[i], "dev%u", i);
+		devs_init[i].name = dev_names[i];
+		devs_init[i].dev = &dev_ids[i];
+		devs_init[i].dev_descriptor = &iio_devs[i];
+	}
+
+	TEST_ASSERT_EQUAL_INT(0, iio_init(&desc, &param));
+
+	return desc;
+}
+
+static void lookup_session_add(const char *cmd)
+{
+	strcpy(session + session_len, cmd);
+	session_len += strlen(cmd);
+	session_cmds++;
+}
+
+/* Serve the session until the expected lines are sent, return the ns spent */
+static uint64_t lookup_serve(struct iio_desc *desc, uint32_t lines)
+{
+	struct timespec start, end;
+	int ret;
+
+	rx_idx = 0;
+	answer_len = 0;
+	sent_lines = 0;
+	show_calls = 0;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	while (rx_idx != session_len || sent_lines != lines) {
+		ret = iio_step(desc);
+		TEST_ASSERT_TRUE(ret == 0 || ret == -EAGAIN);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	return (uint64_t)(end.tv_sec - start.tv_sec) * 1000000000ull +
+	       end.tv_nsec - start.tv_nsec;
+}
+
+/* Random READs spread over every device, channel and attribute in use */
+static void lookup_session_random(uint32_t nb_devs, uint32_t nb_ch)
+{
+	uint32_t seed = 0x12345678;
+	uint32_t i, dev, ch, attr;
+	char cmd[96];
+
+	session_len = 0;
+	session_cmds = 0;
+	for (i = 0; i < BENCH_CMDS; i++) {
+		seed = seed * 1103515245 + 12345;
+		dev = (seed >> 8) % nb_devs;
+		ch = (seed >> 12) % nb_ch;
+		attr = (seed >> 20) % NB_ATTRS;
+		sprintf(cmd, "READ iio:device%u INPUT voltage%u %s\r\n", dev,
+			ch, attr_names[attr]);
+		lookup_session_add(cmd);
+	}
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	session_len = 0;
+	session_cmds = 0;
+}
+
+void tearDown(void)
+{
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+void test_iio_attr_lookup_resolves(void)
+{
+	struct iio_desc *desc = lookup_init(NB_DEVS, NB_CHANNELS);
+
+	lookup_session_add("READ iio:device3 INPUT voltage63 "
+			   "filter_fir_en\r\n");
+	lookup_session_add("READ iio:device0 INPUT voltage17 scale\r\n");
+	lookup_session_add("READ iio:device2 sampling_frequency\r\n");
+	lookup_session_add("READ iio:device1 INPUT voltage5 raw\r\n");
+	lookup_serve(desc, 2 * session_cmds);
+
+	TEST_ASSERT_EQUAL_UINT32(session_cmds, show_calls);
+	TEST_ASSERT_EQUAL_STRING("6\n3.63.7\n6\n0.17.1\n7\n2.dev.3\n"
+				 "5\n1.5.0\n", answer);
+
+	TEST_ASSERT_EQUAL_INT(0, iio_remove(desc));
+}
+
+void test_iio_attr_lookup_misses(void)
+{
+	struct iio_desc *desc = lookup_init(NB_DEVS, NB_CHANNELS);
+
+	lookup_session_add("READ iio:device4 INPUT voltage0 raw\r\n");
+	lookup_session_add("READ iio:device0 INPUT voltage64 raw\r\n");
+	lookup_session_add("READ iio:device0 OUTPUT voltage0 raw\r\n");
+	lookup_session_add("READ iio:device0 INPUT voltage0 rawx\r\n");
+	/* Devices are addressed by id, not by name */
+	lookup_session_add("READ dev1 INPUT voltage5 raw\r\n");
+	/* Each miss is answered with a single error code line */
+	lookup_serve(desc, session_cmds);
+
+	TEST_ASSERT_EQUAL_UINT32(0, show_calls);
+
+	TEST_ASSERT_EQUAL_INT(0, iio_remove(desc));
+}
+
+void test_iio_attr_lookup_benchmark(void)
+{
+	struct iio_desc *desc;
+	uint64_t small_ns, large_ns;
+	uint32_t small_probes, large_probes;
+	char msg[160];
+
+	/* Same request mix against a single channel context... */
+	desc = lookup_init(1, 1);
+	lookup_session_random(1, 1);
+	iio_attr_index_probes = 0;
+	small_ns = lookup_serve(desc, 2 * session_cmds);
+	small_probes = iio_attr_index_probes;
+	TEST_ASSERT_EQUAL_UINT32(session_cmds, show_calls);
+	TEST_ASSERT_EQUAL_INT(0, iio_remove(desc));
+
+	/* ...and against NB_DEVS * NB_CHANNELS channels */
+	desc = lookup_init(NB_DEVS, NB_CHANNELS);
+	lookup_session_random(NB_DEVS, NB_CHANNELS);
+	iio_attr_index_probes = 0;
+	large_ns = lookup_serve(desc, 2 * session_cmds);
+	large_probes = iio_attr_index_probes;
+	TEST_ASSERT_EQUAL_UINT32(session_cmds, show_calls);
+	TEST_ASSERT_EQUAL_INT(0, iio_remove(desc));
+
+	snprintf(msg, sizeof(msg),
+		 "%u READs: 1 channel: %llu ns/cmd, %u channels: %llu ns/cmd",
+		 session_cmds, (unsigned long long)(small_ns / session_cmds),
+		 NB_DEVS * NB_CHANNELS,
+		 (unsigned long long)(large_ns / session_cmds));
+	TEST_MESSAGE(msg);
+	snprintf(msg, sizeof(msg),
+		 "index probes: 1 channel: %u, %u channels: %u",
+		 small_probes, NB_DEVS * NB_CHANNELS, large_probes);
+	TEST_MESSAGE(msg);
+
+	/*
+	 * The lookup cost must not grow with the number of channels. Count the
+	 * index entries visited rather than the time spent, so that the result
+	 * doesn't depend on the load of the machine running the test.
+	 */
+	TEST_ASSERT_GREATER_OR_EQUAL_UINT32(session_cmds, small_probes);
+	TEST_ASSERT_LESS_THAN_UINT32(2 * small_probes, large_probes);
+}
@@ -0,0 +1,434 @@
+/***************************************************************************//**
+ *   @file   test_iio_capture.c
+ *   @brief  Unit tests of the IIO buffer to file capture
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "iio.h"
+#include "iiod.h"
+#include "iio_capture.h"
+#include "mock_no_os_uart.h"
+#include "mock_no_os_delay.h"
+#include "no_os_util.h"
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+#define FILE_SIZE		0x4000
+/* Two 16 bit channels */
+#define SCAN_BYTES		4
+#define BLOCK_SCANS		4
+#define BLOCK_BYTES		(BLOCK_SCANS * SCAN_BYTES)
+#define CAPTURE_MASK		0x3
+
+/* Capture file kept in memory */
+static struct mem_file {
+	uint8_t data[FILE_SIZE];
+	uint32_t len;
+	/* If not 0, largest length accepted by one write, to split writes */
+	uint32_t max_write;
+	uint32_t nb_writes;
+	uint32_t nb_syncs;
+} file;
+
+static struct scan_type s12_le = {
+	.sign = 's',
+	.realbits = 12,
+	.storagebits = 16,
+	.shift = 0,
+	.is_big_endian = false,
+};
+
+static struct scan_type u14_be = {
+	.sign = 'u',
+	.realbits = 14,
+	.storagebits = 16,
+	.shift = 2,
+	.is_big_endian = true,
+};
+
+static struct scan_type u32_le = {
+	.sign = 'u',
+	.realbits = 32,
+	.storagebits = 32,
+	.shift = 0,
+	.is_big_endian = false,
+};
+
+static struct iio_channel channels[] = {
+	{
+		.ch_type = IIO_VOLTAGE,
+		.channel = 0,
+		.scan_index = 0,
+		.scan_type = &s12_le,
+		.indexed = true,
+	}, {
+		.ch_type = IIO_VOLTAGE,
+		.channel = 1,
+		.scan_index = 1,
+		.scan_type = &u14_be,
+		.indexed = true,
+	}, {
+		.ch_type = IIO_TEMP,
+		.scan_index = 2,
+		.scan_type = &u32_le,
+	},
+};
+
+static struct iio_device iio_dev;
+static struct iio_capture_desc *capture;
+/* Index of the next scan produced */
+static uint32_t next_scan;
+static uint32_t nb_pre_enable;
+static uint32_t nb_post_disable;
+static struct no_os_time now;
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+static int mem_write(void *f, const void *buf, uint32_t len)
+{
+	struct mem_file *mf = f;
+
+	if (mf->len == FILE_SIZE)
+		return -ENOSPC;
+
+	if (mf->max_write)
+		len = no_os_min(len, mf->max_write);
+	len = no_os_min(len, FILE_SIZE - mf->len);
+	memcpy(mf->data + mf->len, buf, len);
+	mf->len += len;
+	mf->nb_writes++;
+
+	return len;
+}
+
+static int mem_sync(void *f)
+{
+	struct mem_file *mf = f;
+
+	mf->nb_syncs++;
+
+	return 0;
+}
+
+static const struct iio_capture_ops mem_ops = {
+	.write = mem_write,
+	.sync = mem_sync,
+};
+
+/* Scan n holds n on the first channel and ~n on the second one */
+static void make_scan(uint32_t n, uint16_t *scan)
+{
+	scan[0] = n;
+	scan[1] = ~n;
+}
+
+static int32_t dev_read(void *dev, void *buff, uint32_t nb_samples)
+{
+	uint16_t *scans = buff;
+	uint32_t i;
+
+	for (i = 0; i < nb_samples; i++)
+		make_scan(next_scan++, scans + 2 * i);
+
+	return nb_samples;
+}
+
+static int32_t dev_pre_enable(void *dev, uint32_t mask)
+{
+	TEST_ASSERT_EQUAL_HEX32(CAPTURE_MASK, mask);
+	nb_pre_enable++;
+
+	return 0;
+}
+
+static int32_t dev_post_disable(void *dev)
+{
+	nb_post_disable++;
+
+	return 0;
+}
+
+static struct no_os_time get_time(int num_calls)
+{
+	return now;
+}
+
+static void push_scans(uint32_t nb)
+{
+	struct iio_buffer *buffer = iio_capture_get_buffer(capture);
+	uint16_t scan[2];
+
+	while (nb--) {
+		make_scan(next_scan++, scan);
+		iio_buffer_push_scan(buffer, scan);
+	}
+}
+
+static void capture_create(uint32_t mask, uint32_t samples,
+			   bool external_producer)
+{
+	struct iio_capture_init_param param = {
+		.name = "capture-test",
+		.dev_descriptor = &iio_dev,
+		.mask = mask,
+		.samples = samples,
+		.ops = &mem_ops,
+		.file = &file,
+		.external_producer = external_producer,
+	};
+
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_init(&capture, &param));
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_start(capture));
+	TEST_ASSERT_EQUAL_UINT32(IIO_CAPTURE_HEADER_ALIGN, file.len);
+}
+
+/* Check that the file holds nb consecutive scans from first, at offset */
+static void check_scans(uint32_t offset, uint32_t first, uint32_t nb)
+{
+	uint16_t scan[2];
+	uint32_t i;
+
+	TEST_ASSERT_LESS_OR_EQUAL_UINT32(file.len, offset + nb * SCAN_BYTES);
+	for (i = 0; i < nb; i++) {
+		make_scan(first + i, scan);
+		TEST_ASSERT_EQUAL_MEMORY(scan, file.data + offset +
+					 i * SCAN_BYTES, SCAN_BYTES);
+	}
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	memset(&file, 0, sizeof(file));
+	memset(&iio_dev, 0, sizeof(iio_dev));
+	iio_dev.num_ch = NO_OS_ARRAY_SIZE(channels);
+	iio_dev.channels = channels;
+	iio_dev.read_dev = dev_read;
+	iio_dev.pre_enable = dev_pre_enable;
+	iio_dev.post_disable = dev_post_disable;
+
+	capture = NULL;
+	next_scan = 0;
+	nb_pre_enable = 0;
+	nb_post_disable = 0;
+	now.s = 100;
+	now.us = 0;
+	no_os_get_time_StubWithCallback(get_time);
+}
+
+void tearDown(void)
+{
+	if (capture)
+		iio_capture_remove(capture);
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+void test_capture_header(void)
+{
+	const char expected[] =
+		"iio-capture 1\n"
+		"header_len 00000512\n"
+		"device capture-test\n"
+		"scan_bytes 8\n"
+		"channels 2\n"
+		"channel voltage0 0 le:s12/16>>0\n"
+		"channel temp 2 le:u32/32>>0\n"
+		"data\n";
+	uint32_t len = sizeof(expected) - 1;
+	uint32_t i;
+
+	/* The second channel is left out, the third one is 32 bit aligned */
+	iio_dev.pre_enable = NULL;
+	capture_create(0x5, BLOCK_SCANS, true);
+
+	TEST_ASSERT_EQUAL_MEMORY(expected, file.data, len);
+	for (i = len; i < IIO_CAPTURE_HEADER_ALIGN - 1; i++)
+		TEST_ASSERT_EQUAL_HEX8(' ', file.data[i]);
+	TEST_ASSERT_EQUAL_HEX8('\n', file.data[IIO_CAPTURE_HEADER_ALIGN - 1]);
+
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_stop(capture));
+	TEST_ASSERT_EQUAL_UINT32(IIO_CAPTURE_HEADER_ALIGN, file.len);
+	TEST_ASSERT_EQUAL_UINT32(1, file.nb_syncs);
+	TEST_ASSERT_EQUAL_UINT32(1, nb_post_disable);
+}
+
+void test_capture_big_endian_channel_header(void)
+{
+	capture_create(CAPTURE_MASK, BLOCK_SCANS, true);
+
+	TEST_ASSERT_NOT_NULL(strstr((char *)file.data,
+				    "scan_bytes 4\nchannels 2\n"
+				    "channel voltage0 0 le:s12/16>>0\n"
+				    "channel voltage1 1 be:u14/16>>2\n"
+				    "data\n"));
+	TEST_ASSERT_EQUAL_UINT32(1, nb_pre_enable);
+}
+
+/* The device fills a block on each step, the file takes it in short writes */
+void test_capture_read_dev_short_writes(void)
+{
+	struct iio_capture_stats stats;
+	uint32_t i;
+
+	file.max_write = 3;
+	capture_create(CAPTURE_MASK, BLOCK_SCANS, false);
+
+	for (i = 0; i < 5; i++)
+		TEST_ASSERT_EQUAL_INT(0, iio_capture_step(capture));
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_stop(capture));
+
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_get_stats(capture, &stats));
+	TEST_ASSERT_EQUAL_UINT32(5 * BLOCK_BYTES, stats.bytes);
+	TEST_ASSERT_EQUAL_UINT32(5, stats.blocks);
+	TEST_ASSERT_EQUAL_UINT32(0, stats.overruns);
+	TEST_ASSERT_EQUAL_UINT32(IIO_CAPTURE_HEADER_ALIGN + 5 * BLOCK_BYTES,
+				 file.len);
+	check_scans(IIO_CAPTURE_HEADER_ALIGN, 0, 5 * BLOCK_SCANS);
+	TEST_ASSERT_EQUAL_UINT32(1, file.nb_syncs);
+	TEST_ASSERT_EQUAL_UINT32(1, nb_post_disable);
+}
+
+/* A producer filling more than nb_blocks blocks overwrites the oldest data */
+void test_capture_overrun(void)
+{
+	struct iio_capture_stats stats;
+	uint32_t offset = IIO_CAPTURE_HEADER_ALIGN;
+
+	capture_create(CAPTURE_MASK, BLOCK_SCANS, true);
+
+	/* Three blocks in the two block buffer, the first one is lost */
+	push_scans(3 * BLOCK_SCANS);
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_step(capture));
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_get_stats(capture, &stats));
+	TEST_ASSERT_EQUAL_UINT32(1, stats.overruns);
+	TEST_ASSERT_EQUAL_UINT32(2, stats.blocks);
+	check_scans(offset, BLOCK_SCANS, 2 * BLOCK_SCANS);
+	offset += 2 * BLOCK_BYTES;
+
+	/* Keeping up with the producer doesn't count more overruns */
+	push_scans(2 * BLOCK_SCANS);
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_step(capture));
+	push_scans(BLOCK_SCANS);
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_step(capture));
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_get_stats(capture, &stats));
+	TEST_ASSERT_EQUAL_UINT32(1, stats.overruns);
+	TEST_ASSERT_EQUAL_UINT32(5, stats.blocks);
+	check_scans(offset, 3 * BLOCK_SCANS, 3 * BLOCK_SCANS);
+
+	/* Two more overruns, one per lost block */
+	push_scans(3 * BLOCK_SCANS);
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_step(capture));
+	push_scans(3 * BLOCK_SCANS);
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_step(capture));
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_get_stats(capture, &stats));
+	TEST_ASSERT_EQUAL_UINT32(3, stats.overruns);
+	TEST_ASSERT_EQUAL_UINT32(9, stats.blocks);
+	TEST_ASSERT_EQUAL_UINT32(9 * BLOCK_BYTES, stats.bytes);
+}
+
+/* Steps only write full blocks, stop also writes the last partial one */
+void test_capture_partial_final_drain(void)
+{
+	struct iio_capture_stats stats;
+
+	capture_create(CAPTURE_MASK, BLOCK_SCANS, true);
+
+	push_scans(BLOCK_SCANS + 2);
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_step(capture));
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_step(capture));
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_get_stats(capture, &stats));
+	TEST_ASSERT_EQUAL_UINT32(BLOCK_BYTES, stats.bytes);
+	TEST_ASSERT_EQUAL_UINT32(1, stats.blocks);
+	TEST_ASSERT_EQUAL_UINT32(0, file.nb_syncs);
+
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_stop(capture));
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_get_stats(capture, &stats));
+	TEST_ASSERT_EQUAL_UINT32(BLOCK_BYTES + 2 * SCAN_BYTES, stats.bytes);
+	TEST_ASSERT_EQUAL_UINT32(2, stats.blocks);
+	TEST_ASSERT_EQUAL_UINT32(0, stats.overruns);
+	TEST_ASSERT_EQUAL_UINT32(IIO_CAPTURE_HEADER_ALIGN + stats.bytes,
+				 file.len);
+	check_scans(IIO_CAPTURE_HEADER_ALIGN, 0, BLOCK_SCANS + 2);
+	TEST_ASSERT_EQUAL_UINT32(1, file.nb_syncs);
+
+	/* The capture is already stopped */
+	TEST_ASSERT_EQUAL_INT(-EINVAL, iio_capture_stop(capture));
+}
+
+/* The throughput is in MB/s, over the time from start to the last write */
+void test_capture_throughput(void)
+{
+	struct iio_capture_stats stats;
+
+	/* 4000 byte blocks */
+	capture_create(CAPTURE_MASK, 1000, true);
+
+	push_scans(1000);
+	now.us = 2000;
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_step(capture));
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_get_stats(capture, &stats));
+	TEST_ASSERT_EQUAL_UINT32(2000, stats.elapsed_us);
+	TEST_ASSERT_EQUAL_UINT32(2, stats.mbytes_per_sec);
+
+	/* 8000 bytes in 2.5 ms, 3.2 MB/s */
+	push_scans(1000);
+	now.us = 2500;
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_step(capture));
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_get_stats(capture, &stats));
+	TEST_ASSERT_EQUAL_UINT32(2500, stats.elapsed_us);
+	TEST_ASSERT_EQUAL_UINT32(3, stats.mbytes_per_sec);
+
+	/* Elapsed time across a second boundary, 12000 bytes in 1.0005 s */
+	push_scans(1000);
+	now.s++;
+	now.us = 500;
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_step(capture));
+	TEST_ASSERT_EQUAL_INT(0, iio_capture_get_stats(capture, &stats));
+	TEST_ASSERT_EQUAL_UINT32(1000500, stats.elapsed_us);
+	TEST_ASSERT_EQUAL_UINT32(0, stats.mbytes_per_sec);
+}
@@ -0,0 +1,340 @@
+/***************************************************************************//**
+ *   @file   test_iio_metrics.c
+ *   @brief  Unit tests of the IIO server metrics context attribute
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "iio.h"
+#include "iiod.h"
+#include "mock_no_os_uart.h"
+#include "no_os_util.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+#define NB_CHANNELS		2
+#define METRICS_ATTR \
+	"<context-attribute name=\"iiod_metrics\" value=\""
+
+/* Index of the commands in the cmd= list, see struct iiod_metrics */
+enum metrics_cmd {
+	CMD_PRINT = 2,
+	CMD_VERSION = 3,
+	CMD_READ = 7,
+};
+
+/* Metrics parsed back from the context attribute */
+struct parsed_metrics {
+	uint32_t cmds[IIOD_METRICS_NB_CMDS];
+	uint32_t parse_errors;
+	uint64_t readbuf_bytes;
+	uint64_t writebuf_bytes;
+	uint32_t overruns;
+	uint32_t hist[IIOD_METRICS_NB_STATES][IIOD_METRICS_HIST_LEN];
+	uint32_t hist_len[IIOD_METRICS_NB_STATES];
+};
+
+static struct iio_attribute ch_attrs[] = {
+	{
+		.name = "raw",
+		.show = NULL,
+	},
+	END_ATTRIBUTES_ARRAY,
+};
+static struct iio_channel channels[NB_CHANNELS];
+static struct iio_device iio_dev;
+static struct iio_device_init dev_init;
+static uint32_t dev_id;
+
+static char session[0x400];
+static uint32_t session_len;
+static uint32_t rx_idx;
+
+static char answer[0x4000];
+static uint32_t answer_len;
+static uint32_t sent_lines;
+
+static char conn_buf[0x1000];
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+static int metrics_show(void *device, char *buf, uint32_t len,
+			const struct iio_ch_info *channel, intptr_t priv)
+{
+	return snprintf(buf, len, "%d", channel->ch_num);
+}
+
+static int metrics_recv(void *conn, uint8_t *buf, uint32_t len)
+{
+	if (rx_idx == session_len)
+		return -EAGAIN;
+
+	len = no_os_min(len, session_len - rx_idx);
+	memcpy(buf, session + rx_idx, len);
+	rx_idx += len;
+
+	return len;
+}
+
+static int metrics_send(void *conn, uint8_t *buf, uint32_t len)
+{
+	uint32_t i;
+
+	for (i = 0; i < len; i++)
+		if (buf[i] == '\n')
+			sent_lines++;
+
+	TEST_ASSERT_LESS_THAN_UINT32(sizeof(answer), answer_len + len);
+	memcpy(answer + answer_len, buf, len);
+	answer_len += len;
+	answer[answer_len] = '\0';
+
+	return len;
+}
+
+static struct iio_desc *metrics_init(void)
+{
+	struct iio_local_backend backend = {
+		.local_backend_event_read = metrics_recv,
+		.local_backend_event_write = metrics_send,
+		.local_backend_buff = conn_buf,
+		.local_backend_buff_len = sizeof(conn_buf),
+	};
+	struct iio_init_param param = {
+		.phy_type = USE_LOCAL_BACKEND,
+		.local_backend = &backend,
+		.devs = &dev_init,
+		.nb_devs = 1,
+	};
+	struct iio_desc *desc;
+	uint32_t i;
+
+	ch_attrs[0].show = metrics_show;
+	for (i = 0; i < NB_CHANNELS; i++) {
+		channels[i].ch_type = IIO_VOLTAGE;
+		channels[i].channel = i;
+		channels[i].scan_index = i;
+		channels[i].indexed = true;
+		channels[i].attributes = ch_attrs;
+	}
+	iio_dev.num_ch = NB_CHANNELS;
+	iio_dev.channels = channels;
+	dev_init.name = "dev0";
+	dev_init.dev = &dev_id;
+	dev_init.dev_descriptor = &iio_dev;
+
+	TEST_ASSERT_EQUAL_INT(0, iio_init(&desc, &param));
+
+	return desc;
+}
+
+/* Send cmds and serve them until the expected answer lines are sent */
+static void metrics_serve(struct iio_desc *desc, const char *cmds,
+			  uint32_t lines)
+{
+	strcpy(session, cmds);
+	session_len = strlen(cmds);
+	rx_idx = 0;
+	answer_len = 0;
+	answer[0] = '\0';
+	sent_lines = 0;
+
+	/* Failing commands are answered with an error code line */
+	while (rx_idx != session_len || sent_lines != lines)
+		iio_step(desc);
+}
+
+/* Parse a comma separated list of counters, return the number of entries */
+static uint32_t parse_list(char **p, uint32_t *vals, uint32_t max)
+{
+	uint32_t nb = 0;
+
+	while (nb < max && **p >= '0' && **p <= '9') {
+		vals[nb++] = strtoul(*p, p, 10);
+		if (**p != ',')
+			break;
+		(*p)++;
+	}
+
+	return nb;
+}
+
+static void expect_key(char **p, const char *key)
+{
+	TEST_ASSERT_EQUAL_STRING_LEN(key, *p, strlen(key));
+	*p += strlen(key);
+}
+
+/* Fetch the xml with PRINT and parse the value of the metrics attribute */
+static void metrics_read(struct iio_desc *desc, struct parsed_metrics *m)
+{
+	char key[8];
+	char *p;
+	uint32_t j;
+
+	/* Length line and xml line */
+	metrics_serve(desc, "PRINT\r\n", 2);
+
+	p = strstr(answer, METRICS_ATTR);
+	TEST_ASSERT_NOT_NULL(p);
+	p += strlen(METRICS_ATTR);
+
+	memset(m, 0, sizeof(*m));
+	expect_key(&p, "cmd=");
+	TEST_ASSERT_EQUAL_UINT32(IIOD_METRICS_NB_CMDS,
+				 parse_list(&p, m->cmds, IIOD_METRICS_NB_CMDS));
+	expect_key(&p, " perr=");
+	m->parse_errors = strtoul(p, &p, 10);
+	expect_key(&p, " rdbuf=");
+	m->readbuf_bytes = strtoull(p, &p, 10);
+	expect_key(&p, " wrbuf=");
+	m->writebuf_bytes = strtoull(p, &p, 10);
+	expect_key(&p, " ovr=");
+	TEST_ASSERT_EQUAL_UINT32(1, parse_list(&p, &m->overruns, 1));
+	for (j = 0; j < IIOD_METRICS_NB_STATES; j++) {
+		sprintf(key, " h%u=", j);
+		expect_key(&p, key);
+		m->hist_len[j] = parse_list(&p, m->hist[j],
+					    IIOD_METRICS_HIST_LEN);
+	}
+
+	/* The rest of the value is padding up to the closing quote */
+	while (*p == ' ')
+		p++;
+	TEST_ASSERT_EQUAL_HEX8('"', *p);
+}
+
+static uint32_t hist_sum(const struct parsed_metrics *m, uint32_t state)
+{
+	uint32_t i, sum = 0;
+
+	for (i = 0; i < m->hist_len[state]; i++)
+		sum += m->hist[state][i];
+
+	return sum;
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	session_len = 0;
+	rx_idx = 0;
+}
+
+void tearDown(void)
+{
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+void test_iio_metrics_counters(void)
+{
+	struct iio_desc *desc = metrics_init();
+	struct parsed_metrics m;
+	uint32_t j;
+
+	/* The metrics of a fresh context only count the PRINT reading them */
+	metrics_read(desc, &m);
+	for (j = 0; j < IIOD_METRICS_NB_CMDS; j++)
+		TEST_ASSERT_EQUAL_UINT32(j == CMD_PRINT, m.cmds[j]);
+	TEST_ASSERT_EQUAL_UINT32(0, m.parse_errors);
+
+	metrics_serve(desc, "VERSION\r\n"
+		      "READ iio:device0 INPUT voltage0 raw\r\n"
+		      "READ iio:device0 INPUT voltage1 raw\r\n"
+		      "READ iio:device0 INPUT voltage1 raw\r\n"
+		      "NOT A COMMAND\r\n"
+		      "READBUF iio:device0 many\r\n", 9);
+
+	metrics_read(desc, &m);
+	TEST_ASSERT_EQUAL_UINT32(2, m.cmds[CMD_PRINT]);
+	TEST_ASSERT_EQUAL_UINT32(1, m.cmds[CMD_VERSION]);
+	TEST_ASSERT_EQUAL_UINT32(3, m.cmds[CMD_READ]);
+	for (j = 0; j < IIOD_METRICS_NB_CMDS; j++)
+		if (j != CMD_PRINT && j != CMD_VERSION && j != CMD_READ)
+			TEST_ASSERT_EQUAL_UINT32(0, m.cmds[j]);
+	TEST_ASSERT_EQUAL_UINT32(2, m.parse_errors);
+	TEST_ASSERT_EQUAL_UINT64(0, m.readbuf_bytes);
+	TEST_ASSERT_EQUAL_UINT64(0, m.writebuf_bytes);
+	TEST_ASSERT_EQUAL_UINT32(0, m.overruns);
+
+	TEST_ASSERT_EQUAL_INT(0, iio_remove(desc));
+}
+
+void test_iio_metrics_histograms(void)
+{
+	struct iio_desc *desc = metrics_init();
+	struct parsed_metrics before, after;
+	uint32_t j;
+
+	metrics_read(desc, &before);
+	metrics_serve(desc, "READ iio:device0 INPUT voltage0 raw\r\n"
+		      "READ iio:device0 INPUT voltage1 raw\r\n", 4);
+	metrics_read(desc, &after);
+
+	for (j = 0; j < IIOD_METRICS_NB_STATES; j++) {
+		/* Trailing empty buckets are trimmed */
+		if (after.hist_len[j])
+			TEST_ASSERT_NOT_EQUAL(0,
+					      after.hist[j][after.hist_len[j] -
+							    1]);
+		/* Steps are only ever added */
+		TEST_ASSERT_GREATER_OR_EQUAL_UINT32(hist_sum(&before, j),
+						    hist_sum(&after, j));
+	}
+
+	/*
+	 * Each command line goes through reading the line, running the
+	 * command and writing the result: the two READs and the first PRINT.
+	 */
+	for (j = 0; j < 3; j++)
+		TEST_ASSERT_GREATER_OR_EQUAL_UINT32(hist_sum(&before, j) + 3,
+						    hist_sum(&after, j));
+
+	TEST_ASSERT_EQUAL_INT(0, iio_remove(desc));
+}
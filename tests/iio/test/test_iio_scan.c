@@ -0,0 +1,384 @@
+/***************************************************************************//**
+ *   @file   test_iio_scan.c
+ *   @brief  Unit tests of the IIO scan element conversions
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "iio_scan.h"
+#include "no_os_util.h"
+#include <errno.h>
+#include <string.h>
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+/* Odd lengths, so that no block size is a multiple of a vector width */
+static const uint32_t sample_counts[] = {1, 3, 7, 33, 101};
+
+#define MAX_SAMPLES		101
+#define MAX_CH			7
+/* Bytes appended to every output buffer, must not be written */
+#define CANARY_LEN		8
+#define CANARY			0xA5
+
+static uint32_t seed;
+static uint8_t src[MAX_SAMPLES * MAX_CH * 4 + CANARY_LEN];
+static uint8_t dst[MAX_SAMPLES * MAX_CH * 4 + CANARY_LEN];
+static uint8_t ref[MAX_SAMPLES * MAX_CH * 4 + CANARY_LEN];
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+static uint8_t rand8(void)
+{
+	seed = seed * 1103515245 + 12345;
+
+	return seed >> 16;
+}
+
+static void fill_random(uint8_t *buf, uint32_t len)
+{
+	uint32_t i;
+
+	for (i = 0; i < len; i++)
+		buf[i] = rand8();
+}
+
+static void check_canary(const uint8_t *buf, uint32_t len)
+{
+	uint32_t i;
+
+	for (i = 0; i < CANARY_LEN; i++)
+		TEST_ASSERT_EQUAL_HEX8(CANARY, buf[len + i]);
+}
+
+/* Read and write a sample of the given width in CPU endianness */
+static uint32_t sample_get(const uint8_t *buf, uint32_t i, uint8_t bytes)
+{
+	uint8_t v8;
+	uint16_t v16;
+	uint32_t v32;
+
+	switch (bytes) {
+	case 1:
+		memcpy(&v8, buf + i, 1);
+		return v8;
+	case 2:
+		memcpy(&v16, buf + 2 * i, 2);
+		return v16;
+	default:
+		memcpy(&v32, buf + 4 * i, 4);
+		return v32;
+	}
+}
+
+static void sample_set(uint8_t *buf, uint32_t i, uint8_t bytes, uint32_t val)
+{
+	uint8_t v8 = val;
+	uint16_t v16 = val;
+
+	switch (bytes) {
+	case 1:
+		memcpy(buf + i, &v8, 1);
+		break;
+	case 2:
+		memcpy(buf + 2 * i, &v16, 2);
+		break;
+	default:
+		memcpy(buf + 4 * i, &val, 4);
+		break;
+	}
+}
+
+/* Reference of iio_scan_sign_extend() for a single sample */
+static uint32_t ref_sign_extend(const struct scan_type *type, uint32_t raw)
+{
+	uint32_t mask = type->realbits == 32 ? 0xFFFFFFFF :
+			(1u << type->realbits) - 1;
+	uint32_t storage = type->storagebits == 32 ? 0xFFFFFFFF :
+			   (1u << type->storagebits) - 1;
+	uint32_t val = (raw >> type->shift) & mask;
+
+	if (type->sign == 's' && (val & (1u << (type->realbits - 1))))
+		val |= ~mask;
+
+	return val & storage;
+}
+
+/* Sign extend MAX_SAMPLES random samples and compare with the reference */
+static void check_sign_extend(struct scan_type *type, char sign)
+{
+	uint8_t bytes = type->storagebits / 8;
+	uint32_t i;
+
+	type->sign = sign;
+	memset(src, CANARY, sizeof(src));
+	fill_random(src, MAX_SAMPLES * bytes);
+	/* Only the sign bit set, then all the bits cleared */
+	sample_set(src, 0, bytes, 1u << (type->realbits - 1 + type->shift));
+	sample_set(src, 1, bytes, 0);
+	memcpy(dst, src, sizeof(dst));
+
+	TEST_ASSERT_EQUAL_INT(0, iio_scan_sign_extend(type, dst, MAX_SAMPLES));
+	for (i = 0; i < MAX_SAMPLES; i++)
+		TEST_ASSERT_EQUAL_HEX32(ref_sign_extend(type,
+							sample_get(src, i,
+									bytes)),
+					sample_get(dst, i, bytes));
+	check_canary(dst, MAX_SAMPLES * bytes);
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	seed = 0x12345678;
+	memset(dst, CANARY, sizeof(dst));
+	memset(ref, 0, sizeof(ref));
+}
+
+void tearDown(void)
+{
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+void test_iio_scan_unpack_be(void)
+{
+	static const struct {
+		uint8_t storagebits;
+		uint8_t src_bytes;
+	} cases[] = {
+		{8, 1}, {16, 1}, {16, 2}, {32, 1}, {32, 2}, {32, 3}, {32, 4},
+	};
+	struct scan_type type = {.sign = 'u'};
+	uint32_t c, n, i, nb, val;
+	uint8_t bytes, j;
+
+	for (c = 0; c < NO_OS_ARRAY_SIZE(cases); c++) {
+		type.storagebits = cases[c].storagebits;
+		bytes = type.storagebits / 8;
+		for (n = 0; n < NO_OS_ARRAY_SIZE(sample_counts); n++) {
+			nb = sample_counts[n];
+			fill_random(src, nb * cases[c].src_bytes);
+			memset(dst, CANARY, sizeof(dst));
+
+			TEST_ASSERT_EQUAL_INT(0, iio_scan_unpack_be(&type,
+					      dst, src, cases[c].src_bytes,
+					      nb));
+
+			for (i = 0; i < nb; i++) {
+				val = 0;
+				for (j = 0; j < cases[c].src_bytes; j++)
+					val = (val << 8) |
+					      src[i * cases[c].src_bytes + j];
+				TEST_ASSERT_EQUAL_HEX32(val,
+							sample_get(dst, i,
+									bytes));
+			}
+			check_canary(dst, nb * bytes);
+		}
+	}
+
+	type.storagebits = 16;
+	TEST_ASSERT_EQUAL_INT(-EINVAL, iio_scan_unpack_be(&type, dst, src, 0,
+			      1));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, iio_scan_unpack_be(&type, dst, src, 3,
+			      1));
+	type.storagebits = 24;
+	TEST_ASSERT_EQUAL_INT(-EINVAL, iio_scan_unpack_be(&type, dst, src, 3,
+			      1));
+}
+
+void test_iio_scan_swab(void)
+{
+	struct scan_type type = {.sign = 'u'};
+	uint32_t n, i, nb;
+	uint8_t bytes, j;
+
+	for (bytes = 1; bytes <= 4; bytes *= 2) {
+		type.storagebits = bytes * 8;
+		for (n = 0; n < NO_OS_ARRAY_SIZE(sample_counts); n++) {
+			nb = sample_counts[n];
+			memset(dst, CANARY, sizeof(dst));
+			fill_random(dst, nb * bytes);
+			memcpy(src, dst, nb * bytes);
+
+			TEST_ASSERT_EQUAL_INT(0, iio_scan_swab(&type, dst,
+					      nb));
+			for (i = 0; i < nb; i++)
+				for (j = 0; j < bytes; j++)
+					TEST_ASSERT_EQUAL_HEX8(
+						src[i * bytes + j],
+						dst[i * bytes + bytes - 1 - j]);
+			check_canary(dst, nb * bytes);
+
+			/* Swapping twice gives back the samples */
+			TEST_ASSERT_EQUAL_INT(0, iio_scan_swab(&type, dst,
+					      nb));
+			TEST_ASSERT_EQUAL_HEX8_ARRAY(src, dst, nb * bytes);
+		}
+	}
+
+	type.storagebits = 64;
+	TEST_ASSERT_EQUAL_INT(-EINVAL, iio_scan_swab(&type, dst, 1));
+}
+
+void test_iio_scan_sign_extend(void)
+{
+	struct scan_type type;
+	uint8_t bytes;
+
+	/* Every realbits, with the value at bit 0 and at the top of the word */
+	for (bytes = 1; bytes <= 4; bytes *= 2) {
+		type.storagebits = bytes * 8;
+		for (type.realbits = 1; type.realbits <= type.storagebits;
+		     type.realbits++) {
+			type.shift = 0;
+			check_sign_extend(&type, 'u');
+			check_sign_extend(&type, 's');
+			type.shift = type.storagebits - type.realbits;
+			check_sign_extend(&type, 'u');
+			check_sign_extend(&type, 's');
+		}
+	}
+
+	type.storagebits = 16;
+	type.realbits = 0;
+	type.shift = 0;
+	TEST_ASSERT_EQUAL_INT(-EINVAL, iio_scan_sign_extend(&type, dst, 1));
+	type.realbits = 12;
+	type.shift = 5;
+	TEST_ASSERT_EQUAL_INT(-EINVAL, iio_scan_sign_extend(&type, dst, 1));
+}
+
+void test_iio_scan_select(void)
+{
+	static const uint8_t widths[] = {1, 2, 3, 4};
+	uint32_t mask, nb_ch, ch, k, w;
+	uint8_t bytes;
+
+	for (w = 0; w < NO_OS_ARRAY_SIZE(widths); w++) {
+		bytes = widths[w];
+		for (nb_ch = 1; nb_ch <= MAX_CH; nb_ch++) {
+			/* Every mask, with bits above nb_ch ignored */
+			for (mask = 0; mask < (2u << nb_ch); mask++) {
+				fill_random(src, nb_ch * bytes);
+				memset(dst, CANARY, sizeof(dst));
+
+				k = 0;
+				for (ch = 0; ch < nb_ch; ch++) {
+					if (!(mask & NO_OS_BIT(ch)))
+						continue;
+					memcpy(ref + k * bytes,
+					       src + ch * bytes, bytes);
+					k++;
+				}
+
+				TEST_ASSERT_EQUAL_UINT32(k,
+					iio_scan_select(dst, src, mask, nb_ch,
+							bytes));
+				if (k)
+					TEST_ASSERT_EQUAL_HEX8_ARRAY(ref, dst,
+								     k * bytes);
+				check_canary(dst, k * bytes);
+			}
+		}
+	}
+
+	/* All the 32 channels of the widest mask */
+	fill_random(src, 32 * 2);
+	TEST_ASSERT_EQUAL_UINT32(32, iio_scan_select(dst, src, 0xFFFFFFFF,
+			       32, 2));
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(src, dst, 32 * 2);
+}
+
+void test_iio_scan_interleave(void)
+{
+	static const uint8_t widths[] = {1, 2, 3, 4, 8};
+	static uint8_t planes[MAX_CH][MAX_SAMPLES * 8];
+	static uint8_t out[MAX_CH][MAX_SAMPLES * 8 + CANARY_LEN];
+	static uint8_t set[MAX_CH * MAX_SAMPLES * 8 + CANARY_LEN];
+	const void *srcs[MAX_CH];
+	void *dsts[MAX_CH];
+	uint32_t n, w, nb, nb_ch, ch, i;
+	uint8_t bytes;
+
+	for (ch = 0; ch < MAX_CH; ch++) {
+		srcs[ch] = planes[ch];
+		dsts[ch] = out[ch];
+	}
+
+	for (w = 0; w < NO_OS_ARRAY_SIZE(widths); w++) {
+		bytes = widths[w];
+		for (nb_ch = 1; nb_ch <= MAX_CH; nb_ch++) {
+			for (n = 0; n < NO_OS_ARRAY_SIZE(sample_counts); n++) {
+				nb = sample_counts[n];
+				for (ch = 0; ch < nb_ch; ch++)
+					fill_random(planes[ch], nb * bytes);
+				memset(set, CANARY, sizeof(set));
+				memset(out, CANARY, sizeof(out));
+
+				iio_scan_interleave(set, srcs, nb_ch, nb,
+						    bytes);
+				for (i = 0; i < nb; i++)
+					for (ch = 0; ch < nb_ch; ch++)
+						TEST_ASSERT_EQUAL_HEX8_ARRAY(
+							planes[ch] + i * bytes,
+							set + (i * nb_ch + ch) *
+							bytes, bytes);
+				check_canary(set, nb * nb_ch * bytes);
+
+				/* and back to the per channel buffers */
+				iio_scan_deinterleave(dsts, set, nb_ch, nb,
+						      bytes);
+				for (ch = 0; ch < nb_ch; ch++) {
+					TEST_ASSERT_EQUAL_HEX8_ARRAY(
+						planes[ch], out[ch],
+						nb * bytes);
+					check_canary(out[ch], nb * bytes);
+				}
+			}
+		}
+	}
+}
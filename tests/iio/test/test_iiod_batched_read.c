@@ -0,0 +1,338 @@
+/***************************************************************************//**
+ *   @file   test_iiod_batched_read.c
+ *   @brief  Dashboard refresh latency of READ and READMULTI over a pty.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+#include "unity.h"
+#include "iiod.h"
+#include "no_os_alloc.h"
+#include "no_os_util.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+/* Attributes shown by a dashboard refresh, as READ tuples */
+static const char * const refresh_attrs[] = {
+	"iio:device0 INPUT voltage0 raw",
+	"iio:device0 INPUT voltage0 scale",
+	"iio:device0 INPUT voltage1 raw",
+	"iio:device0 INPUT voltage1 scale",
+	"iio:device0 INPUT voltage2 raw",
+	"iio:device0 INPUT voltage3 raw",
+	"iio:device0 INPUT temp0 input",
+	"iio:device0 sampling_frequency",
+	"iio:device1 OUTPUT altvoltage0 frequency",
+	"iio:device1 OUTPUT altvoltage1 frequency",
+	"iio:device1 OUTPUT voltage0 hardwaregain",
+	"iio:device1 OUTPUT voltage1 hardwaregain",
+	"iio:device1 INPUT voltage0 hardwaregain",
+	"iio:device1 INPUT voltage0 rssi",
+	"iio:device1 INPUT voltage1 rssi",
+	"iio:device2 DEBUG direct_reg_access",
+};
+
+#define NB_REFRESH_ATTRS	NO_OS_ARRAY_SIZE(refresh_attrs)
+#define REFRESH_ROUNDS		50
+#define ATTR_VALUE		"1000000"
+
+static int master_fd;
+static int slave_fd;
+static struct iiod_desc *iiod;
+static uint32_t conn_id;
+static char conn_buf[0x1000];
+
+static uint32_t attr_reads;
+static uint32_t round_trips;
+static uint32_t wire_bytes;
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+/* UART side of the server, the slave end of the pty */
+static int pty_recv(struct iiod_ctx *ctx, uint8_t *buf, uint32_t len)
+{
+	ssize_t ret;
+
+	ret = read(slave_fd, buf, len);
+	if (ret < 0)
+		return errno == EAGAIN ? -EAGAIN : -errno;
+	if (!ret)
+		return -EAGAIN;
+
+	return ret;
+}
+
+static int pty_send(struct iiod_ctx *ctx, uint8_t *buf, uint32_t len)
+{
+	ssize_t ret;
+
+	ret = write(slave_fd, buf, len);
+	if (ret < 0)
+		return errno == EAGAIN ? -EAGAIN : -errno;
+
+	return ret;
+}
+
+static int pty_read_attr(struct iiod_ctx *ctx, const char *device,
+			 struct iiod_attr *attr, char *buf, uint32_t len)
+{
+	attr_reads++;
+	strcpy(buf, ATTR_VALUE);
+
+	return strlen(ATTR_VALUE);
+}
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/*
+ * Client side of one request: send it, then step the server until the
+ * expected number of answer lines came back on the master end.
+ */
+static void pty_request(const char *req, uint32_t len, uint32_t lines,
+			char *answer, uint32_t answer_len)
+{
+	uint32_t got = 0, idx = 0;
+	ssize_t ret;
+	char c;
+
+	TEST_ASSERT_EQUAL_INT(len, write(master_fd, req, len));
+	wire_bytes += len;
+	round_trips++;
+
+	while (got < lines) {
+		ret = iiod_conn_step(iiod, conn_id);
+		TEST_ASSERT_TRUE(ret >= 0 || ret == -EAGAIN);
+
+		while (read(master_fd, &c, 1) == 1) {
+			wire_bytes++;
+			if (answer && idx < answer_len - 1)
+				answer[idx++] = c;
+			if (c == '\n')
+				got++;
+		}
+	}
+
+	if (answer)
+		answer[idx] = '\0';
+}
+
+/* One READ round trip per attribute, as stock libiio clients do */
+static void refresh_read(void)
+{
+	char req[64];
+	uint32_t i;
+
+	for (i = 0; i < NB_REFRESH_ATTRS; i++) {
+		sprintf(req, "READ %s\r\n", refresh_attrs[i]);
+		pty_request(req, strlen(req), 2, NULL, 0);
+	}
+}
+
+/* All the attributes in a single READMULTI round trip */
+static void refresh_readmulti(char *answer, uint32_t answer_len)
+{
+	char req[1024];
+	uint32_t i, hdr, len = 0;
+	char payload[1024];
+
+	for (i = 0; i < NB_REFRESH_ATTRS; i++)
+		len += sprintf(payload + len, "%s\n", refresh_attrs[i]);
+
+	hdr = sprintf(req, "READMULTI %u\r\n", len);
+	memcpy(req + hdr, payload, len);
+
+	pty_request(req, hdr + len, 1 + 2 * NB_REFRESH_ATTRS, answer,
+		    answer_len);
+}
+
+static void pty_server_init(bool batched_read)
+{
+	struct iiod_ops ops = {
+		.recv = pty_recv,
+		.send = pty_send,
+		.read_attr = pty_read_attr,
+	};
+	struct iiod_init_param param = {
+		.ops = &ops,
+		.phy_type = USE_UART,
+		.batched_read = batched_read,
+	};
+	struct iiod_conn_data data = {
+		.buf = conn_buf,
+		.len = sizeof(conn_buf),
+	};
+
+	TEST_ASSERT_EQUAL_INT(0, iiod_init(&iiod, &param));
+	TEST_ASSERT_EQUAL_INT(0, iiod_conn_add(iiod, &data, &conn_id));
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	struct termios tio;
+
+	master_fd = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+	TEST_ASSERT_GREATER_OR_EQUAL(0, master_fd);
+	TEST_ASSERT_EQUAL_INT(0, grantpt(master_fd));
+	TEST_ASSERT_EQUAL_INT(0, unlockpt(master_fd));
+
+	slave_fd = open(ptsname(master_fd), O_RDWR | O_NOCTTY | O_NONBLOCK);
+	TEST_ASSERT_GREATER_OR_EQUAL(0, slave_fd);
+
+	/* No echo and no newline translation, like a serial port in raw mode */
+	TEST_ASSERT_EQUAL_INT(0, tcgetattr(slave_fd, &tio));
+	cfmakeraw(&tio);
+	TEST_ASSERT_EQUAL_INT(0, tcsetattr(slave_fd, TCSANOW, &tio));
+
+	attr_reads = 0;
+	round_trips = 0;
+	wire_bytes = 0;
+	iiod = NULL;
+}
+
+void tearDown(void)
+{
+	struct iiod_conn_data data;
+
+	if (iiod) {
+		iiod_conn_remove(iiod, conn_id, &data);
+		iiod_remove(iiod);
+	}
+	close(slave_fd);
+	close(master_fd);
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+void test_iiod_readmulti_answer(void)
+{
+	char answer[1024];
+	char expected[1024];
+	uint32_t i, len;
+
+	pty_server_init(true);
+	refresh_readmulti(answer, sizeof(answer));
+
+	len = sprintf(expected, "%u\n", (unsigned)NB_REFRESH_ATTRS);
+	for (i = 0; i < NB_REFRESH_ATTRS; i++)
+		len += sprintf(expected + len, "%u\n%s\n",
+			       (unsigned)strlen(ATTR_VALUE), ATTR_VALUE);
+
+	TEST_ASSERT_EQUAL_UINT32(NB_REFRESH_ATTRS, attr_reads);
+	TEST_ASSERT_EQUAL_STRING(expected, answer);
+}
+
+void test_iiod_readmulti_disabled(void)
+{
+	char answer[32];
+	const char req[] = "READMULTI 5\r\n";
+
+	/* Stock servers reject the command before reading any payload */
+	pty_server_init(false);
+	pty_request(req, strlen(req), 1, answer, sizeof(answer));
+
+	TEST_ASSERT_EQUAL_UINT32(0, attr_reads);
+	TEST_ASSERT_EQUAL_STRING("-22\n", answer);
+}
+
+void test_iiod_readmulti_benchmark(void)
+{
+	uint32_t read_trips, read_bytes, multi_trips, multi_bytes;
+	uint64_t read_ns, multi_ns;
+	char answer[1024];
+	char msg[200];
+	uint32_t i;
+
+	pty_server_init(true);
+
+	read_ns = now_ns();
+	for (i = 0; i < REFRESH_ROUNDS; i++)
+		refresh_read();
+	read_ns = now_ns() - read_ns;
+	read_trips = round_trips;
+	read_bytes = wire_bytes;
+
+	round_trips = 0;
+	wire_bytes = 0;
+	multi_ns = now_ns();
+	for (i = 0; i < REFRESH_ROUNDS; i++)
+		refresh_readmulti(answer, sizeof(answer));
+	multi_ns = now_ns() - multi_ns;
+	multi_trips = round_trips;
+	multi_bytes = wire_bytes;
+
+	TEST_ASSERT_EQUAL_UINT32(2 * REFRESH_ROUNDS * NB_REFRESH_ATTRS,
+				 attr_reads);
+
+	/*
+	 * At 115200 baud (~11.5 bytes/ms) the bytes on the wire dominate, the
+	 * pty only adds the per round trip latency.
+	 */
+	snprintf(msg, sizeof(msg),
+		 "%u attrs/refresh: READ %llu us/refresh %u trips %u bytes, "
+		 "READMULTI %llu us/refresh %u trips %u bytes",
+		 (unsigned)NB_REFRESH_ATTRS,
+		 (unsigned long long)(read_ns / REFRESH_ROUNDS / 1000),
+		 read_trips / REFRESH_ROUNDS, read_bytes / REFRESH_ROUNDS,
+		 (unsigned long long)(multi_ns / REFRESH_ROUNDS / 1000),
+		 multi_trips / REFRESH_ROUNDS, multi_bytes / REFRESH_ROUNDS);
+	TEST_MESSAGE(msg);
+
+	TEST_ASSERT_EQUAL_UINT32(REFRESH_ROUNDS, multi_trips);
+	TEST_ASSERT_LESS_THAN(read_bytes, multi_bytes);
+	/* The times depend on the machine load, they are only reported */
+}
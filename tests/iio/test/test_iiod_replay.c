@@ -0,0 +1,237 @@
+/***************************************************************************//**
+ *   @file   test_iiod_replay.c
+ *   @brief  Replay of a libiio attribute polling session against iiod.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "iiod.h"
+#include "no_os_util.h"
+#include <errno.h>
+#include <time.h>
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+/*
+ * One polling round of a libiio client (iio_attr / IIO Oscilloscope plot
+ * refresh) as captured on the wire.
+ */
+static const char * const poll_round[] = {
+	"READ iio:device0 INPUT voltage0 raw\r\n",
+	"READ iio:device0 INPUT voltage0 scale\r\n",
+	"READ iio:device0 INPUT voltage1 raw\r\n",
+	"READ iio:device0 sampling_frequency\r\n",
+	"READ iio:device1 OUTPUT altvoltage0 frequency\r\n",
+	"READ iio:device1 OUTPUT voltage0 hardwaregain\r\n",
+	"READ iio:device1 INPUT temp0 input\r\n",
+	"READ iio:device2 DEBUG direct_reg_access\r\n",
+};
+
+#define POLL_ROUNDS		500
+#define SESSION_MAX_LEN		(POLL_ROUNDS * 64 * NO_OS_ARRAY_SIZE(poll_round))
+#define ATTR_VALUE		"1000000"
+
+static char session[SESSION_MAX_LEN];
+static uint32_t session_len;
+static uint32_t session_cmds;
+
+static uint32_t rx_idx;
+static uint32_t rx_chunk;
+static uint32_t recv_calls;
+static uint32_t sent_lines;
+static uint32_t attr_reads;
+
+static char conn_buf[0x1000];
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+/* Socket with the whole session pending, returning at most rx_chunk bytes */
+static int replay_recv(struct iiod_ctx *ctx, uint8_t *buf, uint32_t len)
+{
+	recv_calls++;
+	if (rx_idx == session_len)
+		return -EAGAIN;
+
+	len = no_os_min(len, no_os_min(rx_chunk, session_len - rx_idx));
+	memcpy(buf, session + rx_idx, len);
+	rx_idx += len;
+
+	return len;
+}
+
+static int replay_send(struct iiod_ctx *ctx, uint8_t *buf, uint32_t len)
+{
+	uint32_t i;
+
+	for (i = 0; i < len; i++)
+		if (buf[i] == '\n')
+			sent_lines++;
+
+	return len;
+}
+
+static int replay_read_attr(struct iiod_ctx *ctx, const char *device,
+			    struct iiod_attr *attr, char *buf, uint32_t len)
+{
+	attr_reads++;
+	strcpy(buf, ATTR_VALUE);
+
+	return strlen(ATTR_VALUE);
+}
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/* Replay the session through iiod_conn_step and return the elapsed ns */
+static uint64_t replay(uint32_t chunk)
+{
+	struct iiod_ops ops = {
+		.recv = replay_recv,
+		.send = replay_send,
+		.read_attr = replay_read_attr,
+	};
+	struct iiod_init_param param = {
+		.ops = &ops,
+		.phy_type = USE_NETWORK,
+	};
+	struct iiod_conn_data data = {
+		.buf = conn_buf,
+		.len = sizeof(conn_buf),
+	};
+	struct iiod_desc *iiod;
+	uint32_t conn_id;
+	uint64_t start;
+	int32_t ret;
+
+	rx_idx = 0;
+	rx_chunk = chunk;
+	recv_calls = 0;
+	sent_lines = 0;
+	attr_reads = 0;
+
+	TEST_ASSERT_EQUAL_INT(0, iiod_init(&iiod, &param));
+	TEST_ASSERT_EQUAL_INT(0, iiod_conn_add(iiod, &data, &conn_id));
+
+	start = now_ns();
+	do {
+		ret = iiod_conn_step(iiod, conn_id);
+	} while (ret != -EAGAIN || rx_idx != session_len ||
+		 !iiod_conn_is_idle(iiod, conn_id));
+	start = now_ns() - start;
+
+	TEST_ASSERT_EQUAL_INT(0, iiod_conn_remove(iiod, conn_id, &data));
+	iiod_remove(iiod);
+
+	return start;
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	uint32_t i, j;
+
+	session_len = 0;
+	session_cmds = 0;
+	for (i = 0; i < POLL_ROUNDS; i++) {
+		for (j = 0; j < NO_OS_ARRAY_SIZE(poll_round); j++) {
+			strcpy(session + session_len, poll_round[j]);
+			session_len += strlen(poll_round[j]);
+			session_cmds++;
+		}
+	}
+}
+
+void tearDown(void)
+{
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+void test_iiod_replay_answers_every_command(void)
+{
+	replay(UINT32_MAX);
+
+	TEST_ASSERT_EQUAL_UINT32(session_cmds, attr_reads);
+	/* Each READ is answered with the length line and the value line */
+	TEST_ASSERT_EQUAL_UINT32(2 * session_cmds, sent_lines);
+}
+
+void test_iiod_replay_split_commands(void)
+{
+	/* Commands split at every possible position across recv calls */
+	replay(7);
+
+	TEST_ASSERT_EQUAL_UINT32(session_cmds, attr_reads);
+	TEST_ASSERT_EQUAL_UINT32(2 * session_cmds, sent_lines);
+}
+
+void test_iiod_replay_benchmark(void)
+{
+	uint64_t byte_ns, bulk_ns;
+	uint32_t byte_calls, bulk_calls;
+	char msg[160];
+
+	/* One byte per recv call, as the parser used to request */
+	byte_ns = replay(1);
+	byte_calls = recv_calls;
+
+	bulk_ns = replay(UINT32_MAX);
+	bulk_calls = recv_calls;
+
+	snprintf(msg, sizeof(msg),
+		 "%u commands, %u bytes: 1 byte/recv: %u calls %llu ns/cmd, "
+		 "buffered: %u calls %llu ns/cmd",
+		 session_cmds, session_len, byte_calls,
+		 (unsigned long long)(byte_ns / session_cmds), bulk_calls,
+		 (unsigned long long)(bulk_ns / session_cmds));
+	TEST_MESSAGE(msg);
+
+	TEST_ASSERT_GREATER_OR_EQUAL(session_len, byte_calls);
+	TEST_ASSERT_LESS_THAN(session_len / 32, bulk_calls);
+}
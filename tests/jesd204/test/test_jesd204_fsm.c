@@ -0,0 +1,371 @@
+/***************************************************************************//**
+ *   @file   test_jesd204_fsm.c
+ *   @brief  Unit tests of the JESD204 FSM on a 40 device, 4 link topology
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "jesd204.h"
+#include "no_os_alloc.h"
+#include "no_os_delay.h"
+#include "no_os_util.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+TEST_FILE("jesd204-core.c")
+TEST_FILE("jesd204-fsm.c")
+TEST_FILE("linux_delay.c")
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+/*
+ * 40 converter devices spread over 4 links, one clock chip shared by all the
+ * links (also the SYSREF provider) and the top device.
+ */
+#define TEST_LINK_DEVS		40
+#define TEST_LINKS		4
+#define TEST_CLK_DEV		TEST_LINK_DEVS
+#define TEST_TOP_DEV		(TEST_LINK_DEVS + 1)
+#define TEST_DEVS		(TEST_LINK_DEVS + 2)
+
+/* The top device asks for a SYSREF after each link and after the device op */
+#define TEST_SYSREF_OP		JESD204_OP_LINK_PRE_SETUP
+#define TEST_SYSREFS		(TEST_LINKS + 1)
+
+#define TEST_LINK_DELAY_US	200
+#define TEST_CLK_DELAY_US	50
+
+struct test_priv {
+	unsigned int idx;
+};
+
+static struct jesd204_dev_data link_dev_data;
+static struct jesd204_dev_data clk_dev_data;
+static struct jesd204_dev_data top_dev_data;
+
+static struct jesd204_dev *jdevs[TEST_DEVS];
+static struct jesd204_topology *topology;
+
+static pthread_mutex_t test_lock = PTHREAD_MUTEX_INITIALIZER;
+static unsigned int per_device_calls[TEST_DEVS][__JESD204_MAX_OPS];
+static unsigned int per_link_calls[TEST_DEVS][__JESD204_MAX_OPS];
+static unsigned int sysrefs;
+/*
+ * The FSM callbacks don't get the op, it is tracked through the top device:
+ * its per_device callback runs last in each op of the start sequence and
+ * first in each op of the stop sequence.
+ */
+static int cur_op;
+static int clk_busy;
+static bool clk_overlap;
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+static int test_per_device(struct jesd204_dev *jdev,
+			   enum jesd204_state_op_reason reason)
+{
+	struct test_priv *priv = jesd204_dev_priv(jdev);
+	bool top = priv->idx == TEST_TOP_DEV;
+
+	pthread_mutex_lock(&test_lock);
+	if (top && reason == JESD204_STATE_OP_REASON_UNINIT)
+		cur_op--;
+	per_device_calls[priv->idx][cur_op]++;
+	if (top && reason == JESD204_STATE_OP_REASON_INIT)
+		cur_op++;
+	pthread_mutex_unlock(&test_lock);
+
+	return JESD204_STATE_CHANGE_DONE;
+}
+
+static int test_per_link(struct jesd204_dev *jdev,
+			 enum jesd204_state_op_reason reason,
+			 struct jesd204_link *lnk)
+{
+	struct test_priv *priv = jesd204_dev_priv(jdev);
+
+	if (priv->idx == TEST_CLK_DEV) {
+		if (__atomic_fetch_add(&clk_busy, 1, __ATOMIC_SEQ_CST))
+			clk_overlap = true;
+		usleep(TEST_CLK_DELAY_US);
+		__atomic_fetch_sub(&clk_busy, 1, __ATOMIC_SEQ_CST);
+	} else if (priv->idx < TEST_LINK_DEVS) {
+		usleep(TEST_LINK_DELAY_US);
+	}
+
+	pthread_mutex_lock(&test_lock);
+	per_link_calls[priv->idx][cur_op]++;
+	pthread_mutex_unlock(&test_lock);
+
+	return JESD204_STATE_CHANGE_DONE;
+}
+
+static int test_sysref(struct jesd204_dev *jdev)
+{
+	pthread_mutex_lock(&test_lock);
+	sysrefs++;
+	pthread_mutex_unlock(&test_lock);
+
+	return 0;
+}
+
+static unsigned int test_dev_links(unsigned int idx)
+{
+	return idx < TEST_LINK_DEVS ? 1 : TEST_LINKS;
+}
+
+static void test_clear_counts(void)
+{
+	memset(per_device_calls, 0, sizeof(per_device_calls));
+	memset(per_link_calls, 0, sizeof(per_link_calls));
+	sysrefs = 0;
+	clk_overlap = false;
+}
+
+/* Each device runs its per_device op once and its per_link op on each link */
+static void test_check_counts(void)
+{
+	char msg[32];
+	int idx, op;
+
+	for (idx = 0; idx < TEST_DEVS; idx++) {
+		snprintf(msg, sizeof(msg), "device %d", idx);
+		for (op = 0; op < __JESD204_MAX_OPS; op++) {
+			TEST_ASSERT_EQUAL_UINT_MESSAGE(1,
+					per_device_calls[idx][op], msg);
+			TEST_ASSERT_EQUAL_UINT_MESSAGE(test_dev_links(idx),
+					per_link_calls[idx][op], msg);
+		}
+	}
+}
+
+static uint64_t test_fsm_start(enum jesd204_fsm_mode mode)
+{
+	uint64_t start;
+
+	TEST_ASSERT_EQUAL_INT(0, jesd204_fsm_set_mode(topology, mode));
+	test_clear_counts();
+	start = no_os_get_time_ns();
+	TEST_ASSERT_EQUAL_INT(0, jesd204_fsm_start(topology,
+			      JESD204_LINKS_ALL));
+
+	return (no_os_get_time_ns() - start) / 1000;
+}
+
+static void test_fsm_stop(void)
+{
+	TEST_ASSERT_EQUAL_INT(0, jesd204_fsm_stop(topology, JESD204_LINKS_ALL));
+	TEST_ASSERT_EQUAL_INT(0, cur_op);
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	struct jesd204_topology_dev tdevs[TEST_DEVS] = {0};
+	struct test_priv *priv;
+	int idx, op;
+
+	for (op = 0; op < __JESD204_MAX_OPS; op++) {
+		link_dev_data.state_ops[op].per_device = test_per_device;
+		link_dev_data.state_ops[op].per_link = test_per_link;
+		clk_dev_data.state_ops[op].per_device = test_per_device;
+		clk_dev_data.state_ops[op].per_link = test_per_link;
+		top_dev_data.state_ops[op].per_device = test_per_device;
+		top_dev_data.state_ops[op].per_link = test_per_link;
+	}
+	top_dev_data.state_ops[TEST_SYSREF_OP].post_state_sysref = true;
+	clk_dev_data.sysref_cb = test_sysref;
+	link_dev_data.sizeof_priv = sizeof(struct test_priv);
+	clk_dev_data.sizeof_priv = sizeof(struct test_priv);
+	top_dev_data.sizeof_priv = sizeof(struct test_priv);
+
+	for (idx = 0; idx < TEST_DEVS; idx++) {
+		TEST_ASSERT_EQUAL_INT(0, jesd204_dev_register(&jdevs[idx],
+				      idx == TEST_TOP_DEV ? &top_dev_data :
+				      idx == TEST_CLK_DEV ? &clk_dev_data :
+				      &link_dev_data));
+		priv = jesd204_dev_priv(jdevs[idx]);
+		priv->idx = idx;
+		tdevs[idx].jdev = jdevs[idx];
+	}
+
+	for (idx = 0; idx < TEST_LINK_DEVS; idx++) {
+		tdevs[idx].link_ids[0] = idx % TEST_LINKS;
+		tdevs[idx].links_number = 1;
+	}
+	for (idx = 0; idx < TEST_LINKS; idx++) {
+		tdevs[TEST_CLK_DEV].link_ids[idx] = idx;
+		tdevs[TEST_TOP_DEV].link_ids[idx] = idx;
+	}
+	tdevs[TEST_CLK_DEV].links_number = TEST_LINKS;
+	tdevs[TEST_CLK_DEV].is_sysref_provider = true;
+	tdevs[TEST_TOP_DEV].links_number = TEST_LINKS;
+	tdevs[TEST_TOP_DEV].is_top_device = true;
+
+	TEST_ASSERT_EQUAL_INT(0, jesd204_topology_init(&topology, tdevs,
+			      TEST_DEVS));
+	cur_op = 0;
+	test_clear_counts();
+}
+
+void tearDown(void)
+{
+	int idx;
+
+	jesd204_topology_remove(topology);
+	for (idx = 0; idx < TEST_DEVS; idx++)
+		jesd204_dev_unregister(jdevs[idx]);
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+/**
+ * @brief The serial start runs every op once on each device, also past the
+ * first 16 devices, and asks for one SYSREF per link plus the device one.
+ */
+void test_jesd204_fsm_serial(void)
+{
+	char msg[80];
+	uint64_t us;
+
+	us = test_fsm_start(JESD204_FSM_MODE_SERIAL);
+	test_check_counts();
+	TEST_ASSERT_EQUAL_UINT(TEST_SYSREFS, sysrefs);
+	TEST_ASSERT_EQUAL_INT(__JESD204_MAX_OPS, cur_op);
+
+	snprintf(msg, sizeof(msg), "serial start: %llu us",
+		 (unsigned long long)us);
+	TEST_MESSAGE(msg);
+
+	test_fsm_stop();
+}
+
+/**
+ * @brief The parallel start makes the same calls as the serial one, never
+ * enters the shared clock device from two links at once and is faster.
+ */
+void test_jesd204_fsm_parallel(void)
+{
+	uint64_t serial_us, parallel_us;
+	char msg[80];
+
+	TEST_ASSERT_EQUAL_INT(-EINVAL, jesd204_fsm_set_mode(NULL,
+			      JESD204_FSM_MODE_PARALLEL));
+
+	serial_us = test_fsm_start(JESD204_FSM_MODE_SERIAL);
+	test_fsm_stop();
+
+	parallel_us = test_fsm_start(JESD204_FSM_MODE_PARALLEL);
+	test_check_counts();
+	TEST_ASSERT_EQUAL_UINT(TEST_SYSREFS, sysrefs);
+	TEST_ASSERT_FALSE(clk_overlap);
+	TEST_ASSERT_LESS_THAN_UINT64(serial_us, parallel_us);
+
+	snprintf(msg, sizeof(msg), "serial start: %llu us, parallel: %llu us",
+		 (unsigned long long)serial_us,
+		 (unsigned long long)parallel_us);
+	TEST_MESSAGE(msg);
+
+	test_fsm_stop();
+}
+
+/**
+ * @brief The stop sequence walks the ops backwards on every device, without
+ * asking for a SYSREF.
+ */
+void test_jesd204_fsm_stop(void)
+{
+	test_fsm_start(JESD204_FSM_MODE_SERIAL);
+	test_clear_counts();
+
+	test_fsm_stop();
+	test_check_counts();
+	TEST_ASSERT_EQUAL_UINT(0, sysrefs);
+}
+
+/**
+ * @brief The op timing reports the number of per_link calls of each device
+ * and at least the time its callbacks slept.
+ */
+void test_jesd204_fsm_op_timing(void)
+{
+	struct jesd204_op_timing timing;
+	struct jesd204_dev *other;
+	int idx, op, ret;
+
+	test_fsm_start(JESD204_FSM_MODE_SERIAL);
+
+	for (idx = 0; idx < TEST_DEVS; idx++) {
+		for (op = 0; op < __JESD204_MAX_OPS; op++) {
+			ret = jesd204_fsm_get_op_timing(topology, jdevs[idx],
+							op, &timing);
+			TEST_ASSERT_EQUAL_INT(0, ret);
+			TEST_ASSERT_EQUAL_UINT32(test_dev_links(idx),
+						 timing.links);
+			if (idx < TEST_LINK_DEVS)
+				TEST_ASSERT_GREATER_OR_EQUAL_UINT32(
+					TEST_LINK_DELAY_US, timing.per_link_us);
+			else if (idx == TEST_CLK_DEV)
+				TEST_ASSERT_GREATER_OR_EQUAL_UINT32(
+					TEST_LINKS * TEST_CLK_DELAY_US,
+					timing.per_link_us);
+		}
+	}
+
+	TEST_ASSERT_EQUAL_INT(-EINVAL, jesd204_fsm_get_op_timing(topology,
+			      jdevs[0], __JESD204_MAX_OPS, &timing));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, jesd204_fsm_get_op_timing(topology,
+			      jdevs[0], 0, NULL));
+
+	TEST_ASSERT_EQUAL_INT(0, jesd204_dev_register(&other, &link_dev_data));
+	TEST_ASSERT_EQUAL_INT(-ENODEV, jesd204_fsm_get_op_timing(topology,
+			      other, 0, &timing));
+	jesd204_dev_unregister(other);
+
+	test_fsm_stop();
+}
@@ -0,0 +1,266 @@
+/***************************************************************************//**
+ *   @file   test_no_os_crc.c
+ *   @brief  Tests and benchmark of the CRC engine and byte-wise CRCs.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "no_os_crc8.h"
+#include "no_os_crc16.h"
+#include "no_os_crc24.h"
+#include "no_os_crc_engine.h"
+#include "no_os_alloc.h"
+#include "no_os_util.h"
+#include <errno.h>
+#include <stdio.h>
+#include <time.h>
+
+/* The constant engines have no header of their own. */
+TEST_FILE("no_os_crc_tables.c")
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+#define TEST_BUF_SIZE		256
+#define TEST_MAX_LEN		200
+#define BENCH_BLOCK_SIZE	512
+#define BENCH_BLOCKS		4096
+
+static uint8_t buf[TEST_BUF_SIZE];
+static uint8_t bench_buf[BENCH_BLOCK_SIZE];
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+/* Bit at a time reference, MSB first, any width up to 32 bits. */
+static uint32_t ref_crc(uint8_t width, uint32_t poly, const uint8_t *pdata,
+			size_t nbytes, uint32_t crc)
+{
+	uint32_t top = 1u << (width - 1);
+	uint32_t mask = 0xffffffff >> (32 - width);
+	uint8_t bit;
+
+	while (nbytes--) {
+		crc ^= (uint32_t)*pdata++ << (width - 8);
+		for (bit = 0; bit < 8; bit++)
+			crc = (crc & top) ? (crc << 1) ^ poly : crc << 1;
+		crc &= mask;
+	}
+
+	return crc;
+}
+
+/* The byte-wise loop no_os_crc16() used for every length. */
+static uint16_t bytewise_crc16(const uint16_t *table, const uint8_t *pdata,
+			       size_t nbytes, uint16_t crc)
+{
+	while (nbytes--)
+		crc = table[((crc >> 8) ^ *pdata++) & 0xff] ^ (crc << 8);
+
+	return crc;
+}
+
+static void fill(uint8_t *data, size_t len, uint32_t seed)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		seed = seed * 1103515245 + 12345;
+		data[i] = seed >> 16;
+	}
+}
+
+static double mbps(struct timespec *start, size_t bytes)
+{
+	struct timespec end;
+	double ns;
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	ns = (end.tv_sec - start->tv_sec) * 1e9 +
+	     (end.tv_nsec - start->tv_nsec);
+
+	return bytes * 1e3 / ns;
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	fill(buf, sizeof(buf), 1);
+}
+
+void tearDown(void)
+{
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+/* Lengths on both sides of NO_OS_CRC_ENGINE_MIN_LEN, at unaligned offsets. */
+void test_no_os_crc_bytewise_api(void)
+{
+	uint8_t table8[NO_OS_CRC8_TABLE_SIZE];
+	uint16_t table16[NO_OS_CRC16_TABLE_SIZE];
+	uint32_t table24[NO_OS_CRC24_TABLE_SIZE];
+	const uint16_t polys16[] = { 0x1021, 0x755B, 0x8005 };
+	const uint8_t polys8[] = { 0x07, 0x31, 0x9b };
+	size_t len, off, p;
+
+	no_os_crc24_populate_msb(table24, 0x5D6DCB);
+	for (p = 0; p < NO_OS_ARRAY_SIZE(polys8); p++) {
+		no_os_crc8_populate_msb(table8, polys8[p]);
+		no_os_crc16_populate_msb(table16, polys16[p]);
+		for (len = 0; len < TEST_MAX_LEN; len++) {
+			off = len % 7;
+			TEST_ASSERT_EQUAL_HEX8(ref_crc(8, polys8[p], buf + off,
+						       len, 0x5a),
+					       no_os_crc8(table8, buf + off,
+							  len, 0x5a));
+			TEST_ASSERT_EQUAL_HEX16(ref_crc(16, polys16[p],
+							buf + off, len, 0xffff),
+						no_os_crc16(table16, buf + off,
+							    len, 0xffff));
+			TEST_ASSERT_EQUAL_HEX32(ref_crc(24, 0x5D6DCB,
+							buf + off, len,
+							0x123456),
+						no_os_crc24(table24, buf + off,
+							    len, 0x123456));
+		}
+	}
+}
+
+void test_no_os_crc_engine_constant(void)
+{
+	const struct no_os_crc_engine *engines[] = {
+		&no_os_crc8_07_engine,
+		&no_os_crc8_31_engine,
+		&no_os_crc16_1021_engine,
+		&no_os_crc16_755b_engine,
+		&no_os_crc24_5d6dcb_engine,
+	};
+	const struct no_os_crc_engine *e;
+	const uint8_t *data;
+	size_t len, i;
+
+	for (i = 0; i < NO_OS_ARRAY_SIZE(engines); i++) {
+		e = engines[i];
+		TEST_ASSERT_EQUAL_INT(NO_OS_CRC_SLICE_BY_4, e->slices);
+		for (len = 0; len < TEST_MAX_LEN; len++) {
+			data = buf + len % 5;
+			TEST_ASSERT_EQUAL_HEX32(ref_crc(e->width, e->polynomial,
+							data, len, 0),
+						no_os_crc_engine_compute(e,
+								data, len, 0));
+		}
+	}
+}
+
+void test_no_os_crc_engine_init(void)
+{
+	const enum no_os_crc_slices slices[] = {
+		NO_OS_CRC_SLICE_BY_1, NO_OS_CRC_SLICE_BY_4, NO_OS_CRC_SLICE_BY_8
+	};
+	struct no_os_crc_engine *engine;
+	uint32_t crc;
+	size_t i, len;
+
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_crc_engine_init(&engine, 0,
+			      0x07, NO_OS_CRC_SLICE_BY_1));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_crc_engine_init(&engine, 33,
+			      0x07, NO_OS_CRC_SLICE_BY_1));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_crc_engine_init(&engine, 8,
+			      0x07, 2));
+
+	for (i = 0; i < NO_OS_ARRAY_SIZE(slices); i++) {
+		TEST_ASSERT_EQUAL_INT(0, no_os_crc_engine_init(&engine, 32,
+				      0x04C11DB7, slices[i]));
+		for (len = 0; len < TEST_MAX_LEN; len++) {
+			crc = no_os_crc_engine_compute(engine, buf + len % 3,
+						       len, 0xffffffff);
+			TEST_ASSERT_EQUAL_HEX32(ref_crc(32, 0x04C11DB7,
+							buf + len % 3, len,
+							0xffffffff), crc);
+		}
+		no_os_crc_engine_remove(engine);
+	}
+}
+
+/* CRC-16-CCITT over SD sized blocks, as the drivers compute it. */
+void test_no_os_crc_benchmark(void)
+{
+	uint16_t table[NO_OS_CRC16_TABLE_SIZE];
+	struct no_os_crc_engine *engine8;
+	double bytewise, routed, slice8;
+	struct timespec start;
+	uint16_t ref = 0, crc = 0;
+	uint32_t crc8 = 0;
+	char msg[128];
+	int i;
+
+	fill(bench_buf, sizeof(bench_buf), 2);
+	no_os_crc16_populate_msb(table, 0x1021);
+	TEST_ASSERT_EQUAL_INT(0, no_os_crc_engine_init(&engine8, 16, 0x1021,
+			      NO_OS_CRC_SLICE_BY_8));
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < BENCH_BLOCKS; i++)
+		ref = bytewise_crc16(table, bench_buf, BENCH_BLOCK_SIZE, ref);
+	bytewise = mbps(&start, BENCH_BLOCKS * BENCH_BLOCK_SIZE);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < BENCH_BLOCKS; i++)
+		crc = no_os_crc16(table, bench_buf, BENCH_BLOCK_SIZE, crc);
+	routed = mbps(&start, BENCH_BLOCKS * BENCH_BLOCK_SIZE);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < BENCH_BLOCKS; i++)
+		crc8 = no_os_crc_engine_compute(engine8, bench_buf,
+						BENCH_BLOCK_SIZE, crc8);
+	slice8 = mbps(&start, BENCH_BLOCKS * BENCH_BLOCK_SIZE);
+	no_os_crc_engine_remove(engine8);
+
+	TEST_ASSERT_EQUAL_HEX16(ref, crc);
+	TEST_ASSERT_EQUAL_HEX16(ref, crc8);
+
+	snprintf(msg, sizeof(msg),
+		 "CRC-16 %d B blocks: byte-wise %.0f MB/s, "
+		 "no_os_crc16 %.0f MB/s, slice-by-8 %.0f MB/s",
+		 BENCH_BLOCK_SIZE, bytewise, routed, slice8);
+	TEST_MESSAGE(msg);
+}
@@ -0,0 +1,290 @@
+/***************************************************************************//**
+ *   @file   test_no_os_pool.c
+ *   @brief  Tests and benchmark of the block pool and the pooled containers.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "no_os_pool.h"
+#include "no_os_fifo.h"
+#include "no_os_list.h"
+#include "no_os_alloc.h"
+#include "no_os_util.h"
+#include <stdlib.h>
+#include <time.h>
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+/* Queue depth and payload of a UART / DMA SG queue */
+#define BENCH_DEPTH		64
+#define BENCH_ROUNDS		2000
+#define BENCH_LEN		32
+#define BENCH_ELEMS		(BENCH_DEPTH * BENCH_ROUNDS)
+
+struct bench_frame {
+	struct no_os_fifo_element elem;
+	char data[BENCH_LEN];
+};
+
+static struct bench_frame frames[BENCH_DEPTH];
+static char payload[BENCH_LEN];
+
+static uint32_t heap_allocs;
+static uint32_t heap_frees;
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+/* Count the heap traffic of the code under test */
+void *no_os_malloc(size_t size)
+{
+	heap_allocs++;
+
+	return malloc(size);
+}
+
+void *no_os_calloc(size_t nitems, size_t size)
+{
+	heap_allocs++;
+
+	return calloc(nitems, size);
+}
+
+void no_os_free(void *ptr)
+{
+	if (ptr)
+		heap_frees++;
+
+	free(ptr);
+}
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static void bench_report(const char *name, uint64_t ns, uint32_t allocs)
+{
+	char msg[120];
+
+	snprintf(msg, sizeof(msg), "%-22s %4llu ns/elem, %u heap allocs",
+		 name, (unsigned long long)(ns / BENCH_ELEMS), allocs);
+	TEST_MESSAGE(msg);
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	heap_allocs = 0;
+	heap_frees = 0;
+}
+
+void tearDown(void)
+{
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+void test_no_os_pool_alloc_free(void)
+{
+	struct no_os_pool *pool;
+	void *blocks[6];
+	uint32_t i;
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_pool_init(&pool, 24, 4));
+
+	for (i = 0; i < NO_OS_ARRAY_SIZE(blocks); i++) {
+		blocks[i] = no_os_pool_alloc(pool);
+		TEST_ASSERT_NOT_NULL(blocks[i]);
+		TEST_ASSERT_EQUAL_UINT8(0, ((uint8_t *)blocks[i])[23]);
+		memset(blocks[i], 0xA5, 24);
+	}
+
+	/* The last two blocks come from the heap */
+	for (i = 0; i < NO_OS_ARRAY_SIZE(blocks); i++)
+		TEST_ASSERT_EQUAL(i < 4, no_os_pool_owns(pool, blocks[i]));
+	TEST_ASSERT_EQUAL_UINT32(4, pool->nb_alloc);
+	TEST_ASSERT_EQUAL_UINT32(2, pool->nb_heap_alloc);
+	TEST_ASSERT_EQUAL_UINT32(4, pool->peak_used);
+
+	for (i = 0; i < NO_OS_ARRAY_SIZE(blocks); i++)
+		no_os_pool_free(pool, blocks[i]);
+	TEST_ASSERT_EQUAL_UINT32(0, pool->nb_used);
+
+	/* Freed blocks are handed out again, zeroed */
+	blocks[0] = no_os_pool_alloc(pool);
+	TEST_ASSERT_TRUE(no_os_pool_owns(pool, blocks[0]));
+	TEST_ASSERT_EQUAL_UINT8(0, ((uint8_t *)blocks[0])[0]);
+	no_os_pool_free(pool, blocks[0]);
+
+	no_os_pool_remove(pool);
+	TEST_ASSERT_EQUAL_UINT32(heap_allocs, heap_frees);
+}
+
+void test_no_os_fifo_order(void)
+{
+	struct no_os_fifo_element *elem;
+	struct no_os_fifo_desc *fifo;
+	char big[BENCH_LEN + 1] = "oversized";
+	uint32_t i;
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_fifo_desc_init(&fifo, BENCH_LEN, 2));
+
+	/* Copies from the pool, from the heap and caller owned elements */
+	TEST_ASSERT_EQUAL_INT(0, no_os_fifo_push(fifo, "a", 1));
+	TEST_ASSERT_EQUAL_INT(0, no_os_fifo_push(fifo, big, sizeof(big)));
+	frames[0].elem.data = frames[0].data;
+	frames[0].elem.len = 1;
+	frames[0].data[0] = 'c';
+	no_os_fifo_push_elem(fifo, &frames[0].elem);
+	TEST_ASSERT_EQUAL_INT(0, no_os_fifo_push(fifo, "d", 1));
+	TEST_ASSERT_EQUAL_UINT32(4, fifo->nb_elements);
+
+	for (i = 0; i < 4; i++) {
+		elem = no_os_fifo_pop(fifo);
+		TEST_ASSERT_NOT_NULL(elem);
+		if (i == 1)
+			TEST_ASSERT_EQUAL_STRING(big, elem->data);
+		else
+			TEST_ASSERT_EQUAL_UINT8("a?cd"[i], elem->data[0]);
+		if (i == 2)
+			TEST_ASSERT_EQUAL_PTR(&frames[0].elem, elem);
+		no_os_fifo_release(fifo, elem);
+	}
+	TEST_ASSERT_NULL(no_os_fifo_pop(fifo));
+
+	no_os_fifo_desc_remove(fifo);
+	TEST_ASSERT_EQUAL_UINT32(heap_allocs, heap_frees);
+}
+
+void test_no_os_pool_benchmark(void)
+{
+	struct no_os_fifo_element *head = NULL;
+	struct no_os_fifo_desc *fifo;
+	struct no_os_list_desc *list;
+	uint32_t i, j, allocs;
+	uint64_t ns;
+	void *data;
+
+	/* Legacy fifo: heap element per insert, tail found by walking */
+	allocs = heap_allocs;
+	ns = now_ns();
+	for (i = 0; i < BENCH_ROUNDS; i++) {
+		for (j = 0; j < BENCH_DEPTH; j++)
+			no_os_fifo_insert(&head, payload, BENCH_LEN);
+		for (j = 0; j < BENCH_DEPTH; j++)
+			head = no_os_fifo_remove(head);
+	}
+	ns = now_ns() - ns;
+	bench_report("no_os_fifo_insert", ns, heap_allocs - allocs);
+	TEST_ASSERT_EQUAL_UINT32(BENCH_ELEMS, heap_allocs - allocs);
+
+	/* Pooled fifo with a tail pointer */
+	TEST_ASSERT_EQUAL_INT(0, no_os_fifo_desc_init(&fifo, BENCH_LEN,
+			      BENCH_DEPTH));
+	allocs = heap_allocs;
+	ns = now_ns();
+	for (i = 0; i < BENCH_ROUNDS; i++) {
+		for (j = 0; j < BENCH_DEPTH; j++)
+			no_os_fifo_push(fifo, payload, BENCH_LEN);
+		for (j = 0; j < BENCH_DEPTH; j++)
+			no_os_fifo_release(fifo, no_os_fifo_pop(fifo));
+	}
+	ns = now_ns() - ns;
+	bench_report("no_os_fifo_push", ns, heap_allocs - allocs);
+	TEST_ASSERT_EQUAL_UINT32(0, heap_allocs - allocs);
+	TEST_ASSERT_EQUAL_UINT32(BENCH_ELEMS, fifo->pool->nb_alloc);
+
+	/* Intrusive fifo, elements embedded in the caller's frames */
+	allocs = heap_allocs;
+	ns = now_ns();
+	for (i = 0; i < BENCH_ROUNDS; i++) {
+		for (j = 0; j < BENCH_DEPTH; j++)
+			no_os_fifo_push_elem(fifo, &frames[j].elem);
+		for (j = 0; j < BENCH_DEPTH; j++)
+			TEST_ASSERT_EQUAL_PTR(&frames[j].elem,
+					      no_os_fifo_pop(fifo));
+	}
+	ns = now_ns() - ns;
+	bench_report("no_os_fifo_push_elem", ns, heap_allocs - allocs);
+	TEST_ASSERT_EQUAL_UINT32(0, heap_allocs - allocs);
+	no_os_fifo_desc_remove(fifo);
+
+	/* Heap backed list, as used by the DMA SG lists before */
+	TEST_ASSERT_EQUAL_INT(0, no_os_list_init(&list, NO_OS_LIST_QUEUE,
+			      NULL));
+	allocs = heap_allocs;
+	ns = now_ns();
+	for (i = 0; i < BENCH_ROUNDS; i++) {
+		for (j = 0; j < BENCH_DEPTH; j++)
+			list->push(list, payload);
+		for (j = 0; j < BENCH_DEPTH; j++)
+			list->pop(list, &data);
+	}
+	ns = now_ns() - ns;
+	bench_report("no_os_list_init", ns, heap_allocs - allocs);
+	TEST_ASSERT_EQUAL_UINT32(BENCH_ELEMS, heap_allocs - allocs);
+	no_os_list_remove(list);
+
+	/* Pooled list */
+	TEST_ASSERT_EQUAL_INT(0, no_os_list_init_pool(&list, NO_OS_LIST_QUEUE,
+			      NULL, BENCH_DEPTH));
+	allocs = heap_allocs;
+	ns = now_ns();
+	for (i = 0; i < BENCH_ROUNDS; i++) {
+		for (j = 0; j < BENCH_DEPTH; j++)
+			list->push(list, payload);
+		for (j = 0; j < BENCH_DEPTH; j++)
+			list->pop(list, &data);
+	}
+	ns = now_ns() - ns;
+	bench_report("no_os_list_init_pool", ns, heap_allocs - allocs);
+	TEST_ASSERT_EQUAL_UINT32(0, heap_allocs - allocs);
+	no_os_list_remove(list);
+
+	TEST_ASSERT_EQUAL_UINT32(heap_allocs, heap_frees);
+}
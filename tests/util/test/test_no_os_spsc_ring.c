@@ -0,0 +1,364 @@
+/***************************************************************************//**
+ *   @file   test_no_os_spsc_ring.c
+ *   @brief  Unit and stress tests for the SPSC byte ring and lf256fifo.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+ *    INCLUDED FILES
+ ******************************************************************************/
+
+#include "unity.h"
+#include "no_os_spsc_ring.h"
+#include "no_os_lf256fifo.h"
+#include "no_os_alloc.h"
+#include "no_os_util.h"
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+/*******************************************************************************
+ *    PRIVATE DATA
+ ******************************************************************************/
+
+#define STRESS_RING_SIZE	64
+#define STRESS_BYTES		(1024 * 1024)
+
+/*
+ * Producer/consumer state of a stress run. The producer behaves like a UART
+ * RX interrupt: it delivers bursts of 1..16 bytes, never waits for the
+ * consumer and drops what does not fit. Only the bytes accepted by the ring
+ * advance the sequence, so the consumer must see an unbroken sequence.
+ * Both sides yield when they can't make progress so the test also runs on a
+ * single CPU.
+ */
+struct stress_ctx {
+	struct no_os_spsc_ring *ring;
+	struct lf256fifo *fifo;
+	uint32_t produced;
+	uint32_t dropped;
+	uint32_t consumed;
+	uint32_t errors;
+	atomic_bool done;
+};
+
+static struct no_os_spsc_ring *ring;
+
+/*******************************************************************************
+ *    PRIVATE FUNCTIONS
+ ******************************************************************************/
+
+static uint32_t xorshift(uint32_t *state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+
+	return *state;
+}
+
+static void *ring_irq_producer(void *arg)
+{
+	struct stress_ctx *ctx = arg;
+	uint32_t rnd = 0x12345678, burst, n, i;
+	uint8_t data[16], *span;
+
+	while (ctx->produced < STRESS_BYTES) {
+		burst = 1 + xorshift(&rnd) % 16;
+		for (i = 0; i < burst; i++)
+			data[i] = (uint8_t)(ctx->produced + i);
+
+		switch (xorshift(&rnd) % 3) {
+		case 0:
+			for (n = 0; n < burst; n++)
+				if (no_os_spsc_ring_put(ctx->ring, data[n]))
+					break;
+			break;
+		case 1:
+			n = no_os_spsc_ring_write_n(ctx->ring, data, burst);
+			break;
+		default:
+			n = no_os_spsc_ring_peek_write(ctx->ring, &span);
+			n = no_os_min(burst, n);
+			memcpy(span, data, n);
+			no_os_spsc_ring_commit_write(ctx->ring, n);
+			break;
+		}
+
+		ctx->produced += n;
+		ctx->dropped += burst - n;
+		if (n < burst || !(rnd & 0x7))
+			sched_yield();
+	}
+	atomic_store(&ctx->done, true);
+
+	return NULL;
+}
+
+static void ring_check(struct stress_ctx *ctx, const uint8_t *data,
+		       uint32_t len)
+{
+	uint32_t i;
+
+	for (i = 0; i < len; i++)
+		if (data[i] != (uint8_t)(ctx->consumed + i))
+			ctx->errors++;
+	ctx->consumed += len;
+}
+
+static void *ring_consumer(void *arg)
+{
+	struct stress_ctx *ctx = arg;
+	uint32_t rnd = 0x9abcdef0, n;
+	uint8_t data[32], *span;
+
+	while (!atomic_load(&ctx->done) || no_os_spsc_ring_count(ctx->ring)) {
+		switch (xorshift(&rnd) % 3) {
+		case 0:
+			n = 0;
+			while (n < sizeof(data) &&
+			       !no_os_spsc_ring_get(ctx->ring, &data[n]))
+				n++;
+			ring_check(ctx, data, n);
+			break;
+		case 1:
+			n = no_os_spsc_ring_read_n(ctx->ring, data,
+						   1 + xorshift(&rnd) % 32);
+			ring_check(ctx, data, n);
+			break;
+		default:
+			n = no_os_spsc_ring_peek_read(ctx->ring, &span);
+			ring_check(ctx, span, n);
+			no_os_spsc_ring_commit_read(ctx->ring, n);
+			break;
+		}
+		if (!n)
+			sched_yield();
+	}
+
+	return NULL;
+}
+
+static void *fifo_irq_producer(void *arg)
+{
+	struct stress_ctx *ctx = arg;
+	uint32_t rnd = 0x2468ace0, burst, i;
+
+	while (ctx->produced < STRESS_BYTES) {
+		burst = 1 + xorshift(&rnd) % 16;
+		for (i = 0; i < burst; i++) {
+			if (lf256fifo_write(ctx->fifo, (uint8_t)ctx->produced))
+				break;
+			ctx->produced++;
+		}
+		ctx->dropped += burst - i;
+		if (i < burst || !(rnd & 0x7))
+			sched_yield();
+	}
+	atomic_store(&ctx->done, true);
+
+	return NULL;
+}
+
+static void *fifo_consumer(void *arg)
+{
+	struct stress_ctx *ctx = arg;
+	uint32_t rnd = 0x13579bdf, n;
+	uint8_t data[32];
+
+	while (!atomic_load(&ctx->done) || !lf256fifo_is_empty(ctx->fifo)) {
+		if (xorshift(&rnd) & 1) {
+			n = lf256fifo_read(ctx->fifo, data) ? 0 : 1;
+		} else {
+			n = lf256fifo_read_n(ctx->fifo, data,
+					     1 + xorshift(&rnd) % 32);
+		}
+		ring_check(ctx, data, n);
+		if (!n)
+			sched_yield();
+	}
+
+	return NULL;
+}
+
+/*******************************************************************************
+ *    SETUP, TEARDOWN
+ ******************************************************************************/
+
+void setUp(void)
+{
+	ring = NULL;
+}
+
+void tearDown(void)
+{
+	no_os_spsc_ring_remove(ring);
+}
+
+/*******************************************************************************
+ *    TESTS
+ ******************************************************************************/
+
+void test_no_os_spsc_ring_init(void)
+{
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_spsc_ring_init(NULL, 16));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_spsc_ring_init(&ring, 0));
+	TEST_ASSERT_EQUAL_INT(-EINVAL, no_os_spsc_ring_init(&ring, 24));
+	TEST_ASSERT_EQUAL_INT(0, no_os_spsc_ring_init(&ring, 16));
+	TEST_ASSERT_EQUAL_UINT32(0, no_os_spsc_ring_count(ring));
+	TEST_ASSERT_EQUAL_UINT32(16, no_os_spsc_ring_space(ring));
+}
+
+void test_no_os_spsc_ring_put_get(void)
+{
+	uint8_t c;
+	uint32_t i;
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_spsc_ring_init(&ring, 4));
+	TEST_ASSERT_EQUAL_INT(-EAGAIN, no_os_spsc_ring_get(ring, &c));
+
+	/* Run the indexes around the ring several times */
+	for (i = 0; i < 10; i++) {
+		TEST_ASSERT_EQUAL_INT(0, no_os_spsc_ring_put(ring, i));
+		TEST_ASSERT_EQUAL_INT(0, no_os_spsc_ring_put(ring, i + 1));
+		TEST_ASSERT_EQUAL_INT(0, no_os_spsc_ring_put(ring, i + 2));
+		TEST_ASSERT_EQUAL_INT(0, no_os_spsc_ring_put(ring, i + 3));
+		TEST_ASSERT_NOT_EQUAL_INT(0, no_os_spsc_ring_put(ring, 0));
+		TEST_ASSERT_EQUAL_UINT32(4, no_os_spsc_ring_count(ring));
+
+		TEST_ASSERT_EQUAL_INT(0, no_os_spsc_ring_get(ring, &c));
+		TEST_ASSERT_EQUAL_UINT8(i, c);
+		TEST_ASSERT_EQUAL_INT(0, no_os_spsc_ring_get(ring, &c));
+		TEST_ASSERT_EQUAL_UINT8(i + 1, c);
+		TEST_ASSERT_EQUAL_INT(0, no_os_spsc_ring_get(ring, &c));
+		TEST_ASSERT_EQUAL_UINT8(i + 2, c);
+		/* Leave one byte behind so the next round wraps */
+		TEST_ASSERT_EQUAL_INT(0, no_os_spsc_ring_get(ring, &c));
+		TEST_ASSERT_EQUAL_UINT8(i + 3, c);
+	}
+}
+
+void test_no_os_spsc_ring_bulk_wrap(void)
+{
+	uint8_t in[12], out[12];
+	uint32_t i;
+
+	for (i = 0; i < sizeof(in); i++)
+		in[i] = 0xa0 + i;
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_spsc_ring_init(&ring, 8));
+	TEST_ASSERT_EQUAL_UINT32(5, no_os_spsc_ring_write_n(ring, in, 5));
+	TEST_ASSERT_EQUAL_UINT32(5, no_os_spsc_ring_read_n(ring, out, 5));
+
+	/* Only the free space is written, across the end of the storage */
+	TEST_ASSERT_EQUAL_UINT32(8, no_os_spsc_ring_write_n(ring, in, 12));
+	TEST_ASSERT_EQUAL_UINT32(0, no_os_spsc_ring_space(ring));
+	TEST_ASSERT_EQUAL_UINT32(8, no_os_spsc_ring_read_n(ring, out, 12));
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(in, out, 8);
+	TEST_ASSERT_EQUAL_UINT32(0, no_os_spsc_ring_read_n(ring, out, 12));
+}
+
+void test_no_os_spsc_ring_spans(void)
+{
+	uint8_t in[8] = {1, 2, 3, 4, 5, 6, 7, 8}, out[8], *span;
+	uint32_t n;
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_spsc_ring_init(&ring, 8));
+	TEST_ASSERT_EQUAL_UINT32(6, no_os_spsc_ring_write_n(ring, in, 6));
+	TEST_ASSERT_EQUAL_UINT32(6, no_os_spsc_ring_read_n(ring, out, 6));
+
+	/* The free space is split: only the part up to the end is a span */
+	n = no_os_spsc_ring_peek_write(ring, &span);
+	TEST_ASSERT_EQUAL_UINT32(2, n);
+	memcpy(span, in, n);
+	no_os_spsc_ring_commit_write(ring, n);
+	n = no_os_spsc_ring_peek_write(ring, &span);
+	TEST_ASSERT_EQUAL_UINT32(6, n);
+	memcpy(span, in + 2, 3);
+	no_os_spsc_ring_commit_write(ring, 3);
+	TEST_ASSERT_EQUAL_UINT32(5, no_os_spsc_ring_count(ring));
+
+	n = no_os_spsc_ring_peek_read(ring, &span);
+	TEST_ASSERT_EQUAL_UINT32(2, n);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(in, span, n);
+	no_os_spsc_ring_commit_read(ring, n);
+	n = no_os_spsc_ring_peek_read(ring, &span);
+	TEST_ASSERT_EQUAL_UINT32(3, n);
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(in + 2, span, n);
+	no_os_spsc_ring_commit_read(ring, n);
+
+	no_os_spsc_ring_put(ring, 9);
+	no_os_spsc_ring_flush(ring);
+	TEST_ASSERT_EQUAL_UINT32(0, no_os_spsc_ring_count(ring));
+}
+
+void test_no_os_spsc_ring_irq_stress(void)
+{
+	struct stress_ctx ctx = {0};
+	pthread_t producer, consumer;
+	char msg[96];
+
+	TEST_ASSERT_EQUAL_INT(0, no_os_spsc_ring_init(&ring, STRESS_RING_SIZE));
+	ctx.ring = ring;
+
+	TEST_ASSERT_EQUAL_INT(0, pthread_create(&consumer, NULL, ring_consumer,
+						&ctx));
+	TEST_ASSERT_EQUAL_INT(0, pthread_create(&producer, NULL,
+						ring_irq_producer, &ctx));
+	pthread_join(producer, NULL);
+	pthread_join(consumer, NULL);
+
+	snprintf(msg, sizeof(msg), "%u bytes through the ring, %u dropped",
+		 ctx.consumed, ctx.dropped);
+	TEST_MESSAGE(msg);
+
+	TEST_ASSERT_EQUAL_UINT32(0, ctx.errors);
+	TEST_ASSERT_EQUAL_UINT32(ctx.produced, ctx.consumed);
+}
+
+void test_lf256fifo_irq_stress(void)
+{
+	struct stress_ctx ctx = {0};
+	pthread_t producer, consumer;
+
+	TEST_ASSERT_EQUAL_INT(0, lf256fifo_init(&ctx.fifo));
+
+	TEST_ASSERT_EQUAL_INT(0, pthread_create(&consumer, NULL, fifo_consumer,
+						&ctx));
+	TEST_ASSERT_EQUAL_INT(0, pthread_create(&producer, NULL,
+						fifo_irq_producer, &ctx));
+	pthread_join(producer, NULL);
+	pthread_join(consumer, NULL);
+	lf256fifo_remove(ctx.fifo);
+
+	TEST_ASSERT_EQUAL_UINT32(0, ctx.errors);
+	TEST_ASSERT_EQUAL_UINT32(ctx.produced, ctx.consumed);
+}
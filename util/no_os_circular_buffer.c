@@ -141,7 +141,10 @@ int32_t no_os_cb_size(struct no_os_circular_buffer *desc, uint32_t *size)
 		nb_spins = UINT32_MAX - desc->read.spin_count +
 			   desc->write.spin_count + 1;
 
-	if (nb_spins > 0)
+	if (nb_spins > 1)
+		/* The writer went around the buffer more than once */
+		*size = desc->size + 1;
+	else if (nb_spins > 0)
 		*size = desc->size + desc->write.idx - desc->read.idx;
 	else
 		*size = desc->write.idx - desc->read.idx;
@@ -31,6 +31,7 @@
  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *******************************************************************************/
 #include "no_os_crc16.h"
+#include "no_os_crc_engine.h"
 
 /***************************************************************************//**
  * @brief Creates the CRC-16 lookup table for a given polynomial.
@@ -69,8 +70,30 @@ void no_os_crc16_populate_msb(uint16_t * table, const uint16_t polynomial)
 	}
 }
 
+/***************************************************************************//**
+ * @brief Find the constant engine computing the same CRC-16 as a lookup table.
+ *        Entry 1 of a msb-first table is the polynomial itself.
+ *
+ * @param table - Pointer to a CRC-16 lookup table.
+ *
+ * @return The engine, or NULL if there is none for this polynomial.
+*******************************************************************************/
+static const struct no_os_crc_engine *no_os_crc16_engine(const uint16_t *table)
+{
+	switch (table[1]) {
+	case 0x1021:
+		return &no_os_crc16_1021_engine;
+	case 0x755B:
+		return &no_os_crc16_755b_engine;
+	default:
+		return NULL;
+	}
+}
+
 /***************************************************************************//**
  * @brief Computes the CRC-16 over a buffer of data.
+ *        Buffers of at least NO_OS_CRC_ENGINE_MIN_LEN bytes go through the
+ *        constant slice-by-4 engine for the table polynomial, if there is one.
  *
  * @param table     - Pointer to a CRC-16 lookup table for the desired polynomial.
  * @param pdata     - Pointer to data buffer.
@@ -85,8 +108,16 @@ uint16_t no_os_crc16(const uint16_t * table, const uint8_t *pdata,
 		     size_t nbytes,
 		     uint16_t crc)
 {
+	const struct no_os_crc_engine *engine;
 	unsigned int idx;
 
+	if (NO_OS_CRC_ENGINE_MIN_LEN && nbytes >= NO_OS_CRC_ENGINE_MIN_LEN) {
+		engine = no_os_crc16_engine(table);
+		if (engine)
+			return no_os_crc_engine_compute(engine, pdata, nbytes,
+							crc);
+	}
+
 	while (nbytes--) {
 		idx = ((crc >> 8) ^ *pdata) & 0xff;
 		crc = (table[idx] ^ (crc << 8)) & 0xffff;
@@ -31,6 +31,7 @@
  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *******************************************************************************/
 #include "no_os_crc24.h"
+#include "no_os_crc_engine.h"
 
 /***************************************************************************//**
  * @brief Creates the CRC-24 lookup table for a given polynomial.
@@ -70,8 +71,28 @@ void no_os_crc24_populate_msb(uint32_t * table, const uint32_t polynomial)
 	}
 }
 
+/***************************************************************************//**
+ * @brief Find the constant engine computing the same CRC-24 as a lookup table.
+ *        Entry 1 of a msb-first table is the polynomial itself.
+ *
+ * @param table - Pointer to a CRC-24 lookup table.
+ *
+ * @return The engine, or NULL if there is none for this polynomial.
+*******************************************************************************/
+static const struct no_os_crc_engine *no_os_crc24_engine(const uint32_t *table)
+{
+	switch (table[1]) {
+	case 0x5D6DCB:
+		return &no_os_crc24_5d6dcb_engine;
+	default:
+		return NULL;
+	}
+}
+
 /***************************************************************************//**
  * @brief Computes the CRC-24 over a buffer of data.
+ *        Buffers of at least NO_OS_CRC_ENGINE_MIN_LEN bytes go through the
+ *        constant slice-by-4 engine for the table polynomial, if there is one.
  *
  * @param table     - Pointer to a CRC-24 lookup table for the desired polynomial.
  * @param pdata     - Pointer to data buffer.
@@ -86,8 +107,16 @@ uint32_t no_os_crc24(const uint32_t * table, const uint8_t *pdata,
 		     size_t nbytes,
 		     uint32_t crc)
 {
+	const struct no_os_crc_engine *engine;
 	unsigned int idx;
 
+	if (NO_OS_CRC_ENGINE_MIN_LEN && nbytes >= NO_OS_CRC_ENGINE_MIN_LEN) {
+		engine = no_os_crc24_engine(table);
+		if (engine)
+			return no_os_crc_engine_compute(engine, pdata, nbytes,
+							crc);
+	}
+
 	while (nbytes--) {
 		idx = ((crc >> 16) ^ *pdata) & 0xff;
 		crc = (table[idx] ^ (crc << 8)) & 0xffffff;
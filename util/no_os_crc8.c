@@ -31,6 +31,7 @@
  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *******************************************************************************/
 #include "no_os_crc8.h"
+#include "no_os_crc_engine.h"
 
 /***************************************************************************//**
  * @brief Creates the CRC-8 lookup table for a given polynomial.
@@ -67,8 +68,30 @@ void no_os_crc8_populate_msb(uint8_t * table, const uint8_t polynomial)
 	}
 }
 
+/***************************************************************************//**
+ * @brief Find the constant engine computing the same CRC-8 as a lookup table.
+ *        Entry 1 of a msb-first table is the polynomial itself.
+ *
+ * @param table - Pointer to a CRC-8 lookup table.
+ *
+ * @return The engine, or NULL if there is none for this polynomial.
+*******************************************************************************/
+static const struct no_os_crc_engine *no_os_crc8_engine(const uint8_t *table)
+{
+	switch (table[1]) {
+	case 0x07:
+		return &no_os_crc8_07_engine;
+	case 0x31:
+		return &no_os_crc8_31_engine;
+	default:
+		return NULL;
+	}
+}
+
 /***************************************************************************//**
  * @brief Computes the CRC-8 over a buffer of data.
+ *        Buffers of at least NO_OS_CRC_ENGINE_MIN_LEN bytes go through the
+ *        constant slice-by-4 engine for the table polynomial, if there is one.
  *
  * @param table     - Pointer to a CRC-8 lookup table for the desired polynomial.
  * @param pdata     - Pointer to 8-bit data buffer.
@@ -82,8 +105,16 @@ void no_os_crc8_populate_msb(uint8_t * table, const uint8_t polynomial)
 uint8_t no_os_crc8(const uint8_t * table, const uint8_t *pdata, size_t nbytes,
 		   uint8_t crc)
 {
+	const struct no_os_crc_engine *engine;
 	unsigned int idx;
 
+	if (NO_OS_CRC_ENGINE_MIN_LEN && nbytes >= NO_OS_CRC_ENGINE_MIN_LEN) {
+		engine = no_os_crc8_engine(table);
+		if (engine)
+			return no_os_crc_engine_compute(engine, pdata, nbytes,
+							crc);
+	}
+
 	while (nbytes--) {
 		idx = (crc ^ *pdata);
 		crc = (table[idx]) & 0xff;
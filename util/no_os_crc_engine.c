@@ -0,0 +1,182 @@
+/***************************************************************************//**
+ *   @file   no_os_crc_engine.c
+ *   @brief  Source file of the table driven CRC engine.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+#include <errno.h>
+#include "no_os_crc_engine.h"
+#include "no_os_alloc.h"
+
+/***************************************************************************//**
+ * @brief Read a 32-bit big endian word, regardless of alignment.
+ *
+ * @param buf - Pointer to the first byte.
+ *
+ * @return The word.
+*******************************************************************************/
+static inline uint32_t no_os_crc_load_be32(const uint8_t *buf)
+{
+	return ((uint32_t)buf[0] << 24) | ((uint32_t)buf[1] << 16) |
+	       ((uint32_t)buf[2] << 8) | buf[3];
+}
+
+/***************************************************************************//**
+ * @brief Allocate a CRC engine and compute its lookup tables.
+ *
+ * @param engine     - Pointer where the allocated engine is stored.
+ * @param width      - CRC width in bits, 1 to 32.
+ * @param polynomial - msb-first representation of desired polynomial, without
+ *                     the x^width term (e.g. 0x1021 for CRC-16-CCITT).
+ * @param slices     - Number of lookup tables, see enum no_os_crc_slices.
+ *
+ * @return 0 in case of success, negative error code otherwise.
+*******************************************************************************/
+int no_os_crc_engine_init(struct no_os_crc_engine **engine, uint8_t width,
+			  uint32_t polynomial, enum no_os_crc_slices slices)
+{
+	struct no_os_crc_engine *desc;
+	uint32_t (*table)[NO_OS_CRC_ENGINE_TABLE_SIZE];
+	uint32_t crc;
+	uint8_t shift;
+	uint32_t n, k;
+
+	if (!engine || !width || width > 32)
+		return -EINVAL;
+
+	if (slices != NO_OS_CRC_SLICE_BY_1 && slices != NO_OS_CRC_SLICE_BY_4 &&
+	    slices != NO_OS_CRC_SLICE_BY_8)
+		return -EINVAL;
+
+	desc = no_os_calloc(1, sizeof(*desc));
+	if (!desc)
+		return -ENOMEM;
+
+	table = no_os_calloc(slices, sizeof(*table));
+	if (!table) {
+		no_os_free(desc);
+		return -ENOMEM;
+	}
+
+	shift = 32 - width;
+	polynomial &= 0xffffffff >> shift;
+
+	for (n = 0; n < NO_OS_CRC_ENGINE_TABLE_SIZE; n++) {
+		crc = (uint32_t)n << 24;
+		for (k = 0; k < 8; k++) {
+			if (crc & 0x80000000)
+				crc = (crc << 1) ^ (polynomial << shift);
+			else
+				crc <<= 1;
+		}
+		table[0][n] = crc;
+	}
+
+	/* Each extra table advances the previous one over a zero byte. */
+	for (k = 1; k < slices; k++)
+		for (n = 0; n < NO_OS_CRC_ENGINE_TABLE_SIZE; n++)
+			table[k][n] = (table[k - 1][n] << 8) ^
+				      table[0][table[k - 1][n] >> 24];
+
+	desc->width = width;
+	desc->polynomial = polynomial;
+	desc->slices = slices;
+	desc->table = (const uint32_t (*)[NO_OS_CRC_ENGINE_TABLE_SIZE])table;
+	*engine = desc;
+
+	return 0;
+}
+
+/***************************************************************************//**
+ * @brief Free a CRC engine allocated with no_os_crc_engine_init().
+ *
+ * @param engine - The engine.
+ *
+ * @return None.
+*******************************************************************************/
+void no_os_crc_engine_remove(struct no_os_crc_engine *engine)
+{
+	if (!engine)
+		return;
+
+	no_os_free((void *)engine->table);
+	no_os_free(engine);
+}
+
+/***************************************************************************//**
+ * @brief Computes the CRC over a buffer of data. With slice-by-4 and
+ *        slice-by-8 engines, the data is consumed one word at a time and only
+ *        the tail goes through the byte-wise loop.
+ *
+ * @param engine    - CRC engine for the desired width and polynomial.
+ * @param pdata     - Pointer to data buffer.
+ * @param nbytes    - Number of bytes to compute the CRC over.
+ * @param crc       - Initial value for the CRC computation. Can be used to
+ *                    cascade calls to this function by providing a previous
+ *                    output of this function as the crc parameter.
+ *
+ * @return crc      - Computed CRC value, right aligned.
+*******************************************************************************/
+uint32_t no_os_crc_engine_compute(const struct no_os_crc_engine *engine,
+				  const uint8_t *pdata, size_t nbytes,
+				  uint32_t crc)
+{
+	const uint32_t (*t)[NO_OS_CRC_ENGINE_TABLE_SIZE] = engine->table;
+	uint8_t shift = 32 - engine->width;
+
+	crc <<= shift;
+
+	if (engine->slices == NO_OS_CRC_SLICE_BY_8) {
+		while (nbytes >= 8) {
+			crc ^= no_os_crc_load_be32(pdata);
+			crc = t[7][crc >> 24] ^ t[6][(crc >> 16) & 0xff] ^
+			      t[5][(crc >> 8) & 0xff] ^ t[4][crc & 0xff] ^
+			      t[3][pdata[4]] ^ t[2][pdata[5]] ^
+			      t[1][pdata[6]] ^ t[0][pdata[7]];
+			pdata += 8;
+			nbytes -= 8;
+		}
+	}
+
+	if (engine->slices >= NO_OS_CRC_SLICE_BY_4) {
+		while (nbytes >= 4) {
+			crc ^= no_os_crc_load_be32(pdata);
+			crc = t[3][crc >> 24] ^ t[2][(crc >> 16) & 0xff] ^
+			      t[1][(crc >> 8) & 0xff] ^ t[0][crc & 0xff];
+			pdata += 4;
+			nbytes -= 4;
+		}
+	}
+
+	while (nbytes--) {
+		crc = (crc << 8) ^ t[0][(crc >> 24) ^ *pdata];
+		pdata++;
+	}
+
+	return crc >> shift;
+}
@@ -0,0 +1,1177 @@
+/***************************************************************************//**
+ *   @file   no_os_crc_tables.c
+ *   @brief  Constant lookup tables of the CRC engine.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+#include "no_os_crc_engine.h"
+
+/*
+ * Generated with the algorithm of no_os_crc_engine_init(): slice-by-4 tables
+ * of the left aligned CRC register.
+ */
+
+/* CRC-8, poly = 0x07 */
+static const uint32_t
+no_os_crc8_07_table[NO_OS_CRC_SLICE_BY_4][NO_OS_CRC_ENGINE_TABLE_SIZE] = {
+	{
+		0x00000000, 0x07000000, 0x0e000000, 0x09000000, 0x1c000000,
+		0x1b000000, 0x12000000, 0x15000000, 0x38000000, 0x3f000000,
+		0x36000000, 0x31000000, 0x24000000, 0x23000000, 0x2a000000,
+		0x2d000000, 0x70000000, 0x77000000, 0x7e000000, 0x79000000,
+		0x6c000000, 0x6b000000, 0x62000000, 0x65000000, 0x48000000,
+		0x4f000000, 0x46000000, 0x41000000, 0x54000000, 0x53000000,
+		0x5a000000, 0x5d000000, 0xe0000000, 0xe7000000, 0xee000000,
+		0xe9000000, 0xfc000000, 0xfb000000, 0xf2000000, 0xf5000000,
+		0xd8000000, 0xdf000000, 0xd6000000, 0xd1000000, 0xc4000000,
+		0xc3000000, 0xca000000, 0xcd000000, 0x90000000, 0x97000000,
+		0x9e000000, 0x99000000, 0x8c000000, 0x8b000000, 0x82000000,
+		0x85000000, 0xa8000000, 0xaf000000, 0xa6000000, 0xa1000000,
+		0xb4000000, 0xb3000000, 0xba000000, 0xbd000000, 0xc7000000,
+		0xc0000000, 0xc9000000, 0xce000000, 0xdb000000, 0xdc000000,
+		0xd5000000, 0xd2000000, 0xff000000, 0xf8000000, 0xf1000000,
+		0xf6000000, 0xe3000000, 0xe4000000, 0xed000000, 0xea000000,
+		0xb7000000, 0xb0000000, 0xb9000000, 0xbe000000, 0xab000000,
+		0xac000000, 0xa5000000, 0xa2000000, 0x8f000000, 0x88000000,
+		0x81000000, 0x86000000, 0x93000000, 0x94000000, 0x9d000000,
+		0x9a000000, 0x27000000, 0x20000000, 0x29000000, 0x2e000000,
+		0x3b000000, 0x3c000000, 0x35000000, 0x32000000, 0x1f000000,
+		0x18000000, 0x11000000, 0x16000000, 0x03000000, 0x04000000,
+		0x0d000000, 0x0a000000, 0x57000000, 0x50000000, 0x59000000,
+		0x5e000000, 0x4b000000, 0x4c000000, 0x45000000, 0x42000000,
+		0x6f000000, 0x68000000, 0x61000000, 0x66000000, 0x73000000,
+		0x74000000, 0x7d000000, 0x7a000000, 0x89000000, 0x8e000000,
+		0x87000000, 0x80000000, 0x95000000, 0x92000000, 0x9b000000,
+		0x9c000000, 0xb1000000, 0xb6000000, 0xbf000000, 0xb8000000,
+		0xad000000, 0xaa000000, 0xa3000000, 0xa4000000, 0xf9000000,
+		0xfe000000, 0xf7000000, 0xf0000000, 0xe5000000, 0xe2000000,
+		0xeb000000, 0xec000000, 0xc1000000, 0xc6000000, 0xcf000000,
+		0xc8000000, 0xdd000000, 0xda000000, 0xd3000000, 0xd4000000,
+		0x69000000, 0x6e000000, 0x67000000, 0x60000000, 0x75000000,
+		0x72000000, 0x7b000000, 0x7c000000, 0x51000000, 0x56000000,
+		0x5f000000, 0x58000000, 0x4d000000, 0x4a000000, 0x43000000,
+		0x44000000, 0x19000000, 0x1e000000, 0x17000000, 0x10000000,
+		0x05000000, 0x02000000, 0x0b000000, 0x0c000000, 0x21000000,
+		0x26000000, 0x2f000000, 0x28000000, 0x3d000000, 0x3a000000,
+		0x33000000, 0x34000000, 0x4e000000, 0x49000000, 0x40000000,
+		0x47000000, 0x52000000, 0x55000000, 0x5c000000, 0x5b000000,
+		0x76000000, 0x71000000, 0x78000000, 0x7f000000, 0x6a000000,
+		0x6d000000, 0x64000000, 0x63000000, 0x3e000000, 0x39000000,
+		0x30000000, 0x37000000, 0x22000000, 0x25000000, 0x2c000000,
+		0x2b000000, 0x06000000, 0x01000000, 0x08000000, 0x0f000000,
+		0x1a000000, 0x1d000000, 0x14000000, 0x13000000, 0xae000000,
+		0xa9000000, 0xa0000000, 0xa7000000, 0xb2000000, 0xb5000000,
+		0xbc000000, 0xbb000000, 0x96000000, 0x91000000, 0x98000000,
+		0x9f000000, 0x8a000000, 0x8d000000, 0x84000000, 0x83000000,
+		0xde000000, 0xd9000000, 0xd0000000, 0xd7000000, 0xc2000000,
+		0xc5000000, 0xcc000000, 0xcb000000, 0xe6000000, 0xe1000000,
+		0xe8000000, 0xef000000, 0xfa000000, 0xfd000000, 0xf4000000,
+		0xf3000000,
+	},
+	{
+		0x00000000, 0x15000000, 0x2a000000, 0x3f000000, 0x54000000,
+		0x41000000, 0x7e000000, 0x6b000000, 0xa8000000, 0xbd000000,
+		0x82000000, 0x97000000, 0xfc000000, 0xe9000000, 0xd6000000,
+		0xc3000000, 0x57000000, 0x42000000, 0x7d000000, 0x68000000,
+		0x03000000, 0x16000000, 0x29000000, 0x3c000000, 0xff000000,
+		0xea000000, 0xd5000000, 0xc0000000, 0xab000000, 0xbe000000,
+		0x81000000, 0x94000000, 0xae000000, 0xbb000000, 0x84000000,
+		0x91000000, 0xfa000000, 0xef000000, 0xd0000000, 0xc5000000,
+		0x06000000, 0x13000000, 0x2c000000, 0x39000000, 0x52000000,
+		0x47000000, 0x78000000, 0x6d000000, 0xf9000000, 0xec000000,
+		0xd3000000, 0xc6000000, 0xad000000, 0xb8000000, 0x87000000,
+		0x92000000, 0x51000000, 0x44000000, 0x7b000000, 0x6e000000,
+		0x05000000, 0x10000000, 0x2f000000, 0x3a000000, 0x5b000000,
+		0x4e000000, 0x71000000, 0x64000000, 0x0f000000, 0x1a000000,
+		0x25000000, 0x30000000, 0xf3000000, 0xe6000000, 0xd9000000,
+		0xcc000000, 0xa7000000, 0xb2000000, 0x8d000000, 0x98000000,
+		0x0c000000, 0x19000000, 0x26000000, 0x33000000, 0x58000000,
+		0x4d000000, 0x72000000, 0x67000000, 0xa4000000, 0xb1000000,
+		0x8e000000, 0x9b000000, 0xf0000000, 0xe5000000, 0xda000000,
+		0xcf000000, 0xf5000000, 0xe0000000, 0xdf000000, 0xca000000,
+		0xa1000000, 0xb4000000, 0x8b000000, 0x9e000000, 0x5d000000,
+		0x48000000, 0x77000000, 0x62000000, 0x09000000, 0x1c000000,
+		0x23000000, 0x36000000, 0xa2000000, 0xb7000000, 0x88000000,
+		0x9d000000, 0xf6000000, 0xe3000000, 0xdc000000, 0xc9000000,
+		0x0a000000, 0x1f000000, 0x20000000, 0x35000000, 0x5e000000,
+		0x4b000000, 0x74000000, 0x61000000, 0xb6000000, 0xa3000000,
+		0x9c000000, 0x89000000, 0xe2000000, 0xf7000000, 0xc8000000,
+		0xdd000000, 0x1e000000, 0x0b000000, 0x34000000, 0x21000000,
+		0x4a000000, 0x5f000000, 0x60000000, 0x75000000, 0xe1000000,
+		0xf4000000, 0xcb000000, 0xde000000, 0xb5000000, 0xa0000000,
+		0x9f000000, 0x8a000000, 0x49000000, 0x5c000000, 0x63000000,
+		0x76000000, 0x1d000000, 0x08000000, 0x37000000, 0x22000000,
+		0x18000000, 0x0d000000, 0x32000000, 0x27000000, 0x4c000000,
+		0x59000000, 0x66000000, 0x73000000, 0xb0000000, 0xa5000000,
+		0x9a000000, 0x8f000000, 0xe4000000, 0xf1000000, 0xce000000,
+		0xdb000000, 0x4f000000, 0x5a000000, 0x65000000, 0x70000000,
+		0x1b000000, 0x0e000000, 0x31000000, 0x24000000, 0xe7000000,
+		0xf2000000, 0xcd000000, 0xd8000000, 0xb3000000, 0xa6000000,
+		0x99000000, 0x8c000000, 0xed000000, 0xf8000000, 0xc7000000,
+		0xd2000000, 0xb9000000, 0xac000000, 0x93000000, 0x86000000,
+		0x45000000, 0x50000000, 0x6f000000, 0x7a000000, 0x11000000,
+		0x04000000, 0x3b000000, 0x2e000000, 0xba000000, 0xaf000000,
+		0x90000000, 0x85000000, 0xee000000, 0xfb000000, 0xc4000000,
+		0xd1000000, 0x12000000, 0x07000000, 0x38000000, 0x2d000000,
+		0x46000000, 0x53000000, 0x6c000000, 0x79000000, 0x43000000,
+		0x56000000, 0x69000000, 0x7c000000, 0x17000000, 0x02000000,
+		0x3d000000, 0x28000000, 0xeb000000, 0xfe000000, 0xc1000000,
+		0xd4000000, 0xbf000000, 0xaa000000, 0x95000000, 0x80000000,
+		0x14000000, 0x01000000, 0x3e000000, 0x2b000000, 0x40000000,
+		0x55000000, 0x6a000000, 0x7f000000, 0xbc000000, 0xa9000000,
+		0x96000000, 0x83000000, 0xe8000000, 0xfd000000, 0xc2000000,
+		0xd7000000,
+	},
+	{
+		0x00000000, 0x6b000000, 0xd6000000, 0xbd000000, 0xab000000,
+		0xc0000000, 0x7d000000, 0x16000000, 0x51000000, 0x3a000000,
+		0x87000000, 0xec000000, 0xfa000000, 0x91000000, 0x2c000000,
+		0x47000000, 0xa2000000, 0xc9000000, 0x74000000, 0x1f000000,
+		0x09000000, 0x62000000, 0xdf000000, 0xb4000000, 0xf3000000,
+		0x98000000, 0x25000000, 0x4e000000, 0x58000000, 0x33000000,
+		0x8e000000, 0xe5000000, 0x43000000, 0x28000000, 0x95000000,
+		0xfe000000, 0xe8000000, 0x83000000, 0x3e000000, 0x55000000,
+		0x12000000, 0x79000000, 0xc4000000, 0xaf000000, 0xb9000000,
+		0xd2000000, 0x6f000000, 0x04000000, 0xe1000000, 0x8a000000,
+		0x37000000, 0x5c000000, 0x4a000000, 0x21000000, 0x9c000000,
+		0xf7000000, 0xb0000000, 0xdb000000, 0x66000000, 0x0d000000,
+		0x1b000000, 0x70000000, 0xcd000000, 0xa6000000, 0x86000000,
+		0xed000000, 0x50000000, 0x3b000000, 0x2d000000, 0x46000000,
+		0xfb000000, 0x90000000, 0xd7000000, 0xbc000000, 0x01000000,
+		0x6a000000, 0x7c000000, 0x17000000, 0xaa000000, 0xc1000000,
+		0x24000000, 0x4f000000, 0xf2000000, 0x99000000, 0x8f000000,
+		0xe4000000, 0x59000000, 0x32000000, 0x75000000, 0x1e000000,
+		0xa3000000, 0xc8000000, 0xde000000, 0xb5000000, 0x08000000,
+		0x63000000, 0xc5000000, 0xae000000, 0x13000000, 0x78000000,
+		0x6e000000, 0x05000000, 0xb8000000, 0xd3000000, 0x94000000,
+		0xff000000, 0x42000000, 0x29000000, 0x3f000000, 0x54000000,
+		0xe9000000, 0x82000000, 0x67000000, 0x0c000000, 0xb1000000,
+		0xda000000, 0xcc000000, 0xa7000000, 0x1a000000, 0x71000000,
+		0x36000000, 0x5d000000, 0xe0000000, 0x8b000000, 0x9d000000,
+		0xf6000000, 0x4b000000, 0x20000000, 0x0b000000, 0x60000000,
+		0xdd000000, 0xb6000000, 0xa0000000, 0xcb000000, 0x76000000,
+		0x1d000000, 0x5a000000, 0x31000000, 0x8c000000, 0xe7000000,
+		0xf1000000, 0x9a000000, 0x27000000, 0x4c000000, 0xa9000000,
+		0xc2000000, 0x7f000000, 0x14000000, 0x02000000, 0x69000000,
+		0xd4000000, 0xbf000000, 0xf8000000, 0x93000000, 0x2e000000,
+		0x45000000, 0x53000000, 0x38000000, 0x85000000, 0xee000000,
+		0x48000000, 0x23000000, 0x9e000000, 0xf5000000, 0xe3000000,
+		0x88000000, 0x35000000, 0x5e000000, 0x19000000, 0x72000000,
+		0xcf000000, 0xa4000000, 0xb2000000, 0xd9000000, 0x64000000,
+		0x0f000000, 0xea000000, 0x81000000, 0x3c000000, 0x57000000,
+		0x41000000, 0x2a000000, 0x97000000, 0xfc000000, 0xbb000000,
+		0xd0000000, 0x6d000000, 0x06000000, 0x10000000, 0x7b000000,
+		0xc6000000, 0xad000000, 0x8d000000, 0xe6000000, 0x5b000000,
+		0x30000000, 0x26000000, 0x4d000000, 0xf0000000, 0x9b000000,
+		0xdc000000, 0xb7000000, 0x0a000000, 0x61000000, 0x77000000,
+		0x1c000000, 0xa1000000, 0xca000000, 0x2f000000, 0x44000000,
+		0xf9000000, 0x92000000, 0x84000000, 0xef000000, 0x52000000,
+		0x39000000, 0x7e000000, 0x15000000, 0xa8000000, 0xc3000000,
+		0xd5000000, 0xbe000000, 0x03000000, 0x68000000, 0xce000000,
+		0xa5000000, 0x18000000, 0x73000000, 0x65000000, 0x0e000000,
+		0xb3000000, 0xd8000000, 0x9f000000, 0xf4000000, 0x49000000,
+		0x22000000, 0x34000000, 0x5f000000, 0xe2000000, 0x89000000,
+		0x6c000000, 0x07000000, 0xba000000, 0xd1000000, 0xc7000000,
+		0xac000000, 0x11000000, 0x7a000000, 0x3d000000, 0x56000000,
+		0xeb000000, 0x80000000, 0x96000000, 0xfd000000, 0x40000000,
+		0x2b000000,
+	},
+	{
+		0x00000000, 0x16000000, 0x2c000000, 0x3a000000, 0x58000000,
+		0x4e000000, 0x74000000, 0x62000000, 0xb0000000, 0xa6000000,
+		0x9c000000, 0x8a000000, 0xe8000000, 0xfe000000, 0xc4000000,
+		0xd2000000, 0x67000000, 0x71000000, 0x4b000000, 0x5d000000,
+		0x3f000000, 0x29000000, 0x13000000, 0x05000000, 0xd7000000,
+		0xc1000000, 0xfb000000, 0xed000000, 0x8f000000, 0x99000000,
+		0xa3000000, 0xb5000000, 0xce000000, 0xd8000000, 0xe2000000,
+		0xf4000000, 0x96000000, 0x80000000, 0xba000000, 0xac000000,
+		0x7e000000, 0x68000000, 0x52000000, 0x44000000, 0x26000000,
+		0x30000000, 0x0a000000, 0x1c000000, 0xa9000000, 0xbf000000,
+		0x85000000, 0x93000000, 0xf1000000, 0xe7000000, 0xdd000000,
+		0xcb000000, 0x19000000, 0x0f000000, 0x35000000, 0x23000000,
+		0x41000000, 0x57000000, 0x6d000000, 0x7b000000, 0x9b000000,
+		0x8d000000, 0xb7000000, 0xa1000000, 0xc3000000, 0xd5000000,
+		0xef000000, 0xf9000000, 0x2b000000, 0x3d000000, 0x07000000,
+		0x11000000, 0x73000000, 0x65000000, 0x5f000000, 0x49000000,
+		0xfc000000, 0xea000000, 0xd0000000, 0xc6000000, 0xa4000000,
+		0xb2000000, 0x88000000, 0x9e000000, 0x4c000000, 0x5a000000,
+		0x60000000, 0x76000000, 0x14000000, 0x02000000, 0x38000000,
+		0x2e000000, 0x55000000, 0x43000000, 0x79000000, 0x6f000000,
+		0x0d000000, 0x1b000000, 0x21000000, 0x37000000, 0xe5000000,
+		0xf3000000, 0xc9000000, 0xdf000000, 0xbd000000, 0xab000000,
+		0x91000000, 0x87000000, 0x32000000, 0x24000000, 0x1e000000,
+		0x08000000, 0x6a000000, 0x7c000000, 0x46000000, 0x50000000,
+		0x82000000, 0x94000000, 0xae000000, 0xb8000000, 0xda000000,
+		0xcc000000, 0xf6000000, 0xe0000000, 0x31000000, 0x27000000,
+		0x1d000000, 0x0b000000, 0x69000000, 0x7f000000, 0x45000000,
+		0x53000000, 0x81000000, 0x97000000, 0xad000000, 0xbb000000,
+		0xd9000000, 0xcf000000, 0xf5000000, 0xe3000000, 0x56000000,
+		0x40000000, 0x7a000000, 0x6c000000, 0x0e000000, 0x18000000,
+		0x22000000, 0x34000000, 0xe6000000, 0xf0000000, 0xca000000,
+		0xdc000000, 0xbe000000, 0xa8000000, 0x92000000, 0x84000000,
+		0xff000000, 0xe9000000, 0xd3000000, 0xc5000000, 0xa7000000,
+		0xb1000000, 0x8b000000, 0x9d000000, 0x4f000000, 0x59000000,
+		0x63000000, 0x75000000, 0x17000000, 0x01000000, 0x3b000000,
+		0x2d000000, 0x98000000, 0x8e000000, 0xb4000000, 0xa2000000,
+		0xc0000000, 0xd6000000, 0xec000000, 0xfa000000, 0x28000000,
+		0x3e000000, 0x04000000, 0x12000000, 0x70000000, 0x66000000,
+		0x5c000000, 0x4a000000, 0xaa000000, 0xbc000000, 0x86000000,
+		0x90000000, 0xf2000000, 0xe4000000, 0xde000000, 0xc8000000,
+		0x1a000000, 0x0c000000, 0x36000000, 0x20000000, 0x42000000,
+		0x54000000, 0x6e000000, 0x78000000, 0xcd000000, 0xdb000000,
+		0xe1000000, 0xf7000000, 0x95000000, 0x83000000, 0xb9000000,
+		0xaf000000, 0x7d000000, 0x6b000000, 0x51000000, 0x47000000,
+		0x25000000, 0x33000000, 0x09000000, 0x1f000000, 0x64000000,
+		0x72000000, 0x48000000, 0x5e000000, 0x3c000000, 0x2a000000,
+		0x10000000, 0x06000000, 0xd4000000, 0xc2000000, 0xf8000000,
+		0xee000000, 0x8c000000, 0x9a000000, 0xa0000000, 0xb6000000,
+		0x03000000, 0x15000000, 0x2f000000, 0x39000000, 0x5b000000,
+		0x4d000000, 0x77000000, 0x61000000, 0xb3000000, 0xa5000000,
+		0x9f000000, 0x89000000, 0xeb000000, 0xfd000000, 0xc7000000,
+		0xd1000000,
+	},
+};
+
+const struct no_os_crc_engine no_os_crc8_07_engine = {
+	.width = 8,
+	.polynomial = 0x7,
+	.slices = NO_OS_CRC_SLICE_BY_4,
+	.table = no_os_crc8_07_table,
+};
+
+/* CRC-8, poly = 0x31 */
+static const uint32_t
+no_os_crc8_31_table[NO_OS_CRC_SLICE_BY_4][NO_OS_CRC_ENGINE_TABLE_SIZE] = {
+	{
+		0x00000000, 0x31000000, 0x62000000, 0x53000000, 0xc4000000,
+		0xf5000000, 0xa6000000, 0x97000000, 0xb9000000, 0x88000000,
+		0xdb000000, 0xea000000, 0x7d000000, 0x4c000000, 0x1f000000,
+		0x2e000000, 0x43000000, 0x72000000, 0x21000000, 0x10000000,
+		0x87000000, 0xb6000000, 0xe5000000, 0xd4000000, 0xfa000000,
+		0xcb000000, 0x98000000, 0xa9000000, 0x3e000000, 0x0f000000,
+		0x5c000000, 0x6d000000, 0x86000000, 0xb7000000, 0xe4000000,
+		0xd5000000, 0x42000000, 0x73000000, 0x20000000, 0x11000000,
+		0x3f000000, 0x0e000000, 0x5d000000, 0x6c000000, 0xfb000000,
+		0xca000000, 0x99000000, 0xa8000000, 0xc5000000, 0xf4000000,
+		0xa7000000, 0x96000000, 0x01000000, 0x30000000, 0x63000000,
+		0x52000000, 0x7c000000, 0x4d000000, 0x1e000000, 0x2f000000,
+		0xb8000000, 0x89000000, 0xda000000, 0xeb000000, 0x3d000000,
+		0x0c000000, 0x5f000000, 0x6e000000, 0xf9000000, 0xc8000000,
+		0x9b000000, 0xaa000000, 0x84000000, 0xb5000000, 0xe6000000,
+		0xd7000000, 0x40000000, 0x71000000, 0x22000000, 0x13000000,
+		0x7e000000, 0x4f000000, 0x1c000000, 0x2d000000, 0xba000000,
+		0x8b000000, 0xd8000000, 0xe9000000, 0xc7000000, 0xf6000000,
+		0xa5000000, 0x94000000, 0x03000000, 0x32000000, 0x61000000,
+		0x50000000, 0xbb000000, 0x8a000000, 0xd9000000, 0xe8000000,
+		0x7f000000, 0x4e000000, 0x1d000000, 0x2c000000, 0x02000000,
+		0x33000000, 0x60000000, 0x51000000, 0xc6000000, 0xf7000000,
+		0xa4000000, 0x95000000, 0xf8000000, 0xc9000000, 0x9a000000,
+		0xab000000, 0x3c000000, 0x0d000000, 0x5e000000, 0x6f000000,
+		0x41000000, 0x70000000, 0x23000000, 0x12000000, 0x85000000,
+		0xb4000000, 0xe7000000, 0xd6000000, 0x7a000000, 0x4b000000,
+		0x18000000, 0x29000000, 0xbe000000, 0x8f000000, 0xdc000000,
+		0xed000000, 0xc3000000, 0xf2000000, 0xa1000000, 0x90000000,
+		0x07000000, 0x36000000, 0x65000000, 0x54000000, 0x39000000,
+		0x08000000, 0x5b000000, 0x6a000000, 0xfd000000, 0xcc000000,
+		0x9f000000, 0xae000000, 0x80000000, 0xb1000000, 0xe2000000,
+		0xd3000000, 0x44000000, 0x75000000, 0x26000000, 0x17000000,
+		0xfc000000, 0xcd000000, 0x9e000000, 0xaf000000, 0x38000000,
+		0x09000000, 0x5a000000, 0x6b000000, 0x45000000, 0x74000000,
+		0x27000000, 0x16000000, 0x81000000, 0xb0000000, 0xe3000000,
+		0xd2000000, 0xbf000000, 0x8e000000, 0xdd000000, 0xec000000,
+		0x7b000000, 0x4a000000, 0x19000000, 0x28000000, 0x06000000,
+		0x37000000, 0x64000000, 0x55000000, 0xc2000000, 0xf3000000,
+		0xa0000000, 0x91000000, 0x47000000, 0x76000000, 0x25000000,
+		0x14000000, 0x83000000, 0xb2000000, 0xe1000000, 0xd0000000,
+		0xfe000000, 0xcf000000, 0x9c000000, 0xad000000, 0x3a000000,
+		0x0b000000, 0x58000000, 0x69000000, 0x04000000, 0x35000000,
+		0x66000000, 0x57000000, 0xc0000000, 0xf1000000, 0xa2000000,
+		0x93000000, 0xbd000000, 0x8c000000, 0xdf000000, 0xee000000,
+		0x79000000, 0x48000000, 0x1b000000, 0x2a000000, 0xc1000000,
+		0xf0000000, 0xa3000000, 0x92000000, 0x05000000, 0x34000000,
+		0x67000000, 0x56000000, 0x78000000, 0x49000000, 0x1a000000,
+		0x2b000000, 0xbc000000, 0x8d000000, 0xde000000, 0xef000000,
+		0x82000000, 0xb3000000, 0xe0000000, 0xd1000000, 0x46000000,
+		0x77000000, 0x24000000, 0x15000000, 0x3b000000, 0x0a000000,
+		0x59000000, 0x68000000, 0xff000000, 0xce000000, 0x9d000000,
+		0xac000000,
+	},
+	{
+		0x00000000, 0xf4000000, 0xd9000000, 0x2d000000, 0x83000000,
+		0x77000000, 0x5a000000, 0xae000000, 0x37000000, 0xc3000000,
+		0xee000000, 0x1a000000, 0xb4000000, 0x40000000, 0x6d000000,
+		0x99000000, 0x6e000000, 0x9a000000, 0xb7000000, 0x43000000,
+		0xed000000, 0x19000000, 0x34000000, 0xc0000000, 0x59000000,
+		0xad000000, 0x80000000, 0x74000000, 0xda000000, 0x2e000000,
+		0x03000000, 0xf7000000, 0xdc000000, 0x28000000, 0x05000000,
+		0xf1000000, 0x5f000000, 0xab000000, 0x86000000, 0x72000000,
+		0xeb000000, 0x1f000000, 0x32000000, 0xc6000000, 0x68000000,
+		0x9c000000, 0xb1000000, 0x45000000, 0xb2000000, 0x46000000,
+		0x6b000000, 0x9f000000, 0x31000000, 0xc5000000, 0xe8000000,
+		0x1c000000, 0x85000000, 0x71000000, 0x5c000000, 0xa8000000,
+		0x06000000, 0xf2000000, 0xdf000000, 0x2b000000, 0x89000000,
+		0x7d000000, 0x50000000, 0xa4000000, 0x0a000000, 0xfe000000,
+		0xd3000000, 0x27000000, 0xbe000000, 0x4a000000, 0x67000000,
+		0x93000000, 0x3d000000, 0xc9000000, 0xe4000000, 0x10000000,
+		0xe7000000, 0x13000000, 0x3e000000, 0xca000000, 0x64000000,
+		0x90000000, 0xbd000000, 0x49000000, 0xd0000000, 0x24000000,
+		0x09000000, 0xfd000000, 0x53000000, 0xa7000000, 0x8a000000,
+		0x7e000000, 0x55000000, 0xa1000000, 0x8c000000, 0x78000000,
+		0xd6000000, 0x22000000, 0x0f000000, 0xfb000000, 0x62000000,
+		0x96000000, 0xbb000000, 0x4f000000, 0xe1000000, 0x15000000,
+		0x38000000, 0xcc000000, 0x3b000000, 0xcf000000, 0xe2000000,
+		0x16000000, 0xb8000000, 0x4c000000, 0x61000000, 0x95000000,
+		0x0c000000, 0xf8000000, 0xd5000000, 0x21000000, 0x8f000000,
+		0x7b000000, 0x56000000, 0xa2000000, 0x23000000, 0xd7000000,
+		0xfa000000, 0x0e000000, 0xa0000000, 0x54000000, 0x79000000,
+		0x8d000000, 0x14000000, 0xe0000000, 0xcd000000, 0x39000000,
+		0x97000000, 0x63000000, 0x4e000000, 0xba000000, 0x4d000000,
+		0xb9000000, 0x94000000, 0x60000000, 0xce000000, 0x3a000000,
+		0x17000000, 0xe3000000, 0x7a000000, 0x8e000000, 0xa3000000,
+		0x57000000, 0xf9000000, 0x0d000000, 0x20000000, 0xd4000000,
+		0xff000000, 0x0b000000, 0x26000000, 0xd2000000, 0x7c000000,
+		0x88000000, 0xa5000000, 0x51000000, 0xc8000000, 0x3c000000,
+		0x11000000, 0xe5000000, 0x4b000000, 0xbf000000, 0x92000000,
+		0x66000000, 0x91000000, 0x65000000, 0x48000000, 0xbc000000,
+		0x12000000, 0xe6000000, 0xcb000000, 0x3f000000, 0xa6000000,
+		0x52000000, 0x7f000000, 0x8b000000, 0x25000000, 0xd1000000,
+		0xfc000000, 0x08000000, 0xaa000000, 0x5e000000, 0x73000000,
+		0x87000000, 0x29000000, 0xdd000000, 0xf0000000, 0x04000000,
+		0x9d000000, 0x69000000, 0x44000000, 0xb0000000, 0x1e000000,
+		0xea000000, 0xc7000000, 0x33000000, 0xc4000000, 0x30000000,
+		0x1d000000, 0xe9000000, 0x47000000, 0xb3000000, 0x9e000000,
+		0x6a000000, 0xf3000000, 0x07000000, 0x2a000000, 0xde000000,
+		0x70000000, 0x84000000, 0xa9000000, 0x5d000000, 0x76000000,
+		0x82000000, 0xaf000000, 0x5b000000, 0xf5000000, 0x01000000,
+		0x2c000000, 0xd8000000, 0x41000000, 0xb5000000, 0x98000000,
+		0x6c000000, 0xc2000000, 0x36000000, 0x1b000000, 0xef000000,
+		0x18000000, 0xec000000, 0xc1000000, 0x35000000, 0x9b000000,
+		0x6f000000, 0x42000000, 0xb6000000, 0x2f000000, 0xdb000000,
+		0xf6000000, 0x02000000, 0xac000000, 0x58000000, 0x75000000,
+		0x81000000,
+	},
+	{
+		0x00000000, 0x46000000, 0x8c000000, 0xca000000, 0x29000000,
+		0x6f000000, 0xa5000000, 0xe3000000, 0x52000000, 0x14000000,
+		0xde000000, 0x98000000, 0x7b000000, 0x3d000000, 0xf7000000,
+		0xb1000000, 0xa4000000, 0xe2000000, 0x28000000, 0x6e000000,
+		0x8d000000, 0xcb000000, 0x01000000, 0x47000000, 0xf6000000,
+		0xb0000000, 0x7a000000, 0x3c000000, 0xdf000000, 0x99000000,
+		0x53000000, 0x15000000, 0x79000000, 0x3f000000, 0xf5000000,
+		0xb3000000, 0x50000000, 0x16000000, 0xdc000000, 0x9a000000,
+		0x2b000000, 0x6d000000, 0xa7000000, 0xe1000000, 0x02000000,
+		0x44000000, 0x8e000000, 0xc8000000, 0xdd000000, 0x9b000000,
+		0x51000000, 0x17000000, 0xf4000000, 0xb2000000, 0x78000000,
+		0x3e000000, 0x8f000000, 0xc9000000, 0x03000000, 0x45000000,
+		0xa6000000, 0xe0000000, 0x2a000000, 0x6c000000, 0xf2000000,
+		0xb4000000, 0x7e000000, 0x38000000, 0xdb000000, 0x9d000000,
+		0x57000000, 0x11000000, 0xa0000000, 0xe6000000, 0x2c000000,
+		0x6a000000, 0x89000000, 0xcf000000, 0x05000000, 0x43000000,
+		0x56000000, 0x10000000, 0xda000000, 0x9c000000, 0x7f000000,
+		0x39000000, 0xf3000000, 0xb5000000, 0x04000000, 0x42000000,
+		0x88000000, 0xce000000, 0x2d000000, 0x6b000000, 0xa1000000,
+		0xe7000000, 0x8b000000, 0xcd000000, 0x07000000, 0x41000000,
+		0xa2000000, 0xe4000000, 0x2e000000, 0x68000000, 0xd9000000,
+		0x9f000000, 0x55000000, 0x13000000, 0xf0000000, 0xb6000000,
+		0x7c000000, 0x3a000000, 0x2f000000, 0x69000000, 0xa3000000,
+		0xe5000000, 0x06000000, 0x40000000, 0x8a000000, 0xcc000000,
+		0x7d000000, 0x3b000000, 0xf1000000, 0xb7000000, 0x54000000,
+		0x12000000, 0xd8000000, 0x9e000000, 0xd5000000, 0x93000000,
+		0x59000000, 0x1f000000, 0xfc000000, 0xba000000, 0x70000000,
+		0x36000000, 0x87000000, 0xc1000000, 0x0b000000, 0x4d000000,
+		0xae000000, 0xe8000000, 0x22000000, 0x64000000, 0x71000000,
+		0x37000000, 0xfd000000, 0xbb000000, 0x58000000, 0x1e000000,
+		0xd4000000, 0x92000000, 0x23000000, 0x65000000, 0xaf000000,
+		0xe9000000, 0x0a000000, 0x4c000000, 0x86000000, 0xc0000000,
+		0xac000000, 0xea000000, 0x20000000, 0x66000000, 0x85000000,
+		0xc3000000, 0x09000000, 0x4f000000, 0xfe000000, 0xb8000000,
+		0x72000000, 0x34000000, 0xd7000000, 0x91000000, 0x5b000000,
+		0x1d000000, 0x08000000, 0x4e000000, 0x84000000, 0xc2000000,
+		0x21000000, 0x67000000, 0xad000000, 0xeb000000, 0x5a000000,
+		0x1c000000, 0xd6000000, 0x90000000, 0x73000000, 0x35000000,
+		0xff000000, 0xb9000000, 0x27000000, 0x61000000, 0xab000000,
+		0xed000000, 0x0e000000, 0x48000000, 0x82000000, 0xc4000000,
+		0x75000000, 0x33000000, 0xf9000000, 0xbf000000, 0x5c000000,
+		0x1a000000, 0xd0000000, 0x96000000, 0x83000000, 0xc5000000,
+		0x0f000000, 0x49000000, 0xaa000000, 0xec000000, 0x26000000,
+		0x60000000, 0xd1000000, 0x97000000, 0x5d000000, 0x1b000000,
+		0xf8000000, 0xbe000000, 0x74000000, 0x32000000, 0x5e000000,
+		0x18000000, 0xd2000000, 0x94000000, 0x77000000, 0x31000000,
+		0xfb000000, 0xbd000000, 0x0c000000, 0x4a000000, 0x80000000,
+		0xc6000000, 0x25000000, 0x63000000, 0xa9000000, 0xef000000,
+		0xfa000000, 0xbc000000, 0x76000000, 0x30000000, 0xd3000000,
+		0x95000000, 0x5f000000, 0x19000000, 0xa8000000, 0xee000000,
+		0x24000000, 0x62000000, 0x81000000, 0xc7000000, 0x0d000000,
+		0x4b000000,
+	},
+	{
+		0x00000000, 0x9b000000, 0x07000000, 0x9c000000, 0x0e000000,
+		0x95000000, 0x09000000, 0x92000000, 0x1c000000, 0x87000000,
+		0x1b000000, 0x80000000, 0x12000000, 0x89000000, 0x15000000,
+		0x8e000000, 0x38000000, 0xa3000000, 0x3f000000, 0xa4000000,
+		0x36000000, 0xad000000, 0x31000000, 0xaa000000, 0x24000000,
+		0xbf000000, 0x23000000, 0xb8000000, 0x2a000000, 0xb1000000,
+		0x2d000000, 0xb6000000, 0x70000000, 0xeb000000, 0x77000000,
+		0xec000000, 0x7e000000, 0xe5000000, 0x79000000, 0xe2000000,
+		0x6c000000, 0xf7000000, 0x6b000000, 0xf0000000, 0x62000000,
+		0xf9000000, 0x65000000, 0xfe000000, 0x48000000, 0xd3000000,
+		0x4f000000, 0xd4000000, 0x46000000, 0xdd000000, 0x41000000,
+		0xda000000, 0x54000000, 0xcf000000, 0x53000000, 0xc8000000,
+		0x5a000000, 0xc1000000, 0x5d000000, 0xc6000000, 0xe0000000,
+		0x7b000000, 0xe7000000, 0x7c000000, 0xee000000, 0x75000000,
+		0xe9000000, 0x72000000, 0xfc000000, 0x67000000, 0xfb000000,
+		0x60000000, 0xf2000000, 0x69000000, 0xf5000000, 0x6e000000,
+		0xd8000000, 0x43000000, 0xdf000000, 0x44000000, 0xd6000000,
+		0x4d000000, 0xd1000000, 0x4a000000, 0xc4000000, 0x5f000000,
+		0xc3000000, 0x58000000, 0xca000000, 0x51000000, 0xcd000000,
+		0x56000000, 0x90000000, 0x0b000000, 0x97000000, 0x0c000000,
+		0x9e000000, 0x05000000, 0x99000000, 0x02000000, 0x8c000000,
+		0x17000000, 0x8b000000, 0x10000000, 0x82000000, 0x19000000,
+		0x85000000, 0x1e000000, 0xa8000000, 0x33000000, 0xaf000000,
+		0x34000000, 0xa6000000, 0x3d000000, 0xa1000000, 0x3a000000,
+		0xb4000000, 0x2f000000, 0xb3000000, 0x28000000, 0xba000000,
+		0x21000000, 0xbd000000, 0x26000000, 0xf1000000, 0x6a000000,
+		0xf6000000, 0x6d000000, 0xff000000, 0x64000000, 0xf8000000,
+		0x63000000, 0xed000000, 0x76000000, 0xea000000, 0x71000000,
+		0xe3000000, 0x78000000, 0xe4000000, 0x7f000000, 0xc9000000,
+		0x52000000, 0xce000000, 0x55000000, 0xc7000000, 0x5c000000,
+		0xc0000000, 0x5b000000, 0xd5000000, 0x4e000000, 0xd2000000,
+		0x49000000, 0xdb000000, 0x40000000, 0xdc000000, 0x47000000,
+		0x81000000, 0x1a000000, 0x86000000, 0x1d000000, 0x8f000000,
+		0x14000000, 0x88000000, 0x13000000, 0x9d000000, 0x06000000,
+		0x9a000000, 0x01000000, 0x93000000, 0x08000000, 0x94000000,
+		0x0f000000, 0xb9000000, 0x22000000, 0xbe000000, 0x25000000,
+		0xb7000000, 0x2c000000, 0xb0000000, 0x2b000000, 0xa5000000,
+		0x3e000000, 0xa2000000, 0x39000000, 0xab000000, 0x30000000,
+		0xac000000, 0x37000000, 0x11000000, 0x8a000000, 0x16000000,
+		0x8d000000, 0x1f000000, 0x84000000, 0x18000000, 0x83000000,
+		0x0d000000, 0x96000000, 0x0a000000, 0x91000000, 0x03000000,
+		0x98000000, 0x04000000, 0x9f000000, 0x29000000, 0xb2000000,
+		0x2e000000, 0xb5000000, 0x27000000, 0xbc000000, 0x20000000,
+		0xbb000000, 0x35000000, 0xae000000, 0x32000000, 0xa9000000,
+		0x3b000000, 0xa0000000, 0x3c000000, 0xa7000000, 0x61000000,
+		0xfa000000, 0x66000000, 0xfd000000, 0x6f000000, 0xf4000000,
+		0x68000000, 0xf3000000, 0x7d000000, 0xe6000000, 0x7a000000,
+		0xe1000000, 0x73000000, 0xe8000000, 0x74000000, 0xef000000,
+		0x59000000, 0xc2000000, 0x5e000000, 0xc5000000, 0x57000000,
+		0xcc000000, 0x50000000, 0xcb000000, 0x45000000, 0xde000000,
+		0x42000000, 0xd9000000, 0x4b000000, 0xd0000000, 0x4c000000,
+		0xd7000000,
+	},
+};
+
+const struct no_os_crc_engine no_os_crc8_31_engine = {
+	.width = 8,
+	.polynomial = 0x31,
+	.slices = NO_OS_CRC_SLICE_BY_4,
+	.table = no_os_crc8_31_table,
+};
+
+/* CRC-16-CCITT, poly = 0x1021 */
+static const uint32_t
+no_os_crc16_1021_table[NO_OS_CRC_SLICE_BY_4][NO_OS_CRC_ENGINE_TABLE_SIZE] = {
+	{
+		0x00000000, 0x10210000, 0x20420000, 0x30630000, 0x40840000,
+		0x50a50000, 0x60c60000, 0x70e70000, 0x81080000, 0x91290000,
+		0xa14a0000, 0xb16b0000, 0xc18c0000, 0xd1ad0000, 0xe1ce0000,
+		0xf1ef0000, 0x12310000, 0x02100000, 0x32730000, 0x22520000,
+		0x52b50000, 0x42940000, 0x72f70000, 0x62d60000, 0x93390000,
+		0x83180000, 0xb37b0000, 0xa35a0000, 0xd3bd0000, 0xc39c0000,
+		0xf3ff0000, 0xe3de0000, 0x24620000, 0x34430000, 0x04200000,
+		0x14010000, 0x64e60000, 0x74c70000, 0x44a40000, 0x54850000,
+		0xa56a0000, 0xb54b0000, 0x85280000, 0x95090000, 0xe5ee0000,
+		0xf5cf0000, 0xc5ac0000, 0xd58d0000, 0x36530000, 0x26720000,
+		0x16110000, 0x06300000, 0x76d70000, 0x66f60000, 0x56950000,
+		0x46b40000, 0xb75b0000, 0xa77a0000, 0x97190000, 0x87380000,
+		0xf7df0000, 0xe7fe0000, 0xd79d0000, 0xc7bc0000, 0x48c40000,
+		0x58e50000, 0x68860000, 0x78a70000, 0x08400000, 0x18610000,
+		0x28020000, 0x38230000, 0xc9cc0000, 0xd9ed0000, 0xe98e0000,
+		0xf9af0000, 0x89480000, 0x99690000, 0xa90a0000, 0xb92b0000,
+		0x5af50000, 0x4ad40000, 0x7ab70000, 0x6a960000, 0x1a710000,
+		0x0a500000, 0x3a330000, 0x2a120000, 0xdbfd0000, 0xcbdc0000,
+		0xfbbf0000, 0xeb9e0000, 0x9b790000, 0x8b580000, 0xbb3b0000,
+		0xab1a0000, 0x6ca60000, 0x7c870000, 0x4ce40000, 0x5cc50000,
+		0x2c220000, 0x3c030000, 0x0c600000, 0x1c410000, 0xedae0000,
+		0xfd8f0000, 0xcdec0000, 0xddcd0000, 0xad2a0000, 0xbd0b0000,
+		0x8d680000, 0x9d490000, 0x7e970000, 0x6eb60000, 0x5ed50000,
+		0x4ef40000, 0x3e130000, 0x2e320000, 0x1e510000, 0x0e700000,
+		0xff9f0000, 0xefbe0000, 0xdfdd0000, 0xcffc0000, 0xbf1b0000,
+		0xaf3a0000, 0x9f590000, 0x8f780000, 0x91880000, 0x81a90000,
+		0xb1ca0000, 0xa1eb0000, 0xd10c0000, 0xc12d0000, 0xf14e0000,
+		0xe16f0000, 0x10800000, 0x00a10000, 0x30c20000, 0x20e30000,
+		0x50040000, 0x40250000, 0x70460000, 0x60670000, 0x83b90000,
+		0x93980000, 0xa3fb0000, 0xb3da0000, 0xc33d0000, 0xd31c0000,
+		0xe37f0000, 0xf35e0000, 0x02b10000, 0x12900000, 0x22f30000,
+		0x32d20000, 0x42350000, 0x52140000, 0x62770000, 0x72560000,
+		0xb5ea0000, 0xa5cb0000, 0x95a80000, 0x85890000, 0xf56e0000,
+		0xe54f0000, 0xd52c0000, 0xc50d0000, 0x34e20000, 0x24c30000,
+		0x14a00000, 0x04810000, 0x74660000, 0x64470000, 0x54240000,
+		0x44050000, 0xa7db0000, 0xb7fa0000, 0x87990000, 0x97b80000,
+		0xe75f0000, 0xf77e0000, 0xc71d0000, 0xd73c0000, 0x26d30000,
+		0x36f20000, 0x06910000, 0x16b00000, 0x66570000, 0x76760000,
+		0x46150000, 0x56340000, 0xd94c0000, 0xc96d0000, 0xf90e0000,
+		0xe92f0000, 0x99c80000, 0x89e90000, 0xb98a0000, 0xa9ab0000,
+		0x58440000, 0x48650000, 0x78060000, 0x68270000, 0x18c00000,
+		0x08e10000, 0x38820000, 0x28a30000, 0xcb7d0000, 0xdb5c0000,
+		0xeb3f0000, 0xfb1e0000, 0x8bf90000, 0x9bd80000, 0xabbb0000,
+		0xbb9a0000, 0x4a750000, 0x5a540000, 0x6a370000, 0x7a160000,
+		0x0af10000, 0x1ad00000, 0x2ab30000, 0x3a920000, 0xfd2e0000,
+		0xed0f0000, 0xdd6c0000, 0xcd4d0000, 0xbdaa0000, 0xad8b0000,
+		0x9de80000, 0x8dc90000, 0x7c260000, 0x6c070000, 0x5c640000,
+		0x4c450000, 0x3ca20000, 0x2c830000, 0x1ce00000, 0x0cc10000,
+		0xef1f0000, 0xff3e0000, 0xcf5d0000, 0xdf7c0000, 0xaf9b0000,
+		0xbfba0000, 0x8fd90000, 0x9ff80000, 0x6e170000, 0x7e360000,
+		0x4e550000, 0x5e740000, 0x2e930000, 0x3eb20000, 0x0ed10000,
+		0x1ef00000,
+	},
+	{
+		0x00000000, 0x33310000, 0x66620000, 0x55530000, 0xccc40000,
+		0xfff50000, 0xaaa60000, 0x99970000, 0x89a90000, 0xba980000,
+		0xefcb0000, 0xdcfa0000, 0x456d0000, 0x765c0000, 0x230f0000,
+		0x103e0000, 0x03730000, 0x30420000, 0x65110000, 0x56200000,
+		0xcfb70000, 0xfc860000, 0xa9d50000, 0x9ae40000, 0x8ada0000,
+		0xb9eb0000, 0xecb80000, 0xdf890000, 0x461e0000, 0x752f0000,
+		0x207c0000, 0x134d0000, 0x06e60000, 0x35d70000, 0x60840000,
+		0x53b50000, 0xca220000, 0xf9130000, 0xac400000, 0x9f710000,
+		0x8f4f0000, 0xbc7e0000, 0xe92d0000, 0xda1c0000, 0x438b0000,
+		0x70ba0000, 0x25e90000, 0x16d80000, 0x05950000, 0x36a40000,
+		0x63f70000, 0x50c60000, 0xc9510000, 0xfa600000, 0xaf330000,
+		0x9c020000, 0x8c3c0000, 0xbf0d0000, 0xea5e0000, 0xd96f0000,
+		0x40f80000, 0x73c90000, 0x269a0000, 0x15ab0000, 0x0dcc0000,
+		0x3efd0000, 0x6bae0000, 0x589f0000, 0xc1080000, 0xf2390000,
+		0xa76a0000, 0x945b0000, 0x84650000, 0xb7540000, 0xe2070000,
+		0xd1360000, 0x48a10000, 0x7b900000, 0x2ec30000, 0x1df20000,
+		0x0ebf0000, 0x3d8e0000, 0x68dd0000, 0x5bec0000, 0xc27b0000,
+		0xf14a0000, 0xa4190000, 0x97280000, 0x87160000, 0xb4270000,
+		0xe1740000, 0xd2450000, 0x4bd20000, 0x78e30000, 0x2db00000,
+		0x1e810000, 0x0b2a0000, 0x381b0000, 0x6d480000, 0x5e790000,
+		0xc7ee0000, 0xf4df0000, 0xa18c0000, 0x92bd0000, 0x82830000,
+		0xb1b20000, 0xe4e10000, 0xd7d00000, 0x4e470000, 0x7d760000,
+		0x28250000, 0x1b140000, 0x08590000, 0x3b680000, 0x6e3b0000,
+		0x5d0a0000, 0xc49d0000, 0xf7ac0000, 0xa2ff0000, 0x91ce0000,
+		0x81f00000, 0xb2c10000, 0xe7920000, 0xd4a30000, 0x4d340000,
+		0x7e050000, 0x2b560000, 0x18670000, 0x1b980000, 0x28a90000,
+		0x7dfa0000, 0x4ecb0000, 0xd75c0000, 0xe46d0000, 0xb13e0000,
+		0x820f0000, 0x92310000, 0xa1000000, 0xf4530000, 0xc7620000,
+		0x5ef50000, 0x6dc40000, 0x38970000, 0x0ba60000, 0x18eb0000,
+		0x2bda0000, 0x7e890000, 0x4db80000, 0xd42f0000, 0xe71e0000,
+		0xb24d0000, 0x817c0000, 0x91420000, 0xa2730000, 0xf7200000,
+		0xc4110000, 0x5d860000, 0x6eb70000, 0x3be40000, 0x08d50000,
+		0x1d7e0000, 0x2e4f0000, 0x7b1c0000, 0x482d0000, 0xd1ba0000,
+		0xe28b0000, 0xb7d80000, 0x84e90000, 0x94d70000, 0xa7e60000,
+		0xf2b50000, 0xc1840000, 0x58130000, 0x6b220000, 0x3e710000,
+		0x0d400000, 0x1e0d0000, 0x2d3c0000, 0x786f0000, 0x4b5e0000,
+		0xd2c90000, 0xe1f80000, 0xb4ab0000, 0x879a0000, 0x97a40000,
+		0xa4950000, 0xf1c60000, 0xc2f70000, 0x5b600000, 0x68510000,
+		0x3d020000, 0x0e330000, 0x16540000, 0x25650000, 0x70360000,
+		0x43070000, 0xda900000, 0xe9a10000, 0xbcf20000, 0x8fc30000,
+		0x9ffd0000, 0xaccc0000, 0xf99f0000, 0xcaae0000, 0x53390000,
+		0x60080000, 0x355b0000, 0x066a0000, 0x15270000, 0x26160000,
+		0x73450000, 0x40740000, 0xd9e30000, 0xead20000, 0xbf810000,
+		0x8cb00000, 0x9c8e0000, 0xafbf0000, 0xfaec0000, 0xc9dd0000,
+		0x504a0000, 0x637b0000, 0x36280000, 0x05190000, 0x10b20000,
+		0x23830000, 0x76d00000, 0x45e10000, 0xdc760000, 0xef470000,
+		0xba140000, 0x89250000, 0x991b0000, 0xaa2a0000, 0xff790000,
+		0xcc480000, 0x55df0000, 0x66ee0000, 0x33bd0000, 0x008c0000,
+		0x13c10000, 0x20f00000, 0x75a30000, 0x46920000, 0xdf050000,
+		0xec340000, 0xb9670000, 0x8a560000, 0x9a680000, 0xa9590000,
+		0xfc0a0000, 0xcf3b0000, 0x56ac0000, 0x659d0000, 0x30ce0000,
+		0x03ff0000,
+	},
+	{
+		0x00000000, 0x37300000, 0x6e600000, 0x59500000, 0xdcc00000,
+		0xebf00000, 0xb2a00000, 0x85900000, 0xa9a10000, 0x9e910000,
+		0xc7c10000, 0xf0f10000, 0x75610000, 0x42510000, 0x1b010000,
+		0x2c310000, 0x43630000, 0x74530000, 0x2d030000, 0x1a330000,
+		0x9fa30000, 0xa8930000, 0xf1c30000, 0xc6f30000, 0xeac20000,
+		0xddf20000, 0x84a20000, 0xb3920000, 0x36020000, 0x01320000,
+		0x58620000, 0x6f520000, 0x86c60000, 0xb1f60000, 0xe8a60000,
+		0xdf960000, 0x5a060000, 0x6d360000, 0x34660000, 0x03560000,
+		0x2f670000, 0x18570000, 0x41070000, 0x76370000, 0xf3a70000,
+		0xc4970000, 0x9dc70000, 0xaaf70000, 0xc5a50000, 0xf2950000,
+		0xabc50000, 0x9cf50000, 0x19650000, 0x2e550000, 0x77050000,
+		0x40350000, 0x6c040000, 0x5b340000, 0x02640000, 0x35540000,
+		0xb0c40000, 0x87f40000, 0xdea40000, 0xe9940000, 0x1dad0000,
+		0x2a9d0000, 0x73cd0000, 0x44fd0000, 0xc16d0000, 0xf65d0000,
+		0xaf0d0000, 0x983d0000, 0xb40c0000, 0x833c0000, 0xda6c0000,
+		0xed5c0000, 0x68cc0000, 0x5ffc0000, 0x06ac0000, 0x319c0000,
+		0x5ece0000, 0x69fe0000, 0x30ae0000, 0x079e0000, 0x820e0000,
+		0xb53e0000, 0xec6e0000, 0xdb5e0000, 0xf76f0000, 0xc05f0000,
+		0x990f0000, 0xae3f0000, 0x2baf0000, 0x1c9f0000, 0x45cf0000,
+		0x72ff0000, 0x9b6b0000, 0xac5b0000, 0xf50b0000, 0xc23b0000,
+		0x47ab0000, 0x709b0000, 0x29cb0000, 0x1efb0000, 0x32ca0000,
+		0x05fa0000, 0x5caa0000, 0x6b9a0000, 0xee0a0000, 0xd93a0000,
+		0x806a0000, 0xb75a0000, 0xd8080000, 0xef380000, 0xb6680000,
+		0x81580000, 0x04c80000, 0x33f80000, 0x6aa80000, 0x5d980000,
+		0x71a90000, 0x46990000, 0x1fc90000, 0x28f90000, 0xad690000,
+		0x9a590000, 0xc3090000, 0xf4390000, 0x3b5a0000, 0x0c6a0000,
+		0x553a0000, 0x620a0000, 0xe79a0000, 0xd0aa0000, 0x89fa0000,
+		0xbeca0000, 0x92fb0000, 0xa5cb0000, 0xfc9b0000, 0xcbab0000,
+		0x4e3b0000, 0x790b0000, 0x205b0000, 0x176b0000, 0x78390000,
+		0x4f090000, 0x16590000, 0x21690000, 0xa4f90000, 0x93c90000,
+		0xca990000, 0xfda90000, 0xd1980000, 0xe6a80000, 0xbff80000,
+		0x88c80000, 0x0d580000, 0x3a680000, 0x63380000, 0x54080000,
+		0xbd9c0000, 0x8aac0000, 0xd3fc0000, 0xe4cc0000, 0x615c0000,
+		0x566c0000, 0x0f3c0000, 0x380c0000, 0x143d0000, 0x230d0000,
+		0x7a5d0000, 0x4d6d0000, 0xc8fd0000, 0xffcd0000, 0xa69d0000,
+		0x91ad0000, 0xfeff0000, 0xc9cf0000, 0x909f0000, 0xa7af0000,
+		0x223f0000, 0x150f0000, 0x4c5f0000, 0x7b6f0000, 0x575e0000,
+		0x606e0000, 0x393e0000, 0x0e0e0000, 0x8b9e0000, 0xbcae0000,
+		0xe5fe0000, 0xd2ce0000, 0x26f70000, 0x11c70000, 0x48970000,
+		0x7fa70000, 0xfa370000, 0xcd070000, 0x94570000, 0xa3670000,
+		0x8f560000, 0xb8660000, 0xe1360000, 0xd6060000, 0x53960000,
+		0x64a60000, 0x3df60000, 0x0ac60000, 0x65940000, 0x52a40000,
+		0x0bf40000, 0x3cc40000, 0xb9540000, 0x8e640000, 0xd7340000,
+		0xe0040000, 0xcc350000, 0xfb050000, 0xa2550000, 0x95650000,
+		0x10f50000, 0x27c50000, 0x7e950000, 0x49a50000, 0xa0310000,
+		0x97010000, 0xce510000, 0xf9610000, 0x7cf10000, 0x4bc10000,
+		0x12910000, 0x25a10000, 0x09900000, 0x3ea00000, 0x67f00000,
+		0x50c00000, 0xd5500000, 0xe2600000, 0xbb300000, 0x8c000000,
+		0xe3520000, 0xd4620000, 0x8d320000, 0xba020000, 0x3f920000,
+		0x08a20000, 0x51f20000, 0x66c20000, 0x4af30000, 0x7dc30000,
+		0x24930000, 0x13a30000, 0x96330000, 0xa1030000, 0xf8530000,
+		0xcf630000,
+	},
+	{
+		0x00000000, 0x76b40000, 0xed680000, 0x9bdc0000, 0xcaf10000,
+		0xbc450000, 0x27990000, 0x512d0000, 0x85c30000, 0xf3770000,
+		0x68ab0000, 0x1e1f0000, 0x4f320000, 0x39860000, 0xa25a0000,
+		0xd4ee0000, 0x1ba70000, 0x6d130000, 0xf6cf0000, 0x807b0000,
+		0xd1560000, 0xa7e20000, 0x3c3e0000, 0x4a8a0000, 0x9e640000,
+		0xe8d00000, 0x730c0000, 0x05b80000, 0x54950000, 0x22210000,
+		0xb9fd0000, 0xcf490000, 0x374e0000, 0x41fa0000, 0xda260000,
+		0xac920000, 0xfdbf0000, 0x8b0b0000, 0x10d70000, 0x66630000,
+		0xb28d0000, 0xc4390000, 0x5fe50000, 0x29510000, 0x787c0000,
+		0x0ec80000, 0x95140000, 0xe3a00000, 0x2ce90000, 0x5a5d0000,
+		0xc1810000, 0xb7350000, 0xe6180000, 0x90ac0000, 0x0b700000,
+		0x7dc40000, 0xa92a0000, 0xdf9e0000, 0x44420000, 0x32f60000,
+		0x63db0000, 0x156f0000, 0x8eb30000, 0xf8070000, 0x6e9c0000,
+		0x18280000, 0x83f40000, 0xf5400000, 0xa46d0000, 0xd2d90000,
+		0x49050000, 0x3fb10000, 0xeb5f0000, 0x9deb0000, 0x06370000,
+		0x70830000, 0x21ae0000, 0x571a0000, 0xccc60000, 0xba720000,
+		0x753b0000, 0x038f0000, 0x98530000, 0xeee70000, 0xbfca0000,
+		0xc97e0000, 0x52a20000, 0x24160000, 0xf0f80000, 0x864c0000,
+		0x1d900000, 0x6b240000, 0x3a090000, 0x4cbd0000, 0xd7610000,
+		0xa1d50000, 0x59d20000, 0x2f660000, 0xb4ba0000, 0xc20e0000,
+		0x93230000, 0xe5970000, 0x7e4b0000, 0x08ff0000, 0xdc110000,
+		0xaaa50000, 0x31790000, 0x47cd0000, 0x16e00000, 0x60540000,
+		0xfb880000, 0x8d3c0000, 0x42750000, 0x34c10000, 0xaf1d0000,
+		0xd9a90000, 0x88840000, 0xfe300000, 0x65ec0000, 0x13580000,
+		0xc7b60000, 0xb1020000, 0x2ade0000, 0x5c6a0000, 0x0d470000,
+		0x7bf30000, 0xe02f0000, 0x969b0000, 0xdd380000, 0xab8c0000,
+		0x30500000, 0x46e40000, 0x17c90000, 0x617d0000, 0xfaa10000,
+		0x8c150000, 0x58fb0000, 0x2e4f0000, 0xb5930000, 0xc3270000,
+		0x920a0000, 0xe4be0000, 0x7f620000, 0x09d60000, 0xc69f0000,
+		0xb02b0000, 0x2bf70000, 0x5d430000, 0x0c6e0000, 0x7ada0000,
+		0xe1060000, 0x97b20000, 0x435c0000, 0x35e80000, 0xae340000,
+		0xd8800000, 0x89ad0000, 0xff190000, 0x64c50000, 0x12710000,
+		0xea760000, 0x9cc20000, 0x071e0000, 0x71aa0000, 0x20870000,
+		0x56330000, 0xcdef0000, 0xbb5b0000, 0x6fb50000, 0x19010000,
+		0x82dd0000, 0xf4690000, 0xa5440000, 0xd3f00000, 0x482c0000,
+		0x3e980000, 0xf1d10000, 0x87650000, 0x1cb90000, 0x6a0d0000,
+		0x3b200000, 0x4d940000, 0xd6480000, 0xa0fc0000, 0x74120000,
+		0x02a60000, 0x997a0000, 0xefce0000, 0xbee30000, 0xc8570000,
+		0x538b0000, 0x253f0000, 0xb3a40000, 0xc5100000, 0x5ecc0000,
+		0x28780000, 0x79550000, 0x0fe10000, 0x943d0000, 0xe2890000,
+		0x36670000, 0x40d30000, 0xdb0f0000, 0xadbb0000, 0xfc960000,
+		0x8a220000, 0x11fe0000, 0x674a0000, 0xa8030000, 0xdeb70000,
+		0x456b0000, 0x33df0000, 0x62f20000, 0x14460000, 0x8f9a0000,
+		0xf92e0000, 0x2dc00000, 0x5b740000, 0xc0a80000, 0xb61c0000,
+		0xe7310000, 0x91850000, 0x0a590000, 0x7ced0000, 0x84ea0000,
+		0xf25e0000, 0x69820000, 0x1f360000, 0x4e1b0000, 0x38af0000,
+		0xa3730000, 0xd5c70000, 0x01290000, 0x779d0000, 0xec410000,
+		0x9af50000, 0xcbd80000, 0xbd6c0000, 0x26b00000, 0x50040000,
+		0x9f4d0000, 0xe9f90000, 0x72250000, 0x04910000, 0x55bc0000,
+		0x23080000, 0xb8d40000, 0xce600000, 0x1a8e0000, 0x6c3a0000,
+		0xf7e60000, 0x81520000, 0xd07f0000, 0xa6cb0000, 0x3d170000,
+		0x4ba30000,
+	},
+};
+
+const struct no_os_crc_engine no_os_crc16_1021_engine = {
+	.width = 16,
+	.polynomial = 0x1021,
+	.slices = NO_OS_CRC_SLICE_BY_4,
+	.table = no_os_crc16_1021_table,
+};
+
+/* CRC-16, poly = 0x755B */
+static const uint32_t
+no_os_crc16_755b_table[NO_OS_CRC_SLICE_BY_4][NO_OS_CRC_ENGINE_TABLE_SIZE] = {
+	{
+		0x00000000, 0x755b0000, 0xeab60000, 0x9fed0000, 0xa0370000,
+		0xd56c0000, 0x4a810000, 0x3fda0000, 0x35350000, 0x406e0000,
+		0xdf830000, 0xaad80000, 0x95020000, 0xe0590000, 0x7fb40000,
+		0x0aef0000, 0x6a6a0000, 0x1f310000, 0x80dc0000, 0xf5870000,
+		0xca5d0000, 0xbf060000, 0x20eb0000, 0x55b00000, 0x5f5f0000,
+		0x2a040000, 0xb5e90000, 0xc0b20000, 0xff680000, 0x8a330000,
+		0x15de0000, 0x60850000, 0xd4d40000, 0xa18f0000, 0x3e620000,
+		0x4b390000, 0x74e30000, 0x01b80000, 0x9e550000, 0xeb0e0000,
+		0xe1e10000, 0x94ba0000, 0x0b570000, 0x7e0c0000, 0x41d60000,
+		0x348d0000, 0xab600000, 0xde3b0000, 0xbebe0000, 0xcbe50000,
+		0x54080000, 0x21530000, 0x1e890000, 0x6bd20000, 0xf43f0000,
+		0x81640000, 0x8b8b0000, 0xfed00000, 0x613d0000, 0x14660000,
+		0x2bbc0000, 0x5ee70000, 0xc10a0000, 0xb4510000, 0xdcf30000,
+		0xa9a80000, 0x36450000, 0x431e0000, 0x7cc40000, 0x099f0000,
+		0x96720000, 0xe3290000, 0xe9c60000, 0x9c9d0000, 0x03700000,
+		0x762b0000, 0x49f10000, 0x3caa0000, 0xa3470000, 0xd61c0000,
+		0xb6990000, 0xc3c20000, 0x5c2f0000, 0x29740000, 0x16ae0000,
+		0x63f50000, 0xfc180000, 0x89430000, 0x83ac0000, 0xf6f70000,
+		0x691a0000, 0x1c410000, 0x239b0000, 0x56c00000, 0xc92d0000,
+		0xbc760000, 0x08270000, 0x7d7c0000, 0xe2910000, 0x97ca0000,
+		0xa8100000, 0xdd4b0000, 0x42a60000, 0x37fd0000, 0x3d120000,
+		0x48490000, 0xd7a40000, 0xa2ff0000, 0x9d250000, 0xe87e0000,
+		0x77930000, 0x02c80000, 0x624d0000, 0x17160000, 0x88fb0000,
+		0xfda00000, 0xc27a0000, 0xb7210000, 0x28cc0000, 0x5d970000,
+		0x57780000, 0x22230000, 0xbdce0000, 0xc8950000, 0xf74f0000,
+		0x82140000, 0x1df90000, 0x68a20000, 0xccbd0000, 0xb9e60000,
+		0x260b0000, 0x53500000, 0x6c8a0000, 0x19d10000, 0x863c0000,
+		0xf3670000, 0xf9880000, 0x8cd30000, 0x133e0000, 0x66650000,
+		0x59bf0000, 0x2ce40000, 0xb3090000, 0xc6520000, 0xa6d70000,
+		0xd38c0000, 0x4c610000, 0x393a0000, 0x06e00000, 0x73bb0000,
+		0xec560000, 0x990d0000, 0x93e20000, 0xe6b90000, 0x79540000,
+		0x0c0f0000, 0x33d50000, 0x468e0000, 0xd9630000, 0xac380000,
+		0x18690000, 0x6d320000, 0xf2df0000, 0x87840000, 0xb85e0000,
+		0xcd050000, 0x52e80000, 0x27b30000, 0x2d5c0000, 0x58070000,
+		0xc7ea0000, 0xb2b10000, 0x8d6b0000, 0xf8300000, 0x67dd0000,
+		0x12860000, 0x72030000, 0x07580000, 0x98b50000, 0xedee0000,
+		0xd2340000, 0xa76f0000, 0x38820000, 0x4dd90000, 0x47360000,
+		0x326d0000, 0xad800000, 0xd8db0000, 0xe7010000, 0x925a0000,
+		0x0db70000, 0x78ec0000, 0x104e0000, 0x65150000, 0xfaf80000,
+		0x8fa30000, 0xb0790000, 0xc5220000, 0x5acf0000, 0x2f940000,
+		0x257b0000, 0x50200000, 0xcfcd0000, 0xba960000, 0x854c0000,
+		0xf0170000, 0x6ffa0000, 0x1aa10000, 0x7a240000, 0x0f7f0000,
+		0x90920000, 0xe5c90000, 0xda130000, 0xaf480000, 0x30a50000,
+		0x45fe0000, 0x4f110000, 0x3a4a0000, 0xa5a70000, 0xd0fc0000,
+		0xef260000, 0x9a7d0000, 0x05900000, 0x70cb0000, 0xc49a0000,
+		0xb1c10000, 0x2e2c0000, 0x5b770000, 0x64ad0000, 0x11f60000,
+		0x8e1b0000, 0xfb400000, 0xf1af0000, 0x84f40000, 0x1b190000,
+		0x6e420000, 0x51980000, 0x24c30000, 0xbb2e0000, 0xce750000,
+		0xaef00000, 0xdbab0000, 0x44460000, 0x311d0000, 0x0ec70000,
+		0x7b9c0000, 0xe4710000, 0x912a0000, 0x9bc50000, 0xee9e0000,
+		0x71730000, 0x04280000, 0x3bf20000, 0x4ea90000, 0xd1440000,
+		0xa41f0000,
+	},
+	{
+		0x00000000, 0xec210000, 0xad190000, 0x41380000, 0x2f690000,
+		0xc3480000, 0x82700000, 0x6e510000, 0x5ed20000, 0xb2f30000,
+		0xf3cb0000, 0x1fea0000, 0x71bb0000, 0x9d9a0000, 0xdca20000,
+		0x30830000, 0xbda40000, 0x51850000, 0x10bd0000, 0xfc9c0000,
+		0x92cd0000, 0x7eec0000, 0x3fd40000, 0xd3f50000, 0xe3760000,
+		0x0f570000, 0x4e6f0000, 0xa24e0000, 0xcc1f0000, 0x203e0000,
+		0x61060000, 0x8d270000, 0x0e130000, 0xe2320000, 0xa30a0000,
+		0x4f2b0000, 0x217a0000, 0xcd5b0000, 0x8c630000, 0x60420000,
+		0x50c10000, 0xbce00000, 0xfdd80000, 0x11f90000, 0x7fa80000,
+		0x93890000, 0xd2b10000, 0x3e900000, 0xb3b70000, 0x5f960000,
+		0x1eae0000, 0xf28f0000, 0x9cde0000, 0x70ff0000, 0x31c70000,
+		0xdde60000, 0xed650000, 0x01440000, 0x407c0000, 0xac5d0000,
+		0xc20c0000, 0x2e2d0000, 0x6f150000, 0x83340000, 0x1c260000,
+		0xf0070000, 0xb13f0000, 0x5d1e0000, 0x334f0000, 0xdf6e0000,
+		0x9e560000, 0x72770000, 0x42f40000, 0xaed50000, 0xefed0000,
+		0x03cc0000, 0x6d9d0000, 0x81bc0000, 0xc0840000, 0x2ca50000,
+		0xa1820000, 0x4da30000, 0x0c9b0000, 0xe0ba0000, 0x8eeb0000,
+		0x62ca0000, 0x23f20000, 0xcfd30000, 0xff500000, 0x13710000,
+		0x52490000, 0xbe680000, 0xd0390000, 0x3c180000, 0x7d200000,
+		0x91010000, 0x12350000, 0xfe140000, 0xbf2c0000, 0x530d0000,
+		0x3d5c0000, 0xd17d0000, 0x90450000, 0x7c640000, 0x4ce70000,
+		0xa0c60000, 0xe1fe0000, 0x0ddf0000, 0x638e0000, 0x8faf0000,
+		0xce970000, 0x22b60000, 0xaf910000, 0x43b00000, 0x02880000,
+		0xeea90000, 0x80f80000, 0x6cd90000, 0x2de10000, 0xc1c00000,
+		0xf1430000, 0x1d620000, 0x5c5a0000, 0xb07b0000, 0xde2a0000,
+		0x320b0000, 0x73330000, 0x9f120000, 0x384c0000, 0xd46d0000,
+		0x95550000, 0x79740000, 0x17250000, 0xfb040000, 0xba3c0000,
+		0x561d0000, 0x669e0000, 0x8abf0000, 0xcb870000, 0x27a60000,
+		0x49f70000, 0xa5d60000, 0xe4ee0000, 0x08cf0000, 0x85e80000,
+		0x69c90000, 0x28f10000, 0xc4d00000, 0xaa810000, 0x46a00000,
+		0x07980000, 0xebb90000, 0xdb3a0000, 0x371b0000, 0x76230000,
+		0x9a020000, 0xf4530000, 0x18720000, 0x594a0000, 0xb56b0000,
+		0x365f0000, 0xda7e0000, 0x9b460000, 0x77670000, 0x19360000,
+		0xf5170000, 0xb42f0000, 0x580e0000, 0x688d0000, 0x84ac0000,
+		0xc5940000, 0x29b50000, 0x47e40000, 0xabc50000, 0xeafd0000,
+		0x06dc0000, 0x8bfb0000, 0x67da0000, 0x26e20000, 0xcac30000,
+		0xa4920000, 0x48b30000, 0x098b0000, 0xe5aa0000, 0xd5290000,
+		0x39080000, 0x78300000, 0x94110000, 0xfa400000, 0x16610000,
+		0x57590000, 0xbb780000, 0x246a0000, 0xc84b0000, 0x89730000,
+		0x65520000, 0x0b030000, 0xe7220000, 0xa61a0000, 0x4a3b0000,
+		0x7ab80000, 0x96990000, 0xd7a10000, 0x3b800000, 0x55d10000,
+		0xb9f00000, 0xf8c80000, 0x14e90000, 0x99ce0000, 0x75ef0000,
+		0x34d70000, 0xd8f60000, 0xb6a70000, 0x5a860000, 0x1bbe0000,
+		0xf79f0000, 0xc71c0000, 0x2b3d0000, 0x6a050000, 0x86240000,
+		0xe8750000, 0x04540000, 0x456c0000, 0xa94d0000, 0x2a790000,
+		0xc6580000, 0x87600000, 0x6b410000, 0x05100000, 0xe9310000,
+		0xa8090000, 0x44280000, 0x74ab0000, 0x988a0000, 0xd9b20000,
+		0x35930000, 0x5bc20000, 0xb7e30000, 0xf6db0000, 0x1afa0000,
+		0x97dd0000, 0x7bfc0000, 0x3ac40000, 0xd6e50000, 0xb8b40000,
+		0x54950000, 0x15ad0000, 0xf98c0000, 0xc90f0000, 0x252e0000,
+		0x64160000, 0x88370000, 0xe6660000, 0x0a470000, 0x4b7f0000,
+		0xa75e0000,
+	},
+	{
+		0x00000000, 0x70980000, 0xe1300000, 0x91a80000, 0xb73b0000,
+		0xc7a30000, 0x560b0000, 0x26930000, 0x1b2d0000, 0x6bb50000,
+		0xfa1d0000, 0x8a850000, 0xac160000, 0xdc8e0000, 0x4d260000,
+		0x3dbe0000, 0x365a0000, 0x46c20000, 0xd76a0000, 0xa7f20000,
+		0x81610000, 0xf1f90000, 0x60510000, 0x10c90000, 0x2d770000,
+		0x5def0000, 0xcc470000, 0xbcdf0000, 0x9a4c0000, 0xead40000,
+		0x7b7c0000, 0x0be40000, 0x6cb40000, 0x1c2c0000, 0x8d840000,
+		0xfd1c0000, 0xdb8f0000, 0xab170000, 0x3abf0000, 0x4a270000,
+		0x77990000, 0x07010000, 0x96a90000, 0xe6310000, 0xc0a20000,
+		0xb03a0000, 0x21920000, 0x510a0000, 0x5aee0000, 0x2a760000,
+		0xbbde0000, 0xcb460000, 0xedd50000, 0x9d4d0000, 0x0ce50000,
+		0x7c7d0000, 0x41c30000, 0x315b0000, 0xa0f30000, 0xd06b0000,
+		0xf6f80000, 0x86600000, 0x17c80000, 0x67500000, 0xd9680000,
+		0xa9f00000, 0x38580000, 0x48c00000, 0x6e530000, 0x1ecb0000,
+		0x8f630000, 0xfffb0000, 0xc2450000, 0xb2dd0000, 0x23750000,
+		0x53ed0000, 0x757e0000, 0x05e60000, 0x944e0000, 0xe4d60000,
+		0xef320000, 0x9faa0000, 0x0e020000, 0x7e9a0000, 0x58090000,
+		0x28910000, 0xb9390000, 0xc9a10000, 0xf41f0000, 0x84870000,
+		0x152f0000, 0x65b70000, 0x43240000, 0x33bc0000, 0xa2140000,
+		0xd28c0000, 0xb5dc0000, 0xc5440000, 0x54ec0000, 0x24740000,
+		0x02e70000, 0x727f0000, 0xe3d70000, 0x934f0000, 0xaef10000,
+		0xde690000, 0x4fc10000, 0x3f590000, 0x19ca0000, 0x69520000,
+		0xf8fa0000, 0x88620000, 0x83860000, 0xf31e0000, 0x62b60000,
+		0x122e0000, 0x34bd0000, 0x44250000, 0xd58d0000, 0xa5150000,
+		0x98ab0000, 0xe8330000, 0x799b0000, 0x09030000, 0x2f900000,
+		0x5f080000, 0xcea00000, 0xbe380000, 0xc78b0000, 0xb7130000,
+		0x26bb0000, 0x56230000, 0x70b00000, 0x00280000, 0x91800000,
+		0xe1180000, 0xdca60000, 0xac3e0000, 0x3d960000, 0x4d0e0000,
+		0x6b9d0000, 0x1b050000, 0x8aad0000, 0xfa350000, 0xf1d10000,
+		0x81490000, 0x10e10000, 0x60790000, 0x46ea0000, 0x36720000,
+		0xa7da0000, 0xd7420000, 0xeafc0000, 0x9a640000, 0x0bcc0000,
+		0x7b540000, 0x5dc70000, 0x2d5f0000, 0xbcf70000, 0xcc6f0000,
+		0xab3f0000, 0xdba70000, 0x4a0f0000, 0x3a970000, 0x1c040000,
+		0x6c9c0000, 0xfd340000, 0x8dac0000, 0xb0120000, 0xc08a0000,
+		0x51220000, 0x21ba0000, 0x07290000, 0x77b10000, 0xe6190000,
+		0x96810000, 0x9d650000, 0xedfd0000, 0x7c550000, 0x0ccd0000,
+		0x2a5e0000, 0x5ac60000, 0xcb6e0000, 0xbbf60000, 0x86480000,
+		0xf6d00000, 0x67780000, 0x17e00000, 0x31730000, 0x41eb0000,
+		0xd0430000, 0xa0db0000, 0x1ee30000, 0x6e7b0000, 0xffd30000,
+		0x8f4b0000, 0xa9d80000, 0xd9400000, 0x48e80000, 0x38700000,
+		0x05ce0000, 0x75560000, 0xe4fe0000, 0x94660000, 0xb2f50000,
+		0xc26d0000, 0x53c50000, 0x235d0000, 0x28b90000, 0x58210000,
+		0xc9890000, 0xb9110000, 0x9f820000, 0xef1a0000, 0x7eb20000,
+		0x0e2a0000, 0x33940000, 0x430c0000, 0xd2a40000, 0xa23c0000,
+		0x84af0000, 0xf4370000, 0x659f0000, 0x15070000, 0x72570000,
+		0x02cf0000, 0x93670000, 0xe3ff0000, 0xc56c0000, 0xb5f40000,
+		0x245c0000, 0x54c40000, 0x697a0000, 0x19e20000, 0x884a0000,
+		0xf8d20000, 0xde410000, 0xaed90000, 0x3f710000, 0x4fe90000,
+		0x440d0000, 0x34950000, 0xa53d0000, 0xd5a50000, 0xf3360000,
+		0x83ae0000, 0x12060000, 0x629e0000, 0x5f200000, 0x2fb80000,
+		0xbe100000, 0xce880000, 0xe81b0000, 0x98830000, 0x092b0000,
+		0x79b30000,
+	},
+	{
+		0x00000000, 0xfa4d0000, 0x81c10000, 0x7b8c0000, 0x76d90000,
+		0x8c940000, 0xf7180000, 0x0d550000, 0xedb20000, 0x17ff0000,
+		0x6c730000, 0x963e0000, 0x9b6b0000, 0x61260000, 0x1aaa0000,
+		0xe0e70000, 0xae3f0000, 0x54720000, 0x2ffe0000, 0xd5b30000,
+		0xd8e60000, 0x22ab0000, 0x59270000, 0xa36a0000, 0x438d0000,
+		0xb9c00000, 0xc24c0000, 0x38010000, 0x35540000, 0xcf190000,
+		0xb4950000, 0x4ed80000, 0x29250000, 0xd3680000, 0xa8e40000,
+		0x52a90000, 0x5ffc0000, 0xa5b10000, 0xde3d0000, 0x24700000,
+		0xc4970000, 0x3eda0000, 0x45560000, 0xbf1b0000, 0xb24e0000,
+		0x48030000, 0x338f0000, 0xc9c20000, 0x871a0000, 0x7d570000,
+		0x06db0000, 0xfc960000, 0xf1c30000, 0x0b8e0000, 0x70020000,
+		0x8a4f0000, 0x6aa80000, 0x90e50000, 0xeb690000, 0x11240000,
+		0x1c710000, 0xe63c0000, 0x9db00000, 0x67fd0000, 0x524a0000,
+		0xa8070000, 0xd38b0000, 0x29c60000, 0x24930000, 0xdede0000,
+		0xa5520000, 0x5f1f0000, 0xbff80000, 0x45b50000, 0x3e390000,
+		0xc4740000, 0xc9210000, 0x336c0000, 0x48e00000, 0xb2ad0000,
+		0xfc750000, 0x06380000, 0x7db40000, 0x87f90000, 0x8aac0000,
+		0x70e10000, 0x0b6d0000, 0xf1200000, 0x11c70000, 0xeb8a0000,
+		0x90060000, 0x6a4b0000, 0x671e0000, 0x9d530000, 0xe6df0000,
+		0x1c920000, 0x7b6f0000, 0x81220000, 0xfaae0000, 0x00e30000,
+		0x0db60000, 0xf7fb0000, 0x8c770000, 0x763a0000, 0x96dd0000,
+		0x6c900000, 0x171c0000, 0xed510000, 0xe0040000, 0x1a490000,
+		0x61c50000, 0x9b880000, 0xd5500000, 0x2f1d0000, 0x54910000,
+		0xaedc0000, 0xa3890000, 0x59c40000, 0x22480000, 0xd8050000,
+		0x38e20000, 0xc2af0000, 0xb9230000, 0x436e0000, 0x4e3b0000,
+		0xb4760000, 0xcffa0000, 0x35b70000, 0xa4940000, 0x5ed90000,
+		0x25550000, 0xdf180000, 0xd24d0000, 0x28000000, 0x538c0000,
+		0xa9c10000, 0x49260000, 0xb36b0000, 0xc8e70000, 0x32aa0000,
+		0x3fff0000, 0xc5b20000, 0xbe3e0000, 0x44730000, 0x0aab0000,
+		0xf0e60000, 0x8b6a0000, 0x71270000, 0x7c720000, 0x863f0000,
+		0xfdb30000, 0x07fe0000, 0xe7190000, 0x1d540000, 0x66d80000,
+		0x9c950000, 0x91c00000, 0x6b8d0000, 0x10010000, 0xea4c0000,
+		0x8db10000, 0x77fc0000, 0x0c700000, 0xf63d0000, 0xfb680000,
+		0x01250000, 0x7aa90000, 0x80e40000, 0x60030000, 0x9a4e0000,
+		0xe1c20000, 0x1b8f0000, 0x16da0000, 0xec970000, 0x971b0000,
+		0x6d560000, 0x238e0000, 0xd9c30000, 0xa24f0000, 0x58020000,
+		0x55570000, 0xaf1a0000, 0xd4960000, 0x2edb0000, 0xce3c0000,
+		0x34710000, 0x4ffd0000, 0xb5b00000, 0xb8e50000, 0x42a80000,
+		0x39240000, 0xc3690000, 0xf6de0000, 0x0c930000, 0x771f0000,
+		0x8d520000, 0x80070000, 0x7a4a0000, 0x01c60000, 0xfb8b0000,
+		0x1b6c0000, 0xe1210000, 0x9aad0000, 0x60e00000, 0x6db50000,
+		0x97f80000, 0xec740000, 0x16390000, 0x58e10000, 0xa2ac0000,
+		0xd9200000, 0x236d0000, 0x2e380000, 0xd4750000, 0xaff90000,
+		0x55b40000, 0xb5530000, 0x4f1e0000, 0x34920000, 0xcedf0000,
+		0xc38a0000, 0x39c70000, 0x424b0000, 0xb8060000, 0xdffb0000,
+		0x25b60000, 0x5e3a0000, 0xa4770000, 0xa9220000, 0x536f0000,
+		0x28e30000, 0xd2ae0000, 0x32490000, 0xc8040000, 0xb3880000,
+		0x49c50000, 0x44900000, 0xbedd0000, 0xc5510000, 0x3f1c0000,
+		0x71c40000, 0x8b890000, 0xf0050000, 0x0a480000, 0x071d0000,
+		0xfd500000, 0x86dc0000, 0x7c910000, 0x9c760000, 0x663b0000,
+		0x1db70000, 0xe7fa0000, 0xeaaf0000, 0x10e20000, 0x6b6e0000,
+		0x91230000,
+	},
+};
+
+const struct no_os_crc_engine no_os_crc16_755b_engine = {
+	.width = 16,
+	.polynomial = 0x755b,
+	.slices = NO_OS_CRC_SLICE_BY_4,
+	.table = no_os_crc16_755b_table,
+};
+
+/* CRC-24, poly = 0x5D6DCB */
+static const uint32_t
+no_os_crc24_5d6dcb_table[NO_OS_CRC_SLICE_BY_4][NO_OS_CRC_ENGINE_TABLE_SIZE] = {
+	{
+		0x00000000, 0x5d6dcb00, 0xbadb9600, 0xe7b65d00, 0x28dae700,
+		0x75b72c00, 0x92017100, 0xcf6cba00, 0x51b5ce00, 0x0cd80500,
+		0xeb6e5800, 0xb6039300, 0x796f2900, 0x2402e200, 0xc3b4bf00,
+		0x9ed97400, 0xa36b9c00, 0xfe065700, 0x19b00a00, 0x44ddc100,
+		0x8bb17b00, 0xd6dcb000, 0x316aed00, 0x6c072600, 0xf2de5200,
+		0xafb39900, 0x4805c400, 0x15680f00, 0xda04b500, 0x87697e00,
+		0x60df2300, 0x3db2e800, 0x1bbaf300, 0x46d73800, 0xa1616500,
+		0xfc0cae00, 0x33601400, 0x6e0ddf00, 0x89bb8200, 0xd4d64900,
+		0x4a0f3d00, 0x1762f600, 0xf0d4ab00, 0xadb96000, 0x62d5da00,
+		0x3fb81100, 0xd80e4c00, 0x85638700, 0xb8d16f00, 0xe5bca400,
+		0x020af900, 0x5f673200, 0x900b8800, 0xcd664300, 0x2ad01e00,
+		0x77bdd500, 0xe964a100, 0xb4096a00, 0x53bf3700, 0x0ed2fc00,
+		0xc1be4600, 0x9cd38d00, 0x7b65d000, 0x26081b00, 0x3775e600,
+		0x6a182d00, 0x8dae7000, 0xd0c3bb00, 0x1faf0100, 0x42c2ca00,
+		0xa5749700, 0xf8195c00, 0x66c02800, 0x3bade300, 0xdc1bbe00,
+		0x81767500, 0x4e1acf00, 0x13770400, 0xf4c15900, 0xa9ac9200,
+		0x941e7a00, 0xc973b100, 0x2ec5ec00, 0x73a82700, 0xbcc49d00,
+		0xe1a95600, 0x061f0b00, 0x5b72c000, 0xc5abb400, 0x98c67f00,
+		0x7f702200, 0x221de900, 0xed715300, 0xb01c9800, 0x57aac500,
+		0x0ac70e00, 0x2ccf1500, 0x71a2de00, 0x96148300, 0xcb794800,
+		0x0415f200, 0x59783900, 0xbece6400, 0xe3a3af00, 0x7d7adb00,
+		0x20171000, 0xc7a14d00, 0x9acc8600, 0x55a03c00, 0x08cdf700,
+		0xef7baa00, 0xb2166100, 0x8fa48900, 0xd2c94200, 0x357f1f00,
+		0x6812d400, 0xa77e6e00, 0xfa13a500, 0x1da5f800, 0x40c83300,
+		0xde114700, 0x837c8c00, 0x64cad100, 0x39a71a00, 0xf6cba000,
+		0xaba66b00, 0x4c103600, 0x117dfd00, 0x6eebcc00, 0x33860700,
+		0xd4305a00, 0x895d9100, 0x46312b00, 0x1b5ce000, 0xfceabd00,
+		0xa1877600, 0x3f5e0200, 0x6233c900, 0x85859400, 0xd8e85f00,
+		0x1784e500, 0x4ae92e00, 0xad5f7300, 0xf032b800, 0xcd805000,
+		0x90ed9b00, 0x775bc600, 0x2a360d00, 0xe55ab700, 0xb8377c00,
+		0x5f812100, 0x02ecea00, 0x9c359e00, 0xc1585500, 0x26ee0800,
+		0x7b83c300, 0xb4ef7900, 0xe982b200, 0x0e34ef00, 0x53592400,
+		0x75513f00, 0x283cf400, 0xcf8aa900, 0x92e76200, 0x5d8bd800,
+		0x00e61300, 0xe7504e00, 0xba3d8500, 0x24e4f100, 0x79893a00,
+		0x9e3f6700, 0xc352ac00, 0x0c3e1600, 0x5153dd00, 0xb6e58000,
+		0xeb884b00, 0xd63aa300, 0x8b576800, 0x6ce13500, 0x318cfe00,
+		0xfee04400, 0xa38d8f00, 0x443bd200, 0x19561900, 0x878f6d00,
+		0xdae2a600, 0x3d54fb00, 0x60393000, 0xaf558a00, 0xf2384100,
+		0x158e1c00, 0x48e3d700, 0x599e2a00, 0x04f3e100, 0xe345bc00,
+		0xbe287700, 0x7144cd00, 0x2c290600, 0xcb9f5b00, 0x96f29000,
+		0x082be400, 0x55462f00, 0xb2f07200, 0xef9db900, 0x20f10300,
+		0x7d9cc800, 0x9a2a9500, 0xc7475e00, 0xfaf5b600, 0xa7987d00,
+		0x402e2000, 0x1d43eb00, 0xd22f5100, 0x8f429a00, 0x68f4c700,
+		0x35990c00, 0xab407800, 0xf62db300, 0x119bee00, 0x4cf62500,
+		0x839a9f00, 0xdef75400, 0x39410900, 0x642cc200, 0x4224d900,
+		0x1f491200, 0xf8ff4f00, 0xa5928400, 0x6afe3e00, 0x3793f500,
+		0xd025a800, 0x8d486300, 0x13911700, 0x4efcdc00, 0xa94a8100,
+		0xf4274a00, 0x3b4bf000, 0x66263b00, 0x81906600, 0xdcfdad00,
+		0xe14f4500, 0xbc228e00, 0x5b94d300, 0x06f91800, 0xc995a200,
+		0x94f86900, 0x734e3400, 0x2e23ff00, 0xb0fa8b00, 0xed974000,
+		0x0a211d00, 0x574cd600, 0x98206c00, 0xc54da700, 0x22fbfa00,
+		0x7f963100,
+	},
+	{
+		0x00000000, 0xddd79800, 0xe6c2fb00, 0x3b156300, 0x90e83d00,
+		0x4d3fa500, 0x762ac600, 0xabfd5e00, 0x7cbdb100, 0xa16a2900,
+		0x9a7f4a00, 0x47a8d200, 0xec558c00, 0x31821400, 0x0a977700,
+		0xd740ef00, 0xf97b6200, 0x24acfa00, 0x1fb99900, 0xc26e0100,
+		0x69935f00, 0xb444c700, 0x8f51a400, 0x52863c00, 0x85c6d300,
+		0x58114b00, 0x63042800, 0xbed3b000, 0x152eee00, 0xc8f97600,
+		0xf3ec1500, 0x2e3b8d00, 0xaf9b0f00, 0x724c9700, 0x4959f400,
+		0x948e6c00, 0x3f733200, 0xe2a4aa00, 0xd9b1c900, 0x04665100,
+		0xd326be00, 0x0ef12600, 0x35e44500, 0xe833dd00, 0x43ce8300,
+		0x9e191b00, 0xa50c7800, 0x78dbe000, 0x56e06d00, 0x8b37f500,
+		0xb0229600, 0x6df50e00, 0xc6085000, 0x1bdfc800, 0x20caab00,
+		0xfd1d3300, 0x2a5ddc00, 0xf78a4400, 0xcc9f2700, 0x1148bf00,
+		0xbab5e100, 0x67627900, 0x5c771a00, 0x81a08200, 0x025bd500,
+		0xdf8c4d00, 0xe4992e00, 0x394eb600, 0x92b3e800, 0x4f647000,
+		0x74711300, 0xa9a68b00, 0x7ee66400, 0xa331fc00, 0x98249f00,
+		0x45f30700, 0xee0e5900, 0x33d9c100, 0x08cca200, 0xd51b3a00,
+		0xfb20b700, 0x26f72f00, 0x1de24c00, 0xc035d400, 0x6bc88a00,
+		0xb61f1200, 0x8d0a7100, 0x50dde900, 0x879d0600, 0x5a4a9e00,
+		0x615ffd00, 0xbc886500, 0x17753b00, 0xcaa2a300, 0xf1b7c000,
+		0x2c605800, 0xadc0da00, 0x70174200, 0x4b022100, 0x96d5b900,
+		0x3d28e700, 0xe0ff7f00, 0xdbea1c00, 0x063d8400, 0xd17d6b00,
+		0x0caaf300, 0x37bf9000, 0xea680800, 0x41955600, 0x9c42ce00,
+		0xa757ad00, 0x7a803500, 0x54bbb800, 0x896c2000, 0xb2794300,
+		0x6faedb00, 0xc4538500, 0x19841d00, 0x22917e00, 0xff46e600,
+		0x28060900, 0xf5d19100, 0xcec4f200, 0x13136a00, 0xb8ee3400,
+		0x6539ac00, 0x5e2ccf00, 0x83fb5700, 0x04b7aa00, 0xd9603200,
+		0xe2755100, 0x3fa2c900, 0x945f9700, 0x49880f00, 0x729d6c00,
+		0xaf4af400, 0x780a1b00, 0xa5dd8300, 0x9ec8e000, 0x431f7800,
+		0xe8e22600, 0x3535be00, 0x0e20dd00, 0xd3f74500, 0xfdccc800,
+		0x201b5000, 0x1b0e3300, 0xc6d9ab00, 0x6d24f500, 0xb0f36d00,
+		0x8be60e00, 0x56319600, 0x81717900, 0x5ca6e100, 0x67b38200,
+		0xba641a00, 0x11994400, 0xcc4edc00, 0xf75bbf00, 0x2a8c2700,
+		0xab2ca500, 0x76fb3d00, 0x4dee5e00, 0x9039c600, 0x3bc49800,
+		0xe6130000, 0xdd066300, 0x00d1fb00, 0xd7911400, 0x0a468c00,
+		0x3153ef00, 0xec847700, 0x47792900, 0x9aaeb100, 0xa1bbd200,
+		0x7c6c4a00, 0x5257c700, 0x8f805f00, 0xb4953c00, 0x6942a400,
+		0xc2bffa00, 0x1f686200, 0x247d0100, 0xf9aa9900, 0x2eea7600,
+		0xf33dee00, 0xc8288d00, 0x15ff1500, 0xbe024b00, 0x63d5d300,
+		0x58c0b000, 0x85172800, 0x06ec7f00, 0xdb3be700, 0xe02e8400,
+		0x3df91c00, 0x96044200, 0x4bd3da00, 0x70c6b900, 0xad112100,
+		0x7a51ce00, 0xa7865600, 0x9c933500, 0x4144ad00, 0xeab9f300,
+		0x376e6b00, 0x0c7b0800, 0xd1ac9000, 0xff971d00, 0x22408500,
+		0x1955e600, 0xc4827e00, 0x6f7f2000, 0xb2a8b800, 0x89bddb00,
+		0x546a4300, 0x832aac00, 0x5efd3400, 0x65e85700, 0xb83fcf00,
+		0x13c29100, 0xce150900, 0xf5006a00, 0x28d7f200, 0xa9777000,
+		0x74a0e800, 0x4fb58b00, 0x92621300, 0x399f4d00, 0xe448d500,
+		0xdf5db600, 0x028a2e00, 0xd5cac100, 0x081d5900, 0x33083a00,
+		0xeedfa200, 0x4522fc00, 0x98f56400, 0xa3e00700, 0x7e379f00,
+		0x500c1200, 0x8ddb8a00, 0xb6cee900, 0x6b197100, 0xc0e42f00,
+		0x1d33b700, 0x2626d400, 0xfbf14c00, 0x2cb1a300, 0xf1663b00,
+		0xca735800, 0x17a4c000, 0xbc599e00, 0x618e0600, 0x5a9b6500,
+		0x874cfd00,
+	},
+	{
+		0x00000000, 0x096f5400, 0x12dea800, 0x1bb1fc00, 0x25bd5000,
+		0x2cd20400, 0x3763f800, 0x3e0cac00, 0x4b7aa000, 0x4215f400,
+		0x59a40800, 0x50cb5c00, 0x6ec7f000, 0x67a8a400, 0x7c195800,
+		0x75760c00, 0x96f54000, 0x9f9a1400, 0x842be800, 0x8d44bc00,
+		0xb3481000, 0xba274400, 0xa196b800, 0xa8f9ec00, 0xdd8fe000,
+		0xd4e0b400, 0xcf514800, 0xc63e1c00, 0xf832b000, 0xf15de400,
+		0xeaec1800, 0xe3834c00, 0x70874b00, 0x79e81f00, 0x6259e300,
+		0x6b36b700, 0x553a1b00, 0x5c554f00, 0x47e4b300, 0x4e8be700,
+		0x3bfdeb00, 0x3292bf00, 0x29234300, 0x204c1700, 0x1e40bb00,
+		0x172fef00, 0x0c9e1300, 0x05f14700, 0xe6720b00, 0xef1d5f00,
+		0xf4aca300, 0xfdc3f700, 0xc3cf5b00, 0xcaa00f00, 0xd111f300,
+		0xd87ea700, 0xad08ab00, 0xa467ff00, 0xbfd60300, 0xb6b95700,
+		0x88b5fb00, 0x81daaf00, 0x9a6b5300, 0x93040700, 0xe10e9600,
+		0xe861c200, 0xf3d03e00, 0xfabf6a00, 0xc4b3c600, 0xcddc9200,
+		0xd66d6e00, 0xdf023a00, 0xaa743600, 0xa31b6200, 0xb8aa9e00,
+		0xb1c5ca00, 0x8fc96600, 0x86a63200, 0x9d17ce00, 0x94789a00,
+		0x77fbd600, 0x7e948200, 0x65257e00, 0x6c4a2a00, 0x52468600,
+		0x5b29d200, 0x40982e00, 0x49f77a00, 0x3c817600, 0x35ee2200,
+		0x2e5fde00, 0x27308a00, 0x193c2600, 0x10537200, 0x0be28e00,
+		0x028dda00, 0x9189dd00, 0x98e68900, 0x83577500, 0x8a382100,
+		0xb4348d00, 0xbd5bd900, 0xa6ea2500, 0xaf857100, 0xdaf37d00,
+		0xd39c2900, 0xc82dd500, 0xc1428100, 0xff4e2d00, 0xf6217900,
+		0xed908500, 0xe4ffd100, 0x077c9d00, 0x0e13c900, 0x15a23500,
+		0x1ccd6100, 0x22c1cd00, 0x2bae9900, 0x301f6500, 0x39703100,
+		0x4c063d00, 0x45696900, 0x5ed89500, 0x57b7c100, 0x69bb6d00,
+		0x60d43900, 0x7b65c500, 0x720a9100, 0x9f70e700, 0x961fb300,
+		0x8dae4f00, 0x84c11b00, 0xbacdb700, 0xb3a2e300, 0xa8131f00,
+		0xa17c4b00, 0xd40a4700, 0xdd651300, 0xc6d4ef00, 0xcfbbbb00,
+		0xf1b71700, 0xf8d84300, 0xe369bf00, 0xea06eb00, 0x0985a700,
+		0x00eaf300, 0x1b5b0f00, 0x12345b00, 0x2c38f700, 0x2557a300,
+		0x3ee65f00, 0x37890b00, 0x42ff0700, 0x4b905300, 0x5021af00,
+		0x594efb00, 0x67425700, 0x6e2d0300, 0x759cff00, 0x7cf3ab00,
+		0xeff7ac00, 0xe698f800, 0xfd290400, 0xf4465000, 0xca4afc00,
+		0xc325a800, 0xd8945400, 0xd1fb0000, 0xa48d0c00, 0xade25800,
+		0xb653a400, 0xbf3cf000, 0x81305c00, 0x885f0800, 0x93eef400,
+		0x9a81a000, 0x7902ec00, 0x706db800, 0x6bdc4400, 0x62b31000,
+		0x5cbfbc00, 0x55d0e800, 0x4e611400, 0x470e4000, 0x32784c00,
+		0x3b171800, 0x20a6e400, 0x29c9b000, 0x17c51c00, 0x1eaa4800,
+		0x051bb400, 0x0c74e000, 0x7e7e7100, 0x77112500, 0x6ca0d900,
+		0x65cf8d00, 0x5bc32100, 0x52ac7500, 0x491d8900, 0x4072dd00,
+		0x3504d100, 0x3c6b8500, 0x27da7900, 0x2eb52d00, 0x10b98100,
+		0x19d6d500, 0x02672900, 0x0b087d00, 0xe88b3100, 0xe1e46500,
+		0xfa559900, 0xf33acd00, 0xcd366100, 0xc4593500, 0xdfe8c900,
+		0xd6879d00, 0xa3f19100, 0xaa9ec500, 0xb12f3900, 0xb8406d00,
+		0x864cc100, 0x8f239500, 0x94926900, 0x9dfd3d00, 0x0ef93a00,
+		0x07966e00, 0x1c279200, 0x1548c600, 0x2b446a00, 0x222b3e00,
+		0x399ac200, 0x30f59600, 0x45839a00, 0x4cecce00, 0x575d3200,
+		0x5e326600, 0x603eca00, 0x69519e00, 0x72e06200, 0x7b8f3600,
+		0x980c7a00, 0x91632e00, 0x8ad2d200, 0x83bd8600, 0xbdb12a00,
+		0xb4de7e00, 0xaf6f8200, 0xa600d600, 0xd376da00, 0xda198e00,
+		0xc1a87200, 0xc8c72600, 0xf6cb8a00, 0xffa4de00, 0xe4152200,
+		0xed7a7600,
+	},
+	{
+		0x00000000, 0x638c0500, 0xc7180a00, 0xa4940f00, 0xd35ddf00,
+		0xb0d1da00, 0x1445d500, 0x77c9d000, 0xfbd67500, 0x985a7000,
+		0x3cce7f00, 0x5f427a00, 0x288baa00, 0x4b07af00, 0xef93a000,
+		0x8c1fa500, 0xaac12100, 0xc94d2400, 0x6dd92b00, 0x0e552e00,
+		0x799cfe00, 0x1a10fb00, 0xbe84f400, 0xdd08f100, 0x51175400,
+		0x329b5100, 0x960f5e00, 0xf5835b00, 0x824a8b00, 0xe1c68e00,
+		0x45528100, 0x26de8400, 0x08ef8900, 0x6b638c00, 0xcff78300,
+		0xac7b8600, 0xdbb25600, 0xb83e5300, 0x1caa5c00, 0x7f265900,
+		0xf339fc00, 0x90b5f900, 0x3421f600, 0x57adf300, 0x20642300,
+		0x43e82600, 0xe77c2900, 0x84f02c00, 0xa22ea800, 0xc1a2ad00,
+		0x6536a200, 0x06baa700, 0x71737700, 0x12ff7200, 0xb66b7d00,
+		0xd5e77800, 0x59f8dd00, 0x3a74d800, 0x9ee0d700, 0xfd6cd200,
+		0x8aa50200, 0xe9290700, 0x4dbd0800, 0x2e310d00, 0x11df1200,
+		0x72531700, 0xd6c71800, 0xb54b1d00, 0xc282cd00, 0xa10ec800,
+		0x059ac700, 0x6616c200, 0xea096700, 0x89856200, 0x2d116d00,
+		0x4e9d6800, 0x3954b800, 0x5ad8bd00, 0xfe4cb200, 0x9dc0b700,
+		0xbb1e3300, 0xd8923600, 0x7c063900, 0x1f8a3c00, 0x6843ec00,
+		0x0bcfe900, 0xaf5be600, 0xccd7e300, 0x40c84600, 0x23444300,
+		0x87d04c00, 0xe45c4900, 0x93959900, 0xf0199c00, 0x548d9300,
+		0x37019600, 0x19309b00, 0x7abc9e00, 0xde289100, 0xbda49400,
+		0xca6d4400, 0xa9e14100, 0x0d754e00, 0x6ef94b00, 0xe2e6ee00,
+		0x816aeb00, 0x25fee400, 0x4672e100, 0x31bb3100, 0x52373400,
+		0xf6a33b00, 0x952f3e00, 0xb3f1ba00, 0xd07dbf00, 0x74e9b000,
+		0x1765b500, 0x60ac6500, 0x03206000, 0xa7b46f00, 0xc4386a00,
+		0x4827cf00, 0x2babca00, 0x8f3fc500, 0xecb3c000, 0x9b7a1000,
+		0xf8f61500, 0x5c621a00, 0x3fee1f00, 0x23be2400, 0x40322100,
+		0xe4a62e00, 0x872a2b00, 0xf0e3fb00, 0x936ffe00, 0x37fbf100,
+		0x5477f400, 0xd8685100, 0xbbe45400, 0x1f705b00, 0x7cfc5e00,
+		0x0b358e00, 0x68b98b00, 0xcc2d8400, 0xafa18100, 0x897f0500,
+		0xeaf30000, 0x4e670f00, 0x2deb0a00, 0x5a22da00, 0x39aedf00,
+		0x9d3ad000, 0xfeb6d500, 0x72a97000, 0x11257500, 0xb5b17a00,
+		0xd63d7f00, 0xa1f4af00, 0xc278aa00, 0x66eca500, 0x0560a000,
+		0x2b51ad00, 0x48dda800, 0xec49a700, 0x8fc5a200, 0xf80c7200,
+		0x9b807700, 0x3f147800, 0x5c987d00, 0xd087d800, 0xb30bdd00,
+		0x179fd200, 0x7413d700, 0x03da0700, 0x60560200, 0xc4c20d00,
+		0xa74e0800, 0x81908c00, 0xe21c8900, 0x46888600, 0x25048300,
+		0x52cd5300, 0x31415600, 0x95d55900, 0xf6595c00, 0x7a46f900,
+		0x19cafc00, 0xbd5ef300, 0xded2f600, 0xa91b2600, 0xca972300,
+		0x6e032c00, 0x0d8f2900, 0x32613600, 0x51ed3300, 0xf5793c00,
+		0x96f53900, 0xe13ce900, 0x82b0ec00, 0x2624e300, 0x45a8e600,
+		0xc9b74300, 0xaa3b4600, 0x0eaf4900, 0x6d234c00, 0x1aea9c00,
+		0x79669900, 0xddf29600, 0xbe7e9300, 0x98a01700, 0xfb2c1200,
+		0x5fb81d00, 0x3c341800, 0x4bfdc800, 0x2871cd00, 0x8ce5c200,
+		0xef69c700, 0x63766200, 0x00fa6700, 0xa46e6800, 0xc7e26d00,
+		0xb02bbd00, 0xd3a7b800, 0x7733b700, 0x14bfb200, 0x3a8ebf00,
+		0x5902ba00, 0xfd96b500, 0x9e1ab000, 0xe9d36000, 0x8a5f6500,
+		0x2ecb6a00, 0x4d476f00, 0xc158ca00, 0xa2d4cf00, 0x0640c000,
+		0x65ccc500, 0x12051500, 0x71891000, 0xd51d1f00, 0xb6911a00,
+		0x904f9e00, 0xf3c39b00, 0x57579400, 0x34db9100, 0x43124100,
+		0x209e4400, 0x840a4b00, 0xe7864e00, 0x6b99eb00, 0x0815ee00,
+		0xac81e100, 0xcf0de400, 0xb8c43400, 0xdb483100, 0x7fdc3e00,
+		0x1c503b00,
+	},
+};
+
+const struct no_os_crc_engine no_os_crc24_5d6dcb_engine = {
+	.width = 24,
+	.polynomial = 0x5d6dcb,
+	.slices = NO_OS_CRC_SLICE_BY_4,
+	.table = no_os_crc24_5d6dcb_table,
+};
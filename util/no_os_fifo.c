@@ -47,23 +47,23 @@
 
 /**
  * @brief Create new fifo element
+ *
+ * The data is stored right after the element, so a single allocation is done.
  * @param buff - Data to be saved in fifo.
  * @param len - Length of the data.
  * @return fifo element in case of success, NULL otherwise
  */
-static struct no_os_fifo_element * fifo_new_element(char *buff, uint32_t len)
+static struct no_os_fifo_element * fifo_new_element(const char *buff,
+		uint32_t len)
 {
 	struct no_os_fifo_element *q = no_os_calloc(1,
-				       sizeof(struct no_os_fifo_element));
+				       sizeof(struct no_os_fifo_element) + len);
 	if (!q)
 		return NULL;
 
 	q->len = len;
-	q->data = no_os_calloc(1, len);
-	if (!(q->data)) {
-		no_os_free(q);
-		return NULL;
-	}
+	q->data = (char *)(q + 1);
+	q->owned = true;
 	memcpy(q->data, buff, len);
 
 	return q;
@@ -126,9 +126,165 @@ struct no_os_fifo_element * no_os_fifo_remove(struct no_os_fifo_element *p_fifo)
 
 	if (p_fifo != NULL) {
 		p_fifo = p_fifo->next;
-		no_os_free(p->data);
 		no_os_free(p);
 	}
 
 	return p_fifo;
 }
+
+/**
+ * @brief Create a fifo descriptor.
+ * @param fifo - Pointer to the fifo to be created.
+ * @param max_len - Largest data length that fits in a pool element. Longer
+ *		    data is still accepted and allocated from the heap.
+ * @param nb_elements - Number of elements to preallocate for no_os_fifo_push().
+ *			Can be 0 if only no_os_fifo_push_elem() is used.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_fifo_desc_init(struct no_os_fifo_desc **fifo, uint32_t max_len,
+			 uint32_t nb_elements)
+{
+	struct no_os_fifo_desc *f;
+	int ret;
+
+	if (!fifo)
+		return -EINVAL;
+
+	f = no_os_calloc(1, sizeof(*f));
+	if (!f)
+		return -ENOMEM;
+
+	f->max_len = max_len;
+	ret = no_os_pool_init(&f->pool, sizeof(struct no_os_fifo_element) +
+			      max_len, nb_elements);
+	if (ret) {
+		no_os_free(f);
+		return ret;
+	}
+
+	*fifo = f;
+
+	return 0;
+}
+
+/**
+ * @brief Release all the elements left and free the fifo.
+ * @param fifo - The fifo.
+ */
+void no_os_fifo_desc_remove(struct no_os_fifo_desc *fifo)
+{
+	if (!fifo)
+		return;
+
+	while (fifo->head)
+		no_os_fifo_release(fifo, no_os_fifo_pop(fifo));
+
+	no_os_pool_remove(fifo->pool);
+	no_os_free(fifo);
+}
+
+/**
+ * @brief Link an element at the tail.
+ * @param fifo - The fifo.
+ * @param elem - Element to be linked.
+ */
+static void no_os_fifo_link(struct no_os_fifo_desc *fifo,
+			    struct no_os_fifo_element *elem)
+{
+	elem->next = NULL;
+	if (fifo->tail)
+		fifo->tail->next = elem;
+	else
+		fifo->head = elem;
+	fifo->tail = elem;
+	fifo->nb_elements++;
+}
+
+/**
+ * @brief Copy data in a new element at the tail.
+ * @param fifo - The fifo.
+ * @param buff - Data to be saved in fifo.
+ * @param len - Length of the data.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_fifo_push(struct no_os_fifo_desc *fifo, const char *buff,
+		    uint32_t len)
+{
+	struct no_os_fifo_element *q;
+
+	if (!fifo || !buff || !len)
+		return -EINVAL;
+
+	if (len <= fifo->max_len) {
+		q = no_os_pool_alloc(fifo->pool);
+		if (!q)
+			return -ENOMEM;
+		q->len = len;
+		q->data = (char *)(q + 1);
+		q->owned = true;
+		memcpy(q->data, buff, len);
+	} else {
+		q = fifo_new_element(buff, len);
+		if (!q)
+			return -ENOMEM;
+	}
+
+	no_os_fifo_link(fifo, q);
+
+	return 0;
+}
+
+/**
+ * @brief Add a caller owned element at the tail.
+ *
+ * Neither the element nor its data are copied. They must stay valid until
+ * the element is popped.
+ * @param fifo - The fifo.
+ * @param elem - Element with data and len already set.
+ */
+void no_os_fifo_push_elem(struct no_os_fifo_desc *fifo,
+			  struct no_os_fifo_element *elem)
+{
+	if (!fifo || !elem)
+		return;
+
+	elem->owned = false;
+	no_os_fifo_link(fifo, elem);
+}
+
+/**
+ * @brief Detach the head element.
+ * @param fifo - The fifo.
+ * @return The element or NULL if the fifo is empty. Elements added with
+ *	   no_os_fifo_push() must be given back with no_os_fifo_release().
+ */
+struct no_os_fifo_element *no_os_fifo_pop(struct no_os_fifo_desc *fifo)
+{
+	struct no_os_fifo_element *p;
+
+	if (!fifo || !fifo->head)
+		return NULL;
+
+	p = fifo->head;
+	fifo->head = p->next;
+	if (!fifo->head)
+		fifo->tail = NULL;
+	fifo->nb_elements--;
+	p->next = NULL;
+
+	return p;
+}
+
+/**
+ * @brief Free a popped element if it was allocated by the fifo.
+ * @param fifo - The fifo.
+ * @param elem - Element returned by no_os_fifo_pop().
+ */
+void no_os_fifo_release(struct no_os_fifo_desc *fifo,
+			struct no_os_fifo_element *elem)
+{
+	if (!fifo || !elem || !elem->owned)
+		return;
+
+	no_os_pool_free(fifo->pool, elem);
+}
@@ -38,6 +38,7 @@
 #include "no_os_list.h"
 #include "no_os_error.h"
 #include "no_os_alloc.h"
+#include "no_os_pool.h"
 #include <stdlib.h>
 
 /******************************************************************************/
@@ -85,6 +86,8 @@ struct _list_desc {
 	uint32_t		nb_iterators;
 	/** Internal list iterator */
 	struct no_os_iterator		l_it;
+	/** Pool the elements are allocated from. NULL to use the heap */
+	struct no_os_pool	*pool;
 };
 
 /** @brief Default function used to compare element in the list ( \ref f_cmp) */
@@ -95,18 +98,23 @@ static int32_t no_os_default_comparator(void *data1, void *data2)
 
 /**
  * @brief Creates a new list elements an configure its value
+ * @param list - List the element is created for
  * @param data - To set list_elem.data
  * @param prev - To set list_elem.prev
  * @param next - To set list_elem.next
  * @return Address of the new element or NULL if allocation fails.
  */
-static inline struct no_os_list_elem *create_element(void *data,
+static inline struct no_os_list_elem *create_element(struct _list_desc *list,
+		void *data,
 		struct no_os_list_elem *prev,
 		struct no_os_list_elem *next)
 {
 	struct no_os_list_elem *elem;
 
-	elem = (struct no_os_list_elem *)no_os_calloc(1, sizeof(*elem));
+	if (list->pool)
+		elem = no_os_pool_alloc(list->pool);
+	else
+		elem = (struct no_os_list_elem *)no_os_calloc(1, sizeof(*elem));
 	if (!elem)
 		return NULL;
 	elem->data = data;
@@ -116,6 +124,20 @@ static inline struct no_os_list_elem *create_element(void *data,
 	return (elem);
 }
 
+/**
+ * @brief Free an element created with create_element
+ * @param list - List the element was created for
+ * @param elem - Element to be freed
+ */
+static inline void destroy_element(struct _list_desc *list,
+				   struct no_os_list_elem *elem)
+{
+	if (list->pool)
+		no_os_pool_free(list->pool, elem);
+	else
+		no_os_free(elem);
+}
+
 /**
  * @brief Updates the necesary link on the list elements to add or remove one
  * @param prev - Low element
@@ -205,10 +227,33 @@ static inline void no_os_set_adapter(struct no_os_list_desc *ad,
 int32_t no_os_list_init(struct no_os_list_desc **list_desc,
 			enum no_os_adapter_type type,
 			f_cmp comparator)
+{
+	return no_os_list_init_pool(list_desc, type, comparator, 0);
+}
+
+/**
+ * @brief Create a new empty list whose elements come from a private pool
+ *
+ * The first nb_elements elements are preallocated together with the list, so
+ * adding and removing them doesn't go through the heap. Elements exceeding
+ * nb_elements are allocated from the heap.
+ * @param list_desc - Where to store the reference of the new created list
+ * @param type - Type of adapter to use.
+ * @param comparator - Used to compare item when using an ordered list or when
+ * using the \em find functions.
+ * @param nb_elements - Number of elements to preallocate. 0 to use the heap
+ * for every element.
+ * @return
+ *  - 0 : On success
+ *  - -1 : Otherwise
+ */
+int32_t no_os_list_init_pool(struct no_os_list_desc **list_desc,
+			     enum no_os_adapter_type type,
+			     f_cmp comparator, uint32_t nb_elements)
 {
 	struct no_os_list_desc	*l_desc;
 	struct _list_desc	*list;
-
+	int			ret;
 
 	if (!list_desc)
 		return -1;
@@ -221,6 +266,17 @@ int32_t no_os_list_init(struct no_os_list_desc **list_desc,
 		return -1;
 	}
 
+	if (nb_elements) {
+		ret = no_os_pool_init(&list->pool,
+				      sizeof(struct no_os_list_elem),
+				      nb_elements);
+		if (ret) {
+			no_os_free(list);
+			no_os_free(l_desc);
+			return -1;
+		}
+	}
+
 	*list_desc = l_desc;
 	l_desc->priv_desc = list;
 	list->comparator = comparator ? comparator : no_os_default_comparator;
@@ -257,6 +313,7 @@ int32_t no_os_list_remove(struct no_os_list_desc *list_desc)
 	/* Remove all the elements */
 	while (0 == no_os_list_get_first(list_desc, &data))
 		;
+	no_os_pool_remove(list->pool);
 	no_os_free(list_desc->priv_desc);
 	no_os_free(list_desc);
 
@@ -300,7 +357,7 @@ int32_t no_os_list_add_first(struct no_os_list_desc *list_desc, void *data)
 
 	prev = NULL;
 	next = list->first;
-	elem = create_element(data, prev, next);
+	elem = create_element(list, data, prev, next);
 	if (!elem)
 		return -1;
 
@@ -327,7 +384,7 @@ int32_t no_os_list_add_last(struct no_os_list_desc *list_desc, void *data)
 
 	prev = list->last;
 	next = NULL;
-	elem = create_element(data, prev, next);
+	elem = create_element(list, data, prev, next);
 	if (!elem)
 		return -1;
 
@@ -560,7 +617,7 @@ int32_t no_os_list_get_first(struct no_os_list_desc *list_desc, void **data)
 	list->nb_elements--;
 
 	*data = elem->data;
-	no_os_free(elem);
+	destroy_element(list, elem);
 
 	return 0;
 }
@@ -590,7 +647,7 @@ int32_t no_os_list_get_last(struct no_os_list_desc *list_desc, void **data)
 	list->nb_elements--;
 
 	*data = elem->data;
-	no_os_free(elem);
+	destroy_element(list, elem);
 
 	return 0;
 }
@@ -820,7 +877,7 @@ int32_t no_os_iterator_get(struct no_os_iterator *iter, void **data)
 		next = it->elem->prev;
 	else
 		next = it->elem->next;
-	no_os_free(it->elem);
+	destroy_element(it->list, it->elem);
 	it->elem = next;
 
 	return 0;
@@ -865,9 +922,9 @@ int32_t no_os_iterator_insert(struct no_os_iterator *iter, void *data,
 		return no_os_list_add_first(&list_desc, data);
 
 	if (after)
-		elem = create_element(data, it->elem, it->elem->next);
+		elem = create_element(it->list, data, it->elem, it->elem->next);
 	else
-		elem = create_element(data, it->elem->prev, it->elem);
+		elem = create_element(it->list, data, it->elem->prev, it->elem);
 	if (!elem)
 		return -1;
 
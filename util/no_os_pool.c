@@ -0,0 +1,158 @@
+/***************************************************************************//**
+ *   @file   no_os_pool.c
+ *   @brief  Implementation of fixed size block pool
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+
+#include <string.h>
+#include <errno.h>
+#include "no_os_pool.h"
+#include "no_os_alloc.h"
+
+/******************************************************************************/
+/************************ Functions Definitions *******************************/
+/******************************************************************************/
+
+/**
+ * @brief Allocate a pool of equally sized blocks.
+ * @param pool - Pointer to the pool to be created.
+ * @param block_size - Size of a block in bytes.
+ * @param nb_blocks - Number of blocks to preallocate. Can be 0, in which case
+ *		      all the allocations are served from the heap.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int no_os_pool_init(struct no_os_pool **pool, uint32_t block_size,
+		    uint32_t nb_blocks)
+{
+	struct no_os_pool *p;
+	uint32_t i;
+
+	if (!pool || !block_size)
+		return -EINVAL;
+
+	block_size = (block_size + sizeof(void *) - 1) &
+		     ~(uint32_t)(sizeof(void *) - 1);
+
+	p = no_os_calloc(1, sizeof(*p) + (size_t)block_size * nb_blocks);
+	if (!p)
+		return -ENOMEM;
+
+	p->mem = (uint8_t *)(p + 1);
+	p->block_size = block_size;
+	p->nb_blocks = nb_blocks;
+
+	/* Chain the blocks in address order */
+	for (i = nb_blocks; i > 0; i--) {
+		*(void **)(p->mem + (i - 1) * block_size) = p->free_list;
+		p->free_list = p->mem + (i - 1) * block_size;
+	}
+
+	*pool = p;
+
+	return 0;
+}
+
+/**
+ * @brief Free the pool.
+ * @param pool - The pool. Blocks still in use are not valid anymore.
+ */
+void no_os_pool_remove(struct no_os_pool *pool)
+{
+	no_os_free(pool);
+}
+
+/**
+ * @brief Check if a block belongs to the pool storage.
+ * @param pool - The pool.
+ * @param block - Block to be checked.
+ * @return true if the block was carved from the pool, false otherwise.
+ */
+bool no_os_pool_owns(struct no_os_pool *pool, void *block)
+{
+	uint8_t *b = block;
+
+	return pool && b >= pool->mem &&
+	       b < pool->mem + (size_t)pool->block_size * pool->nb_blocks;
+}
+
+/**
+ * @brief Get a zeroed block.
+ * @param pool - The pool.
+ * @return The block, or NULL if the pool is empty and the heap allocation
+ *	   failed too.
+ */
+void *no_os_pool_alloc(struct no_os_pool *pool)
+{
+	void *block;
+
+	if (!pool)
+		return NULL;
+
+	block = pool->free_list;
+	if (!block) {
+		block = no_os_calloc(1, pool->block_size);
+		if (block)
+			pool->nb_heap_alloc++;
+
+		return block;
+	}
+
+	pool->free_list = *(void **)block;
+	memset(block, 0, pool->block_size);
+	pool->nb_alloc++;
+	pool->nb_used++;
+	if (pool->nb_used > pool->peak_used)
+		pool->peak_used = pool->nb_used;
+
+	return block;
+}
+
+/**
+ * @brief Give back a block.
+ * @param pool - The pool the block was allocated from.
+ * @param block - Block obtained with no_os_pool_alloc().
+ */
+void no_os_pool_free(struct no_os_pool *pool, void *block)
+{
+	if (!block)
+		return;
+
+	if (!no_os_pool_owns(pool, block)) {
+		no_os_free(block);
+		return;
+	}
+
+	*(void **)block = pool->free_list;
+	pool->free_list = block;
+	pool->nb_used--;
+}
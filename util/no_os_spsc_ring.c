@@ -0,0 +1,286 @@
+/***************************************************************************//**
+ *   @file   no_os_spsc_ring.c
+ *   @brief  Lock-free single producer, single consumer byte ring.
+********************************************************************************
+ * Copyright 2026(c) Analog Devices, Inc.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES, INC. “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL ANALOG DEVICES, INC. BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+
+#include <errno.h>
+#include <string.h>
+#include "no_os_spsc_ring.h"
+#include "no_os_alloc.h"
+#include "no_os_util.h"
+
+/******************************************************************************/
+/************************ Functions Definitions *******************************/
+/******************************************************************************/
+
+/**
+ * @brief Allocate and initialize a ring.
+ * @param ring - Where to store the ring descriptor.
+ * @param size - Size of the ring in bytes. Must be a power of two.
+ * @return 0 if successful, negative error code otherwise.
+ */
+int no_os_spsc_ring_init(struct no_os_spsc_ring **ring, uint32_t size)
+{
+	struct no_os_spsc_ring *r;
+
+	if (!ring || !size || (size & (size - 1)))
+		return -EINVAL;
+
+	r = no_os_calloc(1, sizeof(*r));
+	if (!r)
+		return -ENOMEM;
+
+	r->buff = no_os_calloc(1, size);
+	if (!r->buff) {
+		no_os_free(r);
+		return -ENOMEM;
+	}
+
+	r->size = size;
+	atomic_init(&r->head, 0);
+	atomic_init(&r->tail, 0);
+
+	*ring = r;
+
+	return 0;
+}
+
+/**
+ * @brief Free the resources allocated by no_os_spsc_ring_init().
+ * @param ring - Ring descriptor.
+ */
+void no_os_spsc_ring_remove(struct no_os_spsc_ring *ring)
+{
+	if (!ring)
+		return;
+
+	no_os_free(ring->buff);
+	no_os_free(ring);
+}
+
+/**
+ * @brief Get the number of bytes available for reading.
+ * @param ring - Ring descriptor.
+ * @return Number of bytes.
+ */
+uint32_t no_os_spsc_ring_count(struct no_os_spsc_ring *ring)
+{
+	return atomic_load_explicit(&ring->head, memory_order_acquire) -
+	       atomic_load_explicit(&ring->tail, memory_order_acquire);
+}
+
+/**
+ * @brief Get the number of bytes available for writing.
+ * @param ring - Ring descriptor.
+ * @return Number of bytes.
+ */
+uint32_t no_os_spsc_ring_space(struct no_os_spsc_ring *ring)
+{
+	return ring->size - no_os_spsc_ring_count(ring);
+}
+
+/**
+ * @brief Get the largest contiguous free span. Producer side.
+ * @param ring - Ring descriptor.
+ * @param span - Where to store the address of the span.
+ * @return Length of the span in bytes. 0 if the ring is full.
+ */
+uint32_t no_os_spsc_ring_peek_write(struct no_os_spsc_ring *ring,
+				    uint8_t **span)
+{
+	uint32_t head, tail, idx;
+
+	head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+	/* Pairs with the release in commit_read: slots were fully read */
+	tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+	idx = head & (ring->size - 1);
+
+	*span = ring->buff + idx;
+
+	return no_os_min(ring->size - (head - tail), ring->size - idx);
+}
+
+/**
+ * @brief Publish bytes written in the span returned by peek_write.
+ * @param ring - Ring descriptor.
+ * @param len - Number of bytes written. Must not exceed the span length.
+ */
+void no_os_spsc_ring_commit_write(struct no_os_spsc_ring *ring, uint32_t len)
+{
+	uint32_t head;
+
+	head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+	atomic_store_explicit(&ring->head, head + len, memory_order_release);
+}
+
+/**
+ * @brief Get the largest contiguous span of available data. Consumer side.
+ * @param ring - Ring descriptor.
+ * @param span - Where to store the address of the span.
+ * @return Length of the span in bytes. 0 if the ring is empty.
+ */
+uint32_t no_os_spsc_ring_peek_read(struct no_os_spsc_ring *ring,
+				   uint8_t **span)
+{
+	uint32_t head, tail, idx;
+
+	tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+	/* Pairs with the release in commit_write: data is visible */
+	head = atomic_load_explicit(&ring->head, memory_order_acquire);
+	idx = tail & (ring->size - 1);
+
+	*span = ring->buff + idx;
+
+	return no_os_min(head - tail, ring->size - idx);
+}
+
+/**
+ * @brief Release bytes read from the span returned by peek_read.
+ * @param ring - Ring descriptor.
+ * @param len - Number of bytes read. Must not exceed the span length.
+ */
+void no_os_spsc_ring_commit_read(struct no_os_spsc_ring *ring, uint32_t len)
+{
+	uint32_t tail;
+
+	tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+	atomic_store_explicit(&ring->tail, tail + len, memory_order_release);
+}
+
+/**
+ * @brief Write one byte. Producer side.
+ * @param ring - Ring descriptor.
+ * @param c - Byte to write.
+ * @return 0 if successful, -ENOSPC if the ring is full.
+ */
+int no_os_spsc_ring_put(struct no_os_spsc_ring *ring, uint8_t c)
+{
+	uint8_t *span;
+
+	if (!no_os_spsc_ring_peek_write(ring, &span))
+		return -ENOSPC;
+
+	*span = c;
+	no_os_spsc_ring_commit_write(ring, 1);
+
+	return 0;
+}
+
+/**
+ * @brief Read one byte. Consumer side.
+ * @param ring - Ring descriptor.
+ * @param c - Where to store the byte.
+ * @return 0 if successful, -EAGAIN if the ring is empty.
+ */
+int no_os_spsc_ring_get(struct no_os_spsc_ring *ring, uint8_t *c)
+{
+	uint8_t *span;
+
+	if (!no_os_spsc_ring_peek_read(ring, &span))
+		return -EAGAIN;
+
+	*c = *span;
+	no_os_spsc_ring_commit_read(ring, 1);
+
+	return 0;
+}
+
+/**
+ * @brief Write a block of bytes. Producer side.
+ * @param ring - Ring descriptor.
+ * @param data - Bytes to write.
+ * @param len - Number of bytes to write.
+ * @return Number of bytes written, less than len if the ring got full.
+ */
+uint32_t no_os_spsc_ring_write_n(struct no_os_spsc_ring *ring,
+				 const void *data, uint32_t len)
+{
+	uint32_t done = 0;
+	uint32_t span_len;
+	uint8_t *span;
+
+	/* At most two spans: up to the end of the storage and from its start */
+	while (done < len) {
+		span_len = no_os_spsc_ring_peek_write(ring, &span);
+		if (!span_len)
+			break;
+
+		span_len = no_os_min(span_len, len - done);
+		memcpy(span, (const uint8_t *)data + done, span_len);
+		no_os_spsc_ring_commit_write(ring, span_len);
+		done += span_len;
+	}
+
+	return done;
+}
+
+/**
+ * @brief Read a block of bytes. Consumer side.
+ * @param ring - Ring descriptor.
+ * @param data - Where to store the bytes.
+ * @param len - Maximum number of bytes to read.
+ * @return Number of bytes read, less than len if the ring got empty.
+ */
+uint32_t no_os_spsc_ring_read_n(struct no_os_spsc_ring *ring, void *data,
+				uint32_t len)
+{
+	uint32_t done = 0;
+	uint32_t span_len;
+	uint8_t *span;
+
+	while (done < len) {
+		span_len = no_os_spsc_ring_peek_read(ring, &span);
+		if (!span_len)
+			break;
+
+		span_len = no_os_min(span_len, len - done);
+		memcpy((uint8_t *)data + done, span, span_len);
+		no_os_spsc_ring_commit_read(ring, span_len);
+		done += span_len;
+	}
+
+	return done;
+}
+
+/**
+ * @brief Drop all the available data. Consumer side.
+ * @param ring - Ring descriptor.
+ */
+void no_os_spsc_ring_flush(struct no_os_spsc_ring *ring)
+{
+	uint32_t head;
+
+	head = atomic_load_explicit(&ring->head, memory_order_acquire);
+	atomic_store_explicit(&ring->tail, head, memory_order_release);
+}